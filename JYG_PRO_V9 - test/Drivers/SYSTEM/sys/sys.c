@@ -81,15 +81,29 @@ void sys_msr_msp(uint32_t addr)
 }
 
 /**
- * @brief       使能STM32H7的L1-Cache, 同时开启D cache的强制透写
+ * @brief       使能STM32H7的L1-Cache
  * @param       无
  * @retval      无
+ * @note        D-Cache工作在写回模式, 需先调用mpu_memory_protection()把DMA缓冲池设为不可缓存,
+ *              缓冲池之外的DMA收发缓冲区由dma_buf_clean()/dma_buf_invalidate()维护一致性
  */
 void sys_cache_enable(void)
 {
     SCB_EnableICache();     /* 使能I-Cache,函数在core_cm7.h里面定义 */
     SCB_EnableDCache();     /* 使能D-Cache,函数在core_cm7.h里面定义 */
-    SCB->CACR |= 1 << 2;    /* 强制D-Cache透写,如不开启透写,实际使用中可能遇到各种问题 */
+}
+
+/**
+ * @brief       使能DWT周期计数器(CYCCNT)
+ * @param       无
+ * @retval      无
+ * @note        可重复调用; 不清零CYCCNT, 各模块只使用差值, 避免打断其它模块正在进行的计时
+ */
+void sys_dwt_enable(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;     /* Cortex-M7需先解锁DWT */
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 }
 
 /**
@@ -39,6 +39,24 @@
  */
 #define SYS_SUPPORT_OS         0
 
+/**
+ * SYS_USE_TCM用于定义热点代码/数据是否放入TCM(见User/SCRIPT/jyg_pro.sct)
+ * 0,使用默认位置(代码在FLASH, 用于对比基准)
+ * 1,ITCM_CODE函数在ITCM中0等待执行, 由__main(分散加载)在进入main前从FLASH拷贝;
+ *   DTCM_DATA变量集中放在DTCM起始处. TCM仅CPU可访问, DMA缓冲区不得使用
+ */
+#ifndef SYS_USE_TCM
+#define SYS_USE_TCM            1
+#endif
+
+#if SYS_USE_TCM
+#define ITCM_CODE              __attribute__((section(".itcm_code")))
+#define DTCM_DATA              __attribute__((section(".dtcm_data")))
+#else
+#define ITCM_CODE
+#define DTCM_DATA
+#endif
+
 
 #define      ON      1
 #define      OFF     0
@@ -47,6 +65,7 @@
 void sys_nvic_set_vector_table(uint32_t baseaddr, uint32_t offset);                       /* 设置中断偏移量 */
 void sys_cache_enable(void);                                                              /* 使能STM32H7的L1-Cahce */
 uint8_t sys_stm32_clock_init(uint32_t plln, uint32_t pllm, uint32_t pllp, uint32_t pllq); /* 配置系统时钟 */
+void sys_dwt_enable(void);                                                                /* 使能DWT周期计数器 */
 
 /* 以下为汇编函数 */
 void sys_wfi_set(void);             /* 执行WFI指令 */
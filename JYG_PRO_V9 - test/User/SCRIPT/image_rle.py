@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+16灰度图片RLE压缩工具：读取 image_logo_raw.c，生成 User/bsp/image_logo.c
+
+压缩格式（按像素顺序逐行连续编码，行与行之间的游程可以连续）：
+    每个字节高4位为灰度值，低4位n为游程：
+    n < 15 ：游程长度 n + 1（1~15）
+    n == 15：后面再跟1个字节m，游程长度 16 + m（16~271）
+
+RGB565图片（沙漏）保持原样输出。
+
+全部图片数据标记为 ASSET_SECTION，并生成资源索引 g_asset_index（ASSET_INDEX_SECTION），
+记录每个资源的地址、大小、尺寸、格式和全部数据的CRC32，见 asset.h。两个段默认在内部FLASH，
+version.h中ENABLE_QSPI_ASSETS为1时分别为 .qspi_assets / .qspi_asset_index（QSPI FLASH）。
+
+用法：python image_rle.py [image_logo_raw.c] [image_logo.c]
+"""
+import os
+import re
+import sys
+import zlib
+
+RUN_SHORT_MAX = 15
+RUN_LONG_MAX = 16 + 255
+
+# 16灰度图片名称 -> (宽, 高)
+GRAY_IMAGES = [
+    ("gImage_mode1_126x174", 126, 174),
+    ("gImage_mode2_126x174", 126, 174),
+    ("gImage_mode3_126x174", 126, 174),
+    ("gImage_mode4_126x174", 126, 174),
+    ("gImage_mode5_126x174", 126, 174),
+    ("gImage_dang1", 126, 120),
+    ("gImage_dang2", 126, 120),
+    ("gImage_dang3", 126, 120),
+    ("gImage_dang4", 126, 120),
+    ("gImage_dang5", 126, 120),
+]
+# RGB565图片名称 -> (宽, 高)
+RAW_IMAGES = [("gImage_shalou_40x40", 40, 40)]
+
+
+def parse_arrays(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    arrays = {}
+    for m in re.finditer(r"const\s+unsigned\s+char\s+(\w+)\s*\[\s*(\d*)\s*\]\s*=\s*\{(.*?)\}\s*;", text, re.S):
+        values = [int(v, 0) for v in m.group(3).replace("\n", " ").split(",") if v.strip()]
+        if m.group(2) and int(m.group(2)) != len(values):
+            raise ValueError("%s: declared %s bytes, found %d" % (m.group(1), m.group(2), len(values)))
+        arrays[m.group(1)] = bytes(values)
+    return arrays
+
+
+def unpack_gray(data, pixels):
+    out = []
+    for b in data:
+        out.append(b >> 4)
+        out.append(b & 0x0F)
+    return out[:pixels]
+
+
+def rle_encode(pixels):
+    out = bytearray()
+    i = 0
+    while i < len(pixels):
+        gray = pixels[i]
+        run = 1
+        while i + run < len(pixels) and pixels[i + run] == gray and run < RUN_LONG_MAX:
+            run += 1
+        if run <= RUN_SHORT_MAX:
+            out.append((gray << 4) | (run - 1))
+        else:
+            out.append((gray << 4) | 0x0F)
+            out.append(run - 16)
+        i += run
+    return bytes(out)
+
+
+def rle_decode(data, pixels):
+    out = []
+    i = 0
+    while i < len(data) and len(out) < pixels:
+        gray = data[i] >> 4
+        n = data[i] & 0x0F
+        i += 1
+        if n == 0x0F:
+            run = 16 + data[i]
+            i += 1
+        else:
+            run = n + 1
+        out.extend([gray] * run)
+    return out
+
+
+def format_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("".join("0X%02X," % b for b in data[i:i + 16]))
+    return "\n".join(lines)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    src = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, "image_logo_raw.c")
+    dst = sys.argv[2] if len(sys.argv) > 2 else os.path.join(here, "..", "bsp", "image_logo.c")
+
+    with open(src, "r", encoding="utf-8") as f:
+        arrays = parse_arrays(f.read())
+
+    out = []
+    out.append("/* 由 User/SCRIPT/image_rle.py 根据 image_logo_raw.c 生成，请勿手工修改 */")
+    out.append('#include "image_logo.h"')
+    out.append('#include "asset.h"')
+    out.append("")
+
+    entries = []
+    for name, width, height in RAW_IMAGES:
+        data = arrays[name]
+        if len(data) != width * height * 2:
+            raise SystemExit("%s: expected %d bytes, found %d" % (name, width * height * 2, len(data)))
+        out.append("const unsigned char %s[%d] ASSET_SECTION = {" % (name, len(data)))
+        out.append(format_bytes(data) + "};")
+        out.append("")
+        entries.append((name, data, width, height, "ASSET_FORMAT_RGB565"))
+
+    raw_total = 0
+    rle_total = 0
+    for name, width, height in GRAY_IMAGES:
+        raw = arrays[name]
+        pixels = unpack_gray(raw, width * height)
+        rle = rle_encode(pixels)
+        if rle_decode(rle, len(pixels)) != pixels:
+            raise SystemExit("%s: round-trip mismatch" % name)
+        raw_total += len(raw)
+        rle_total += len(rle)
+
+        out.append("/* %dx%d，原始%d字节 */" % (width, height, len(raw)))
+        out.append("static const unsigned char s_%s_rle[%d] ASSET_SECTION = {" % (name, len(rle)))
+        out.append(format_bytes(rle) + "};")
+        out.append("const image_rle_t %s = { s_%s_rle, sizeof(s_%s_rle), %d, %d };" % (name, name, name, width, height))
+        out.append("")
+        entries.append(("s_%s_rle" % name, rle, width, height, "ASSET_FORMAT_GRAY4_RLE"))
+
+    crc = 0
+    for _, data, _, _, _ in entries:
+        crc = zlib.crc32(data, crc)
+
+    out.append("/* 资源索引 */")
+    out.append("static const asset_entry_t s_asset_entries[%d] ASSET_SECTION = {" % len(entries))
+    for symbol, _, width, height, fmt in entries:
+        out.append("    { %s, sizeof(%s), %d, %d, %s }," % (symbol, symbol, width, height, fmt))
+    out.append("};")
+    out.append("const asset_index_t g_asset_index ASSET_INDEX_SECTION = {")
+    out.append("    ASSET_INDEX_MAGIC, ASSET_INDEX_VERSION, %d, 0x%08XU, s_asset_entries" % (len(entries), crc & 0xFFFFFFFF))
+    out.append("};")
+    out.append("")
+
+    with open(dst, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+    print("gray images: %d -> %d bytes" % (raw_total, rle_total))
+
+
+if __name__ == "__main__":
+    main()
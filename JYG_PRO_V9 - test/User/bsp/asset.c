@@ -0,0 +1,76 @@
+#include "asset.h"
+#include "qspi.h"
+#include <stddef.h>
+
+static uint8_t s_asset_valid = 0U;
+
+/* 标准CRC32（与Python zlib.crc32一致），按位计算不占查表空间 */
+static uint32_t asset_crc32(uint32_t crc, const uint8_t *data, uint32_t size)
+{
+    while (size--)
+    {
+        crc ^= *data++;
+        for (uint8_t i = 0U; i < 8U; i++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief       校验资源索引
+ * @param       无
+ * @retval      0, 资源可用; 1, 索引无效（QSPI未映射、未烧写或数据损坏）
+ * @note        需在qspi_init()之后调用
+ */
+uint8_t asset_init(void)
+{
+    const asset_index_t *index = &g_asset_index;
+    uint32_t crc = 0xFFFFFFFFU;
+
+    s_asset_valid = 0U;
+
+    /* 索引位于QSPI但未进入内存映射时访问会产生总线错误 */
+    if (qspi_is_mapped_addr(index) && !qspi_is_memmapped())
+    {
+        return 1;
+    }
+
+    if (index->magic != ASSET_INDEX_MAGIC || index->version != ASSET_INDEX_VERSION ||
+        index->count == 0U || index->count > ASSET_MAX_COUNT)
+    {
+        return 1;
+    }
+
+    for (uint32_t i = 0U; i < index->count; i++)
+    {
+        crc = asset_crc32(crc, index->entries[i].data, index->entries[i].size);
+    }
+    if ((crc ^ 0xFFFFFFFFU) != index->crc)
+    {
+        return 1;
+    }
+
+    s_asset_valid = 1U;
+    return 0;
+}
+
+uint8_t asset_is_valid(void)
+{
+    return s_asset_valid;
+}
+
+uint32_t asset_get_count(void)
+{
+    return s_asset_valid ? g_asset_index.count : 0U;
+}
+
+const asset_entry_t *asset_get(uint32_t index)
+{
+    if (!s_asset_valid || index >= g_asset_index.count)
+    {
+        return NULL;
+    }
+    return &g_asset_index.entries[index];
+}
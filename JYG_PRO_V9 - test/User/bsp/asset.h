@@ -0,0 +1,51 @@
+#ifndef __ASSET_H
+#define __ASSET_H
+
+#include <stdint.h>
+#include "version.h"
+
+/* 资源索引和图片数据由 User/SCRIPT/image_rle.py 生成，默认与程序一起放在内部FLASH；
+ * ENABLE_QSPI_ASSETS为1时放入QSPI FLASH（.qspi_assets段，索引在该区域最前面的.qspi_asset_index段，见User/SCRIPT/jyg_pro.sct）。
+ * 启动时校验索引的魔数、版本和全部资源数据的CRC32，校验失败（如QSPI未烧写或初始化失败）时不绘制图片
+ */
+#if ENABLE_QSPI_ASSETS
+#define ASSET_SECTION               __attribute__((section(".qspi_assets")))
+#define ASSET_INDEX_SECTION         __attribute__((section(".qspi_asset_index")))
+#else
+#define ASSET_SECTION
+#define ASSET_INDEX_SECTION
+#endif
+
+#define ASSET_INDEX_MAGIC           0x54455341U     /* "ASET" */
+#define ASSET_INDEX_VERSION         1U
+#define ASSET_MAX_COUNT             64U
+
+#define ASSET_FORMAT_RGB565         0U      /* RGB565原始数据，高字节在前 */
+#define ASSET_FORMAT_GRAY4_RLE      1U      /* 16灰度RLE（见image_rle.h） */
+
+typedef struct
+{
+    const uint8_t *data;
+    uint32_t size;
+    uint16_t width;
+    uint16_t height;
+    uint32_t format;
+} asset_entry_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t crc;                   /* 按索引顺序计算全部资源数据的CRC32 */
+    const asset_entry_t *entries;
+} asset_index_t;
+
+extern const asset_index_t g_asset_index;
+
+uint8_t asset_init(void);
+uint8_t asset_is_valid(void);
+uint32_t asset_get_count(void);
+const asset_entry_t *asset_get(uint32_t index);
+
+#endif
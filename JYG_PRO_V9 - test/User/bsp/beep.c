@@ -1,8 +1,157 @@
 #include "beep.h"
-#include "./SYSTEM/delay/delay.h"
+
+typedef struct
+{
+    uint16_t freq_hz;           /* 0表示静音 */
+    uint16_t duration_ms;
+} beep_note_t;
+
+typedef struct
+{
+    const beep_note_t *notes;
+    uint8_t count;
+} beep_pattern_def_t;
+
+static const beep_note_t s_notes_beep[] =
+{
+    {BEEP_PWM_FREQ_HZ, BEEP_DURATION_MS}
+};
+
+static const beep_note_t s_notes_double[] =
+{
+    {BEEP_PWM_FREQ_HZ, 80U}, {0U, 80U}, {BEEP_PWM_FREQ_HZ, 80U}
+};
+
+static const beep_note_t s_notes_error[] =
+{
+    {2500U, 60U}, {0U, 30U}, {1600U, 60U}, {0U, 30U}, {1000U, 150U}
+};
+
+static const beep_note_t s_notes_finish[] =
+{
+    {1047U, 120U}, {1319U, 120U}, {1568U, 120U}, {2093U, 250U}
+};
+
+static const beep_pattern_def_t s_patterns[BEEP_PATTERN_COUNT] =
+{
+    {s_notes_beep,   sizeof(s_notes_beep) / sizeof(s_notes_beep[0])},
+    {s_notes_double, sizeof(s_notes_double) / sizeof(s_notes_double[0])},
+    {s_notes_error,  sizeof(s_notes_error) / sizeof(s_notes_error[0])},
+    {s_notes_finish, sizeof(s_notes_finish) / sizeof(s_notes_finish[0])},
+};
 
 static uint8_t s_beep_initialized = 0U;
 
+/* 队列：beep_play()只写尾，中断只读头 */
+static uint8_t s_queue[BEEP_QUEUE_SIZE];
+static volatile uint8_t s_queue_head = 0U;
+static volatile uint8_t s_queue_tail = 0U;
+
+/* 以下仅在中断中（或定时器停止时）访问 */
+static volatile uint8_t s_playing = 0U;
+static const beep_note_t *s_note = 0;
+static uint8_t s_notes_left = 0U;
+static uint32_t s_ticks_left = 0U;
+static uint8_t s_tone_on = 0U;
+static uint8_t s_pin_high = 0U;
+
+static uint32_t beep_get_timer_clock(void)
+{
+    uint32_t pclk1 = HAL_RCC_GetPCLK1Freq();
+    uint32_t d2ppre1 = (RCC->D2CFGR & RCC_D2CFGR_D2PPRE1_Msk) >> RCC_D2CFGR_D2PPRE1_Pos;
+
+    if (d2ppre1 >= 4U)    
+    {
+        return pclk1 * 2U;
+    }
+
+    return pclk1;
+}
+
+static void beep_pin_low(void)
+{
+    BEEP_GPIO_PORT->BSRR = (uint32_t)BEEP_GPIO_PIN << 16U;
+    s_pin_high = 0U;
+}
+
+/* 装载一个音符：有音调时每半个周期中断一次翻转引脚，静音时每1ms中断一次计时 */
+static void beep_start_note(const beep_note_t *note)
+{
+    uint32_t interval_us;
+
+    s_note = note;
+    if (note->freq_hz != 0U)
+    {
+        interval_us = BEEP_TIM_COUNT_FREQ_HZ / (2U * note->freq_hz);
+        s_ticks_left = (2U * note->freq_hz * note->duration_ms) / 1000U;
+        s_tone_on = 1U;
+    }
+    else
+    {
+        interval_us = 1000U;
+        s_ticks_left = note->duration_ms;
+        s_tone_on = 0U;
+        beep_pin_low();
+    }
+
+    if (s_ticks_left == 0U)
+    {
+        s_ticks_left = 1U;
+    }
+
+    BEEP_TIM->ARR = interval_us - 1U;
+    BEEP_TIM->CNT = 0U;
+}
+
+/* 当前音符结束：切换到下一个音符或下一个排队的图案，全部播放完毕后停止定时器 */
+static void beep_advance(void)
+{
+    uint8_t head;
+
+    if (s_notes_left > 1U)
+    {
+        s_notes_left--;
+        beep_start_note(s_note + 1);
+        return;
+    }
+
+    head = s_queue_head;
+    if (head != s_queue_tail)
+    {
+        const beep_pattern_def_t *pattern = &s_patterns[s_queue[head]];
+
+        s_queue_head = (uint8_t)((head + 1U) & (BEEP_QUEUE_SIZE - 1U));
+        s_notes_left = pattern->count;
+        beep_start_note(pattern->notes);
+        return;
+    }
+
+    BEEP_TIM->CR1 &= ~TIM_CR1_CEN;
+    s_notes_left = 0U;
+    s_tone_on = 0U;
+    beep_pin_low();
+    s_playing = 0U;
+}
+
+void BEEP_TIM_IRQHandler(void)
+{
+    if (BEEP_TIM->SR & TIM_SR_UIF)
+    {
+        BEEP_TIM->SR = ~TIM_SR_UIF;
+
+        if (s_tone_on)
+        {
+            s_pin_high ^= 1U;
+            BEEP_GPIO_PORT->BSRR = s_pin_high ? (uint32_t)BEEP_GPIO_PIN : ((uint32_t)BEEP_GPIO_PIN << 16U);
+        }
+
+        if (--s_ticks_left == 0U)
+        {
+            beep_advance();
+        }
+    }
+}
+
 void beep_init(void)
 {
     GPIO_InitTypeDef gpio_init_struct = {0};
@@ -13,43 +162,87 @@ void beep_init(void)
     }
     
     BEEP_GPIO_CLK_ENABLE();
+    BEEP_TIM_CLK_ENABLE();
     
     gpio_init_struct.Pin = BEEP_GPIO_PIN;
     gpio_init_struct.Mode = GPIO_MODE_OUTPUT_PP;
     gpio_init_struct.Pull = GPIO_NOPULL;
-    gpio_init_struct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+    gpio_init_struct.Speed = GPIO_SPEED_FREQ_LOW;
     HAL_GPIO_Init(BEEP_GPIO_PORT, &gpio_init_struct);
     
     HAL_GPIO_WritePin(BEEP_GPIO_PORT, BEEP_GPIO_PIN, GPIO_PIN_RESET);
+
+    BEEP_TIM->CR1 = TIM_CR1_URS;    /* 只有计数溢出产生更新中断 */
+    BEEP_TIM->PSC = beep_get_timer_clock() / BEEP_TIM_COUNT_FREQ_HZ - 1U;
+    BEEP_TIM->ARR = 0xFFFFU;
+    BEEP_TIM->EGR = TIM_EGR_UG;     /* 装载预分频值 */
+    BEEP_TIM->SR = 0U;
+    BEEP_TIM->DIER = TIM_DIER_UIE;
+
+    HAL_NVIC_SetPriority(BEEP_TIM_IRQn, 3, 2);
+    HAL_NVIC_EnableIRQ(BEEP_TIM_IRQn);
     
     s_beep_initialized = 1U;
 }
 
-void beep_beep(void)
+/* 图案入队后立即返回，由TIM7中断在后台播放 */
+void beep_play(beep_pattern_t pattern)
 {
-    uint32_t cycles;
-    uint32_t i;
-    
+    uint8_t next;
+    uint32_t primask;
+
+    if (pattern >= BEEP_PATTERN_COUNT)
+    {
+        return;
+    }
+
     if (!s_beep_initialized)
     {
         beep_init();
     }
-    
-    if (!s_beep_initialized)
+
+    next = (uint8_t)((s_queue_tail + 1U) & (BEEP_QUEUE_SIZE - 1U));
+    if (next == s_queue_head)
     {
         return;
     }
-    
-    cycles = (BEEP_DURATION_MS * 1000U) / BEEP_PWM_PERIOD_US;
-    
-    for (i = 0; i < cycles; i++)
+    s_queue[s_queue_tail] = (uint8_t)pattern;
+    s_queue_tail = next;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (!s_playing)
     {
-        HAL_GPIO_WritePin(BEEP_GPIO_PORT, BEEP_GPIO_PIN, GPIO_PIN_SET);
-        delay_us(BEEP_PWM_HIGH_US);
-        
-        HAL_GPIO_WritePin(BEEP_GPIO_PORT, BEEP_GPIO_PIN, GPIO_PIN_RESET);
-        delay_us(BEEP_PWM_LOW_US);
+        s_playing = 1U;
+        s_notes_left = 0U;
+        beep_advance();
+        BEEP_TIM->SR = ~TIM_SR_UIF;
+        BEEP_TIM->CR1 |= TIM_CR1_CEN;
     }
-    
-    HAL_GPIO_WritePin(BEEP_GPIO_PORT, BEEP_GPIO_PIN, GPIO_PIN_RESET);
+    __set_PRIMASK(primask);
+}
+
+void beep_beep(void)
+{
+    beep_play(BEEP_PATTERN_BEEP);
+}
+
+/* 立即停止并清空队列 */
+void beep_stop(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    s_queue_head = s_queue_tail;
+    if (s_playing)
+    {
+        s_notes_left = 0U;
+        beep_advance();
+    }
+    __set_PRIMASK(primask);
+}
+
+uint8_t beep_is_busy(void)
+{
+    return s_playing;
 }
@@ -1,4 +1,3 @@
-
 #ifndef __BEEP_H
 #define __BEEP_H
 
@@ -8,14 +7,31 @@
 #define BEEP_GPIO_PIN                   GPIO_PIN_0
 #define BEEP_GPIO_CLK_ENABLE()          do{ __HAL_RCC_GPIOC_CLK_ENABLE(); }while(0)
 
-#define BEEP_PWM_FREQ_HZ                2000U
-#define BEEP_PWM_PERIOD_US              (1000000U / BEEP_PWM_FREQ_HZ)
-#define BEEP_PWM_HIGH_US                (BEEP_PWM_PERIOD_US / 2U)
-#define BEEP_PWM_LOW_US                 (BEEP_PWM_PERIOD_US / 2U)
+/* PC0没有定时器复用功能，由基本定时器TIM7的更新中断翻转引脚产生方波（BSRR写入，不占用主循环） */
+#define BEEP_TIM                        TIM7
+#define BEEP_TIM_IRQn                   TIM7_IRQn
+#define BEEP_TIM_IRQHandler             TIM7_IRQHandler
+#define BEEP_TIM_CLK_ENABLE()           do{ __HAL_RCC_TIM7_CLK_ENABLE(); }while(0)
+#define BEEP_TIM_COUNT_FREQ_HZ          1000000U    /* 计数频率1MHz */
 
+#define BEEP_PWM_FREQ_HZ                2000U
 #define BEEP_DURATION_MS                100U
 
+#define BEEP_QUEUE_SIZE                 4U          /* 需为2的幂，队列满时新的提示音被丢弃 */
+
+typedef enum
+{
+    BEEP_PATTERN_BEEP = 0U,     /* 单声提示（按键） */
+    BEEP_PATTERN_DOUBLE,        /* 双声提示 */
+    BEEP_PATTERN_ERROR,         /* 下降音调的错误提示 */
+    BEEP_PATTERN_FINISH,        /* 上升音阶的结束提示 */
+    BEEP_PATTERN_COUNT
+} beep_pattern_t;
+
 void beep_init(void);      
 void beep_beep(void);       
+void beep_play(beep_pattern_t pattern);
+void beep_stop(void);
+uint8_t beep_is_busy(void);
 
 #endif
@@ -0,0 +1,318 @@
+#include "digipot.h"
+#include "i2c_callback.h"
+#include "profiler.h"
+
+static digipot_t *s_devices[DIGIPOT_MAX_DEVICES];
+static uint8_t s_device_count = 0U;
+
+static digipot_t *digipot_find(const I2C_HandleTypeDef *hi2c)
+{
+    for (uint8_t i = 0U; i < s_device_count; i++)
+    {
+        if (s_devices[i]->hi2c == hi2c)
+        {
+            return s_devices[i];
+        }
+    }
+    return 0;
+}
+
+/* 启动一次发送，调用前需已屏蔽中断或处于该I2C的中断上下文 */
+static void digipot_start(digipot_t *dev, uint8_t value)
+{
+    dev->tx_value = value;
+    dev->busy = 1U;
+    dev->start_tick = HAL_GetTick();
+
+    if (HAL_I2C_Master_Transmit_IT(dev->hi2c, (uint16_t)(dev->address << 1U), &dev->tx_value, 1U) != HAL_OK)
+    {
+        dev->busy = 0U;
+        dev->stats.failures++;
+    }
+}
+
+/* 当前值结束（成功或放弃）后发送待写槽位中的值 */
+static void digipot_start_pending(digipot_t *dev)
+{
+    dev->busy = 0U;
+    if (dev->pending)
+    {
+        dev->pending = 0U;
+        dev->attempts = 1U;
+        digipot_start(dev, dev->pending_value);
+    }
+}
+
+/* 退避结束：有更新的值时直接改发新值，否则重发当前值，次数用完则放弃 */
+static void digipot_retry(digipot_t *dev)
+{
+    if (!dev->pending && dev->attempts < DIGIPOT_MAX_RETRY)
+    {
+        dev->attempts++;
+        dev->stats.retries++;
+        digipot_start(dev, dev->tx_value);
+        return;
+    }
+
+    if (!dev->pending)
+    {
+        dev->stats.failures++;
+    }
+    else
+    {
+        dev->stats.coalesced++;
+    }
+    digipot_start_pending(dev);
+}
+
+/* 需在屏蔽中断下调用：无应答退避到期后重发；中断发送超时（总线被拉住或外设异常）则复位外设并放弃当前值 */
+static void digipot_service(digipot_t *dev)
+{
+    uint32_t elapsed = HAL_GetTick() - dev->start_tick;
+
+    if (!dev->busy)
+    {
+        return;
+    }
+
+    if (dev->backoff)
+    {
+        if (elapsed >= DIGIPOT_RETRY_BACKOFF_MS)
+        {
+            dev->backoff = 0U;
+            digipot_retry(dev);
+        }
+        return;
+    }
+
+    if (elapsed < DIGIPOT_TIMEOUT_MS)
+    {
+        return;
+    }
+
+    dev->stats.bus_resets++;
+    dev->stats.failures++;
+    (void)HAL_I2C_DeInit(dev->hi2c);
+    (void)HAL_I2C_Init(dev->hi2c);
+    dev->written_valid = 0U;
+    digipot_start_pending(dev);
+}
+
+static void digipot_tx_cplt_callback(I2C_HandleTypeDef *hi2c)
+{
+    digipot_t *dev = digipot_find(hi2c);
+
+    if (dev == 0 || !dev->busy)
+    {
+        return;
+    }
+
+    dev->stats.completed++;
+    dev->written_value = dev->tx_value;
+    dev->written_valid = 1U;
+
+    if (dev->pending && dev->pending_value == dev->tx_value)
+    {
+        dev->pending = 0U;
+        dev->stats.coalesced++;
+    }
+    digipot_start_pending(dev);
+}
+
+/* 无应答或总线错误：不在中断中立即重发，退避DIGIPOT_RETRY_BACKOFF_MS后由digipot_service()处理 */
+static void digipot_error_callback(I2C_HandleTypeDef *hi2c)
+{
+    digipot_t *dev = digipot_find(hi2c);
+
+    if (dev == 0 || !dev->busy)
+    {
+        return;
+    }
+
+    dev->written_valid = 0U;
+    dev->backoff = 1U;
+    dev->start_tick = HAL_GetTick();
+}
+
+void digipot_register(digipot_t *dev, I2C_HandleTypeDef *hi2c, uint8_t address)
+{
+    dev->hi2c = hi2c;
+    dev->address = address;
+    dev->busy = 0U;
+    dev->backoff = 0U;
+    dev->pending = 0U;
+    dev->attempts = 0U;
+    dev->written_valid = 0U;
+    dev->profile = 0;
+    dev->ramping = 0U;
+    dev->ramp_value = DIGIPOT_WIPER_MAX;
+    dev->ramp_target = DIGIPOT_WIPER_MAX;
+
+    if (digipot_find(hi2c) == 0 && s_device_count < DIGIPOT_MAX_DEVICES)
+    {
+        s_devices[s_device_count++] = dev;
+    }
+    i2c_callback_register(hi2c, digipot_tx_cplt_callback, digipot_error_callback);
+}
+
+void digipot_write(digipot_t *dev, uint8_t value)
+{
+    uint32_t primask;
+
+    if (dev->hi2c == 0)
+    {
+        return;
+    }
+
+    PROF_ZONE_BEGIN(PROF_ZONE_DIGIPOT_WRITE);
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    dev->stats.requests++;
+    digipot_service(dev);
+
+    if (dev->busy)
+    {
+        if (dev->pending)
+        {
+            dev->stats.coalesced++;     /* 未发送的旧值被覆盖 */
+        }
+        dev->pending_value = value;
+        dev->pending = 1U;
+    }
+    else if (dev->written_valid && dev->written_value == value)
+    {
+        dev->stats.coalesced++;
+    }
+    else
+    {
+        dev->attempts = 1U;
+        digipot_start(dev, value);
+    }
+
+    __set_PRIMASK(primask);
+    PROF_ZONE_END(PROF_ZONE_DIGIPOT_WRITE);
+}
+
+uint8_t digipot_is_busy(const digipot_t *dev)
+{
+    return dev->busy;
+}
+
+void digipot_get_stats(const digipot_t *dev, digipot_stats_t *stats)
+{
+    *stats = dev->stats;
+}
+
+/* 改为不限速（NULL或step为0）时，进行中的斜坡直接到目标值 */
+void digipot_set_profile(digipot_t *dev, const digipot_ramp_profile_t *profile)
+{
+    if (profile == 0 || profile->step == 0U)
+    {
+        if (dev->ramping)
+        {
+            dev->ramping = 0U;
+            dev->ramp_value = dev->ramp_target;
+            digipot_write(dev, dev->ramp_target);
+        }
+    }
+    dev->profile = profile;
+}
+
+/* 使能输出时调用：先回到起始值，再按斜坡升到目标 */
+void digipot_ramp_start(digipot_t *dev, uint8_t target)
+{
+    if (dev->profile != 0 && dev->profile->step != 0U && dev->profile->start_wiper > target)
+    {
+        dev->ramp_value = dev->profile->start_wiper;
+        digipot_write(dev, dev->ramp_value);
+    }
+    digipot_ramp_to(dev, target);
+}
+
+void digipot_ramp_to(digipot_t *dev, uint8_t target)
+{
+    if (target > DIGIPOT_WIPER_MAX)
+    {
+        target = DIGIPOT_WIPER_MAX;
+    }
+    dev->ramp_target = target;
+
+    if (dev->profile == 0 || dev->profile->step == 0U || target >= dev->ramp_value)
+    {
+        dev->ramping = 0U;
+        dev->ramp_value = target;
+        digipot_write(dev, target);
+        return;
+    }
+
+    if (!dev->ramping)
+    {
+        dev->ramping = 1U;
+        dev->ramp_tick = HAL_GetTick() - dev->profile->interval_ms;    /* 第一步立即执行 */
+        digipot_ramp_process();
+    }
+}
+
+/* 输出关闭时调用：停止斜坡，有曲线时回到起始值，下次使能从低输出端开始 */
+void digipot_ramp_stop(digipot_t *dev)
+{
+    dev->ramping = 0U;
+    if (dev->profile != 0 && dev->profile->step != 0U)
+    {
+        dev->ramp_value = dev->profile->start_wiper;
+        dev->ramp_target = dev->ramp_value;
+        digipot_write(dev, dev->ramp_value);
+    }
+}
+
+uint8_t digipot_is_ramping(const digipot_t *dev)
+{
+    return dev->ramping;
+}
+
+/* 斜坡节拍：由调度任务周期调用，间隔需不大于各曲线的interval_ms；
+ * 同时处理无应答后的重发和传输超时，没有新的写入时也能继续
+ */
+void digipot_ramp_process(void)
+{
+    uint32_t now = HAL_GetTick();
+
+    for (uint8_t i = 0U; i < s_device_count; i++)
+    {
+        digipot_t *dev = s_devices[i];
+        uint32_t primask = __get_PRIMASK();
+
+        __disable_irq();
+        digipot_service(dev);
+        __set_PRIMASK(primask);
+
+        if (!dev->ramping)
+        {
+            continue;
+        }
+        if (dev->profile == 0 || dev->profile->step == 0U)
+        {
+            dev->ramp_value = dev->ramp_target;
+            dev->ramping = 0U;
+            digipot_write(dev, dev->ramp_value);
+            continue;
+        }
+        if ((now - dev->ramp_tick) < dev->profile->interval_ms)
+        {
+            continue;
+        }
+
+        dev->ramp_tick = now;
+        if ((uint8_t)(dev->ramp_value - dev->ramp_target) > dev->profile->step)
+        {
+            dev->ramp_value = (uint8_t)(dev->ramp_value - dev->profile->step);
+        }
+        else
+        {
+            dev->ramp_value = dev->ramp_target;
+            dev->ramping = 0U;
+        }
+        digipot_write(dev, dev->ramp_value);
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef __DIGIPOT_H
+#define __DIGIPOT_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/* 数字电位器异步写入服务：单字节写滑动端，中断方式发送，调用立即返回；
+ * 传输进行中再次写入的值放入待写槽位，连续调整时只保留最后一个值
+ */
+#define DIGIPOT_MAX_DEVICES     2U
+#define DIGIPOT_MAX_RETRY       3U      /* 单个值的最多发送次数 */
+#define DIGIPOT_TIMEOUT_MS      20U     /* 传输超过该时间未完成视为总线卡死，复位I2C外设 */
+#define DIGIPOT_RETRY_BACKOFF_MS 2U     /* 无应答后至少等待该时间再重发，在digipot_ramp_process()或digipot_write()中执行 */
+#define DIGIPOT_WIPER_MAX       0x7FU   /* 7位滑动端 */
+
+/* 软启动斜坡：滑动端值越小输出电压越高（TEC与WSD电路相同），
+ * 朝高输出方向每interval_ms最多移动step个计数，朝低输出方向一步到位；step为0表示不限速
+ */
+typedef struct
+{
+    uint8_t start_wiper;    /* 使能输出时的起始值（低输出端） */
+    uint8_t step;
+    uint16_t interval_ms;
+} digipot_ramp_profile_t;
+
+typedef struct
+{
+    uint32_t requests;      /* digipot_write()调用次数 */
+    uint32_t completed;     /* 成功写入次数 */
+    uint32_t coalesced;     /* 被后续值覆盖或与当前值相同而省去的写入 */
+    uint32_t retries;       /* 重发次数 */
+    uint32_t failures;      /* 重发后仍失败而放弃的值 */
+    uint32_t bus_resets;    /* 超时复位I2C外设次数 */
+} digipot_stats_t;
+
+typedef struct
+{
+    I2C_HandleTypeDef *hi2c;
+    uint8_t address;                /* 7位地址 */
+    volatile uint8_t busy;
+    volatile uint8_t backoff;       /* 无应答后等待重发（busy保持为1） */
+    volatile uint8_t pending;       /* 待写槽位有效 */
+    volatile uint8_t pending_value;
+    uint8_t tx_value;               /* 正在发送的值（中断发送期间需保持有效） */
+    uint8_t attempts;
+    uint8_t written_valid;
+    uint8_t written_value;          /* 最近一次成功写入的值 */
+    uint32_t start_tick;
+    const digipot_ramp_profile_t *profile;
+    uint8_t ramping;
+    uint8_t ramp_value;             /* 斜坡当前已下发的值 */
+    uint8_t ramp_target;
+    uint32_t ramp_tick;             /* 上一步的时刻 */
+    digipot_stats_t stats;
+} digipot_t;
+
+/* hi2c需已由调用者初始化，并在其EV/ER中断中调用HAL_I2C_EV_IRQHandler/HAL_I2C_ER_IRQHandler；
+ * 完成/错误回调经i2c_callback.c按句柄分发
+ */
+void digipot_register(digipot_t *dev, I2C_HandleTypeDef *hi2c, uint8_t address);
+void digipot_write(digipot_t *dev, uint8_t value);
+uint8_t digipot_is_busy(const digipot_t *dev);
+void digipot_get_stats(const digipot_t *dev, digipot_stats_t *stats);
+void digipot_set_profile(digipot_t *dev, const digipot_ramp_profile_t *profile);
+void digipot_ramp_start(digipot_t *dev, uint8_t target);
+void digipot_ramp_to(digipot_t *dev, uint8_t target);
+void digipot_ramp_stop(digipot_t *dev);
+uint8_t digipot_is_ramping(const digipot_t *dev);
+void digipot_ramp_process(void);
+
+#endif
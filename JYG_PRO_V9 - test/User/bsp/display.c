@@ -1,23 +1,25 @@
 #include "display.h"
 #include <stdio.h>
 #include <string.h>
+#include "dma_buf.h"
+#include "asset.h"
 
-static const unsigned char* mode_images[MODE_COUNT] = 
+static const image_rle_t* mode_images[MODE_COUNT] = 
 {
-    gImage_mode1_126x174,  
-    gImage_mode2_126x174,  
-    gImage_mode3_126x174,  
-    gImage_mode4_126x174,  
-    gImage_mode5_126x174   
+    &gImage_mode1_126x174,  
+    &gImage_mode2_126x174,  
+    &gImage_mode3_126x174,  
+    &gImage_mode4_126x174,  
+    &gImage_mode5_126x174   
 };
 
-static const unsigned char* level_images[LEVEL_COUNT] = 
+static const image_rle_t* level_images[LEVEL_COUNT] = 
 {
-    gImage_dang1,  
-    gImage_dang2,  
-    gImage_dang3,  
-    gImage_dang4,  
-    gImage_dang5   
+    &gImage_dang1,  
+    &gImage_dang2,  
+    &gImage_dang3,  
+    &gImage_dang4,  
+    &gImage_dang5   
 };
 
 #define TIME_DIGIT_WIDTH              10U
@@ -31,7 +33,38 @@ static const unsigned char* level_images[LEVEL_COUNT] =
 #define TIME_TEXT_FOREGROUND_GRAY     0x00U
 #define TIME_TEXT_COLON_GRAY          0x03U
 
-static uint8_t s_time_gray_buffer[((TIME_TEXT_MAX_WIDTH * TIME_FONT_HEIGHT) + 1U) / 2U];
+#define TIME_TEXT_BUFFER_BYTES        (((TIME_TEXT_MAX_WIDTH * TIME_FONT_HEIGHT) + 1U) / 2U)
+
+/* 两块缓冲区交替渲染，上一帧用于与新帧比较（DMA2D无法访问DTCM，从DMA缓冲池分配，由DMA2D直接展开） */
+static uint8_t (*s_time_gray_buffer)[TIME_TEXT_BUFFER_BYTES] = NULL;
+static uint8_t s_time_buffer_index = 0U;
+
+/* 局部刷新：按行带比较新旧图片，每个行带只发送变化的列范围 */
+#define DISPLAY_TILE_ROWS             8U
+#define DISPLAY_ROW_BYTES_MAX         (LCD_WIDTH / 2U)
+
+/* 压缩图片比较时的行带解码缓冲区（新行带由DMA2D直接展开，从DMA缓冲池分配；旧行带只用于比较） */
+static uint8_t s_band_old[DISPLAY_TILE_ROWS * DISPLAY_ROW_BYTES_MAX] DTCM_DATA;
+static uint8_t *s_band_new = NULL;
+
+#define DISPLAY_HOURGLASS_X           (LCD_WIDTH - 40U)
+#define DISPLAY_HOURGLASS_Y           DISPLAY_LEVEL_Y
+#define DISPLAY_HOURGLASS_SIZE        40U
+
+typedef struct
+{
+    uint16_t x0;
+    uint16_t y0;
+    uint16_t x1;
+    uint16_t y1;
+} display_rect_t;
+
+/* 屏幕上当前显示的内容，0表示未知（需整块重绘） */
+static uint8_t s_shown_mode = 0U;
+static uint8_t s_shown_level = 0U;
+static uint8_t s_hourglass_valid = 0U;
+static uint8_t s_time_text_valid = 0U;
+static display_rect_t s_time_text_rect;
 
 #define SEG_A  (1U << 0)
 #define SEG_B  (1U << 1)
@@ -210,47 +243,229 @@ static void time_text_render_char(uint8_t *buffer, uint16_t buffer_width, uint16
     }
 }
 
+static uint8_t display_rect_overlap(const display_rect_t *a, const display_rect_t *b)
+{
+    return (a->x0 <= b->x1 && b->x0 <= a->x1 && a->y0 <= b->y1 && b->y0 <= a->y1) ? 1U : 0U;
+}
+
+/**
+ * 比较一个行带的新旧数据（按行连续的16灰度数据，每行row_bytes字节），只发送变化的列范围
+ * changed为0时先初始化dirty，返回是否有变化
+ */
+static uint8_t display_blit_band(uint16_t x, uint16_t y, uint16_t row_bytes, uint16_t band_h,
+                                 const uint8_t *old_rows, const uint8_t *new_rows,
+                                 display_rect_t *dirty, uint8_t changed)
+{
+    uint16_t first = row_bytes;
+    uint16_t last = 0U;
+
+    for (uint16_t r = 0; r < band_h; r++)
+    {
+        const uint8_t *o = old_rows + (uint32_t)r * row_bytes;
+        const uint8_t *n = new_rows + (uint32_t)r * row_bytes;
+        uint16_t c;
+
+        for (c = 0; c < row_bytes && o[c] == n[c]; c++)
+        {
+        }
+        if (c == row_bytes)
+        {
+            continue;
+        }
+        if (c < first)
+        {
+            first = c;
+        }
+        for (c = row_bytes - 1U; c > last && o[c] == n[c]; c--)
+        {
+        }
+        if (c > last)
+        {
+            last = c;
+        }
+    }
+
+    if (first > last)
+    {
+        return changed;
+    }
+
+    LCD_ShowPartialImage16GrayStride(x + first * 2U, y,
+                                     (uint16_t)((last - first + 1U) * 2U), band_h,
+                                     new_rows + first, row_bytes);
+
+    if (!changed)
+    {
+        dirty->x0 = x + first * 2U;
+        dirty->x1 = x + last * 2U + 1U;
+        dirty->y0 = y;
+    }
+    else
+    {
+        if ((uint16_t)(x + first * 2U) < dirty->x0) dirty->x0 = x + first * 2U;
+        if ((uint16_t)(x + last * 2U + 1U) > dirty->x1) dirty->x1 = x + last * 2U + 1U;
+    }
+    dirty->y1 = y + band_h - 1U;
+    return 1U;
+}
+
+/**
+ * 比较同尺寸的新旧16灰度图片（未压缩），只把变化的区域发送到屏幕
+ * width必须为偶数；dirty返回所有已发送区域的外接矩形，返回0表示无变化
+ */
+static uint8_t display_blit_changed(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                    const uint8_t *old_img, const uint8_t *new_img,
+                                    display_rect_t *dirty)
+{
+    uint16_t row_bytes = width / 2U;
+    uint8_t changed = 0U;
+
+    for (uint16_t band_y = 0; band_y < height; band_y += DISPLAY_TILE_ROWS)
+    {
+        uint16_t band_h = ((height - band_y) > DISPLAY_TILE_ROWS) ? DISPLAY_TILE_ROWS : (height - band_y);
+        uint32_t offset = (uint32_t)band_y * row_bytes;
+
+        changed = display_blit_band(x, y + band_y, row_bytes, band_h,
+                                    old_img + offset, new_img + offset, dirty, changed);
+    }
+
+    return changed;
+}
+
+/**
+ * 比较同尺寸的新旧压缩图片：逐行带解码到缓冲区后比较，只把变化的区域发送到屏幕
+ * 图片宽度必须为偶数且不超过屏幕宽度
+ */
+static uint8_t display_blit_changed_rle(uint16_t x, uint16_t y,
+                                        const image_rle_t *old_img, const image_rle_t *new_img,
+                                        display_rect_t *dirty)
+{
+    image_rle_reader_t old_reader;
+    image_rle_reader_t new_reader;
+    uint16_t row_bytes = new_img->width / 2U;
+    uint8_t changed = 0U;
+
+    image_rle_reader_init(&old_reader, old_img);
+    image_rle_reader_init(&new_reader, new_img);
+
+    for (uint16_t band_y = 0; band_y < new_img->height; band_y += DISPLAY_TILE_ROWS)
+    {
+        uint16_t band_h = ((new_img->height - band_y) > DISPLAY_TILE_ROWS) ? DISPLAY_TILE_ROWS : (new_img->height - band_y);
+        uint32_t band_pixels = (uint32_t)band_h * new_img->width;
+
+        image_rle_read_packed(&old_reader, s_band_old, band_pixels);
+        LCD_WaitSourceRead();       /* 上一带仍可能正被DMA2D读取 */
+        image_rle_read_packed(&new_reader, s_band_new, band_pixels);
+
+        changed = display_blit_band(x, y + band_y, row_bytes, band_h,
+                                    s_band_old, s_band_new, dirty, changed);
+    }
+
+    return changed;
+}
+
+static void display_show_hourglass(void)
+{
+    LCD_ShowPartialImageBytes(DISPLAY_HOURGLASS_X, DISPLAY_HOURGLASS_Y,
+                              DISPLAY_HOURGLASS_SIZE, DISPLAY_HOURGLASS_SIZE, gImage_shalou_40x40);
+    s_hourglass_valid = 1U;
+}
+
+/* 屏幕内容被外部改写（清屏等）后调用，下次绘制时整块重绘 */
+void display_invalidate(void)
+{
+    s_shown_mode = 0U;
+    s_shown_level = 0U;
+    s_hourglass_valid = 0U;
+    s_time_text_valid = 0U;
+}
+
 void display_init(void)
 {
-    
+    if (s_time_gray_buffer == NULL)
+    {
+        s_time_gray_buffer = (uint8_t (*)[TIME_TEXT_BUFFER_BYTES])dma_buf_alloc(2U * TIME_TEXT_BUFFER_BYTES);
+        s_band_new = (uint8_t *)dma_buf_alloc(DISPLAY_TILE_ROWS * DISPLAY_ROW_BYTES_MAX);
+    }
+
     LCD_Clear(0x0000);  
+    display_invalidate();
 }
 
 void display_show_mode(uint8_t mode)
 {
     
-    if (mode < MODE_MIN || mode > MODE_MAX)
+    /* 资源索引校验失败（资源在QSPI时未烧写或QSPI初始化失败）时不绘制 */
+    if (mode < MODE_MIN || mode > MODE_MAX || !asset_is_valid())
     {
         return;
     }
     
     
-    LCD_ShowPartialImage16Gray(
-        DISPLAY_MODE_X, 
-        DISPLAY_MODE_Y, 
-        DISPLAY_MODE_WIDTH, 
-        DISPLAY_MODE_HEIGHT, 
-        mode_images[mode - 1]  
-    );
+    if (mode == s_shown_mode)
+    {
+        return;
+    }
+
+    if (s_shown_mode == 0U)
+    {
+        LCD_ShowImage16GrayRle(DISPLAY_MODE_X, DISPLAY_MODE_Y, mode_images[mode - 1]);
+    }
+    else
+    {
+        display_rect_t dirty;
+
+        (void)display_blit_changed_rle(DISPLAY_MODE_X, DISPLAY_MODE_Y,
+                                       mode_images[s_shown_mode - 1], mode_images[mode - 1], &dirty);
+    }
+    s_shown_mode = mode;
 }
 
 void display_show_level(uint8_t level)
 {
     
-    if (level < LEVEL_MIN || level > LEVEL_MAX)
+    if (level < LEVEL_MIN || level > LEVEL_MAX || !asset_is_valid())
     {
         return;
     }
 
-    LCD_ShowPartialImage16Gray(
-        DISPLAY_LEVEL_X, 
-        DISPLAY_LEVEL_Y, 
-        DISPLAY_LEVEL_WIDTH, 
-        DISPLAY_LEVEL_HEIGHT, 
-        level_images[level - 1]  
-    );
+    if (level != s_shown_level)
+    {
+        if (s_shown_level == 0U)
+        {
+            LCD_ShowImage16GrayRle(DISPLAY_LEVEL_X, DISPLAY_LEVEL_Y, level_images[level - 1]);
+            s_hourglass_valid = 0U;
+            s_time_text_valid = 0U;
+        }
+        else
+        {
+            display_rect_t dirty;
+            const display_rect_t hourglass = {
+                DISPLAY_HOURGLASS_X, DISPLAY_HOURGLASS_Y,
+                DISPLAY_HOURGLASS_X + DISPLAY_HOURGLASS_SIZE - 1U, DISPLAY_HOURGLASS_Y + DISPLAY_HOURGLASS_SIZE - 1U
+            };
+
+            if (display_blit_changed_rle(DISPLAY_LEVEL_X, DISPLAY_LEVEL_Y,
+                                         level_images[s_shown_level - 1], level_images[level - 1], &dirty))
+            {
+                /* 叠加在档位图片上的沙漏和时间文字被覆盖时需重绘 */
+                if (display_rect_overlap(&dirty, &hourglass))
+                {
+                    s_hourglass_valid = 0U;
+                }
+                if (s_time_text_valid && display_rect_overlap(&dirty, &s_time_text_rect))
+                {
+                    s_time_text_valid = 0U;
+                }
+            }
+        }
+        s_shown_level = level;
+    }
 
-    LCD_ShowPartialImageBytes(126-40,DISPLAY_LEVEL_Y,40,40,gImage_shalou_40x40);
+    if (!s_hourglass_valid)
+    {
+        display_show_hourglass();
+    }
 }
 
 void display_show_time_text(uint32_t remaining_ms, uint32_t total_ms)
@@ -325,15 +540,18 @@ void display_show_time_text(uint32_t remaining_ms, uint32_t total_ms)
     uint32_t pixel_count = (uint32_t)text_width * text_height;
     uint32_t buffer_bytes = (pixel_count + 1U) / 2U;
     uint8_t fill_byte = (uint8_t)((TIME_TEXT_BACKGROUND_GRAY << 4) | TIME_TEXT_BACKGROUND_GRAY);
+    uint8_t *buffer = s_time_gray_buffer[s_time_buffer_index];
+    const uint8_t *previous = s_time_gray_buffer[s_time_buffer_index ^ 1U];
+    LCD_WaitSourceRead();
     for (uint32_t i = 0; i < buffer_bytes; i++)
     {
-        s_time_gray_buffer[i] = fill_byte;
+        buffer[i] = fill_byte;
     }
 
     uint16_t pen_x = 0;
     for (uint8_t i = 0; i < char_count; i++)
     {
-        time_text_render_char(s_time_gray_buffer, text_width, pen_x, str[i]);
+        time_text_render_char(buffer, text_width, pen_x, str[i]);
         pen_x += char_widths[i];
         if (i + 1U < char_count)
         {
@@ -341,12 +559,30 @@ void display_show_time_text(uint32_t remaining_ms, uint32_t total_ms)
         }
     }
 
-    LCD_ShowPartialImage16Gray(start_x, start_y, text_width, text_height, s_time_gray_buffer);
+    display_rect_t text_rect = { start_x, start_y, start_x + text_width - 1U, start_y + text_height - 1U };
+
+    /* 位置和尺寸不变时只发送变化的数字，否则整块重绘 */
+    if (s_time_text_valid &&
+        (text_width & 1U) == 0U &&
+        memcmp(&text_rect, &s_time_text_rect, sizeof(text_rect)) == 0)
+    {
+        display_rect_t dirty;
+        (void)display_blit_changed(start_x, start_y, text_width, text_height, previous, buffer, &dirty);
+    }
+    else
+    {
+        LCD_ShowPartialImage16Gray(start_x, start_y, text_width, text_height, buffer);
+    }
+
+    s_time_text_rect = text_rect;
+    s_time_text_valid = 1U;
+    s_time_buffer_index ^= 1U;
 }
 
 void display_clear(void)
 {
     LCD_Clear(0x0000);  
+    display_invalidate();
 }
 
 void display_refresh(uint8_t mode, uint8_t level)
@@ -354,3 +590,17 @@ void display_refresh(uint8_t mode, uint8_t level)
     display_show_mode(mode);
     display_show_level(level);
 }
+
+/* 整屏刷新基准：清屏后重绘模式、档位和时间，返回含DMA发送完成在内的DWT周期数（DWT由LCD_Init使能） */
+uint32_t display_benchmark_full_refresh(uint8_t mode, uint8_t level, uint32_t remaining_ms, uint32_t total_ms)
+{
+    uint32_t start;
+
+    LCD_WaitIdle();
+    start = DWT->CYCCNT;
+    display_clear();
+    display_refresh(mode, level);
+    display_show_time_text(remaining_ms, total_ms);
+    LCD_WaitIdle();
+    return DWT->CYCCNT - start;
+}
@@ -46,6 +46,9 @@ void display_show_time_text(uint32_t remaining_ms, uint32_t total_ms);
 
 void display_clear(void);
 
+void display_invalidate(void);
+
 void display_refresh(uint8_t mode, uint8_t level);
+uint32_t display_benchmark_full_refresh(uint8_t mode, uint8_t level, uint32_t remaining_ms, uint32_t total_ms);
 
 #endif
@@ -0,0 +1,54 @@
+#include "dma_buf.h"
+
+static uint8_t s_dma_buf_pool[DMA_BUF_POOL_SIZE] __attribute__((at(DMA_BUF_POOL_ADDR)));
+static uint32_t s_dma_buf_used = 0U;
+
+void *dma_buf_alloc(uint32_t size)
+{
+    uint32_t offset = (s_dma_buf_used + DMA_BUF_ALIGN - 1U) & ~(DMA_BUF_ALIGN - 1U);
+
+    if (size == 0U || size > DMA_BUF_POOL_SIZE || offset > DMA_BUF_POOL_SIZE - size)
+    {
+        return 0;
+    }
+
+    s_dma_buf_used = offset + size;
+    return &s_dma_buf_pool[offset];
+}
+
+uint32_t dma_buf_get_free(void)
+{
+    return DMA_BUF_POOL_SIZE - s_dma_buf_used;
+}
+
+uint8_t dma_buf_is_uncached(const void *addr)
+{
+    uint32_t a = (uint32_t)addr;
+
+    if (a >= DMA_BUF_POOL_ADDR && a < DMA_BUF_POOL_ADDR + DMA_BUF_POOL_SIZE) return 1U;
+    if (a < 0x00010000U) return 1U;                             /* ITCM */
+    if (a >= 0x20000000U && a < 0x20020000U) return 1U;         /* DTCM */
+    return 0U;
+}
+
+void dma_buf_clean(const void *addr, uint32_t size)
+{
+    uint32_t a = (uint32_t)addr;
+
+    if (size == 0U || dma_buf_is_uncached(addr))
+    {
+        return;
+    }
+    SCB_CleanDCache_by_Addr((uint32_t *)(a & ~0x1FU), (int32_t)(size + (a & 0x1FU)));
+}
+
+void dma_buf_invalidate(void *addr, uint32_t size)
+{
+    uint32_t a = (uint32_t)addr;
+
+    if (size == 0U || dma_buf_is_uncached(addr))
+    {
+        return;
+    }
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(a & ~0x1FU), (int32_t)(size + (a & 0x1FU)));
+}
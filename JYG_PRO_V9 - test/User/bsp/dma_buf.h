@@ -0,0 +1,28 @@
+#ifndef __DMA_BUF_H
+#define __DMA_BUF_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/* DMA缓冲池：位于AXI SRAM起始处（DMA1/DMA2D均可访问），由MPU设为不可缓存，
+ * 其中的缓冲区CPU写入后可直接交给DMA发送，DMA接收完成后可直接读取
+ * 大小需为2的幂且基地址按大小对齐（MPU区域要求）
+ */
+#define DMA_BUF_POOL_ADDR           0x24000000U
+#define DMA_BUF_POOL_SIZE           (64U * 1024U)
+#define DMA_BUF_POOL_MPU_SIZE       MPU_REGION_SIZE_64KB
+#define DMA_BUF_ALIGN               32U     /* 按Cache行对齐 */
+
+/* 从缓冲池分配（只分配不释放，初始化时调用），空间不足时返回NULL */
+void *dma_buf_alloc(uint32_t size);
+uint32_t dma_buf_get_free(void);
+uint8_t dma_buf_is_uncached(const void *addr);
+
+/* 缓冲池之外的可缓存内存交给DMA前后使用：
+ * clean：DMA读取前把CPU写入的数据写回内存
+ * invalidate：DMA写入后丢弃Cache中的旧数据（缓冲区需按Cache行对齐，否则会破坏相邻数据）
+ * 地址位于缓冲池或TCM时直接返回
+ */
+void dma_buf_clean(const void *addr, uint32_t size);
+void dma_buf_invalidate(void *addr, uint32_t size);
+
+#endif
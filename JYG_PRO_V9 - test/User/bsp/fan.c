@@ -266,3 +266,16 @@ void fan_process(void)
     }
 }
 
+/* 距延时关闭的剩余时间（毫秒），没有待执行的延时关闭时返回0xFFFFFFFF */
+uint32_t fan_get_delay_remaining(void)
+{
+    int32_t diff;
+
+    if (!s_delay_pending)
+    {
+        return 0xFFFFFFFFUL;
+    }
+
+    diff = (int32_t)(s_delay_deadline - HAL_GetTick());
+    return (diff > 0) ? (uint32_t)diff : 0U;
+}
@@ -44,5 +44,6 @@ uint8_t fan_get_speed(void);
 fan_level_t fan_get_level(void);
 void fan_schedule_delay_off(uint32_t delay_ms);
 void fan_process(void);
+uint32_t fan_get_delay_remaining(void);
 
 #endif
@@ -0,0 +1,68 @@
+#include "i2c_callback.h"
+
+typedef struct
+{
+    I2C_HandleTypeDef *hi2c;
+    i2c_callback_fn_t master_tx_cplt;
+    i2c_callback_fn_t error;
+} i2c_callback_entry_t;
+
+static i2c_callback_entry_t s_entries[I2C_CALLBACK_MAX_HANDLES];
+static uint8_t s_entry_count = 0U;
+
+static i2c_callback_entry_t *i2c_callback_find(const I2C_HandleTypeDef *hi2c)
+{
+    for (uint8_t i = 0U; i < s_entry_count; i++)
+    {
+        if (s_entries[i].hi2c == hi2c)
+        {
+            return &s_entries[i];
+        }
+    }
+    return 0;
+}
+
+void i2c_callback_register(I2C_HandleTypeDef *hi2c, i2c_callback_fn_t master_tx_cplt, i2c_callback_fn_t error)
+{
+    i2c_callback_entry_t *entry = i2c_callback_find(hi2c);
+    uint8_t is_new = 0U;
+
+    if (entry == 0)
+    {
+        if (s_entry_count >= I2C_CALLBACK_MAX_HANDLES)
+        {
+            return;
+        }
+        entry = &s_entries[s_entry_count];
+        is_new = 1U;
+    }
+
+    entry->master_tx_cplt = master_tx_cplt;
+    entry->error = error;
+    if (is_new)
+    {
+        /* 处理函数填好后再计入，中断中不会查到未填完的条目 */
+        entry->hi2c = hi2c;
+        s_entry_count++;
+    }
+}
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    const i2c_callback_entry_t *entry = i2c_callback_find(hi2c);
+
+    if (entry != 0 && entry->master_tx_cplt != 0)
+    {
+        entry->master_tx_cplt(hi2c);
+    }
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    const i2c_callback_entry_t *entry = i2c_callback_find(hi2c);
+
+    if (entry != 0 && entry->error != 0)
+    {
+        entry->error(hi2c);
+    }
+}
@@ -0,0 +1,16 @@
+#ifndef __I2C_CALLBACK_H
+#define __I2C_CALLBACK_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/* HAL的I2C发送完成/错误回调是全局函数，整个工程只能定义一次；
+ * 在此统一定义，按I2C句柄分发到各模块登记的处理函数，未登记的实例忽略
+ */
+#define I2C_CALLBACK_MAX_HANDLES    3U
+
+typedef void (*i2c_callback_fn_t)(I2C_HandleTypeDef *hi2c);
+
+/* 同一句柄重复登记时覆盖原处理函数；不需要的回调传0 */
+void i2c_callback_register(I2C_HandleTypeDef *hi2c, i2c_callback_fn_t master_tx_cplt, i2c_callback_fn_t error);
+
+#endif
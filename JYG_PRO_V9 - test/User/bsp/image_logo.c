@@ -1,6 +1,8 @@
+/* 由 User/SCRIPT/image_rle.py 根据 image_logo_raw.c 生成，请勿手工修改 */
 #include "image_logo.h"
+#include "asset.h"
 
-const unsigned char gImage_shalou_40x40[3200] = { /* 0X10,0X10,0X00,0X28,0X00,0X28,0X01,0X1B, */
+const unsigned char gImage_shalou_40x40[3200] ASSET_SECTION = {
 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
@@ -200,5820 +202,1268 @@ const unsigned char gImage_shalou_40x40[3200] = { /* 0X10,0X10,0X00,0X28,0X00,0X
 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
 0X00,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X00,0X00,0X00,
 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,};
 
-const unsigned char gImage_mode2_126x174[10962] = { 
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0XB8,0X64,0X21,0X00,0X00,0X01,0X24,0X69,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XA6,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X05,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,
-0X50,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE8,0X10,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0XEF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X08,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X2B,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X6F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XC2,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X00,0X02,0XCF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFA,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0X00,0X00,0X0A,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X70,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X00,0X00,0X00,0X8F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XDF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,0X00,0X00,0X00,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XAF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XC0,0X00,0X00,0X00,0X00,0X00,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X6F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF5,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XD1,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XB0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFD,0X30,0X00,0X00,0X00,0X00,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF9,0X10,0X00,0X00,0X00,0X02,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X02,0X43,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFB,0X74,0X23,0X47,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XE0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X03,0XCF,0XFF,0XF9,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XC0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X04,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X8B,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X1B,0XFF,0XFF,0XFF,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X29,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X81,0X06,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF2,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X5A,0XDC,0X82,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X06,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X50,0X00,0X02,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XE0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X35,0X79,0X9A,0X97,0X52,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XB0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XBF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X4F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X06,0XCF,0XEB,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X6F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0XCF,
-0XFF,0XFF,0XF9,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X8F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XB0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0B,0XFF,0XFF,
-0XFF,0XFF,0X70,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XBF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XE0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X4F,0XFF,0XFF,0XFF,
-0XFF,0XF1,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF2,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,
-0XF5,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X25,0X40,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XF7,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X4D,0XFF,0XFF,0X90,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFC,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X02,0XEF,0XFF,0XFF,0XFC,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X19,0XFF,0XFE,0X80,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X02,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X6F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X01,0XBF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X08,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X05,0XAC,0XB7,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFA,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X70,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF6,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X50,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF6,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X70,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X7F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFA,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XC2,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X02,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,
-0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X1B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE6,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X06,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE8,
-0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X18,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,
-0X50,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X5A,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XA6,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X26,0XAF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFE,0XB8,0X64,0X21,0X00,0X00,0X01,0X24,0X68,0XBE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XEF,0XFF,0XDE,0XFF,0XDD,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0XEF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF8,0X7F,0XFF,0X69,0XFF,0X58,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF9,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0XFF,0XFF,0XD1,0X9D,0XDE,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X5A,0XFF,0X66,0X56,0X54,0X36,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF6,0X7F,0X97,0X24,0X7E,0X1C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XBA,
-0XA2,0X5A,0XAA,0XAA,0XBF,0XFF,0XFF,0XFF,0XFF,0XF2,0XBF,0XFE,0X40,0X23,0X31,0XBF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0XDF,0X47,0X92,0X5A,0XBD,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X93,0X5D,0X97,0X24,0X7F,0X16,0X67,0XFF,0XFF,0XFF,0XFF,0XFB,0X02,0X22,
-0X22,0X22,0X22,0X0C,0XFF,0XFF,0XFF,0XFF,0XF7,0X2E,0XF8,0X3E,0XFE,0X25,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF2,0XC7,0X8A,0XC2,0X6A,0X97,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X20,0X02,0XED,0X47,0XFC,0X57,0X25,0XFF,0XFF,0XFF,0XFF,0XFB,0X0F,0XFF,0XFF,
-0XFE,0XFF,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0X19,0XA0,0X7B,0XCA,0X0C,0XCE,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFD,0XF8,0X85,0X00,0X02,0X88,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XD3,0XA5,0X92,0X12,0X61,0X8F,0X8B,0XFF,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFF,
-0XFF,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XBD,0X94,0X22,0X10,0X32,0X09,0XFF,0XFF,0XFF,
-0XFF,0XFC,0XBD,0XFF,0X95,0XA3,0X86,0X7B,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,
-0XB6,0X67,0X68,0X70,0X4F,0X6E,0XFF,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFF,0XFF,
-0X1C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0X80,0XFD,0X49,0XFF,0XFF,0XFF,0XFF,
-0XF5,0X02,0X91,0X5C,0XF6,0XDF,0X81,0X4E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X86,0X97,
-0X78,0X78,0X99,0X2F,0X3F,0XFF,0XFF,0XFF,0XFF,0XFB,0X07,0X76,0X66,0X66,0X77,0X0C,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XCE,0XB4,0X55,0X30,0X55,0X11,0X7F,0XFF,0XFF,0XFF,0XFD,
-0XA0,0XB9,0X46,0X43,0X36,0XBE,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X58,0X89,0X82,
-0X23,0X5E,0X1E,0X1F,0XFF,0XFF,0XFF,0XFF,0XFB,0X03,0X33,0X33,0X33,0X33,0X0C,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X37,0XC6,0X77,0X40,0X87,0X22,0X8F,0XFF,0XFF,0XFF,0XFF,0XE2,
-0XCF,0X95,0X29,0XB0,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X93,0X2B,0XCB,0X08,
-0XDF,0X54,0X4F,0XFF,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFF,0XFF,0X0C,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X0C,0XFC,0XCC,0X80,0XDC,0X39,0XFF,0XFF,0XFF,0XFF,0XFF,0XD2,0XCF,
-0XF5,0X6F,0XF2,0X43,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X08,0XF5,0X12,0X7F,
-0XC0,0XBF,0XFF,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFF,0XFF,0X0C,0XFF,0XFF,0XFF,
-0XFF,0XFA,0X1F,0XE1,0X12,0X10,0X21,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,0XCF,0XA0,
-0XCF,0XFF,0XE2,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X17,0X72,0X75,0X2B,0XA0,
-0XBF,0XFF,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFF,0XFF,0X1C,0XFF,0XFF,0XFF,0XFF,
-0XF3,0X8F,0XFD,0XDD,0X90,0XED,0X9C,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0XDD,0X0A,0XFF,
-0X97,0X62,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X91,0XE9,0X0F,0X69,0XFC,0X08,0X1F,
-0XFF,0XFF,0XFF,0XFF,0XFB,0X07,0X77,0X77,0X77,0X77,0X0C,0XFF,0XFF,0XFF,0XFF,0XD1,
-0XBF,0XFF,0XFF,0XB0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X23,0X37,0X9F,0XFF,0XA6,
-0X6D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X19,0XF7,0XAF,0X59,0XE2,0X8F,0X54,0XFF,
-0XFF,0XFF,0XFF,0XFA,0X03,0X33,0X33,0X33,0X32,0X0C,0XFF,0XFF,0XFF,0XFF,0XFA,0XEF,
-0XFE,0X76,0X12,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X3F,0X61,0X43,0X33,0X45,0X33,
-0X5E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XBF,0XFF,0XFF,0X8B,0XB8,0XFF,0XE7,0XFF,0XFF,
-0XFF,0XFF,0XFC,0X6F,0XFF,0XFF,0XFF,0XFF,0X6D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0X62,0X4D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XEF,0XFC,0X98,0X77,0X88,0X87,0XAF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XEE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFA,0X33,0X32,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X82,0X11,
-0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF6,0X04,0X55,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X04,0X98,0X0E,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFA,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,
-0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X7F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF5,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X1F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X7F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XB8,0XC6,0X24,0XBF,0XFF,0XFF,0XFF,0XFF,0X93,0X25,0XCF,0XFF,0XFF,0XFF,0X71,
-0X15,0X8F,0XFF,0XFF,0XFE,0X82,0X27,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X1F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X06,0XEF,0XFF,0XFF,0XFF,0XFF,
-0X70,0X13,0X62,0X0A,0XFF,0XFF,0XFF,0XF6,0X04,0X62,0X0C,0XFF,0XFF,0XFF,0X51,0X03,
-0X6E,0XFF,0XFF,0XF3,0X16,0X54,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X02,0X32,0X3F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X19,0XFF,0XFF,0XFF,0XFF,0X80,
-0X6F,0XFF,0X13,0XFF,0XFF,0XFF,0X90,0X9F,0XFE,0X34,0XFF,0XFF,0XFF,0XF5,0X3F,0XFF,
-0XFF,0XFF,0X80,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X05,0X55,0X6F,0XFF,
-0XFF,0XFF,0X24,0X44,0XDF,0XFF,0XFF,0XFF,0XFC,0X40,0X4F,0XFF,0XFF,0XFF,0X80,0XCF,
-0XFF,0X70,0XBF,0XFF,0XFF,0X51,0XEF,0XFF,0X80,0XDF,0XFF,0XFF,0XF5,0X3F,0XFF,0XFF,
-0XFF,0XD2,0X18,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X1F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X35,0X55,0XDF,0XFF,0XFF,0XFF,0XFF,0XF9,0X08,0XFF,0XFF,0XFF,0X81,0XDF,0XFF,
-0X80,0XAF,0XFF,0XFE,0X33,0XEF,0XFF,0X90,0XDF,0XFF,0XFF,0XF4,0X3F,0XFF,0XFF,0XFF,
-0XFD,0X40,0X19,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X23,0XFF,0XFF,0XFF,0X80,0XCF,0XFF,0X51,
-0XDF,0XFF,0XFF,0X50,0XEF,0XFF,0X80,0XDF,0XFF,0XFF,0XF4,0X3F,0XFF,0XFF,0XFF,0XFF,
-0XFD,0X50,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XE8,0XDF,0XFB,0X08,0XFF,0XFF,0XFF,0X80,0X6F,0XFC,0X05,0XFF,
-0XFF,0XFF,0XA0,0X7F,0XFC,0X16,0XFF,0XFF,0XFF,0XF4,0X2F,0XFF,0XFF,0XFF,0XCC,0XFF,
-0XC0,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XE0,0X02,0X10,0X3F,0XFF,0XFF,0XFF,0X80,0X11,0X30,0X3E,0XFF,0XFF,
-0XFF,0XF7,0X01,0X30,0X3D,0XFF,0XFF,0XFF,0XFA,0X01,0X5E,0XFF,0XFF,0X80,0X23,0X04,
-0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFB,0X85,0X6A,0XFF,0XFF,0XFF,0XFF,0X81,0XB8,0X58,0XEF,0XFF,0XFF,0XFF,
-0XFF,0XB6,0X59,0XEF,0XFF,0XFF,0XFF,0XFF,0X95,0X9F,0XFF,0XFF,0XE9,0X55,0X9E,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X81,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X92,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0XED,0XCC,0XBB,0XAA,0X99,0X88,0X77,0X66,0X55,0X54,0X44,0X33,0X32,0X22,0X11,0X11,
-0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X11,0X12,0X22,
-0X23,0X33,0X34,0X45,0X55,0X66,0X77,0X88,0X99,0XAA,0XBB,0XCC,0XDE,0XEF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,};
+/* 126x174，原始10962字节 */
+static const unsigned char s_gImage_mode1_126x174_rle[2950] ASSET_SECTION = {
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0X84,0X50,0X00,0X20,0XC0,0XFF,0X4F,0XC0,0X80,0XC0,0XFF,0X07,0X90,
+0X02,0X30,0XFF,0X4E,0XA0,0X02,0XA0,0XFF,0X06,0X80,0X03,0XE0,0XFF,0X10,0XA0,0X60,
+0X90,0XFF,0X2A,0X40,0X02,0X40,0XFF,0X06,0XB0,0X03,0X90,0XFF,0X0F,0XA0,0X02,0X80,
+0XFF,0X29,0X30,0X02,0X20,0XFF,0X07,0X10,0X02,0X30,0XFF,0X0F,0X50,0X02,0X30,0XFF,
+0X29,0X20,0X03,0XFF,0X07,0X60,0X03,0XD0,0XFF,0X0E,0X60,0X03,0XFF,0X29,0X04,0XB0,
+0XFF,0X06,0XB0,0X03,0X60,0XFF,0X0E,0X80,0X03,0XFF,0X28,0XC0,0X04,0X70,0XFF,0X07,
+0X20,0X03,0XE0,0XFF,0X0D,0XA0,0X03,0XD0,0XFF,0X27,0X80,0X04,0X20,0XFF,0X07,0X80,
+0X03,0X70,0XFF,0X0D,0XC0,0X03,0XB0,0XFF,0X27,0X20,0X05,0XD0,0XFF,0X07,0X04,0XE0,
+0XFF,0X0C,0XE0,0X03,0X90,0XFF,0X26,0XC0,0X06,0X60,0XFF,0X07,0X70,0X03,0X60,0XFF,
+0X0D,0X03,0X80,0XFF,0X26,0X40,0X07,0XE0,0XFF,0X06,0XE0,0X04,0XD0,0XFF,0X0C,0X03,
+0X70,0XFF,0X25,0XB0,0X08,0X50,0XFF,0X07,0X80,0X03,0X30,0XFF,0X0C,0X20,0X02,0X60,
+0XFF,0X24,0XE0,0X10,0X03,0XB0,0X10,0X03,0XB0,0XFF,0X07,0X20,0X03,0X80,0XFF,0X0B,
+0X30,0X02,0X40,0XFF,0X24,0X20,0X03,0X40,0XF0,0X90,0X03,0X10,0XD0,0XFF,0X06,0XB0,
+0X04,0XC0,0XFF,0X0A,0X40,0X02,0X30,0XFF,0X22,0XE0,0X30,0X04,0XE0,0XF1,0X30,0X03,
+0X20,0XD0,0XFF,0X06,0X60,0X03,0X20,0XE0,0XFF,0X09,0X50,0X02,0X20,0XFF,0X21,0XB0,
+0X10,0X04,0XB0,0XF2,0XD0,0X04,0X10,0XB0,0XFF,0X06,0X20,0X03,0X40,0XFF,0X09,0X60,
+0X02,0X10,0XFF,0X1F,0XE0,0X60,0X05,0X90,0XF4,0XB0,0X05,0X50,0XD0,0XFF,0X04,0XC0,
+0X04,0X50,0XFF,0X08,0X70,0X03,0XFF,0X1D,0XE0,0X70,0X06,0X90,0XF6,0XA0,0X06,0X30,
+0X80,0XB0,0XE0,0XFF,0X01,0X90,0X04,0X60,0XFF,0X07,0X70,0X03,0XFF,0X1A,0XE0,0X90,
+0X40,0X07,0XA0,0XF8,0XB0,0X09,0X60,0XFF,0X01,0X60,0X04,0X50,0XFF,0X06,0X80,0X03,
+0XFF,0X19,0XD0,0X10,0X07,0X30,0XD0,0XFA,0XD0,0X30,0X08,0XB0,0XFF,0X01,0X50,0X04,
+0X30,0XE0,0XFF,0X04,0X80,0X03,0XFF,0X19,0X70,0X08,0XA0,0XFD,0X30,0X07,0XB0,0XFF,
+0X02,0X40,0X04,0X10,0XC0,0XFF,0X03,0X80,0X03,0XFF,0X19,0X90,0X09,0X30,0XD0,0XF9,
+0XB0,0X20,0X07,0X30,0XFF,0X04,0X50,0X05,0X70,0XFF,0X02,0X80,0X03,0XFF,0X1A,0X40,
+0X0A,0X90,0XF7,0X80,0X07,0X50,0XB0,0XFF,0X06,0X70,0X05,0X20,0XB0,0XFF,0X00,0X90,
+0X03,0XFF,0X1B,0XE0,0XC0,0XA0,0X60,0X20,0X06,0X70,0XF5,0X60,0X05,0X10,0X80,0XFF,
+0X0A,0XA0,0X06,0X30,0XB0,0XFD,0X80,0X03,0XFF,0X20,0XC0,0X50,0X05,0X80,0XF3,0X50,
+0X05,0X80,0XFF,0X0D,0XD0,0X20,0X06,0X20,0X90,0XE0,0XFA,0X70,0X03,0XFF,0X22,0XC0,
+0X20,0X04,0XB0,0XF1,0X70,0X04,0X20,0XD0,0XFF,0X10,0X80,0X08,0X40,0X90,0XE0,0XF7,
+0X70,0X02,0X10,0XFF,0X23,0XE0,0X30,0X03,0X10,0XF0,0XB0,0X04,0X50,0XFF,0X13,0XD0,
+0X40,0X08,0X10,0XE0,0XF6,0X60,0X02,0X20,0XFF,0X25,0X20,0X03,0X70,0X10,0X03,0X50,
+0XFF,0X16,0XC0,0X40,0X07,0X90,0XF6,0X50,0X02,0X20,0XFF,0X25,0XD0,0X08,0X30,0XFF,
+0X19,0XD0,0X60,0X10,0X04,0X90,0XF6,0X30,0X02,0X40,0XFF,0X26,0X70,0X07,0XD0,0XFF,
+0X1C,0X90,0X03,0XA0,0XF6,0X20,0X02,0X50,0XFF,0X26,0XE0,0X06,0X70,0XFF,0X1D,0XC0,
+0X03,0XB0,0XF6,0X03,0X70,0XFF,0X27,0X60,0X05,0XE0,0XFF,0X1D,0XB0,0X03,0XC0,0XF5,
+0XE0,0X03,0X90,0XFF,0X27,0XB0,0X04,0X50,0XFF,0X1E,0X90,0X03,0XE0,0XF5,0XB0,0X03,
+0XB0,0XFF,0X28,0X04,0XA0,0XFF,0X1E,0X70,0X03,0XF6,0X80,0X03,0XE0,0XFF,0X28,0X30,
+0X03,0XD0,0XFF,0X04,0XE0,0X30,0X00,0X20,0XB0,0XFC,0XE0,0X70,0X10,0X00,0X60,0XF2,
+0X50,0X02,0X10,0XF6,0X60,0X02,0X10,0XFF,0X29,0X50,0X03,0XFF,0X05,0X70,0X03,0X30,
+0XA0,0XF8,0XA0,0X50,0X04,0XB0,0XF1,0X30,0X02,0X30,0XF6,0X20,0X02,0X40,0XFF,0X29,
+0X70,0X03,0XFF,0X05,0X60,0X06,0X30,0X60,0X70,0X80,0X70,0X60,0X30,0X07,0XA0,0XF1,
+0X10,0X02,0X60,0XF5,0XE0,0X03,0X80,0XFF,0X29,0X80,0X02,0X10,0XFF,0X05,0XC0,0X0F,
+0X05,0X20,0XF1,0XE0,0X03,0X80,0XF5,0X90,0X03,0XC0,0XFF,0X0D,0XB0,0X20,0X00,0X60,
+0XFF,0X08,0XC0,0X02,0X50,0XFF,0X06,0XD0,0X40,0X0F,0X01,0X10,0X80,0XF2,0XB0,0X03,
+0XB0,0XF5,0X40,0X02,0X10,0XFF,0X0E,0X10,0X02,0XA0,0XFF,0X08,0XB0,0X60,0X80,0XFF,
+0X09,0XB0,0X50,0X0C,0X40,0XA0,0XF4,0X80,0X03,0XE0,0XF4,0XE0,0X03,0X60,0XFF,0X0E,
+0X03,0X20,0XFF,0X26,0XE0,0XA0,0X60,0X40,0X10,0X01,0X10,0X20,0X40,0X70,0XA0,0XE0,
+0XF6,0X50,0X02,0X10,0XF5,0X90,0X03,0XB0,0XFF,0X0E,0X50,0X03,0X90,0XFF,0X39,0X20,
+0X02,0X40,0XF5,0X20,0X02,0X10,0XFF,0X0F,0XD0,0X03,0X10,0XF8,0XB0,0X01,0X40,0XFF,
+0X2B,0XE0,0X03,0X70,0XF4,0XB0,0X03,0X70,0XFF,0X10,0X60,0X03,0X70,0XF7,0X20,0X02,
+0X90,0XFF,0X2A,0XA0,0X03,0XB0,0XF4,0X40,0X03,0XD0,0XFF,0X10,0XE0,0X04,0XD0,0XF6,
+0X10,0X02,0X50,0XFF,0X2A,0X60,0X03,0XF4,0XC0,0X03,0X40,0XFF,0X12,0X70,0X03,0X40,
+0XF6,0X40,0X02,0X20,0XFF,0X2A,0X20,0X02,0X30,0XF4,0X50,0X03,0XB0,0XFF,0X13,0X10,
+0X03,0XB0,0XF5,0X70,0X03,0XE0,0XFF,0X28,0XD0,0X03,0X70,0XF3,0XD0,0X03,0X20,0XFF,
+0X14,0XA0,0X03,0X20,0XF5,0XB0,0X03,0XA0,0XFF,0X28,0X80,0X03,0XC0,0XF3,0X60,0X03,
+0XA0,0XFF,0X15,0X40,0X03,0X70,0XF5,0X03,0X60,0XFF,0X28,0X30,0X02,0X10,0XF3,0XD0,
+0X03,0X10,0XFF,0X16,0XD0,0X04,0XC0,0XF4,0X30,0X02,0X10,0XFF,0X27,0XE0,0X03,0X60,
+0XF3,0X60,0X03,0X90,0XFF,0X17,0X70,0X03,0X20,0XF4,0X80,0X03,0XC0,0XFF,0X26,0X90,
+0X03,0XB0,0XF2,0XD0,0X03,0X10,0XFF,0X19,0X20,0X03,0X70,0XF3,0XD0,0X03,0X60,0XFF,
+0X26,0X30,0X03,0XF3,0X60,0X03,0X80,0XFF,0X19,0XC0,0X04,0XB0,0XF3,0X20,0X02,0X10,
+0XFF,0X25,0XD0,0X03,0X50,0XF2,0XE0,0X03,0X10,0XFF,0X1B,0X70,0X03,0X10,0XE0,0XF2,
+0X80,0X03,0XA0,0XFF,0X24,0X60,0X03,0XB0,0XF2,0X70,0X03,0X80,0XFF,0X1C,0X30,0X03,
+0X30,0XF2,0XE0,0X03,0X30,0XFF,0X24,0X03,0X10,0XF3,0X03,0X10,0XFF,0X1D,0XD0,0X04,
+0X70,0XF2,0X50,0X03,0XB0,0XFF,0X22,0X80,0X03,0X80,0XF2,0X80,0X03,0X70,0XFF,0X1E,
+0XA0,0X04,0X90,0XF1,0XC0,0X03,0X30,0XFF,0X22,0X10,0X03,0XE0,0XF2,0X20,0X03,0XE0,
+0XFF,0X1F,0X70,0X04,0XB0,0XF1,0X30,0X03,0XB0,0XFF,0X20,0X90,0X03,0X60,0XF2,0XC0,
+0X03,0X60,0XFF,0X21,0X40,0X04,0XC0,0XF0,0XB0,0X03,0X20,0XFF,0X20,0X10,0X03,0XD0,
+0XF2,0X60,0X03,0XD0,0XFF,0X21,0XE0,0X20,0X04,0XD0,0XF0,0X40,0X03,0X90,0XFF,0X1E,
+0X90,0X03,0X50,0XF3,0X10,0X02,0X30,0XFF,0X23,0XD0,0X10,0X03,0X10,0XC0,0XD0,0X04,
+0XE0,0XFF,0X1C,0XE0,0X10,0X03,0XD0,0XF2,0XC0,0X03,0X90,0XFF,0X24,0XC0,0X05,0XB0,
+0X60,0X03,0X40,0XFF,0X1C,0X60,0X03,0X60,0XF3,0X80,0X03,0XE0,0XFF,0X25,0XB0,0X05,
+0X80,0X10,0X03,0X80,0XF9,0XD0,0X90,0XD0,0XFF,0X00,0XC0,0XA0,0XD0,0XF9,0XC0,0X04,
+0XE0,0XF3,0X50,0X02,0X20,0XFF,0X27,0XB0,0X05,0X30,0X04,0XC0,0XF7,0XA0,0X02,0X30,
+0X90,0XE0,0XFA,0XB0,0X30,0X02,0XC0,0XF8,0X04,0X80,0XF4,0X20,0X02,0X50,0XFF,0X28,
+0XC0,0X0A,0X10,0XE0,0XF6,0X40,0X05,0X20,0X60,0X80,0XB1,0XC0,0XB0,0XA0,0X80,0X50,
+0X05,0X60,0XF7,0X50,0X03,0X10,0XF5,0X03,0X80,0XFF,0X29,0XD0,0X20,0X09,0X30,0XF6,
+0X50,0X0F,0X06,0X70,0XF6,0XB0,0X05,0XB0,0XF3,0XE0,0X03,0X90,0XFF,0X2A,0XE0,0X40,
+0X09,0X30,0XF5,0XD0,0X30,0X0F,0X04,0X40,0XE0,0XF5,0XD0,0X10,0X06,0XB0,0XF2,0XD0,
+0X03,0XA0,0XFF,0X2C,0X90,0X09,0X20,0XF6,0XC0,0X60,0X0F,0X00,0X40,0XB0,0XF7,0X20,
+0X08,0X80,0XF1,0XE0,0X03,0XA0,0XFF,0X2D,0XE0,0X50,0X08,0X50,0XF8,0XB0,0X70,0X40,
+0X10,0X06,0X20,0X50,0X90,0XE0,0XF8,0X40,0X0A,0X40,0XE0,0XF0,0X03,0X80,0XFF,0X2F,
+0XD0,0X60,0X07,0X40,0XFC,0XD0,0XC1,0XD1,0XFC,0X50,0X04,0XB0,0XC0,0X10,0X05,0X80,
+0X10,0X02,0X30,0XFF,0X32,0XA0,0X60,0X10,0X04,0X30,0XE0,0XFF,0X0C,0X50,0X04,0X90,
+0XF1,0XD0,0X20,0X0A,0XD0,0XFF,0X34,0X50,0X04,0X10,0XD0,0XFF,0X0A,0X40,0X04,0X70,
+0XF4,0X50,0X09,0X50,0XFF,0X35,0X60,0X05,0XA0,0XFF,0X07,0XE0,0X30,0X04,0X60,0XF6,
+0XA0,0X10,0X08,0X80,0XFF,0X35,0X70,0X05,0X60,0XFF,0X05,0XB0,0X10,0X04,0X60,0XF9,
+0X70,0X08,0XB0,0XFF,0X35,0XA0,0X05,0X20,0XC0,0XFF,0X02,0X70,0X05,0X70,0XFB,0XE0,
+0X60,0X06,0X80,0XFF,0X36,0XC0,0X10,0X05,0X60,0XE0,0XFD,0XC0,0X20,0X05,0X90,0XFE,
+0XE0,0X70,0X10,0X03,0XC0,0XFF,0X37,0XE0,0X40,0X05,0X10,0X90,0XFA,0XD0,0X50,0X05,
+0X10,0XB0,0XFF,0X03,0XA0,0X60,0X50,0XA0,0XFF,0X3A,0X80,0X06,0X20,0XA0,0XF6,0XD0,
+0X60,0X06,0X30,0XE0,0XFF,0X53,0XD0,0X30,0X06,0X20,0XA0,0XF2,0XB0,0X40,0X07,0X80,
+0XFF,0X57,0X80,0X07,0X10,0X50,0X10,0X07,0X40,0XD0,0XFF,0X59,0XE0,0X60,0X0E,0X30,
+0XB0,0XFF,0X5D,0XD0,0X50,0X0A,0X20,0XA0,0XFF,0X61,0XD0,0X60,0X06,0X50,0XC0,0XFF,
+0X65,0XE0,0X70,0X20,0X00,0X30,0X90,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XE2,0XE0,0XF2,0XE1,0XF2,0XD0,0XFF,0X00,0XC0,0XD0,0XFF,0X01,0XD0,
+0XFF,0X0A,0XD0,0XFF,0X24,0X80,0X60,0XF2,0X80,0XA0,0XF1,0XB0,0X10,0XE0,0XFD,0XE0,
+0X00,0XB0,0XFF,0X00,0XC0,0X30,0XD0,0XF0,0XE0,0X90,0X64,0X90,0XFE,0XD0,0X10,0XB0,
+0XFF,0X23,0X51,0XF0,0XB0,0X80,0X20,0X40,0X70,0XC0,0X90,0X60,0XFB,0XC0,0XB0,0XD0,
+0X60,0X00,0XB0,0XC2,0XB0,0XC0,0XE0,0XF9,0XD0,0X10,0XE0,0XF0,0XB0,0X00,0X40,0X70,
+0X60,0X70,0X30,0X00,0XD0,0XF7,0XE0,0X40,0X20,0X33,0X00,0X10,0X40,0X32,0X20,0X90,
+0XFF,0X1C,0XC0,0X30,0X50,0XE0,0X90,0X40,0X20,0X30,0X40,0XB0,0X60,0X50,0X70,0X90,
+0XF8,0XD0,0X11,0X20,0X00,0X21,0X14,0X70,0XF8,0X80,0X40,0X10,0X50,0X90,0XB0,0X00,
+0X80,0XC0,0XA0,0XC0,0X60,0X10,0XD0,0XF8,0XA0,0X90,0XA0,0X92,0XB0,0XA0,0X94,0XC0,
+0XFF,0X1B,0XE0,0X40,0X00,0X10,0X30,0XD1,0X50,0X70,0XD0,0XE0,0X30,0X40,0X20,0X30,
+0XF8,0XC0,0X10,0XC1,0XD1,0XC3,0XD0,0X30,0X50,0XF8,0X70,0X20,0X00,0X20,0X70,0XB0,
+0X10,0X40,0X62,0X30,0X10,0XD0,0XFA,0X80,0X50,0X64,0X50,0X60,0XE0,0XFF,0X1E,0XC0,
+0X40,0X90,0X40,0X80,0X50,0X10,0X20,0X50,0X60,0X30,0XD0,0X90,0XA0,0XF8,0XC0,0X20,
+0XF8,0X50,0X60,0XF9,0XD0,0X20,0XF1,0XB0,0X00,0X70,0XB2,0X60,0X00,0XD0,0XFA,0X30,
+0X70,0XB0,0XA3,0X90,0X40,0XB0,0XFF,0X1E,0XB0,0X50,0XC0,0X40,0X71,0X60,0X81,0X01,
+0XD0,0X90,0XD0,0XF8,0XC0,0X20,0XF8,0X50,0X60,0XF9,0XE0,0X20,0X80,0XA0,0XE0,0X20,
+0X30,0X40,0X30,0X40,0X20,0X30,0XFB,0X40,0X30,0X54,0X40,0X20,0XD0,0XFF,0X1E,0X80,
+0X60,0XA0,0X40,0X80,0X90,0X70,0XA0,0X90,0X50,0X40,0XC0,0X80,0XF9,0XC0,0X10,0X80,
+0X97,0X20,0X60,0XF9,0XA0,0X01,0X50,0XC0,0XA0,0XC0,0XE2,0XC0,0XA0,0XC0,0XF9,0XE0,
+0X81,0XA4,0X90,0X80,0XD0,0XFF,0X1E,0X50,0XA0,0X90,0X60,0XA0,0X21,0X30,0X00,0XB0,
+0X90,0XA0,0X80,0XF9,0XD0,0X01,0X17,0X00,0X70,0XF8,0X60,0X01,0XB1,0X00,0X60,0X40,
+0X30,0X40,0X30,0X41,0X10,0XD0,0XF7,0X60,0X20,0X30,0X56,0X40,0X21,0XA0,0XFF,0X1C,
+0X80,0X50,0X30,0X90,0XE0,0X70,0X00,0X70,0XA0,0XD0,0XB0,0X30,0X60,0XF9,0XC0,0X20,
+0XD8,0X40,0X60,0XF7,0XE0,0X70,0X80,0X20,0XF1,0XB0,0X60,0XA0,0XB0,0X10,0XB0,0XC2,
+0XF7,0XE0,0X00,0X50,0XC0,0XB0,0XA4,0XB0,0XC0,0XB0,0X00,0X70,0XFF,0X1D,0X90,0X00,
+0X80,0XF0,0X80,0X00,0X30,0X90,0XE0,0XF0,0X10,0X70,0XF9,0XC0,0X20,0XF8,0X50,0X60,
+0XF9,0XD0,0X20,0XD0,0XF0,0XB0,0X30,0XF1,0X20,0X70,0X80,0X70,0XA0,0XF8,0X90,0XD0,
+0XF0,0XB0,0X30,0X42,0X30,0X70,0XF1,0XB0,0XD0,0XFF,0X1D,0X90,0X00,0X60,0XA0,0X30,
+0X51,0X20,0X50,0XF0,0X10,0X80,0XF9,0XC0,0X30,0XF8,0X50,0X60,0XF9,0XD0,0X20,0XD0,
+0XF0,0X60,0X10,0XF1,0X10,0X42,0X80,0XFB,0X70,0X20,0XB1,0XC0,0X50,0X30,0XF2,0XC0,
+0XFF,0X1C,0XB0,0X00,0XC1,0X00,0XA0,0X70,0XA0,0XF0,0XC0,0X42,0XF9,0XC0,0X10,0X80,
+0X97,0X20,0X60,0XFA,0X20,0XE0,0XF0,0X20,0X10,0X40,0XA0,0X30,0XFE,0XD0,0X10,0X70,
+0XF2,0X80,0X40,0XF1,0XA0,0X20,0XE0,0XFF,0X1A,0XE0,0X10,0X70,0XF0,0X70,0X60,0XF0,
+0X60,0X90,0XF0,0X60,0X10,0XE0,0X60,0X40,0XF8,0XC0,0X01,0X17,0X00,0X50,0XF8,0X90,
+0X50,0X10,0XD0,0X30,0X40,0XD0,0X40,0X01,0X50,0X70,0X60,0X40,0XD0,0XF7,0X90,0X60,
+0X00,0X30,0XE0,0XF2,0X90,0X00,0X70,0X80,0X20,0X60,0XFF,0X1B,0XE0,0XA0,0XF1,0XE0,
+0XF1,0X70,0XB0,0XE0,0X30,0XC0,0XF0,0XC0,0X50,0XF8,0XD0,0X50,0XD3,0XE0,0XD1,0XE1,
+0X70,0X80,0XF8,0X40,0X00,0X80,0XB0,0X20,0XE0,0XF1,0XB0,0X80,0X50,0X42,0XE0,0XF6,
+0XD0,0X10,0X00,0X80,0XE0,0XF4,0X70,0X21,0X40,0XE0,0XFF,0X49,0XE1,0XF1,0XE0,0XFF,
+0X02,0XD0,0XE0,0XF7,0XE1,0XFF,0XFF,0XFF,0X1A,0XD0,0XFB,0XE0,0XC0,0XFF,0X10,0XD0,
+0XFF,0X2E,0XB0,0X60,0X50,0X40,0X50,0XA0,0XF8,0XA0,0X00,0XA0,0XFA,0X90,0X10,0XC0,
+0XFF,0X0E,0X80,0X10,0XB0,0XFF,0X2D,0X60,0X00,0X10,0X30,0X01,0X70,0XF7,0XC0,0X40,
+0XC0,0XFA,0X90,0X00,0XC0,0XF6,0XC0,0X80,0XE0,0XFF,0X04,0XB0,0X50,0XD0,0XFF,0X2D,
+0X60,0X10,0XD0,0XF0,0XE0,0X50,0X00,0XD0,0XFF,0X05,0XA0,0X10,0XD0,0XF6,0X60,0X10,
+0XFF,0X45,0X60,0X10,0XF2,0X80,0X00,0XD0,0XF1,0XA0,0XD0,0X90,0X60,0XF0,0XE0,0XA0,
+0XE0,0XF2,0XC0,0X60,0X40,0XA0,0XD0,0XB0,0XF1,0X90,0X10,0XC0,0X90,0X40,0X70,0XE0,
+0XF1,0XA0,0X30,0X00,0X80,0XB0,0XF2,0XA0,0X51,0XB0,0XF2,0XC0,0XB0,0XD0,0X60,0X40,
+0XA0,0XF2,0XD0,0XA0,0XF2,0XB0,0XE0,0XA0,0X40,0X70,0XD0,0XF3,0XC0,0X60,0X40,0XA0,
+0XD0,0XB0,0XFF,0X1B,0X60,0X10,0XD0,0XE0,0XC0,0X30,0X60,0XF1,0XC0,0X00,0X11,0X40,
+0XF0,0XA0,0X00,0XA0,0XF1,0X90,0X00,0X20,0X40,0X12,0XE0,0XF0,0XA0,0X00,0X30,0X20,
+0X40,0X00,0X20,0XF0,0XE0,0X40,0X01,0X20,0X50,0XF1,0X60,0X00,0X40,0X30,0X00,0X90,
+0XF1,0X50,0X00,0X32,0X00,0X80,0XF1,0X90,0X00,0XD0,0XF0,0XE0,0X10,0X30,0X20,0X40,
+0X00,0X20,0XE0,0XF1,0XA0,0X00,0X10,0X40,0X20,0X00,0X30,0XE0,0XFF,0X1A,0X70,0X01,
+0X10,0X00,0X20,0XF2,0XD0,0X10,0X00,0XD0,0XF1,0XB0,0X00,0XB0,0XF0,0XC0,0X00,0X40,
+0XF1,0XD0,0X10,0X20,0XE0,0XF0,0XA0,0X00,0X40,0XF1,0XA0,0X00,0XC0,0XF1,0X60,0X20,
+0XE0,0XF1,0XB0,0X00,0XB0,0XF1,0X70,0X10,0XE0,0XF0,0X60,0X00,0X90,0XF1,0X40,0X00,
+0XE0,0XF0,0X90,0X00,0XE0,0XF1,0X00,0X10,0XE0,0XF0,0XA0,0X00,0X60,0XF0,0XE0,0X10,
+0X30,0XE0,0XF0,0XD0,0X10,0X20,0XE0,0XFF,0X1A,0X70,0X00,0X60,0X80,0X70,0X20,0X30,
+0XE0,0XF0,0XD0,0X00,0X60,0XF2,0XB0,0X00,0XB0,0XF0,0X80,0X00,0XD0,0XF2,0X80,0X10,
+0XE0,0XF0,0X90,0X10,0XC0,0XF2,0X10,0X80,0XF1,0X60,0X20,0XF1,0XE0,0X21,0XC0,0XA1,
+0X80,0X00,0XA0,0XF0,0X60,0X10,0XF2,0X90,0X00,0XD0,0XF0,0X90,0X00,0XE0,0XF0,0XE0,
+0X00,0X80,0XF2,0X20,0X40,0XF0,0XA0,0X00,0XB0,0XF2,0X80,0X20,0XE0,0XFF,0X1A,0X60,
+0X10,0XF2,0XB0,0X00,0X80,0XF0,0XD0,0X00,0X70,0XF2,0XB0,0X00,0XB0,0XF0,0X70,0X10,
+0XE0,0XF2,0X90,0X10,0XE0,0XF0,0X90,0X10,0XD0,0XF2,0X20,0X80,0XF1,0X60,0X10,0XE0,
+0XF0,0XD0,0X05,0X10,0XB0,0XF0,0X60,0X20,0XF2,0X90,0X00,0XD0,0XF0,0X90,0X00,0XE0,
+0XF0,0XE0,0X10,0X90,0XF2,0X20,0X50,0XF0,0X80,0X00,0XC0,0XF2,0XA0,0X20,0XE0,0XFF,
+0X1A,0X60,0X10,0XE0,0XF2,0X10,0X60,0XF0,0XD0,0X00,0X70,0XF2,0XB0,0X00,0XB0,0XF0,
+0X70,0X10,0XE0,0XF2,0X70,0X10,0XE0,0XF0,0XA0,0X10,0XC0,0XF1,0XE0,0X20,0X90,0XF1,
+0X60,0X20,0XF1,0XE0,0X00,0X30,0XE0,0XD1,0XE0,0XF2,0X60,0X10,0XF2,0X90,0X00,0XD0,
+0XF0,0X90,0X00,0XE0,0XF0,0XE0,0X10,0X80,0XF2,0X20,0X50,0XF0,0X80,0X00,0XC0,0XF2,
+0X80,0X20,0XE0,0XFF,0X1A,0X60,0X10,0XD0,0XF0,0XE0,0X80,0X00,0XA0,0XF0,0XD0,0X00,
+0X70,0XF2,0XB0,0X00,0XB0,0XF0,0XA0,0X00,0X80,0XF1,0XD0,0X00,0X20,0XE0,0XF0,0X90,
+0X00,0XC0,0XF1,0XE0,0X10,0X90,0XF1,0X60,0X10,0XF2,0X80,0X00,0XC0,0XF2,0XD0,0XF1,
+0X60,0X10,0XF2,0X90,0X00,0XD0,0XF0,0X90,0X00,0XD0,0XF0,0XE0,0X00,0X90,0XF2,0X20,
+0X50,0XF0,0XC0,0X00,0X60,0XF1,0XD0,0X10,0X20,0XE0,0XFF,0X1A,0X60,0X00,0X10,0X20,
+0X01,0X60,0XF1,0XC0,0X00,0X60,0XF2,0XA0,0X00,0XA0,0XF1,0X40,0X00,0X40,0X60,0X22,
+0XE0,0XF0,0X90,0X00,0XC0,0XF1,0XE0,0X00,0X80,0XF1,0X90,0X00,0X40,0X80,0XF0,0XE0,
+0X20,0X00,0X61,0X00,0X30,0XF1,0X40,0X00,0XF2,0X80,0X00,0XD0,0XF0,0X80,0X00,0XD0,
+0XF0,0XE0,0X00,0X80,0XF2,0X00,0X30,0XF1,0X60,0X00,0X40,0X60,0X30,0X20,0X30,0XE0,
+0XFF,0X1A,0XB0,0X70,0X62,0XA0,0XF2,0XE0,0X70,0XB0,0XF2,0XD0,0X70,0XD0,0XF2,0X70,
+0X31,0XA0,0X90,0X10,0XE0,0XF0,0XC0,0X80,0XE0,0XF2,0X80,0XC0,0XF2,0X80,0X30,0X70,
+0XF1,0XE0,0X60,0X30,0X20,0X60,0XD0,0XF1,0XA0,0X80,0XF2,0XC0,0X70,0XE0,0XF0,0XC0,
+0X70,0XF2,0X80,0XC0,0XF2,0X80,0XA0,0XF2,0X80,0X31,0X90,0XA0,0X20,0XE0,0XFF,0X33,
+0X40,0X20,0XFF,0X26,0X41,0XFF,0X2E,0XE0,0X70,0XC0,0XF0,0XE0,0X60,0X00,0X90,0XFF,
+0X20,0XE0,0X90,0XB0,0XF0,0XE0,0X80,0X00,0X90,0XFF,0X2E,0XD0,0X13,0X00,0X80,0XFF,
+0X22,0X40,0X00,0X12,0X70,0XFF,0X30,0XB0,0X70,0X50,0X60,0XA0,0XFF,0X23,0XC0,0X70,
+0X51,0XA0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0X93,0XE1,0XD0,0XC1,0XB1,0XA1,0X91,0X81,0X71,0X61,0X51,0X42,0X33,0X23,0X13,
+0X0F,0X08,0X13,0X23,0X33,0X41,0X52,0X61,0X71,0X81,0X92,0XA0,0XB1,0XC1,0XD0,0XE1,
+0XFF,0XFF,0XFF,0XFF,0XFF,0X57,};
+const image_rle_t gImage_mode1_126x174 = { s_gImage_mode1_126x174_rle, sizeof(s_gImage_mode1_126x174_rle), 126, 174 };
 
-const unsigned char gImage_mode1_126x174[10962] = { 
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X02,0XCF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC8,
-0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X3F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X0A,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X0E,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA6,0X9F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X04,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X00,0X09,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X08,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X02,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X03,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X03,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,0X00,0X00,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X00,0XBF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XB0,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X80,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFE,0X10,0X00,0X0B,0X10,0X00,0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF2,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X30,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,
-0X00,0X00,0X4F,0X90,0X00,0X01,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFB,0X00,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X40,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X30,0X00,
-0X00,0XEF,0XF3,0X00,0X00,0X2D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X60,0X00,0X02,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X50,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB1,0X00,0X00,0X0B,
-0XFF,0XFD,0X00,0X00,0X01,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF2,0X00,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X60,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE6,0X00,0X00,0X00,0X9F,0XFF,
-0XFF,0XB0,0X00,0X00,0X05,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,
-0X00,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,
-0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0X00,0X00,0X00,0X09,0XFF,0XFF,0XFF,
-0XFA,0X00,0X00,0X00,0X03,0X8B,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,
-0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,
-0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X94,0X00,0X00,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,
-0XB0,0X00,0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,
-0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X0F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XD1,0X00,0X00,0X00,0X00,0X3D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,
-0X30,0X00,0X00,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,
-0X00,0X3E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X0F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X70,0X00,0X00,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,
-0X00,0X00,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,
-0X01,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X0F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X90,0X00,0X00,0X00,0X00,0X03,0XDF,0XFF,0XFF,0XFF,0XFF,0XFB,0X20,0X00,
-0X00,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,
-0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X0F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,0X09,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X00,0X00,
-0X05,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0X00,
-0X2B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XEC,0XA6,0X20,0X00,0X00,0X00,0X7F,0XFF,0XFF,0XF6,0X00,0X00,0X00,0X18,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X00,0X00,
-0X3B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFC,0X50,0X00,0X00,0X08,0XFF,0XFF,0X50,0X00,0X00,0X08,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X20,0X00,0X00,0X00,
-0X29,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFC,0X20,0X00,0X00,0XBF,0XF7,0X00,0X00,0X02,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X00,0X00,
-0X04,0X9E,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XE3,0X00,0X00,0X1F,0XB0,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD4,0X00,0X00,0X00,0X00,
-0X01,0XEF,0XFF,0XFF,0XFF,0X60,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X20,0X00,0X07,0X10,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC4,0X00,0X00,0X00,0X00,
-0X9F,0XFF,0XFF,0XFF,0X50,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XD0,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD6,0X10,0X00,0X00,0X9F,
-0XFF,0XFF,0XFF,0X30,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0X00,0X00,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0XAF,0XFF,
-0XFF,0XFF,0X20,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0X00,0X00,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0XBF,0XFF,0XFF,
-0XFF,0X00,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,
-0X00,0X00,0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X00,0XCF,0XFF,0XFF,0XFE,
-0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X00,
-0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0XEF,0XFF,0XFF,0XFB,0X00,
-0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X00,
-0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0XFF,0XFF,0XFF,0XF8,0X00,0X00,
-0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X30,0X2B,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFE,0X71,0X06,0XFF,0XF5,0X00,0X01,0XFF,0XFF,0XFF,0XF6,0X00,0X01,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0X3A,0XFF,0XFF,0XFF,0XFF,
-0XFA,0X50,0X00,0X00,0XBF,0XF3,0X00,0X03,0XFF,0XFF,0XFF,0XF2,0X00,0X04,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0X00,0X03,0X67,0X87,0X63,0X00,
-0X00,0X00,0X00,0XAF,0XF1,0X00,0X06,0XFF,0XFF,0XFF,0XE0,0X00,0X08,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X01,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X02,0XFF,0XE0,0X00,0X08,0XFF,0XFF,0XFF,0X90,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X20,0X6F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD4,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,
-0X8F,0XFF,0XB0,0X00,0X0B,0XFF,0XFF,0XFF,0X40,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB6,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB5,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0XAF,0XFF,
-0XFF,0X80,0X00,0X0E,0XFF,0XFF,0XFE,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEA,0X64,0X10,0X01,0X24,0X7A,0XEF,0XFF,0XFF,0XFF,
-0X50,0X00,0X1F,0XFF,0XFF,0XF9,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,
-0X00,0X4F,0XFF,0XFF,0XF2,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XB0,0X04,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,
-0X7F,0XFF,0XFF,0XB0,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X9F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0XBF,
-0XFF,0XFF,0X40,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0X10,0X00,0X5F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0XFF,0XFF,
-0XFC,0X00,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0X4F,0XFF,0XFF,0XFF,0X40,0X00,0X2F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,0X00,0X03,0XFF,0XFF,0XF5,
-0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X0B,0XFF,0XFF,0XFF,0X70,0X00,0X0E,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X07,0XFF,0XFF,0XD0,0X00,
-0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XA0,0X00,0X02,0XFF,0XFF,0XFF,0XB0,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X0C,0XFF,0XFF,0X60,0X00,0X0A,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF4,0X00,0X00,0X7F,0XFF,0XFF,0XF0,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X1F,0XFF,0XFD,0X00,0X00,0X1F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFD,0X00,0X00,0X0C,0XFF,0XFF,0XF3,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X6F,0XFF,0XF6,0X00,0X00,0X9F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X70,0X00,0X02,0XFF,0XFF,0XF8,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0XBF,0XFF,0XD0,0X00,0X01,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF2,0X00,0X00,0X7F,0XFF,0XFD,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF3,0X00,0X00,0XFF,0XFF,0X60,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,
-0X00,0X00,0X0B,0XFF,0XFF,0X20,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XD0,0X00,0X05,0XFF,0XFE,0X00,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,
-0X00,0X01,0XEF,0XFF,0X80,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X60,0X00,0X0B,0XFF,0XF7,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,
-0X00,0X3F,0XFF,0XE0,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X00,0X00,0X1F,0XFF,0XF0,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,
-0X07,0XFF,0XF5,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,
-0X00,0X8F,0XFF,0X80,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X00,
-0X9F,0XFC,0X00,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,
-0XEF,0XFF,0X20,0X00,0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0X0B,
-0XFF,0X30,0X00,0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X06,0XFF,
-0XFC,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0XCF,
-0XB0,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X0D,0XFF,0XF6,
-0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,0X00,0X00,0X0D,0XF4,
-0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X5F,0XFF,0XF1,0X00,
-0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X10,0X00,0X01,0XCD,0X00,
-0X00,0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,0X00,0X00,0XDF,0XFF,0XC0,0X00,0X09,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X00,0X0B,0X60,0X00,
-0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X06,0XFF,0XFF,0X80,0X00,0X0E,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X81,0X00,0X00,
-0X8F,0XFF,0XFF,0XFF,0XFF,0XFD,0X9D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XCA,
-0XDF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X0E,0XFF,0XFF,0X50,0X00,0X2F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X00,0X00,0X03,0X00,0X00,0X0C,
-0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X39,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB3,0X00,0X0C,
-0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X00,0X8F,0XFF,0XFF,0X20,0X00,0X5F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X00,0X00,0X00,0X01,0XEF,
-0XFF,0XFF,0XFF,0X40,0X00,0X00,0X02,0X68,0XBB,0XCB,0XA8,0X50,0X00,0X00,0X06,0XFF,
-0XFF,0XFF,0XFF,0X50,0X00,0X01,0XFF,0XFF,0XFF,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD2,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,
-0XFF,0XFF,0X50,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X07,0XFF,0XFF,
-0XFF,0XFB,0X00,0X00,0X00,0XBF,0XFF,0XFE,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X40,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,
-0XFF,0XD3,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X4E,0XFF,0XFF,0XFF,
-0XD1,0X00,0X00,0X00,0X0B,0XFF,0XFD,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X00,0X00,0X00,0X2F,0XFF,0XFF,
-0XFF,0XC6,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X4B,0XFF,0XFF,0XFF,0XFF,0X20,
-0X00,0X00,0X00,0X00,0X8F,0XFE,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE5,0X00,0X00,0X00,0X00,0X05,0XFF,0XFF,0XFF,
-0XFF,0XFB,0X74,0X10,0X00,0X00,0X00,0X25,0X9E,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,
-0X00,0X00,0X00,0X04,0XEF,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD6,0X00,0X00,0X00,0X00,0X4F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDC,0XCD,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,0XBC,
-0X10,0X00,0X00,0X08,0X10,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X61,0X00,0X00,0X03,0XEF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0X09,0XFF,0XD2,
-0X00,0X00,0X00,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,0X1D,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X7F,0XFF,0XFF,0X50,
-0X00,0X00,0X00,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE3,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFA,0X10,
-0X00,0X00,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X10,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,
-0X00,0X00,0X00,0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0X00,0X2C,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE6,0X00,
-0X00,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC1,0X00,0X00,0X00,0X6E,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XC2,0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0X10,
-0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X40,0X00,0X00,0X01,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XD5,0X00,0X00,0X00,0X1B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X65,
-0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X00,0X02,0XAF,0XFF,0XFF,0XFF,0XD6,0X00,
-0X00,0X00,0X03,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0X00,0X00,0X00,0X02,0XAF,0XFF,0XB4,0X00,0X00,0X00,
-0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X00,0X00,0X01,0X51,0X00,0X00,0X00,0X00,0X4D,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X3B,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFD,0X50,0X00,0X00,0X00,0X00,0X00,0X2A,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFD,0X60,0X00,0X00,0X00,0X5C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0X72,0X03,0X9E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,0XEF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFC,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X86,0XFF,0XF8,0XAF,0XFB,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XE0,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X3D,0XFE,0X96,0X66,
-0X66,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD1,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X55,0XFB,0X82,0X47,0XC9,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,
-0XBD,0X60,0XBC,0XCC,0XBC,0XEF,0XFF,0XFF,0XFF,0XFF,0XFD,0X1E,0XFB,0X04,0X76,0X73,
-0X0D,0XFF,0XFF,0XFF,0XFF,0XE4,0X23,0X33,0X30,0X14,0X33,0X32,0X9F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFC,0X35,0XE9,0X42,0X34,0XB6,0X57,0X9F,0XFF,0XFF,0XFF,0XFF,0XD1,0X12,
-0X02,0X21,0X11,0X11,0X7F,0XFF,0XFF,0XFF,0XFF,0X84,0X15,0X9B,0X08,0XCA,0XC6,0X1D,
-0XFF,0XFF,0XFF,0XFF,0XFA,0X9A,0X99,0X9B,0XA9,0X99,0X99,0XCF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XE4,0X01,0X3D,0XD5,0X7D,0XE3,0X42,0X3F,0XFF,0XFF,0XFF,0XFF,0XC1,0XCC,0XDD,
-0XCC,0XCC,0XD3,0X5F,0XFF,0XFF,0XFF,0XFF,0X72,0X02,0X7B,0X14,0X66,0X63,0X1D,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF8,0X56,0X66,0X66,0X56,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFC,0X49,0X48,0X51,0X25,0X63,0XD9,0XAF,0XFF,0XFF,0XFF,0XFF,0XC2,0XFF,0XFF,0XFF,
-0XFF,0XF5,0X6F,0XFF,0XFF,0XFF,0XFF,0XFD,0X2F,0XFB,0X07,0XBB,0XB6,0X0D,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF3,0X7B,0XAA,0XAA,0X94,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,
-0X5C,0X47,0X76,0X88,0X00,0XD9,0XDF,0XFF,0XFF,0XFF,0XFF,0XC2,0XFF,0XFF,0XFF,0XFF,
-0XF5,0X6F,0XFF,0XFF,0XFF,0XFF,0XFE,0X28,0XAE,0X23,0X43,0X42,0X3F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF4,0X35,0X55,0X55,0X42,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X6A,
-0X48,0X97,0XA9,0X54,0XC8,0XFF,0XFF,0XFF,0XFF,0XFF,0XC1,0X89,0X99,0X99,0X99,0X92,
-0X6F,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X5C,0XAC,0XEE,0XEC,0XAC,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XE8,0X8A,0XAA,0XAA,0X98,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0XA9,0X6A,
-0X22,0X30,0XB9,0XA8,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X01,0X11,0X11,0X11,0X10,0X7F,
-0XFF,0XFF,0XFF,0XFF,0X60,0X0B,0XB0,0X64,0X34,0X34,0X41,0XDF,0XFF,0XFF,0XFF,0XF6,
-0X23,0X55,0X55,0X55,0X54,0X22,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X53,0X9E,0X70,
-0X7A,0XDB,0X36,0XFF,0XFF,0XFF,0XFF,0XFF,0XC2,0XDD,0XDD,0XDD,0XDD,0XD4,0X6F,0XFF,
-0XFF,0XFF,0XFE,0X78,0X2F,0XFB,0X6A,0XB1,0XBC,0XCC,0XFF,0XFF,0XFF,0XFF,0XE0,0X5C,
-0XBA,0XAA,0XAA,0XBC,0XB0,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X8F,0X80,0X39,
-0XEF,0X17,0XFF,0XFF,0XFF,0XFF,0XFF,0XC2,0XFF,0XFF,0XFF,0XFF,0XF5,0X6F,0XFF,0XFF,
-0XFF,0XFF,0XFD,0X2D,0XFB,0X3F,0XF2,0X78,0X7A,0XFF,0XFF,0XFF,0XFF,0XF9,0XDF,0XB3,
-0X44,0X43,0X7F,0XFB,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X6A,0X35,0X52,0X5F,
-0X18,0XFF,0XFF,0XFF,0XFF,0XFF,0XC3,0XFF,0XFF,0XFF,0XFF,0XF5,0X6F,0XFF,0XFF,0XFF,
-0XFF,0XFD,0X2D,0XF6,0X1F,0XF1,0X44,0X48,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X72,0XBB,
-0XC5,0X3F,0XFF,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X0C,0XC0,0XA7,0XAF,0XC4,0X44,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XC1,0X89,0X99,0X99,0X99,0X92,0X6F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X2E,0XF2,0X14,0XA3,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X17,0XFF,0XF8,
-0X4F,0XFA,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,0X7F,0X76,0XF6,0X9F,0X61,0XE6,0X4F,
-0XFF,0XFF,0XFF,0XFF,0XC0,0X01,0X11,0X11,0X11,0X10,0X5F,0XFF,0XFF,0XFF,0XFF,0X95,
-0X1D,0X34,0XD4,0X00,0X57,0X64,0XDF,0XFF,0XFF,0XFF,0XF9,0X60,0X3E,0XFF,0XF9,0X07,
-0X82,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEA,0XFF,0XEF,0XF7,0XBE,0X3C,0XFC,0X5F,0XFF,
-0XFF,0XFF,0XFF,0XD5,0XDD,0XDD,0XED,0XDE,0XE7,0X8F,0XFF,0XFF,0XFF,0XFF,0X40,0X8B,
-0X2E,0XFF,0XB8,0X54,0X44,0XEF,0XFF,0XFF,0XFF,0XD1,0X08,0XEF,0XFF,0XFF,0X72,0X24,
-0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEE,0XFF,0XEF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0XEF,0XFF,0XFF,0XFF,0XFE,0XEF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFD,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XB6,0X54,0X5A,0XFF,0XFF,0XFF,0XFF,0XFA,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF9,0X1C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X81,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X60,0X13,0X00,0X7F,0XFF,0XFF,0XFF,0XFC,0X4C,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,
-0X0C,0XFF,0XFF,0XFF,0XFC,0X8E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XB5,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X61,0XDF,0XE5,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X1D,
-0XFF,0XFF,0XFF,0XF6,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X61,
-0XFF,0XF8,0X0D,0XFF,0XAD,0X96,0XFE,0XAE,0XFF,0XFC,0X64,0XAD,0XBF,0XF9,0X1C,0X94,
-0X7E,0XFF,0XA3,0X08,0XBF,0XFF,0XA5,0X5B,0XFF,0XFC,0XBD,0X64,0XAF,0XFF,0XDA,0XFF,
-0XFB,0XEA,0X47,0XDF,0XFF,0XFC,0X64,0XAD,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X61,0XDE,
-0XC3,0X6F,0XFC,0X01,0X14,0XFA,0X0A,0XFF,0X90,0X24,0X11,0X1E,0XFA,0X03,0X24,0X02,
-0XFE,0X40,0X02,0X5F,0XF6,0X04,0X30,0X9F,0XF5,0X03,0X33,0X08,0XFF,0X90,0XDF,0XE1,
-0X32,0X40,0X2E,0XFF,0XA0,0X14,0X20,0X3E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X01,0X02,
-0XFF,0XFD,0X10,0XDF,0XFB,0X0B,0XFC,0X04,0XFF,0XD1,0X2E,0XFA,0X04,0XFF,0XA0,0XCF,
-0XF6,0X2E,0XFF,0XB0,0XBF,0XF7,0X1E,0XF6,0X09,0XFF,0X40,0XEF,0X90,0XEF,0XF0,0X1E,
-0XFA,0X06,0XFE,0X13,0XEF,0XD1,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X68,0X72,0X3E,
-0XFD,0X06,0XFF,0XFB,0X0B,0XF8,0X0D,0XFF,0XF8,0X1E,0XF9,0X1C,0XFF,0XF1,0X8F,0XF6,
-0X2F,0XFE,0X22,0XCA,0XA8,0X0A,0XF6,0X1F,0XFF,0X90,0XDF,0X90,0XEF,0XE0,0X8F,0XFF,
-0X24,0XFA,0X0B,0XFF,0XF8,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X61,0XFF,0XFB,0X08,0XFD,
-0X07,0XFF,0XFB,0X0B,0XF7,0X1E,0XFF,0XF9,0X1E,0XF9,0X1D,0XFF,0XF2,0X8F,0XF6,0X1E,
-0XFD,0X00,0X00,0X00,0X1B,0XF6,0X2F,0XFF,0X90,0XDF,0X90,0XEF,0XE1,0X9F,0XFF,0X25,
-0XF8,0X0C,0XFF,0XFA,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X61,0XEF,0XFF,0X16,0XFD,0X07,
-0XFF,0XFB,0X0B,0XF7,0X1E,0XFF,0XF7,0X1E,0XFA,0X1C,0XFF,0XE2,0X9F,0XF6,0X2F,0XFE,
-0X03,0XED,0XDE,0XFF,0XF6,0X1F,0XFF,0X90,0XDF,0X90,0XEF,0XE1,0X8F,0XFF,0X25,0XF8,
-0X0C,0XFF,0XF8,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X61,0XDF,0XE8,0X0A,0XFD,0X07,0XFF,
-0XFB,0X0B,0XFA,0X08,0XFF,0XD0,0X2E,0XF9,0X0C,0XFF,0XE1,0X9F,0XF6,0X1F,0XFF,0X80,
-0XCF,0XFF,0XDF,0XF6,0X1F,0XFF,0X90,0XDF,0X90,0XDF,0XE0,0X9F,0XFF,0X25,0XFC,0X06,
-0XFF,0XD1,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X12,0X00,0X6F,0XFC,0X06,0XFF,0XFA,
-0X0A,0XFF,0X40,0X46,0X22,0X2E,0XF9,0X0C,0XFF,0XE0,0X8F,0XF9,0X04,0X8F,0XE2,0X06,
-0X60,0X3F,0XF4,0X0F,0XFF,0X80,0XDF,0X80,0XDF,0XE0,0X8F,0XFF,0X03,0XFF,0X60,0X46,
-0X32,0X3E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB7,0X66,0X6A,0XFF,0XFE,0X7B,0XFF,0XFD,0X7D,
-0XFF,0XF7,0X33,0XA9,0X1E,0XFC,0X8E,0XFF,0XF8,0XCF,0XFF,0X83,0X7F,0XFE,0X63,0X26,
-0XDF,0XFA,0X8F,0XFF,0XC7,0XEF,0XC7,0XFF,0XF8,0XCF,0XFF,0X8A,0XFF,0XF8,0X33,0X9A,
-0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF4,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X4F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X7C,
-0XFE,0X60,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X9B,0XFE,0X80,0X9F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X11,0X11,
-0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X11,0X17,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB7,0X56,0XAF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X55,0XAF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0XED,0XCC,0XBB,0XAA,0X99,0X88,0X77,0X66,0X55,0X44,0X43,0X33,0X32,0X22,
-0X21,0X11,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X11,
-0X12,0X22,0X23,0X33,0X34,0X45,0X55,0X66,0X77,0X88,0X99,0X9A,0XBB,0XCC,0XDE,0XEF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,};
+/* 126x174，原始10962字节 */
+static const unsigned char s_gImage_mode2_126x174_rle[1935] ASSET_SECTION = {
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XF2,0XE0,0XB0,0X80,0X60,0X40,0X20,0X10,0X04,0X10,0X20,0X40,0X60,
+0X90,0XFF,0X5A,0XA0,0X60,0X20,0X0F,0X00,0X50,0XFF,0X57,0XA0,0X50,0X0F,0X04,0XB0,
+0XFF,0X54,0XE0,0X80,0X10,0X0F,0X05,0X10,0XFF,0X53,0XE0,0X70,0X0F,0X08,0X60,0XFB,
+0X90,0XE0,0XFF,0X44,0X80,0X0F,0X0A,0XA0,0XFA,0XC0,0X01,0X80,0XFF,0X41,0XB0,0X10,
+0X0F,0X0B,0XD0,0XFA,0X50,0X02,0X20,0XB0,0XFF,0X3E,0X60,0X0F,0X0D,0XFB,0X05,0X60,
+0XFF,0X3B,0XC0,0X20,0X0F,0X0D,0X10,0XFA,0XC0,0X06,0X20,0XC0,0XFF,0X38,0XA0,0X0F,
+0X0F,0X20,0XFA,0XA0,0X08,0XA0,0XFF,0X36,0X70,0X0F,0X10,0X20,0XFA,0X90,0X09,0X80,
+0XFF,0X34,0X60,0X0F,0X11,0X20,0XFA,0XA0,0X0A,0X60,0XFF,0X32,0X50,0X0F,0X12,0X10,
+0XFA,0XC0,0X0B,0X50,0XFF,0X30,0X60,0X0F,0X14,0XFB,0X0C,0X60,0XFF,0X2E,0X70,0X0F,
+0X15,0XD0,0XFA,0X50,0X0C,0X70,0XFF,0X2C,0XA0,0X0F,0X16,0XA0,0XFA,0XC0,0X0D,0XA0,
+0XFF,0X2A,0XC0,0X0F,0X17,0X60,0XFB,0X50,0X0D,0XC0,0XFF,0X29,0X20,0X0F,0X17,0X10,
+0XFB,0XE0,0X10,0X0C,0X20,0XFF,0X28,0X50,0X0F,0X19,0XB0,0XFB,0XD0,0X10,0X0C,0X60,
+0XFF,0X26,0XB0,0X0F,0X1A,0X50,0XFC,0XD0,0X30,0X0B,0X40,0XFF,0X26,0X10,0X0F,0X1B,
+0XE0,0XFD,0X90,0X10,0X07,0X20,0XA0,0XFF,0X26,0X80,0X0F,0X05,0X20,0X40,0X30,0X0F,
+0X04,0X60,0XFF,0X00,0XB0,0X70,0X40,0X20,0X30,0X40,0X70,0XC0,0XFF,0X27,0XE0,0X0F,
+0X04,0X30,0XC0,0XF3,0X90,0X0F,0X03,0XC0,0XFF,0X3E,0X60,0X0F,0X03,0X50,0XF6,0XC0,
+0X0F,0X02,0X30,0XFF,0X3D,0XE0,0X0F,0X03,0X10,0XF8,0X90,0X0F,0X02,0X60,0XFF,0X3C,
+0X80,0X0F,0X03,0X70,0XF9,0X0F,0X03,0XA0,0XFF,0X3B,0X10,0X0F,0X03,0XB0,0XF9,0X40,
+0X0F,0X03,0XB0,0XFF,0X39,0XA0,0X0F,0X04,0XC0,0XF9,0X50,0X0F,0X04,0XA0,0XFF,0X38,
+0X50,0X0F,0X04,0XA0,0XF9,0X20,0X0F,0X05,0X80,0XFF,0X37,0X0F,0X05,0X40,0XF8,0XD0,
+0X0F,0X07,0X40,0XE0,0XFF,0X34,0XA0,0X0F,0X06,0XB0,0XF7,0X40,0X0F,0X09,0X90,0XFF,
+0X06,0X80,0XB0,0XFF,0X1B,0X60,0X0F,0X06,0X10,0XB0,0XF5,0X60,0X0F,0X0B,0X20,0X90,
+0XFF,0X01,0XE0,0X80,0X10,0X00,0X60,0XFF,0X1B,0X20,0X0F,0X08,0X50,0XA0,0XD0,0XC0,
+0X80,0X20,0X0F,0X0F,0X60,0XB0,0XFB,0XA0,0X50,0X03,0X20,0XFF,0X1A,0XE0,0X0F,0X31,
+0X30,0X50,0X70,0X91,0XA0,0X90,0X70,0X50,0X20,0X07,0XE0,0XFF,0X19,0XB0,0X0F,0X43,
+0XB0,0XFF,0X19,0X80,0X0F,0X43,0X90,0XFF,0X19,0X60,0X0F,0X43,0X60,0XFF,0X19,0X40,
+0X0F,0X43,0X40,0XFF,0X19,0X20,0X0F,0X43,0X20,0XFF,0X19,0X10,0X0F,0X43,0X10,0XFF,
+0X19,0X0F,0X45,0XFF,0X19,0X0F,0X45,0XFF,0X19,0X0F,0X45,0XFF,0X19,0X0F,0X45,0XFF,
+0X19,0X0F,0X45,0XFF,0X19,0X10,0X0F,0X43,0X10,0XFF,0X19,0X20,0X0F,0X43,0X20,0XFF,
+0X19,0X40,0X0F,0X43,0X40,0XFF,0X19,0X60,0X0F,0X28,0X60,0XC0,0XF0,0XE0,0XB0,0X40,
+0X0F,0X05,0X60,0XFF,0X19,0X80,0X0F,0X26,0X10,0XC0,0XF5,0X90,0X0F,0X04,0X80,0XFF,
+0X19,0XB0,0X0F,0X26,0XB0,0XF7,0X70,0X0F,0X03,0XB0,0XFF,0X19,0XE0,0X0F,0X25,0X40,
+0XF9,0X10,0X0F,0X02,0XE0,0XFF,0X1A,0X20,0X0F,0X24,0X90,0XF9,0X50,0X0F,0X01,0X20,
+0XFF,0X1B,0X60,0X0F,0X0A,0X20,0X50,0X40,0X0F,0X07,0XA0,0XF9,0X70,0X0F,0X01,0X60,
+0XFF,0X1B,0XA0,0X0F,0X08,0X40,0XD0,0XF3,0X90,0X0F,0X05,0X90,0XF9,0X50,0X0F,0X01,
+0XB0,0XFF,0X1C,0X0F,0X07,0X60,0XF6,0XC0,0X0F,0X04,0X50,0XF9,0X10,0X0F,0X01,0XFF,
+0X1D,0X50,0X0F,0X05,0X20,0XF8,0X80,0X0F,0X04,0XD0,0XF7,0X90,0X0F,0X01,0X50,0XFF,
+0X1D,0XA0,0X0F,0X05,0X90,0XF9,0X0F,0X04,0X20,0XE0,0XF5,0XC0,0X0F,0X02,0XA0,0XFF,
+0X1E,0X10,0X0F,0X04,0XC0,0XF9,0X30,0X0F,0X04,0X10,0X90,0XF2,0XE0,0X80,0X0F,0X02,
+0X10,0XFF,0X1F,0X80,0X0F,0X04,0XD0,0XF9,0X40,0X0F,0X07,0X21,0X0F,0X04,0X70,0XFF,
+0X1F,0XE0,0X0F,0X04,0XB0,0XF9,0X10,0X0F,0X1D,0XE0,0XFF,0X20,0X60,0X0F,0X03,0X50,
+0XF8,0XC0,0X0F,0X1D,0X60,0XFF,0X21,0XE0,0X0F,0X04,0XC0,0XF7,0X30,0X0F,0X1D,0XE0,
+0XFF,0X22,0X80,0X0F,0X03,0X10,0XB0,0XF5,0X40,0X0F,0X1D,0X80,0XFF,0X24,0X10,0X0F,
+0X04,0X50,0XA0,0XC0,0XB0,0X70,0X10,0X0F,0X1D,0X10,0XFF,0X25,0XB0,0X0F,0X37,0XB0,
+0XFF,0X26,0X60,0X0F,0X35,0X60,0XFF,0X28,0X20,0X0F,0X33,0X20,0XFF,0X29,0XC0,0X0F,
+0X33,0XC0,0XFF,0X2A,0XA0,0X0F,0X31,0XA0,0XFF,0X2C,0X70,0X0F,0X2F,0X70,0XFF,0X2E,
+0X60,0X0F,0X2D,0X60,0XFF,0X30,0X50,0X0F,0X2B,0X50,0XFF,0X32,0X60,0X0F,0X29,0X60,
+0XFF,0X34,0X70,0X0F,0X27,0X70,0XFF,0X36,0XA0,0X0F,0X25,0XA0,0XFF,0X38,0XC0,0X20,
+0X0F,0X21,0X20,0XC0,0XFF,0X3B,0X60,0X0F,0X1F,0X60,0XFF,0X3E,0XB0,0X10,0X0F,0X1B,
+0X10,0XB0,0XFF,0X41,0X80,0X0F,0X19,0X80,0XFF,0X44,0XE0,0X60,0X0F,0X15,0X60,0XE0,
+0XFF,0X47,0XE0,0X80,0X10,0X0F,0X0F,0X10,0X80,0XE0,0XFF,0X4C,0XA0,0X50,0X0F,0X0B,
+0X50,0XA0,0XFF,0X52,0XA0,0X60,0X20,0X0F,0X03,0X20,0X60,0XA0,0XFF,0X58,0XE0,0XB0,
+0X80,0X60,0X40,0X20,0X10,0X04,0X10,0X20,0X40,0X60,0X80,0XB0,0XE0,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X5C,0XE1,0XF2,0XD0,0XE0,0XF1,0XD1,0XFF,
+0X00,0X80,0XFF,0X06,0XC0,0XE0,0XFF,0X3A,0X80,0X70,0XF2,0X60,0X90,0XF1,0X50,0X80,
+0XFE,0X90,0X00,0XFF,0X00,0XD0,0XF3,0XD0,0X10,0X90,0XD1,0XE0,0XFB,0X50,0XA0,0XF1,
+0X61,0X50,0X60,0X50,0X40,0X30,0X60,0XFF,0X1F,0X60,0X70,0XF0,0X90,0X70,0X20,0X40,
+0X70,0XE0,0X10,0XC0,0XFA,0XE0,0XB0,0XA1,0X20,0X50,0XA4,0XB0,0XF9,0X20,0XB0,0XF1,
+0XE0,0X40,0X00,0X20,0X31,0X10,0XB0,0XFA,0X80,0X00,0XD0,0XF0,0X40,0X70,0X90,0X20,
+0X50,0XA0,0XB0,0XD0,0XFF,0X1E,0X90,0X30,0X50,0XD0,0X90,0X70,0X20,0X40,0X70,0XF0,
+0X10,0X61,0X70,0XF8,0XB0,0X00,0X28,0X00,0XC0,0XF8,0X70,0X20,0XE0,0XF0,0X80,0X30,
+0XE0,0XF0,0XE0,0X20,0X50,0XFC,0X20,0XC0,0X70,0X80,0XA0,0XC0,0X20,0X60,0XA0,0X90,
+0X70,0XA0,0XFF,0X1D,0X20,0X01,0X20,0XE0,0XD0,0X40,0X70,0XF0,0XC0,0X50,0X70,0X20,
+0X50,0XF8,0XB0,0X00,0XF5,0XE0,0XF1,0X00,0XC0,0XF9,0X10,0X90,0XA0,0X00,0X70,0XB0,
+0XC0,0XA0,0X00,0XC1,0XE0,0XFA,0XD0,0XF0,0X81,0X50,0X02,0X20,0X81,0XA0,0XFF,0X1D,
+0XD0,0X30,0XA0,0X50,0X90,0X20,0X10,0X20,0X60,0X10,0X80,0XF0,0X80,0XB0,0XF8,0XB0,
+0X10,0XF8,0X00,0XC0,0XF9,0XB0,0XD0,0X90,0X40,0X21,0X10,0X00,0X30,0X20,0X00,0X90,
+0XF8,0XC0,0XB0,0XD0,0XF1,0X90,0X50,0XA0,0X30,0X80,0X60,0X70,0XB0,0XE0,0XFF,0X1D,
+0XD0,0X30,0XB0,0X61,0X70,0X60,0X80,0X70,0X00,0X40,0XF0,0X60,0XE0,0XF8,0XB0,0X10,
+0XF8,0X10,0XC0,0XFD,0XE0,0XF0,0X80,0X00,0XF0,0XD0,0X40,0X90,0XF8,0X50,0X00,0X20,
+0X90,0X10,0X50,0XC0,0XF0,0X60,0XD0,0XF0,0X80,0X10,0X40,0XE0,0XFF,0X1C,0X80,0X60,
+0X90,0X71,0X80,0X70,0X80,0X91,0X20,0XF0,0X30,0XF9,0XB0,0X00,0X71,0X64,0X71,0X00,
+0XC0,0XF9,0XC0,0XE0,0XB0,0X40,0X51,0X30,0X00,0X51,0X11,0X70,0XF7,0XD0,0XA0,0X00,
+0XB0,0X90,0X40,0X60,0X40,0X31,0X60,0XB0,0XE0,0XD0,0XFF,0X1D,0X50,0X81,0X90,0X80,
+0X21,0X30,0X50,0XE0,0X10,0XE0,0X10,0XF9,0XB0,0X00,0X38,0X00,0XC0,0XF9,0X30,0X70,
+0XC0,0X60,0X71,0X40,0X00,0X80,0X70,0X21,0X80,0XF8,0XE0,0X20,0XC0,0XF0,0X90,0X50,
+0X20,0X90,0XB0,0X00,0X60,0XFF,0X1F,0X90,0X30,0X20,0XB0,0XC0,0XB0,0X00,0X80,0XD0,
+0XF0,0X50,0X41,0XF9,0XB0,0X10,0XF8,0X00,0XC0,0XF9,0X00,0XC0,0XF0,0XC2,0X80,0X00,
+0XD0,0XC0,0X30,0X90,0XF9,0XD0,0X20,0XC0,0XF1,0X50,0X60,0XF1,0X20,0X40,0X30,0XA0,
+0XFF,0X1E,0XA0,0X00,0X80,0XF0,0X50,0X10,0X20,0X70,0XF0,0XC0,0X00,0XB0,0XF9,0XB0,
+0X10,0XF8,0X00,0XC0,0XF8,0XA0,0X10,0XF0,0XE0,0X11,0X20,0X10,0X00,0X20,0X10,0X00,
+0X90,0XF9,0XE0,0X20,0XC0,0XF0,0XA0,0X00,0XC0,0XF2,0XE0,0X20,0X90,0XFF,0X1E,0X80,
+0X10,0X71,0X20,0X70,0X50,0X20,0XB0,0XA0,0X00,0XB0,0XF9,0XB0,0X10,0XF8,0X10,0XC0,
+0XF8,0X30,0X80,0XF1,0XD2,0X90,0X00,0XE0,0XD0,0X90,0XC0,0XF9,0XC0,0X00,0XD1,0X00,
+0XA0,0XF1,0X90,0X70,0X60,0X20,0XE0,0XFF,0X1D,0X90,0X10,0XE0,0X90,0X00,0XF0,0X60,
+0X90,0XF0,0XC0,0X00,0X80,0X10,0XF9,0XB0,0X00,0X78,0X00,0XC0,0XF7,0XD0,0X10,0XB0,
+0XF4,0XB0,0X00,0XFC,0XC0,0X20,0X31,0X70,0X90,0XF2,0XA0,0X61,0XD0,0XFF,0X1E,0X10,
+0X90,0XF0,0X70,0XA0,0XF0,0X50,0X90,0XE0,0X20,0X80,0XF0,0X50,0X40,0XF8,0XA0,0X00,
+0X37,0X20,0X00,0XC0,0XF8,0XA0,0XE0,0XF1,0XE0,0X70,0X60,0X10,0X20,0XFC,0X70,0X30,
+0XF0,0X60,0X10,0X40,0X32,0X40,0X50,0X31,0X50,0XE0,0XFF,0X1C,0XB0,0XF4,0X80,0XB1,
+0X80,0XF1,0XE0,0X70,0XF8,0XC0,0X60,0XF8,0X60,0XD0,0XFC,0XE0,0X60,0X20,0X40,0XD0,
+0XFC,0XE1,0XF1,0XC0,0X90,0X80,0X71,0X82,0X70,0XA0,0XFF,0XFF,0XFF,0XA2,0XE1,0XFF,
+0X51,0XA0,0X32,0X20,0X10,0XFF,0X03,0X80,0X20,0X12,0XFF,0X50,0X60,0X00,0X40,0X51,
+0X30,0XFF,0X02,0X70,0X00,0X40,0X90,0X80,0X00,0XE0,0XFF,0X13,0XA0,0X70,0XFF,0X2A,
+0X70,0X10,0XFF,0X06,0X00,0X70,0XFF,0X18,0X50,0X30,0XFF,0X2A,0X70,0X10,0XFF,0X06,
+0X00,0X70,0XFA,0XB0,0X80,0XC0,0X60,0X20,0X40,0XB0,0XF8,0X90,0X30,0X20,0X50,0XC0,
+0XF6,0X70,0X11,0X50,0X80,0XF5,0XE0,0X80,0X21,0X70,0XE0,0XFF,0X1C,0X70,0X10,0XFF,
+0X06,0X50,0X00,0X60,0XE0,0XF8,0X70,0X00,0X10,0X30,0X60,0X20,0X00,0XA0,0XF6,0X60,
+0X00,0X40,0X60,0X20,0X00,0XC0,0XF5,0X50,0X10,0X00,0X30,0X60,0XE0,0XF4,0X30,0X10,
+0X60,0X50,0X40,0XC0,0XFF,0X1C,0X70,0X00,0X20,0X30,0X20,0X30,0XFF,0X03,0X60,0X00,
+0X10,0X90,0XF7,0X80,0X00,0X60,0XF2,0X10,0X30,0XF5,0X90,0X00,0X90,0XF1,0XE0,0X30,
+0X40,0XF6,0X50,0X30,0XF6,0X80,0X00,0XA0,0XFF,0X20,0X70,0X00,0X52,0X60,0XF6,0X20,
+0X42,0XD0,0XF7,0XC0,0X40,0X00,0X40,0XF6,0X80,0X00,0XC0,0XF2,0X70,0X00,0XB0,0XF4,
+0X50,0X10,0XE0,0XF2,0X80,0X00,0XD0,0XF5,0X50,0X30,0XF6,0XD0,0X20,0X10,0X80,0XE0,
+0XFF,0X1E,0X70,0X10,0XFA,0X30,0X52,0XD0,0XF9,0X90,0X00,0X80,0XF5,0X80,0X10,0XD0,
+0XF2,0X80,0X00,0XA0,0XF3,0XE0,0X31,0XE0,0XF2,0X90,0X00,0XD0,0XF5,0X40,0X30,0XF7,
+0XD0,0X40,0X00,0X10,0X90,0XFF,0X1D,0X70,0X10,0XFF,0X0B,0X20,0X30,0XF5,0X80,0X00,
+0XC0,0XF2,0X50,0X10,0XD0,0XF4,0X50,0X00,0XE0,0XF2,0X80,0X00,0XD0,0XF5,0X40,0X30,
+0XF9,0XD0,0X50,0X00,0XA0,0XFF,0X1C,0X70,0X00,0XE0,0XFF,0X04,0XE0,0X80,0XD0,0XF1,
+0XB0,0X00,0X80,0XF5,0X80,0X00,0X60,0XF1,0XC0,0X00,0X50,0XF5,0XA0,0X00,0X70,0XF1,
+0XC0,0X10,0X60,0XF6,0X40,0X20,0XF6,0XC1,0XF1,0XC0,0X00,0X80,0XFF,0X1C,0X60,0X10,
+0XE0,0XFF,0X04,0XE0,0X01,0X20,0X10,0X00,0X30,0XF6,0X80,0X00,0X11,0X30,0X00,0X30,
+0XE0,0XF6,0X70,0X00,0X10,0X30,0X00,0X30,0XD0,0XF6,0XA0,0X00,0X10,0X50,0XE0,0XF3,
+0X80,0X00,0X20,0X30,0X00,0X40,0XE0,0XFF,0X1C,0XD0,0XA0,0XFF,0X06,0XB0,0X80,0X50,
+0X60,0XA0,0XF7,0X80,0X10,0XB0,0X80,0X50,0X80,0XE0,0XF8,0XB0,0X60,0X50,0X90,0XE0,
+0XF8,0X90,0X50,0X90,0XF4,0XE0,0X90,0X51,0X90,0XE0,0XFF,0X42,0X80,0X10,0XD0,0XFF,
+0X6B,0X70,0X00,0XC0,0XFF,0X6B,0X90,0X20,0XD0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X28,0XE1,0XD0,0XC1,0XB1,0XA1,
+0X91,0X81,0X71,0X61,0X52,0X42,0X32,0X22,0X14,0X0F,0X08,0X13,0X23,0X33,0X41,0X52,
+0X61,0X71,0X81,0X91,0XA1,0XB1,0XC1,0XD0,0XE1,0XFF,0XFF,0XFF,0XFF,0XFF,0X5B,};
+const image_rle_t gImage_mode2_126x174 = { s_gImage_mode2_126x174_rle, sizeof(s_gImage_mode2_126x174_rle), 126, 174 };
 
-const unsigned char gImage_mode3_126x174[10962] = { 
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X19,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF2,0X00,0X00,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X90,0X00,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0X10,0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0X00,0X00,0X00,0X00,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,
-0X00,0X00,0X40,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,
-0X08,0XE1,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X2F,
-0XFA,0X00,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0XAF,0XFF,
-0X30,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X03,0XFF,0XFF,0XD0,
-0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X0C,0XFF,0XFF,0XF7,0X00,
-0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0X20,0X00,
-0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XB0,0X00,0X01,
-0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0X6F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFE,0X10,0X00,0X0C,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF3,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X02,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XA0,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X8F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X10,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X0E,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,
-0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X05,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X00,
-0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X07,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X1F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X9F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X60,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFD,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFD,0X00,0X00,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X70,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF4,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF1,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,
-0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFB,0X00,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,
-0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X40,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X4F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XDF,0XFF,0XFF,0XD0,
-0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,0X00,0X00,0XDF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X40,0X00,0X4E,0XFF,0XF8,0X00,
-0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X06,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD1,0X00,0X00,0X02,0XEF,0XFF,0X20,0X00,
-0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X1E,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X7F,0XFF,0XB0,0X00,0X01,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X2F,0XFF,0XF5,0X00,0X00,0X7F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFD,0X00,0X00,0X0D,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X3F,0XFF,0XFF,0X80,0X00,0X03,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X80,0X00,0X00,0X00,0XAF,0XFF,0XFF,0XF2,0X00,0X00,0XAF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF1,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF0,0X00,0X00,0X07,0XFF,0XFF,0XFF,0XFB,0X00,0X00,0X1F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X70,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF0,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X06,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0X00,0X00,0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XD0,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,
-0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,
-0X00,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X01,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,
-0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X08,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X72,0X00,0X00,0X0B,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X0E,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X00,0X00,0X02,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X4F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0X00,0X00,0X00,0X1D,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X00,0X00,0X00,0X00,0X02,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFC,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0XAF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XC9,0X89,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X40,0X00,0XBF,0XFF,0XFF,0XA2,0X00,0X00,0X02,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFA,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XE6,0X49,0XFF,0XFF,0XF6,0X00,0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF0,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X91,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X70,0X00,0X00,0X00,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF0,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X53,0X59,0X71,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF0,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF6,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF0,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,
-0X00,0X00,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,
-0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X00,0X36,0X00,
-0X00,0X00,0X00,0X00,0X00,0X02,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,
-0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X00,0X00,0X00,0X3C,0XFF,0XD3,0X00,
-0X00,0X00,0X00,0X00,0X00,0X08,0X83,0X00,0X03,0X8F,0XFF,0XFF,0XFF,0XC0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X01,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XB6,0X32,
-0X37,0X92,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0XCF,0XFF,0XE9,0X10,0X00,0X00,0X00,
-0X00,0X00,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0XEF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X50,0X00,0X00,0X00,0X00,0X00,0X00,0X09,0XA5,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X9F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0X10,0X00,0X00,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X5F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XE4,0X00,0X05,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X30,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X0E,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X03,0X75,0X00,0X00,0X00,0X00,0X07,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X09,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X5A,0XFF,0XFF,0XB2,0X00,0X00,0X03,0XBF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XDA,0X9A,0XDF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,
-0X00,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X00,0X00,0X00,0X00,
-0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0X03,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X10,0X00,0X00,0X00,0X00,0X1D,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X00,0X00,0X04,0XEF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XE1,0X00,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X16,0XBF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFB,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X80,0X00,0X00,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF7,0X00,0X00,0X01,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X70,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X90,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF9,0X00,0X00,0X00,0X1A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X10,0X00,0X00,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XB1,0X00,0X00,0X00,0X2A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0XBF,0XFD,
-0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,
-0X30,0X00,0X00,0X00,0X06,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X20,0X02,0XFC,0X00,
-0X00,0X00,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,
-0X00,0X00,0X00,0X00,0X00,0X25,0X78,0X99,0X86,0X30,0X00,0X00,0X00,0XAF,0X00,0X00,
-0X00,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE6,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XBF,0X80,0X00,0X00,
-0X01,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE6,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X05,0XFF,0XF7,0X00,0X00,0X2C,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,
-0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X28,0XDF,0XFF,0XFF,0XD9,0X8B,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XB8,0X52,0X10,0X00,0X02,0X47,0XAE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X5B,0XFF,0XFF,0X9E,0XFF,0XFF,0XFF,
-0XFF,0XC7,0X88,0XCF,0XF4,0X6F,0XF8,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XCA,0XAC,0XFF,
-0XFA,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0XBA,0XA9,0XAB,0XA9,0XAA,0X9B,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XB5,0X6B,0X97,0X14,0X8C,0XF7,0X1E,0XFF,0XFF,0XFF,0XFF,
-0XA3,0X30,0X3F,0XF8,0X0D,0XE0,0X7F,0XFF,0XFF,0XFF,0XFF,0XFE,0X12,0X21,0XDD,0XCC,
-0X05,0XCC,0XDF,0XFF,0XFF,0XFF,0XFF,0XF4,0X02,0X23,0X30,0X13,0X22,0X14,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X42,0X33,0X87,0X24,0X6E,0XA0,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFA,0X3F,0X82,0X03,0X30,0X26,0XEF,0XFF,0XFF,0XFF,0XFC,0X1D,0XD3,0X82,0X23,0X21,
-0X31,0X2D,0XFF,0XFF,0XFF,0XFF,0XF2,0X4F,0XFF,0XB0,0XBF,0XFF,0XFE,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X4C,0XB6,0XFD,0X18,0XF9,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,
-0X5F,0X05,0XB3,0X1B,0X70,0XBF,0XFF,0XFF,0XFF,0XFC,0X2F,0XF3,0XBB,0XA8,0XCA,0X8B,
-0XBE,0XFF,0XFF,0XFF,0XFF,0XF2,0X7F,0X85,0X10,0X44,0X45,0XAF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X5A,0XA7,0XA5,0X44,0X75,0XAF,0X87,0XFF,0XFF,0XFF,0XFF,0XF5,0X20,0X4F,
-0X1A,0XF6,0X3F,0XC1,0XBF,0XFF,0XFF,0XFF,0XFD,0X24,0X41,0XFF,0X38,0XFD,0X3A,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF2,0X7D,0X05,0XBC,0XBA,0XA3,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X5A,0X96,0XEC,0XCB,0XCF,0XFB,0X09,0XFF,0XFF,0XFF,0XFF,0XD0,0X79,0X9F,0X31,
-0X41,0X04,0X11,0XDF,0XFF,0XFF,0XFF,0XFD,0X15,0X42,0XD4,0X3E,0XFF,0XA1,0X9F,0XFF,
-0XFF,0XFF,0XFF,0XF2,0X7D,0X16,0XA9,0XAA,0XA3,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X5A,0XA7,0X93,0X54,0X3F,0XE1,0X7F,0XFF,0XFF,0XFF,0XFF,0XA1,0XDF,0XFD,0X19,0XF6,
-0X3F,0XB1,0XBF,0XFF,0XFF,0XFF,0XFC,0X2E,0XF4,0X32,0XBF,0XFF,0XC4,0X3E,0XFF,0XFF,
-0XFF,0XFF,0XF2,0X6E,0X13,0X66,0X56,0X61,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X5A,
-0XA7,0X67,0XFD,0X39,0X25,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X59,0XDE,0X15,0XA4,0X2A,
-0X70,0XBF,0XFF,0XFF,0XFF,0XFD,0X2B,0XB2,0X9C,0X19,0XFD,0X0A,0XEF,0XFF,0XFF,0XFF,
-0XFF,0XF2,0X7D,0X07,0XCC,0XDC,0XC4,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X5B,0XB7,
-0X72,0X54,0X33,0X7F,0XF9,0XFF,0XFF,0XFF,0XFF,0XD6,0X40,0X3F,0X31,0X41,0X04,0X20,
-0XCF,0XFF,0XFF,0XFF,0XFE,0X10,0X01,0XFF,0X42,0XF7,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF2,0X8D,0X13,0X41,0X01,0X40,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X59,0X77,0XA7,
-0X97,0X5E,0XFF,0X50,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X2F,0XEF,0XF8,0X4F,0XFE,0XFF,
-0XFF,0XFF,0XFF,0XFD,0X18,0X92,0XDF,0XD0,0X72,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,
-0X9F,0XC8,0XD9,0X0B,0XAB,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X09,0XE5,0XFA,
-0X7F,0XFA,0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X5A,0X56,0X62,0X16,0X65,0X9F,0XFF,
-0XFF,0XFF,0XFC,0X1F,0XF2,0XCF,0XF8,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB1,0XCF,
-0X82,0XFC,0X2F,0X73,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X55,0XCF,0XF5,0XA2,0X6F,
-0XB0,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X5A,0X45,0X62,0X16,0X64,0X8F,0XFF,0XFF,
-0XFF,0XF9,0X2F,0XD2,0XDF,0XD4,0X02,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0X51,0XFA,0X0A,
-0XFB,0X1D,0XE2,0X2D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0XFC,0X53,0X11,0X24,0X17,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XC9,0X90,0X6F,0XFF,0XF6,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF3,0X5E,0X80,0XA7,0X14,0XE7,0X03,0XAF,0XFF,0XFF,0XFF,0XFC,0X09,0XB0,0X9E,0X95,
-0X0E,0XFE,0X13,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X36,0X9D,0XC2,0X7F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XB2,0X25,0XEF,0XFF,0XF6,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XE4,
-0XC9,0X17,0X62,0X9F,0XFF,0XB2,0X4F,0XFF,0XFF,0XFF,0XFA,0X3E,0XB9,0XF8,0X11,0X8F,
-0XFF,0XC8,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFE,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0XDF,0XEE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEE,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFD,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0X94,0X34,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XD2,0X9F,0XFF,0XFE,0X17,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XC1,0X12,0X32,0X2D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,
-0X8F,0XFF,0XFE,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFC,0X03,0XCF,0XFF,0XCE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD1,0X9F,
-0XFF,0XFE,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XE2,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA7,0X8D,0XFF,0XFF,0XFF,0XD1,0X8F,0XFF,
-0XFE,0X06,0XFF,0XFF,0XFF,0XB7,0X7C,0XFF,0XFF,0XFF,0XFF,0XB7,0XAF,0XDD,0XFF,0XFF,
-0XFF,0XF9,0X7A,0XFF,0XFF,0XFF,0XEC,0XFC,0X79,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,
-0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XE4,0X00,0X00,0X9F,0XFF,0XFF,0XD1,0X8F,0XFF,0XFE,
-0X06,0XFF,0XFF,0XF7,0X00,0X00,0XBF,0XFF,0XFF,0XF6,0X00,0X03,0X18,0XFF,0XFF,0XFD,
-0X30,0X00,0X6F,0XFF,0XFF,0XA1,0X52,0X00,0X4E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0XCF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0XBE,0XD4,0X0C,0XFF,0XFF,0XD1,0X8F,0XFF,0XFE,0X06,
-0XFF,0XFF,0XF8,0XAE,0XE2,0X1F,0XFF,0XFF,0X70,0X9E,0XD3,0X08,0XFF,0XFF,0XF3,0X1C,
-0XFA,0X0A,0XFF,0XFF,0XB0,0X1C,0XE8,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0XDF,0XFF,
-0XFF,0XFF,0XFF,0XFC,0X08,0XFF,0XFF,0X15,0XFF,0XFF,0XD1,0X8F,0XFF,0XFE,0X06,0XFF,
-0XFF,0XFF,0XFE,0XC3,0X0E,0XFF,0XFF,0X13,0XFF,0XFD,0X18,0XFF,0XFF,0XB0,0X8F,0XEF,
-0X23,0XFF,0XFF,0XB0,0XAF,0XFF,0X15,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0XBF,0XFF,0XFF,
-0XFF,0XFF,0XF8,0X0C,0XFF,0XFF,0X22,0XFF,0XFF,0XD1,0X9F,0XFF,0XFE,0X06,0XFF,0XFF,
-0XFA,0X21,0X31,0X1E,0XFF,0XFD,0X17,0XFF,0XFF,0X27,0XFF,0XFF,0X90,0X11,0X11,0X14,
-0XFF,0XFF,0XB0,0XBF,0XFF,0X25,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X5F,0XFF,0XFF,0XFF,
-0XFF,0XF9,0X0B,0XFF,0XFF,0X22,0XFF,0XFF,0XD1,0X8F,0XFF,0XFE,0X06,0XFF,0XFF,0XC0,
-0X4C,0XF7,0X0E,0XFF,0XFD,0X17,0XFF,0XFF,0X17,0XFF,0XFF,0X80,0X9A,0XAA,0XCD,0XFF,
-0XFF,0XB0,0XBF,0XFF,0X25,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X09,0XFF,0XFF,0XEF,0XFF,
-0XFD,0X05,0XFF,0XFC,0X08,0XFF,0XFF,0XD1,0X9F,0XFF,0XFE,0X07,0XFF,0XFF,0X70,0XEF,
-0XF3,0X0E,0XFF,0XFF,0X12,0XFF,0XF8,0X09,0XFF,0XFF,0XC0,0X9F,0XFF,0XFF,0XFF,0XFF,
-0XB0,0XBF,0XFF,0X26,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X58,0X85,0X2C,0XFF,0XFF,
-0X70,0X5A,0X80,0X3F,0XFF,0XFF,0XC0,0X7F,0XFF,0XFE,0X05,0XFF,0XFF,0XA0,0X59,0X60,
-0X0E,0XFF,0XFF,0X90,0X49,0X71,0X08,0XFF,0XFF,0XF5,0X06,0XA7,0X2C,0XFF,0XFF,0XA0,
-0XAF,0XFE,0X14,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X10,0X01,0X8F,0XFF,0XFF,0XF9,
-0X10,0X06,0XEF,0XFF,0XFF,0XE5,0XAF,0XFF,0XFF,0X58,0XFF,0XFF,0XF8,0X00,0X79,0X5E,
-0XFF,0XFF,0XF9,0X00,0X3C,0X27,0XFF,0XFF,0XFF,0X70,0X00,0X7F,0XFF,0XFF,0XC5,0XCF,
-0XFF,0X68,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XED,0XDE,0XFF,0XFF,0XFF,0XFF,0XEC,
-0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDC,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XED,0XFD,0X19,0XFF,0XFF,0XFF,0XFE,0XCE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XCC,0XFF,0XE2,0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,
-0X23,0X01,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC4,0X21,
-0X3A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XEE,0XDC,0XCB,0XBA,0XA9,0X98,0X77,0X76,0X65,0X55,0X44,0X33,0X33,
-0X22,0X22,0X11,0X11,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X11,0X11,0X22,0X22,0X33,0X33,0X44,0X55,0X56,0X67,0X78,0X89,0X99,0XAB,0XBC,0XCD,
-0XEE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,};
-
-const unsigned char gImage_mode4_126x174[10962] = { 
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDA,0X75,0X31,0X00,0X00,0X00,0X13,0X57,0XAD,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XD9,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X9D,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFE,0X82,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X28,
-0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X50,
-0X00,0X00,0X00,0X00,0X00,0X00,0X11,0X22,0X11,0X00,0X00,0X00,0X00,0X00,0X00,0X05,
-0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X30,0X00,0X00,
-0X00,0X00,0X26,0X9C,0XEF,0XFF,0XFF,0XFF,0XFE,0XC9,0X62,0X00,0X00,0X00,0X00,0X03,
-0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X40,0X00,0X00,0X00,0X16,
-0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X61,0X00,0X00,0X00,0X04,
-0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X00,0X00,0X4A,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA4,0X00,0X00,0X00,0X07,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD2,0X00,0X00,0X00,0X6D,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD6,0X00,0X00,0X00,0X2D,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X00,0X5D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD5,0X00,0X00,0X00,0X9F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,0X2C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC2,0X00,0X00,0X05,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XE3,0X00,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X00,0X3E,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFE,0X20,0X00,0X01,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X10,0X00,0X02,0XEF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,
-0X00,0X00,0X3E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X24,0XDF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE3,0X00,0X00,0X2E,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X20,0X00,
-0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X02,0XEF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X6F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0X3F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X06,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X05,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X5F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X01,0XFF,0XFC,0X97,0X65,0X55,0X68,0XAD,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X08,0X83,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X9E,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFE,0X00,0X00,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X4B,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF6,0X00,0X00,0X30,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X3B,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF2,0X00,0X00,0X00,0X00,0X00,0X02,0X34,0X44,0X31,0X00,0X00,0X00,0X00,0X00,0X5E,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X40,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,
-0X00,0X00,0X00,0X00,0X3B,0XFF,0XFF,0XFF,0XFF,0XFB,0X72,0X00,0X00,0X00,0X01,0XAF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFB,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X40,
-0X00,0X00,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC6,0X00,0X00,0X00,0X07,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF3,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X60,
-0X00,0X00,0X00,0XDF,0XA3,0XAF,0XFF,0XFF,0XFF,0XFF,0XE6,0X00,0X00,0X00,0X5F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,
-0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0XFF,0XFF,0XFF,0XFF,0XFE,0X81,
-0X00,0X00,0XFF,0X20,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XC2,0X00,0X00,0X04,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XD0,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,
-0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XA5,
-0X4C,0XFF,0X10,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,0X5F,0XFF,0XFF,
-0XFF,0XFF,0XF6,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X10,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X10,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X07,0XFF,0XFF,0XFF,
-0XFF,0XFD,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X04,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X01,0X01,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X10,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X00,0XBF,0XFF,0XFF,0XFF,
-0XFF,0X40,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,0X00,0X0A,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XD0,0X0D,0X30,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,
-0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,
-0XA0,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X50,0X6F,0XD0,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X1F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XF1,
-0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFC,0X00,0XEF,0XF7,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X1F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XF6,0X00,
-0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF3,0X08,0XFF,0XFF,0X10,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X1F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFA,0X00,0X04,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,
-0X1F,0XFF,0XFF,0XB0,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X1F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0XAF,
-0XFF,0XFF,0XF4,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X1F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0XDF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFA,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X03,0XF7,0X6F,
-0XFF,0XFD,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0XAF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0X00,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X0C,0X90,0X0C,0XFF,
-0XFF,0X70,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF9,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0X90,0X00,0X7F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF5,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X5E,0X00,0X2F,0XFF,0XFF,
-0XF1,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XC0,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF3,0X00,0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0XD6,0X00,0XCF,0XFF,0XFF,0XFB,
-0X01,0XEF,0XFF,0XFF,0XFF,0XFF,0X10,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X30,0X00,0X4F,0XFF,0XFF,0XFF,0XE0,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,
-0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X07,0XE0,0X05,0XFF,0XFF,0XFF,0XFF,0X40,
-0X6F,0XFF,0XFF,0XFF,0XFF,0X10,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X80,0X00,0X1F,0XFF,0XFF,0XFF,0XF0,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,
-0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X1F,0X80,0X0D,0XFF,0XFF,0XFF,0XFF,0XD0,0X0C,
-0XFF,0XFF,0XFF,0XFF,0X10,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XB0,0X00,0X0E,0XFF,0XFF,0XFF,0XF1,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X1F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X9F,0X30,0X3F,0XFF,0XFF,0XFF,0XFF,0XF7,0X03,0XFF,
-0XFF,0XFF,0XFF,0X10,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,
-0X00,0X0C,0XFF,0XFF,0XFF,0XF1,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X2F,0XFF,
-0XFF,0XFF,0XFF,0XFB,0X02,0XFF,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0XCF,0XFF,
-0XFF,0XFF,0X10,0X05,0X55,0X65,0X55,0X55,0X66,0X59,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,
-0X0B,0XFF,0XFF,0XFF,0XF2,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X2F,0XFF,0XFF,
-0XFF,0XFF,0XF6,0X08,0XFF,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X6F,0XFF,0XFF,
-0XFF,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XF0,0X00,0X0A,
-0XFF,0XFF,0XFF,0XF2,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X1F,0XFF,0XFF,0XFF,
-0XFF,0XF2,0X0C,0XFF,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X3F,0XFF,0XFF,0XFF,
-0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X0A,0XFF,
-0XFF,0XFF,0XF1,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,
-0XF0,0X0F,0XFF,0X86,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X1F,0XFF,0XFF,0XFF,0XFF,
-0XEE,0XEE,0XEE,0XEE,0XEE,0XEE,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X0A,0XFF,0XFF,
-0XFF,0XF1,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XF0,
-0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X0B,0XFF,0XFF,0XFF,
-0XF0,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X0E,0XFF,0XFF,0XFF,0XFF,0XF1,0X0E,
-0XFF,0XF3,0X3E,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X0D,0XFF,0XFF,0XFF,0XE0,
-0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XF4,0X0A,0XFF,
-0XE0,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X0F,0XFF,0XFF,0XFF,0XC0,0X00,
-0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X09,0XFF,0XFF,0XFF,0XFF,0XF8,0X05,0XFF,0XF5,
-0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0X30,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X2F,0XFF,0XFF,0XFF,0X90,0X00,0X7F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0XCF,0XFF,0X30,
-0X0B,0XFF,0XFF,0XFF,0XFA,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X5F,0XFF,0XFF,0XFF,0X60,0X00,0XAF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFD,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X3F,0XFF,0XF8,0X8F,
-0XFF,0XFF,0XFF,0XD1,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0X20,0X00,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X04,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0X20,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF7,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0X00,0X00,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X40,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X4E,0XFF,0XFF,0XFF,0XFF,
-0XB1,0X02,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF1,0X00,0X04,0XFF,0XFF,0XFF,0XFA,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X90,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XC1,0X00,0X7D,0XFF,0XFF,0XB4,0X00,
-0X3E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X80,0X00,0X0A,0XFF,0XFF,0XFF,0XF6,0X00,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XD0,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X40,0X00,0X24,0X31,0X00,0X07,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0X10,0X00,0X1F,0XFF,0XFF,0XFF,0XF1,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,
-0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X50,0X00,0X00,0X27,0XEF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,
-0X00,0X8F,0XFF,0XFF,0XFF,0XA0,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,
-0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDC,0XCE,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X00,0X01,
-0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,
-0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X10,0X00,0X0B,0XFF,
-0XFF,0XFF,0XFD,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X6F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,0X00,0X00,0X5F,0XFF,0XFF,
-0XFF,0XF6,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X0D,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X30,0X00,0X02,0XFF,0XFF,0XFF,0XFF,
-0XD0,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X05,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,0X00,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0X50,
-0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X00,0XCF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X10,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,
-0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X2F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFE,0X50,0X00,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XF2,0X00,0X04,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X07,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0X80,0X00,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X0D,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X01,0X7D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,
-0X60,0X00,0X00,0X00,0X2D,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X7F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X00,0X15,0X8B,0XDD,0XED,0XCA,0X84,0X00,0X00,
-0X00,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X02,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XE1,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X02,0X9F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XA4,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X05,0XBF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XEA,0X63,0X00,0X00,0X00,0X00,0X13,0X7B,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF6,0X00,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0X20,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0XDC,0XBC,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X50,0X00,0X02,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XE2,0X00,0X00,0X3E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE3,
-0X00,0X00,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFE,0X20,0X00,0X01,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X10,0X00,
-0X02,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XE3,0X00,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X00,0X3E,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X50,0X00,0X00,0X2C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC2,0X00,0X00,0X05,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF9,0X00,0X00,0X00,0X5D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD5,0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XD2,0X00,0X00,0X00,0X6D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD6,0X00,0X00,0X00,0X2D,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X70,0X00,0X00,0X00,0X4A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XA4,0X00,0X00,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFD,0X40,0X00,0X00,0X00,0X16,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFA,0X61,0X00,0X00,0X00,0X04,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFB,0X30,0X00,0X00,0X00,0X00,0X26,0X9C,0XEF,0XFF,0XFF,0XFF,0XFE,0XC9,0X62,
-0X00,0X00,0X00,0X00,0X03,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFC,0X50,0X00,0X00,0X00,0X00,0X00,0X00,0X11,0X22,0X11,0X00,0X00,0X00,0X00,
-0X00,0X00,0X05,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0X82,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X38,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XD9,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X9D,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDA,0X75,0X31,0X00,0X00,0X00,0X13,0X57,0XAD,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFE,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X26,0XFF,0XCB,0XBB,0XCD,0XDF,0XFF,0XFF,0XFF,
-0XFF,0XFB,0X6F,0XFD,0XCB,0XCA,0X9A,0X8D,0XFF,0XFF,0XFF,0XFF,0XFF,0X7A,0XFF,0XFF,
-0XE6,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X5F,0XFF,0XF5,0X9F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X21,0X4E,0X61,0X21,0X30,0X3F,0XFF,0XFF,0XFF,0XFF,
-0XF3,0X4F,0XC1,0X21,0X12,0X22,0X2C,0XFF,0XFF,0XFF,0XFF,0XFC,0X0A,0XF8,0X45,0X40,
-0X26,0X45,0XEF,0XFF,0XFF,0XFF,0XF8,0X75,0X17,0X8F,0X90,0X37,0X7D,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X71,0XFF,0X43,0XCB,0XBD,0X60,0XAF,0XFF,0XFF,0XFF,0XFF,0XE2,
-0XDE,0XB3,0X7D,0X4A,0XF6,0X7F,0XFF,0XFF,0XFF,0XFF,0XF6,0X05,0X6A,0XAA,0X81,0X5A,
-0XAA,0XFF,0XFF,0XFF,0XFF,0XF8,0X64,0X17,0X89,0X28,0XA2,0X0E,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF8,0X08,0XDC,0XA4,0XF9,0X49,0X2A,0XFF,0XFF,0XFF,0XFF,0XFF,0X88,0XF4,
-0X9C,0X6F,0XBC,0XC2,0XEF,0XFF,0XFF,0XFF,0XFF,0XD1,0XAB,0XAF,0X87,0X61,0X47,0X7F,
-0XFF,0XFF,0XFF,0XFF,0XFC,0X75,0X17,0XC4,0X7F,0XE2,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XC2,0X53,0X12,0X3C,0XFE,0X50,0XBF,0XFF,0XFF,0XFF,0XFF,0XFC,0X08,0X73,0XC3,
-0X34,0X44,0X11,0X5A,0XFF,0XFF,0XFF,0XFF,0X44,0XFE,0XFE,0X28,0XAB,0XA7,0X0D,0XFF,
-0XFF,0XFF,0XFF,0XFD,0XB7,0X1B,0XD7,0X34,0X10,0X53,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFE,0XFD,0X18,0XEF,0XAC,0XA0,0X9B,0XCE,0XFF,0XFF,0XFF,0XFC,0X55,0X0A,0XFA,0X24,
-0XA9,0XAA,0X8C,0XFF,0XFF,0XFF,0XFF,0XA6,0X11,0XAF,0X37,0X88,0X86,0X1D,0XFF,0XFF,
-0XFF,0XFF,0XC5,0X65,0X37,0X4C,0XFC,0X3B,0XE0,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,
-0X66,0X14,0X77,0X33,0X20,0X22,0X09,0XFF,0XFF,0XFF,0XFF,0XF6,0X6F,0XB6,0X23,0X77,
-0X77,0X69,0XFF,0XFF,0XFF,0XFF,0XFF,0X28,0XFE,0X29,0XAA,0XA8,0X2D,0XFF,0XFF,0XFF,
-0XFF,0XEA,0X88,0X88,0X99,0XA9,0X27,0XA1,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X66,
-0X14,0X67,0XFF,0XA2,0XDE,0X1A,0XFF,0XFF,0XFF,0XFF,0XD4,0XFF,0XB5,0X16,0X99,0X99,
-0X79,0XFF,0XFF,0XFF,0XFF,0XB9,0X25,0X9D,0X37,0X88,0X86,0X1D,0XFF,0XFF,0XFF,0XFF,
-0XFB,0X48,0X96,0X78,0X44,0X13,0X50,0X3E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X19,
-0XFF,0XFF,0XB2,0XDF,0X1D,0XFF,0XFF,0XFF,0XFF,0X32,0X43,0XFF,0X16,0X88,0X99,0XDF,
-0XFF,0XFF,0XFF,0XFF,0X72,0X01,0X3C,0X37,0X88,0X87,0X1D,0XFF,0XFF,0XFF,0XFF,0XF8,
-0X29,0XB3,0X3F,0XFF,0X5D,0XF2,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X21,0X11,0X29,
-0XFF,0XB2,0XDF,0XCF,0XFF,0XFF,0XFF,0XFF,0X76,0X89,0XF9,0X02,0X66,0X50,0X8F,0XFF,
-0XFF,0XFF,0XFF,0XFE,0X27,0XFF,0X39,0XAA,0XA8,0X2E,0XFF,0XFF,0XFF,0XFF,0XF9,0X38,
-0XA3,0X8A,0X45,0X13,0X50,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X0C,0XDC,0X27,0XFF,
-0XB2,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,0X75,0XDF,0X64,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X29,0XF6,0X08,0X98,0X98,0X15,0XCF,0XFF,0XFF,0XFF,0XF9,0X39,0XA4,
-0X7C,0X77,0X15,0X83,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X2F,0XFF,0X58,0XFF,0XB2,
-0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0X84,0X26,0X72,0XFC,0X22,0X4F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X32,0XC7,0X94,0X36,0X43,0X87,0XBF,0XFF,0XFF,0XFF,0XF9,0X26,0X83,0X5F,
-0XFF,0X5A,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X05,0X56,0X08,0XED,0X81,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X55,0XB7,0X0B,0XC8,0X01,0X3B,0XCE,0XFF,0XFF,0XFF,0XFF,
-0XFD,0X10,0XCD,0X92,0X9F,0XC2,0X6C,0XFF,0XFF,0XFF,0XFF,0XF8,0X4E,0XE6,0X4F,0XDB,
-0X2A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X05,0X66,0X28,0X80,0X06,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X86,0X03,0XAE,0X62,0X07,0XFF,0XFF,0XFF,0XFF,0XFD,
-0X4B,0XF2,0X2A,0XFF,0XFC,0X31,0XCF,0XFF,0XFF,0XFF,0XF8,0X5D,0X40,0X9F,0X20,0X3F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0XBF,0XFF,0XCD,0XD8,0XAF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0XBF,0XFF,0XFF,0XBC,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFA,0XFF,0XFF,0XFF,0XFB,0XEF,0XFF,0XFF,0XFF,0XFD,0XCE,0X9A,0XFF,0XA9,0XEF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X77,0XFF,0XFF,0XFF,0XFF,0XFF,0XA6,
-0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XDE,0XFF,0XFF,0XFF,0X33,0XFF,0XFF,0XFF,0XFF,0XFF,0X61,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFD,0X19,0XFF,0XFF,0XFF,0X33,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XCB,0XFF,0XFF,0XFF,0XFF,0XFB,0XBF,0XFF,0XFF,0XFF,0XFF,0XFD,0XBD,0XFF,0XFF,
-0XFF,0XF9,0X08,0XEF,0XFF,0XFF,0X34,0XFD,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFB,0XDF,0XFF,0XFF,0XFF,0XFF,0XCB,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB3,
-0X00,0X2D,0XFF,0XFF,0XFA,0X20,0X02,0XBF,0XFF,0XFF,0XFF,0X60,0X00,0X5E,0XFF,0XFF,
-0XA0,0X00,0X18,0XFF,0XFF,0X33,0X60,0X03,0XEF,0XFF,0XFF,0X74,0XEF,0XFF,0XFD,0X59,
-0X20,0X1A,0XFF,0XFF,0XFF,0XC4,0X00,0X66,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X13,0XBB,
-0X8D,0XFF,0XFF,0XA0,0X5B,0XB4,0X0C,0XFF,0XFF,0XF6,0X09,0XB9,0X03,0XFF,0XFF,0XD6,
-0X05,0X9C,0XFF,0XFF,0X30,0X3A,0XB0,0X5F,0XFF,0XFF,0X40,0XEF,0XFF,0XFC,0X01,0X8B,
-0X20,0XDF,0XFF,0XFF,0X30,0XAB,0X60,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X07,0XFF,0XFF,
-0XFF,0XFF,0X23,0XFF,0XFE,0X06,0XFF,0XFF,0XB0,0X8F,0XFF,0X90,0XAF,0XFF,0XFC,0X09,
-0XFF,0XFF,0XFF,0X31,0XEF,0XF8,0X0D,0XFF,0XFF,0X51,0XEF,0XFF,0XFC,0X18,0XFF,0XA0,
-0X9F,0XFF,0XF8,0X0B,0XFF,0XF4,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X50,0X2A,0XFF,0XFF,
-0XFA,0X09,0XFF,0XFF,0X43,0XFF,0XFF,0X80,0XDF,0XFF,0XD0,0X9F,0XFF,0XFB,0X09,0XFF,
-0XFF,0XFF,0X33,0XFF,0XFA,0X0C,0XFF,0XFF,0X51,0XEF,0XFF,0XFC,0X1D,0XFF,0XE1,0X8F,
-0XFF,0XF4,0X0F,0XFF,0XF5,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X30,0X5E,0XFF,0XF9,
-0X0A,0XFF,0XFF,0X53,0XFF,0XFF,0X70,0XEF,0XFF,0XE0,0X8F,0XFF,0XFB,0X09,0XFF,0XFF,
-0XFF,0X33,0XFF,0XFA,0X0C,0XFF,0XFF,0X51,0XEF,0XFF,0XFC,0X1C,0XFF,0XD1,0X8F,0XFF,
-0XF4,0X1F,0XFF,0XF6,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X09,0XFF,0XFD,0X15,
-0XFF,0XFF,0X16,0XFF,0XFF,0XA0,0XAF,0XFF,0XC0,0XAF,0XFF,0XFA,0X0A,0XFF,0XFF,0XFF,
-0X33,0XFF,0XFA,0X0C,0XFF,0XFF,0X51,0XEF,0XFF,0XFC,0X1C,0XFF,0XD1,0X8F,0XFF,0XF5,
-0X0E,0XFF,0XF4,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X8C,0XE8,0X0A,0XFF,0XFF,0X80,0X7D,
-0XD5,0X0B,0XFF,0XFF,0XE2,0X1B,0XEB,0X12,0XFF,0XFF,0XFC,0X04,0XDE,0XFF,0XFF,0X32,
-0XFF,0XF9,0X0C,0XFF,0XFF,0X50,0XEF,0XFF,0XFC,0X1C,0XFF,0XC0,0X8F,0XFF,0XFC,0X04,
-0XDD,0X60,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X10,0X7F,0XFF,0XFF,0XF7,0X00,0X00,
-0XAF,0XFF,0XFF,0XFD,0X30,0X10,0X3E,0XFF,0XFF,0XFF,0X70,0X08,0XFF,0XFF,0X44,0XFF,
-0XFA,0X0C,0XFF,0XFF,0X62,0XEF,0XFF,0XFC,0X1C,0XFF,0XD1,0X9F,0XFF,0XFF,0X90,0X00,
-0X64,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC9,0X9C,0XFF,0XFF,0XFF,0XFF,0XC9,0X9D,0XFF,
-0XFF,0XFF,0XFF,0XFA,0X9B,0XFF,0XFF,0XFF,0XFF,0XFB,0X9D,0XFF,0XFF,0XEE,0XFF,0XFF,
-0XDF,0XFF,0XFF,0XED,0XFF,0XFF,0XFF,0XDF,0XFF,0XFD,0XEF,0XFF,0XFF,0XFD,0X9A,0XF6,
-0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X7F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X35,0X86,0X01,0XCF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X41,0X22,0X1B,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XEE,0XDC,0XCB,0XBA,0X99,0X98,0X87,0X76,0X65,0X55,0X44,0X33,0X33,0X22,0X22,
-0X11,0X11,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X11,0X11,
-0X22,0X22,0X33,0X33,0X44,0X55,0X56,0X67,0X78,0X89,0X9A,0XAB,0XBC,0XCD,0XEE,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,};
-
-const unsigned char gImage_mode5_126x174[10962] = { 
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDA,0X75,0X31,0X00,0X00,0X00,0X13,0X57,0XAD,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XD9,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X9D,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFE,0X82,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X28,
-0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X50,
-0X00,0X00,0X00,0X00,0X00,0X00,0X12,0X22,0X21,0X00,0X00,0X00,0X00,0X00,0X00,0X05,
-0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X30,0X00,0X00,
-0X00,0X00,0X37,0XAC,0XEF,0XFF,0XFF,0XFF,0XFE,0XC9,0X73,0X00,0X00,0X00,0X00,0X03,
-0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X40,0X00,0X00,0X00,0X16,
-0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X61,0X00,0X00,0X00,0X04,
-0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X00,0X00,0X4B,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB5,0X00,0X00,0X00,0X07,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC2,0X00,0X00,0X00,0X6D,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0X00,0X00,0X00,0X2D,
-0XFF,0XFF,0XFF,0XFD,0X67,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X00,0X6E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE6,0X00,0X00,0X00,0X9F,
-0XFF,0XFF,0XF2,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,0X3C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC3,0X00,0X00,0X06,0XFF,
-0XFF,0XF0,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XE3,0X00,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB1,
-0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X00,0X3F,0XFF,
-0XF0,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFE,0X20,0X00,0X02,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X10,0X00,
-0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X20,0X00,0X02,0XEF,0XF1,
-0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,
-0X00,0X00,0X4E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0X0C,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE4,0X00,0X00,0X2E,0XF3,0X00,
-0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X20,0X00,
-0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X02,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X02,0XE4,0X00,0X0E,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X7F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,0X00,0X8F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0X35,0X00,0X0D,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X07,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X00,0X00,0X0D,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X02,0X00,0X0B,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X6F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X70,0X00,0X04,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XF6,0X00,0X00,0X00,0X0A,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X06,0XF3,0X00,0X00,0XAF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XE2,0X00,0X36,0X9D,0X40,0X00,0X00,0X09,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X1E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X0E,0XFD,0X00,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X90,0X00,0X00,0X00,0X00,0X00,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X8F,0XFF,0X70,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XB0,0X00,0X00,0X00,0X00,0X00,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XE0,0X00,0X02,0XFF,0XFF,0XF2,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFA,0X41,0X00,0X00,0X00,0X00,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X40,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X60,0X00,0X0A,0XFF,0XFF,0XFB,0X00,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XDA,0X73,0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFB,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,
-0X00,0X00,0X3F,0XFF,0XFF,0XFF,0X50,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFD,0X95,0X00,0X1D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF3,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,
-0X00,0XCF,0XFF,0XFF,0XFF,0XE0,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,
-0X00,0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X00,0X05,
-0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,
-0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X0E,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF8,0X5C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X00,0X00,0X7F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XB0,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X90,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X04,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,0X00,0X01,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF5,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X70,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,0X00,0X0B,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0X00,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XB0,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X80,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,
-0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF2,0X00,0X00,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,
-0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,
-0X00,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X04,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X30,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,
-0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFA,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,
-0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0XDF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFA,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF1,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,
-0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0XAF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0X00,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,
-0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X0D,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X7F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF5,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,
-0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X00,0X03,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF3,0X00,0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0XAF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0XAF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,
-0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X03,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X1F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,
-0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X0C,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X0A,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X2F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X04,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X2F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF2,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X2F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF2,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X2F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X05,0XFF,0XFF,0XE9,0XBF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF2,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X08,0XFF,0XFE,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF1,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF0,0X00,0X0B,0XFF,0XF9,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF0,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X0E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF0,0X00,0X0C,0XFF,0XF9,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,
-0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF0,0X00,0X0B,0XFF,0XF9,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X80,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,
-0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF0,0X00,0X0A,0XFF,0XFB,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X70,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,0X7F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,
-0X00,0X08,0XFF,0XFD,0X00,0X00,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X40,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0XAF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFD,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,
-0X04,0XFF,0XFF,0X10,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X00,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,
-0XFF,0XFF,0X70,0X00,0X0A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,
-0X00,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X40,0X00,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X9F,
-0XFF,0XE0,0X00,0X00,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X01,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X90,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X2F,0XFF,
-0XF7,0X00,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X07,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XD0,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X09,0XFF,0XFF,
-0X20,0X00,0X00,0X0B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X0E,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,
-0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0XEF,0XFF,0XE2,
-0X00,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X6F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X00,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X78,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X3F,0XFF,0XFE,0X40,
-0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X8F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X20,0X00,0X05,0XFF,0XFF,0XFA,0X20,
-0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFD,0X00,0X00,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X5F,0XFF,0XFF,0XFD,0XEF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF6,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X19,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0X03,0XEF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF7,0X00,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XE0,0X00,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0X17,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X00,0X09,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFB,0X20,0X00,0X00,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,
-0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X00,0X00,0X00,0X03,0X9F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X00,0X00,0X28,0XEF,0XFF,0XFF,0XFF,0XFA,
-0X30,0X00,0X00,0X03,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,
-0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X6C,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA0,0X00,0X00,0X00,0X03,0X68,0X98,0X74,0X00,0X00,
-0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X04,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X00,0X00,0X00,0X00,0X5F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X30,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X19,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X0D,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X00,0X00,0X00,0X00,0X0E,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X07,0XEF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X7F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X29,0X30,0X00,0X0F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X30,0X00,0X00,0X00,0X00,0X00,0X28,0XEF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,0X00,0X02,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X00,0X04,0XFD,0X76,0XCF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X96,0X32,0X12,0X35,0X8D,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X0D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0X00,0X02,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X00,0X03,0X50,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X00,0X03,0XF3,0X00,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF7,0X00,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X00,0X02,0XFF,0X20,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X60,0X00,0X02,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X00,0X02,0XFF,0XE2,0X00,0X00,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE4,
-0X00,0X00,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X10,0X03,0XFF,0XFE,0X20,0X00,0X02,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X20,0X00,
-0X02,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB1,
-0X2C,0XFF,0XFF,0XE3,0X00,0X00,0X08,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X00,0X3E,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X60,0X00,0X00,0X3D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC3,0X00,0X00,0X05,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF9,0X00,0X00,0X00,0X6E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE6,0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XC2,0X00,0X00,0X00,0X6E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD6,0X00,0X00,0X00,0X2C,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X70,0X00,0X00,0X00,0X5B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XB4,0X00,0X00,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFD,0X40,0X00,0X00,0X00,0X16,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFB,0X61,0X00,0X00,0X00,0X04,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFB,0X40,0X00,0X00,0X00,0X00,0X37,0XAC,0XEF,0XFF,0XFF,0XFF,0XFE,0XCA,0X73,
-0X00,0X00,0X00,0X00,0X03,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFC,0X50,0X00,0X00,0X00,0X00,0X00,0X00,0X12,0X22,0X21,0X00,0X00,0X00,0X00,
-0X00,0X00,0X05,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0X83,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X28,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XD9,0X41,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X9D,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XDA,0X75,0X31,0X00,0X00,0X00,0X13,0X57,0XAD,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB9,0XDF,0XFC,0X5C,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XD4,0XDF,0XFF,0XFA,0XAE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X6B,0XDB,
-0X99,0X99,0X9B,0XEF,0XFF,0XFF,0XFF,0XFF,0X95,0XEF,0XFF,0XF8,0X3F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X56,0XCF,0XE4,0X36,0X88,0X8B,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XC0,0XDF,0XFE,0XC8,0X48,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X0B,0X93,0X55,
-0X44,0X55,0X9F,0XFF,0XFF,0XFF,0XFF,0XA2,0X4C,0XFE,0X84,0X8F,0X98,0XDF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X16,0XBD,0X90,0X58,0X94,0X0A,0XFF,0XFF,0XFF,0XFF,0XD9,
-0X70,0X7C,0XC7,0X56,0X13,0X66,0X9F,0XFF,0XFF,0XFF,0XFF,0XEA,0X2E,0X51,0XA9,0X99,
-0XA6,0X4F,0XFF,0XFF,0XFF,0XFF,0XF9,0X2A,0XC6,0X14,0XCA,0X30,0X7E,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFC,0X16,0X97,0X54,0X5D,0XD6,0X3E,0XFF,0XFF,0XFF,0XFF,0XB3,0X20,
-0X09,0X81,0X56,0X66,0X31,0X4E,0XFF,0XFF,0XFF,0XFF,0XC3,0X9F,0X45,0XFF,0XFF,0XFA,
-0X4F,0XFF,0XFF,0XFF,0XFF,0XEE,0XCD,0X61,0X36,0X43,0X53,0X4A,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XD4,0X38,0X97,0X9F,0X43,0X15,0XEF,0XFF,0XFF,0XFF,0XFF,0XEC,0X90,0XAF,
-0X94,0XFF,0XFF,0XD6,0X4E,0XFF,0XFF,0XFF,0XFF,0X91,0XDF,0X43,0XDB,0XDC,0XC7,0X5F,
-0XFF,0XFF,0XFF,0XFE,0X88,0XFF,0X99,0XC8,0X0A,0XEE,0XA9,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XC1,0X38,0X8A,0XFA,0X42,0X13,0X8B,0XDF,0XFF,0XFF,0XFF,0XFF,0XD0,0XCF,0XA5,
-0XFF,0XFF,0XD6,0X5E,0XFF,0XFF,0XFF,0XFD,0X50,0XDF,0X50,0X44,0X23,0X43,0X6F,0XFF,
-0XFF,0XFF,0XFF,0X60,0X6E,0X67,0X71,0X05,0X57,0X67,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X74,0X28,0X96,0X56,0XAB,0X86,0X53,0X9E,0XFF,0XFF,0XFF,0XFF,0XC0,0X4A,0X94,0XAB,
-0XBB,0X94,0X4E,0XFF,0XFF,0XFF,0XF8,0X01,0XDF,0XB9,0XCB,0X07,0XCB,0XBF,0XFF,0XFF,
-0XFF,0XFF,0XD8,0X7F,0XE9,0X24,0XDA,0X05,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X8A,
-0X17,0X97,0X7A,0X98,0XAD,0XB8,0XCF,0XFF,0XFF,0XFF,0XD7,0X40,0X2B,0X91,0X33,0X34,
-0X20,0X4E,0XFF,0XFF,0XFF,0XF8,0X22,0XDF,0XCC,0XFF,0X09,0XFE,0XEF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XDC,0XA6,0X59,0XAC,0X95,0X7C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDE,0X17,
-0X9A,0XDA,0X76,0X8C,0XDF,0XFF,0XFF,0XFF,0XFF,0XA3,0X30,0X8F,0XA1,0X67,0X77,0X54,
-0X7F,0XFF,0XFF,0XFF,0XFD,0X83,0XDF,0X77,0XFE,0X14,0X77,0X9E,0XFF,0XFF,0XFF,0XFF,
-0XFE,0XB7,0X22,0X89,0X6A,0XD9,0X35,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X27,0X8A,
-0XB5,0X9B,0X85,0X9E,0XFF,0XFF,0XFF,0XFF,0XDA,0XB0,0XDF,0X95,0XFF,0XFF,0XFE,0XDF,
-0XFF,0XFF,0XFF,0XFF,0XC2,0XDF,0X44,0XFE,0X12,0X54,0X5E,0XFF,0XFF,0XFF,0XFF,0XD8,
-0X48,0X86,0X57,0X97,0X7D,0XB7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X27,0X8A,0XEB,
-0X74,0X7A,0X95,0XEF,0XFF,0XFF,0XFF,0XFF,0XC0,0XCF,0X85,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XB2,0XDF,0X44,0XFE,0X19,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB5,0X9F,
-0XFB,0X88,0X66,0XB8,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X1A,0XED,0XB5,0X9B,
-0XA5,0X28,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0XDB,0X48,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XB2,0XEB,0X52,0X7F,0X1A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X72,0XDF,0XF9,
-0X69,0XAA,0X62,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X0B,0XFF,0XD9,0X75,0X47,
-0XAE,0XFF,0XFF,0XFF,0XFF,0XEB,0X80,0XC5,0X3E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XB2,0XC2,0X89,0X24,0X04,0X88,0X8A,0XFF,0XFF,0XFF,0XFF,0X51,0XFF,0XFB,0X87,
-0X54,0X69,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X0B,0XFD,0X76,0X66,0X8D,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XB4,0X25,0XA4,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XB2,0XA3,0XBF,0X84,0X44,0X44,0X48,0XFF,0XFF,0XFF,0XFF,0X74,0XFF,0XB7,0X65,0X68,
-0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7D,0XFC,0X46,0X9E,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XC6,0X6D,0XBA,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD8,
-0XCB,0XEF,0XFE,0XCB,0XA9,0XAD,0XFF,0XFF,0XFF,0XFF,0XBB,0XFF,0X86,0X79,0XEF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0XDB,0XBC,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFE,0XA9,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XE8,0X53,0X34,0X7D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XEE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,
-0X52,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XD4,0X04,0X53,0X15,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X9A,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X87,
-0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XD4,0X2D,0XFF,0X70,0XDF,0XFF,0XFF,0XFE,0XEF,0XFF,0XFF,0XFF,0XEE,0XEF,0XFF,
-0XFE,0X37,0XEF,0XFF,0XFF,0XFF,0XEE,0XFF,0XFF,0XFF,0XFF,0XFE,0XEF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFE,0XEF,0XFF,0XFF,0XFF,0XFE,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XD5,0X2C,0XFF,0XB0,0XBF,0XFF,0XFF,0X73,0X38,0XFF,0XFF,0XFD,0X53,0X28,0XFF,0XE5,
-0X02,0X47,0XFF,0XFF,0XC5,0X33,0X7E,0XFF,0XFF,0XBA,0XA5,0X3D,0XFE,0XBA,0XFF,0XFD,
-0XAB,0X94,0X39,0XFF,0XFF,0XFF,0XB3,0X28,0XBA,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD5,
-0X3E,0XFE,0X60,0XDF,0XFF,0XE5,0X25,0X52,0X6F,0XFF,0XB4,0X36,0X27,0XEF,0XE4,0X01,
-0X36,0XFF,0XFB,0X22,0X54,0X05,0XDF,0XFF,0X71,0X35,0X4D,0XFD,0X64,0XEF,0XFC,0X42,
-0X46,0X22,0X9F,0XFF,0XFA,0X13,0X54,0X14,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD5,0X15,
-0X75,0X49,0XFF,0XFF,0X90,0XAE,0XE7,0X0E,0XFF,0X70,0XAE,0XCD,0XFF,0XFC,0X36,0XBC,
-0XFF,0XE4,0X1A,0XDC,0X61,0X6F,0XFF,0X60,0X5C,0XCF,0XFC,0X53,0XEF,0XFC,0X20,0X9D,
-0XB4,0X2F,0XFF,0XC5,0X3B,0XDB,0X31,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD5,0X03,0X20,
-0X5F,0XFF,0XFD,0X60,0X9A,0XA5,0X0C,0XFF,0X92,0X7A,0XEF,0XFF,0XFF,0X49,0XFF,0XFF,
-0XA2,0X6F,0XFF,0XE4,0X1E,0XFF,0X62,0XAF,0XFF,0XFD,0X64,0XEF,0XFC,0X33,0XFF,0XF8,
-0X0F,0XFF,0X82,0XBF,0XFF,0X82,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD5,0X2A,0XA4,0X4D,
-0XFF,0XFD,0X61,0X22,0X11,0X4D,0XFF,0XE8,0X11,0X5C,0XFF,0XFF,0X47,0XFF,0XFF,0X72,
-0X7F,0XFF,0XF6,0X1D,0XFF,0X63,0XCF,0XFF,0XFD,0X64,0XEF,0XFB,0X36,0XEF,0XF8,0X1F,
-0XFF,0X71,0XEF,0XFF,0X93,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD5,0X2D,0XFB,0X35,0XEF,
-0XFD,0X62,0XCD,0XCC,0XEF,0XFF,0XFF,0XD8,0X02,0XBF,0XFF,0X48,0XFF,0XFF,0X92,0X6F,
-0XFF,0XF5,0X2E,0XFF,0X63,0XBF,0XFF,0XFD,0X64,0XEF,0XFC,0X35,0XEF,0XF8,0X1F,0XFF,
-0X81,0XCF,0XFF,0X82,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD4,0X2C,0XFF,0X80,0XBF,0XFE,
-0X70,0XEF,0XFF,0XEF,0XFF,0XFF,0XFF,0X60,0X7F,0XFF,0X47,0XFF,0XFF,0XD3,0X2E,0XFF,
-0X91,0X5F,0XFF,0X62,0XBF,0XFF,0XFD,0X54,0XEF,0XFC,0X35,0XEF,0XF8,0X1F,0XFF,0XA2,
-0X6F,0XFC,0X32,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0X1C,0XFF,0XD2,0X2B,0XFF,0XC2,
-0X25,0X64,0X5F,0XFF,0X92,0X66,0X04,0XCF,0XFF,0X71,0X28,0XFF,0XF9,0X12,0X64,0X04,
-0XDF,0XFF,0X51,0XAF,0XFF,0XFC,0X42,0XEF,0XFB,0X23,0XEF,0XF7,0X0F,0XFF,0XE7,0X04,
-0X54,0X13,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE9,0X8E,0XFF,0XFB,0X5B,0XFF,0XFB,0X53,
-0X45,0X9F,0XFF,0XB4,0X44,0X6C,0XFF,0XFF,0XD6,0X27,0XFF,0XFE,0X94,0X44,0X6C,0XFF,
-0XFF,0XA8,0XDF,0XFF,0XFE,0XA9,0XFF,0XFD,0X89,0XFF,0XFB,0X7F,0XFF,0XFD,0X74,0X49,
-0X62,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEE,0XFF,0XFF,0XEC,0XBE,
-0XFF,0XFF,0XFD,0XBB,0XFF,0XFF,0XFF,0XFE,0XCD,0XFF,0XFF,0XFE,0XBC,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0XDF,0X81,
-0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEC,0XCE,0XE9,0X35,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD6,0X13,0X30,0X4E,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X63,0X38,0XDF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XEE,0XDC,0XCB,0XBA,0X99,0X98,0X87,0X76,0X65,0X55,0X44,0X33,0X33,0X22,0X22,0X11,
-0X11,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X11,0X11,0X22,
-0X22,0X33,0X33,0X44,0X55,0X56,0X67,0X77,0X89,0X9A,0XAB,0XBC,0XCD,0XEE,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,};
-
-const unsigned char gImage_dang1[7560] = { 
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB2,0X22,0X22,0X22,0X22,0X22,0X22,0X25,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XB0,0X01,0X11,0X11,0X11,0X11,0X11,0X04,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF8,0X5D,0XDD,0XDD,0XDD,0XDD,0XDB,0X4D,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFA,0X5F,0XFF,0XFF,0XFF,0XFF,0XFD,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFA,0X4F,0XFF,0XFF,0XFF,0XFF,0XFB,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFB,0X49,0X99,0X99,0X99,0X99,0X96,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFE,0X62,0X56,0X66,0X66,0X66,0X32,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XB2,0X25,0X66,0X66,0X64,0X16,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,
-0X12,0X56,0X66,0X41,0X4E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X92,
-0X35,0X64,0X15,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X24,
-0X51,0X5E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X82,0X43,
-0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB3,0X55,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X76,0X75,0XBF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X5B,0XA9,0X4B,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X75,0XCD,0XBE,0X84,0XBF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X95,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0X5D,0XFC,0XBF,0XF9,0X4C,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA4,0XDF,0XFD,0XCF,0XFF,0X85,0XEF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XAF,0X99,0XFD,0X9A,0XFF,0XDC,0XFC,
-0XDA,0X9D,0XFF,0XFF,0XFD,0X6A,0XFF,0XFB,0XAC,0XFF,0XE6,0X9F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X24,0X84,0X44,0X92,0X8F,0X95,0XF5,0X37,
-0X71,0XDF,0XFF,0XFB,0X4F,0XFF,0XB6,0X68,0XFF,0XFA,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X2C,0XFF,0X0F,0XF9,0X4F,0X95,0XF5,0X7F,0XF5,
-0X9F,0XFF,0XFA,0X5F,0XFA,0X75,0X55,0X9D,0XFC,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X2F,0XFF,0X2F,0XF9,0X2F,0X95,0XF5,0X9F,0XF5,0X9F,
-0XFF,0XFA,0X6D,0X95,0X56,0X66,0X57,0XCC,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X2F,0XFF,0X2F,0XF9,0X2F,0X95,0XF5,0X9F,0XF5,0X9F,0XFF,
-0XE6,0X38,0X56,0X66,0X66,0X65,0X67,0X3B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X2F,0XFF,0X2F,0XF9,0X2F,0X95,0XF5,0X9F,0XF5,0X9F,0XFF,0XA0,
-0X01,0X21,0X11,0X11,0X22,0X10,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X2F,0XFF,0X2F,0XF9,0X2F,0X95,0XF5,0X9F,0XF5,0X9F,0XFF,0XC6,0X65,
-0X66,0X66,0X56,0X66,0X56,0X68,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0XCC,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X84,0X44,0X5A,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XC4,0X36,0X98,0X63,0X7E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFE,0X52,0XBF,0XFF,0XFA,0X37,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF9,0X2A,0XFF,0XFF,0XFF,0XA4,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF7,0X4F,0XFF,0XFF,0XFF,0XE6,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,
-0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X5F,
-0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XDD,0XEF,0XFF,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,
-0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0X94,0X44,0X6A,0XFF,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,
-0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XE6,0X36,0X88,0X64,0X8F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,
-0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X73,0XAF,0XFF,0XF9,0X48,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,
-0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFA,0X39,0XFF,0XFF,0XFF,0X95,0XCF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,
-0X5F,0XFF,0XFF,0XFF,0XE6,0X7F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X6F,
-0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,
-0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEE,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,
-0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XC7,0X44,0X7C,0XFF,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,
-0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF8,0X47,0X88,0X74,0X8F,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,
-0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X94,0X9E,0XFF,0XE9,0X49,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,
-0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,
-0X59,0XFF,0XFF,0XFF,0X95,0XCF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,
-0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X6E,
-0XFF,0XFF,0XFF,0XE6,0X9F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,
-0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,
-0XFF,0XFF,0XF7,0X7F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,
-0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,
-0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,
-0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,
-0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,
-0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,
-0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,
-0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XC6,0X44,0X6C,0XFF,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,0X6F,
-0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,
-0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF8,0X45,0X88,0X64,0X9F,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,
-0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,
-0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X94,
-0X9E,0XFF,0XE9,0X49,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,
-0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X58,0XFF,
-0XFF,0XFF,0X85,0XCF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,
-0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X5D,0XFF,0XFF,
-0XFF,0XE6,0X9F,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,
-0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X7F,0XFF,0XFF,0XFF,
-0XF6,0X7F,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,
-0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFD,0X97,0X69,0XDF,0XFF,0XFF,0XFF,0XF5,0X7F,0XFF,0XFF,0XFF,0XF6,
-0X7F,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,
-0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XA4,0X10,0X01,0X4A,0XFF,0XFF,0XFF,0XF5,0X7F,0XFF,0XFF,0XFF,0XF6,0X7F,
-0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,
-0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFB,0X20,0X00,0X00,0X02,0XBF,0XFF,0XFF,0XF5,0X7F,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,
-0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,
-0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD4,
-0X00,0X00,0X00,0X00,0X4D,0XFF,0XFF,0XF5,0X7F,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,
-0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,
-0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,0X00,
-0X00,0X00,0X00,0X09,0XFF,0XFF,0XF5,0X7F,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XF6,
-0X7F,0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,
-0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,0X00,
-0X00,0X00,0X08,0XFF,0XFF,0XF5,0X7F,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XF6,0X7F,
-0XFF,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,
-0XF7,0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X00,0X00,
-0X00,0X08,0XFF,0XFF,0XF5,0X7F,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XF6,0X7F,0XFF,
-0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,
-0X5F,0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X00,0X00,0X00,
-0X08,0XFF,0XFF,0XF5,0X7F,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,
-0XFF,0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,
-0XFF,0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X00,0X00,0X00,0X08,
-0XFF,0XFF,0XF5,0X7F,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,
-0XF7,0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,
-0XFF,0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X00,0X00,0X00,0X08,0XFF,
-0XFF,0XF5,0X7F,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XF7,0X7F,0XFF,0XFF,0XFF,0XF7,
-0X6F,0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,
-0XFF,0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X00,0X00,0X00,0X08,0XFF,0XFF,
-0XF5,0X7F,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XFF,0XF7,0X7F,
-0XFF,0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,
-0XE7,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X00,0X00,0X00,0X08,0XFF,0XFF,0XF5,
-0X8F,0XFF,0XFF,0XFF,0XF6,0X7F,0XFF,0XFF,0XF6,0X8F,0XFF,0XFF,0XFF,0XF8,0X6F,0XFF,
-0XFF,0XF7,0X6F,0XFF,0XFF,0XFF,0XF8,0X5F,0XFF,0XFF,0XF7,0X5F,0XFF,0XFF,0XFF,0XF7,
-0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X60,0X00,0X00,0X00,0X00,0X08,0XFF,0XFF,0XF5,0X26,
-0X66,0X66,0X66,0X61,0X7F,0XFF,0XFF,0XF6,0X26,0X66,0X66,0X66,0X62,0X6F,0XFF,0XFF,
-0XF7,0X16,0X66,0X66,0X66,0X62,0X5F,0XFF,0XFF,0XF7,0X16,0X66,0X66,0X66,0X62,0X5F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XB7,0X77,0X77,0X77,0X77,0X7B,0XFF,0XFF,0XFB,0X66,0X66,
-0X66,0X66,0X66,0XBF,0XFF,0XFF,0XFB,0X66,0X66,0X66,0X66,0X66,0XBF,0XFF,0XFF,0XFB,
-0X66,0X66,0X66,0X66,0X66,0XBF,0XFF,0XFF,0XFC,0X66,0X66,0X66,0X66,0X67,0XBF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,};
-
-const unsigned char gImage_dang2[7560] = { 
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X30,0X22,0X22,0X22,0X22,0X22,0X20,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XE2,0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XE2,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF0,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,
-0X77,0X77,0X77,0X77,0X77,0X64,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X15,
-0X66,0X66,0X66,0X64,0X1B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X41,0X56,
-0X66,0X66,0X40,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X15,0X66,
-0X64,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X41,0X56,0X40,
-0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X36,0X15,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X15,0X2E,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X37,0X2F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X89,0X66,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X64,0XCA,0XD4,0X7F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0XFF,
-0XED,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X5F,0XFA,0XEF,0X45,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X6F,0X3D,0XFF,0X84,0XCF,0X84,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X66,0XFF,0XCB,0XFF,0XF4,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,0XBF,0X84,0XFD,0X14,0X58,0X41,0X8E,
-0XFF,0XFF,0XFF,0XFB,0X3F,0XFF,0XFA,0XEF,0XFF,0X2C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X37,0XFF,0XF3,0X6C,0X24,0X50,0X42,0X1B,0XFF,
-0XFF,0XFF,0XF4,0XBF,0XFF,0X9A,0X9F,0XFF,0XA5,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X20,0X00,0X00,0X6E,0X90,0X80,0X84,0X4B,0XFF,0XFF,
-0XFF,0XF1,0XFF,0XFA,0X55,0X5C,0XFF,0XF1,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X0E,0XE0,0XFC,0X00,0X00,0X00,0X0B,0XFF,0XFF,0XFF,
-0XE2,0XFF,0X75,0X66,0X65,0X8F,0XF2,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF8,0X4F,0XB0,0XFF,0XF0,0XE6,0X63,0X7D,0XFF,0XFF,0XFF,0XD2,
-0XB6,0X66,0X66,0X66,0X65,0XE2,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X82,0XCC,0X83,0XFF,0XE0,0X1E,0X84,0XFF,0XFF,0XFF,0XFF,0X40,0X56,
-0X66,0X65,0X56,0X66,0X50,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFC,0X4C,0XF5,0X49,0XFF,0XC8,0XEF,0X85,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XED,0XDE,0XED,0XDD,
-0XED,0XDD,0XDD,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEE,0XEE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XE8,0X21,0X12,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFD,0X32,0XAE,0XFC,0X43,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF6,0X3E,0XFF,0XFF,0XF7,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XC1,0XBF,0XFF,0XFF,0XFD,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB2,
-0XFF,0XFF,0XFF,0XFF,0X84,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA2,0XFF,
-0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,
-0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XED,0XDD,0XFF,0XFF,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,
-0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF9,0X21,0X12,0X6D,0XFF,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,
-0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0X62,0XAF,0XFD,0X72,0XBF,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF9,0X2E,0XFF,0XFF,0XFA,0X2E,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD2,
-0XAF,0XFF,0XFF,0XFE,0X77,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD1,0XFF,
-0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,
-0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,
-0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XED,0XCD,0XEF,0XFF,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,
-0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFB,0X52,0X12,0X5B,0XFF,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,
-0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X92,0X9E,0XFE,0X92,0X9F,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,
-0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,
-0X2D,0XFF,0XFF,0XFD,0X2C,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,
-0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X9F,
-0XFF,0XFF,0XFF,0X95,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,
-0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0XDF,0XFF,
-0XFF,0XFF,0XD2,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,
-0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,
-0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,
-0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,
-0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,
-0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,
-0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,
-0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XEC,0XCC,0XDF,0XFF,0XFF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,
-0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,
-0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFB,0X30,0X00,0X19,0XFF,0XFF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,
-0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,
-0X00,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,
-0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,
-0X00,0X00,0X09,0XFF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,
-0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0X00,
-0X00,0X03,0XEF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,
-0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,
-0X00,0XEF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,
-0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFE,0XCB,0XBD,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,
-0XEF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,
-0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XC5,0X00,0X01,0X8E,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XDF,
-0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,
-0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFB,0X10,0X00,0X00,0X04,0XEF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,
-0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,
-0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,
-0X00,0X00,0X00,0X00,0X8F,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,
-0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,
-0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,
-0X00,0X00,0X00,0X1D,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XF1,
-0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,
-0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,
-0X00,0X00,0X0C,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XF1,0XEF,
-0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,
-0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,
-0X00,0X0C,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XF1,0XEF,0XFF,
-0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,
-0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,
-0X0C,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XDF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,
-0XFF,0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,
-0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,0X0C,
-0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XDF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,
-0XE1,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,
-0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,0X0C,0XFF,
-0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,
-0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XC1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,
-0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,0X0C,0XFF,0XFF,
-0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XF1,0XEF,0XFF,0XFF,0XFF,0XE1,0XFF,
-0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XB1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,
-0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,0X0C,0XFF,0XFF,0XF3,
-0X00,0X00,0X00,0X00,0X00,0XDF,0XFF,0XFF,0XF1,0XFF,0XFF,0XFF,0XFF,0XF1,0XFF,0XFF,
-0XFF,0XD1,0XFF,0XFF,0XFF,0XFF,0XD1,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0XA2,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0B,0XFF,0XFF,0XF1,0X00,
-0X00,0X00,0X00,0X00,0XDF,0XFF,0XFF,0XF0,0X78,0X88,0X88,0X88,0X70,0XFF,0XFF,0XFF,
-0XD0,0X88,0X88,0X88,0X88,0X50,0XFF,0XFF,0XFF,0XA0,0X88,0X88,0X88,0X88,0X42,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X96,0X66,0X66,0X66,0X66,0X6D,0XFF,0XFF,0XF8,0X66,0X66,
-0X66,0X66,0X66,0XEF,0XFF,0XFF,0XF6,0X43,0X33,0X33,0X33,0X36,0XFF,0XFF,0XFF,0XE5,
-0X33,0X33,0X33,0X33,0X48,0XFF,0XFF,0XFF,0XD5,0X33,0X33,0X33,0X33,0X49,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,};
-
-const unsigned char gImage_dang3[7560] = { 
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF3,0X02,0X22,0X22,0X22,0X22,0X32,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFD,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X0F,0XFF,0XFF,0XFF,0XFF,0XFE,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X37,0X77,0X77,0X77,0X77,0X76,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA1,
-0X56,0X66,0X66,0X66,0X41,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X15,
-0X66,0X66,0X64,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X31,0X56,
-0X66,0X40,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X15,0X64,
-0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X43,0X61,0X5F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,0X52,0XEF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE3,0X72,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X57,0X96,0X6F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X4C,0XAD,0X47,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFE,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0X55,0XFF,0XAE,0XF4,0X5F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X86,0XF3,0XDF,0XF8,0X4C,0XF8,
-0X4F,0XFF,0XFF,0XFF,0XFF,0XF6,0X6F,0XFC,0XBF,0XFF,0X47,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X1B,0XF8,0X4F,0XD1,0X45,0X84,0X28,
-0XEF,0XFF,0XFF,0XFF,0XB3,0XFF,0XFE,0XAE,0XFF,0XF2,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE3,0X7F,0XFF,0X36,0XC2,0X45,0X04,0X22,0XBF,
-0XFF,0XFF,0XFF,0X4B,0XFF,0XF9,0XA9,0XFF,0XFA,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA2,0X00,0X00,0X06,0XE9,0X08,0X08,0X44,0XBF,0XFF,
-0XFF,0XFF,0X1F,0XFF,0XA5,0X55,0XCF,0XFF,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0XEF,0X0F,0XC0,0X00,0X00,0X00,0XBF,0XFF,0XFF,
-0XFE,0X2F,0XF7,0X56,0X66,0X58,0XFF,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X84,0XFB,0X0F,0XFF,0X0E,0X66,0X37,0XDF,0XFF,0XFF,0XFD,
-0X2B,0X66,0X66,0X66,0X66,0X5E,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF8,0X2C,0XC8,0X3F,0XFE,0X01,0XE8,0X4F,0XFF,0XFF,0XFF,0XF4,0X05,
-0X66,0X66,0X66,0X56,0X55,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XC4,0XCF,0X54,0X9F,0XFC,0X8E,0XF8,0X5F,0XFF,0XFF,0XFF,0XE0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XDD,0XEE,0XDD,
-0XDD,0XDD,0XDD,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEE,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0X82,0X11,0X27,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XD3,0X2A,0XEF,0XC4,0X3D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X63,0XEF,0XFF,0XFF,0X73,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFC,0X1B,0XFF,0XFF,0XFF,0XD5,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,
-0X2F,0XFF,0XFF,0XFF,0XF8,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X2F,
-0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X2F,0XFF,
-0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XDD,0XEE,0XFF,0XFF,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,
-0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X92,0X11,0X26,0XDF,0XFF,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,
-0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XE6,0X2A,0XFF,0XD7,0X2B,0XFF,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,
-0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X92,0XEF,0XFF,0XFF,0XA2,0XEF,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,
-0X2A,0XFF,0XFF,0XFF,0XF7,0X7F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X1F,
-0XFF,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X1F,0XFF,
-0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,
-0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0XDD,0XDE,0XFF,0XFF,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,
-0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XB4,0X00,0X04,0XBF,0XFF,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,
-0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF9,0X00,0X00,0X00,0X09,0XFF,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,
-0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XC0,0X00,0X00,0X00,0X00,0XCF,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,
-0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,
-0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,
-0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,
-0X00,0X00,0X00,0X2F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,
-0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,
-0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,
-0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,
-0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,
-0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,
-0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,
-0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFE,0XCC,0XCD,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,
-0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,
-0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XB3,0X00,0X01,0X9E,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,
-0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,
-0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,
-0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,
-0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,
-0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,
-0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,
-0X00,0X00,0X3E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X1F,
-0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,
-0X00,0X0E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,
-0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XEC,0XBB,0XDF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,
-0X0E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,
-0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFC,0X50,0X00,0X18,0XEF,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0D,
-0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,
-0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XB1,0X00,0X00,0X00,0X4E,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0D,0XFF,
-0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,
-0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0X20,0X00,0X00,0X00,0X08,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,
-0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,
-0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,
-0X00,0X00,0X00,0X01,0XDF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,
-0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,
-0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,
-0X00,0X00,0X00,0XCF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,0X10,
-0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,
-0XFA,0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,
-0X00,0X00,0XCF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,0X10,0X00,
-0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,
-0X2F,0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,
-0X00,0XCF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0X10,0X00,0X00,
-0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,
-0XFF,0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,
-0XCF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,
-0X00,0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,
-0XFF,0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,0XCF,
-0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,
-0X1F,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFC,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,
-0XFF,0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,0XCF,0XFF,
-0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,
-0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFB,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,
-0XF9,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,0XCF,0XFF,0XFF,
-0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,
-0XFF,0XFD,0X1F,0XFF,0XFF,0XFF,0XFD,0X1F,0XFF,0XFF,0XFA,0X2F,0XFF,0XFF,0XFF,0XFA,
-0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XBF,0XFF,0XFF,0X10,
-0X00,0X00,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X00,0X0F,0XFF,0XFF,
-0XFD,0X08,0X88,0X88,0X88,0X85,0X0F,0XFF,0XFF,0XFA,0X08,0X88,0X88,0X88,0X84,0X2F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X66,0X66,0X66,0X66,0X66,0XDF,0XFF,0XFF,0X86,0X66,
-0X66,0X66,0X66,0X6E,0XFF,0XFF,0XFF,0X66,0X66,0X66,0X65,0X66,0X6F,0XFF,0XFF,0XFE,
-0X53,0X33,0X33,0X33,0X34,0X8F,0XFF,0XFF,0XFD,0X53,0X33,0X33,0X33,0X34,0X9F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,};
-
-const unsigned char gImage_dang4[7560] = { 
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X30,0X22,0X22,0X22,0X22,0X22,0X20,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XE2,0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XE2,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF0,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,
-0X77,0X77,0X77,0X77,0X77,0X64,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X15,
-0X66,0X66,0X66,0X64,0X1B,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X41,0X56,
-0X66,0X66,0X40,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X15,0X66,
-0X64,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X41,0X56,0X40,
-0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X36,0X15,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X15,0X2E,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X37,0X2F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X89,0X66,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X64,0XCA,0XD4,0X7F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0XFF,
-0XED,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X5F,0XFA,0XEF,0X45,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X6F,0X3D,0XFF,0X84,0XCF,0X84,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X66,0XFF,0XCB,0XFF,0XF4,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,0XBF,0X84,0XFD,0X14,0X58,0X41,0X8E,
-0XFF,0XFF,0XFF,0XFB,0X3F,0XFF,0XFA,0XEF,0XFF,0X2C,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X37,0XFF,0XF3,0X6C,0X24,0X50,0X42,0X1B,0XFF,
-0XFF,0XFF,0XF4,0XBF,0XFF,0X9A,0X9F,0XFF,0XA5,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFA,0X20,0X00,0X00,0X6E,0X90,0X80,0X84,0X4B,0XFF,0XFF,
-0XFF,0XF1,0XFF,0XFA,0X55,0X5C,0XFF,0XF1,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X0E,0XE0,0XFC,0X00,0X00,0X00,0X0B,0XFF,0XFF,0XFF,
-0XE2,0XFF,0X75,0X66,0X65,0X8F,0XF2,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF8,0X4F,0XB0,0XFF,0XF0,0XE6,0X63,0X7D,0XFF,0XFF,0XFF,0XD2,
-0XB6,0X66,0X66,0X66,0X65,0XE2,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0X82,0XCC,0X83,0XFF,0XE0,0X1E,0X84,0XFF,0XFF,0XFF,0XFF,0X40,0X56,
-0X66,0X65,0X56,0X66,0X50,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFC,0X4C,0XF5,0X49,0XFF,0XC8,0XEF,0X85,0XFF,0XFF,0XFF,0XFE,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XED,0XDE,0XED,0XDD,
-0XED,0XDD,0XDD,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEE,0XEE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XE8,0X21,0X12,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFD,0X32,0XAE,0XFC,0X43,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF6,0X3E,0XFF,0XFF,0XF7,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XC1,0XBF,0XFF,0XFF,0XFD,0X59,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XB2,
-0XFF,0XFF,0XFF,0XFF,0X84,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA2,0XFF,
-0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,
-0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XEE,0XEE,0XEF,0XFF,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,
-0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFA,0X10,0X00,0X6D,0XFF,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,
-0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X60,0X00,0X00,0X01,0XBF,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF9,0X00,0X00,0X00,0X00,0X2E,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,
-0X00,0X00,0X00,0X00,0X08,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,
-0X00,0X00,0X00,0X04,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X00,
-0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,
-0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XED,0XDD,0XEF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,
-0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFB,0X40,0X00,0X4B,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,
-0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X90,0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,
-0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,
-0X00,0X00,0X00,0X00,0X0C,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,
-0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,
-0X00,0X00,0X00,0X05,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,
-0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,
-0X00,0X00,0X02,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,
-0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0X00,
-0X00,0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,
-0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,
-0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,
-0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,
-0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,
-0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XEC,0XCC,0XDF,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,
-0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,
-0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFB,0X30,0X00,0X19,0XFF,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,
-0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X90,
-0X00,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,
-0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,
-0X00,0X00,0X09,0XFF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XD0,
-0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X00,0X00,0X00,
-0X00,0X03,0XEF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XD0,0X00,
-0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,
-0X00,0XEF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,
-0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFE,0XCB,0XBD,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,
-0XEF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,
-0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XC5,0X00,0X01,0X8E,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XDF,
-0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,
-0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFB,0X10,0X00,0X00,0X04,0XEF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,
-0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,
-0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE2,
-0X00,0X00,0X00,0X00,0X8F,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,
-0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,
-0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X70,0X00,
-0X00,0X00,0X00,0X1D,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XF1,
-0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,
-0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,
-0X00,0X00,0X0C,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XF1,0X00,
-0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,
-0XA2,0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,
-0X00,0X0C,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XF1,0X00,0X00,
-0X00,0X00,0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,
-0XFF,0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,
-0X0C,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XF1,0X00,0X00,0X00,
-0X00,0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,
-0XFF,0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,0X0C,
-0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XDF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,
-0X01,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,
-0XFF,0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,0X0C,0XFF,
-0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,
-0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,
-0XFF,0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,0X0C,0XFF,0XFF,
-0XF3,0X00,0X00,0X00,0X00,0X00,0XEF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,
-0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,
-0X93,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,0X00,0X00,0X00,0X00,0X0C,0XFF,0XFF,0XF3,
-0X00,0X00,0X00,0X00,0X00,0XDF,0XFF,0XFF,0XF1,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,
-0XFF,0XD0,0X00,0X00,0X00,0X00,0X03,0XFF,0XFF,0XFF,0XA2,0XFF,0XFF,0XFF,0XFF,0XA2,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0B,0XFF,0XFF,0XF1,0X00,
-0X00,0X00,0X00,0X00,0XDF,0XFF,0XFF,0XF0,0X00,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,
-0XD0,0X00,0X00,0X00,0X00,0X01,0XFF,0XFF,0XFF,0XA0,0X88,0X88,0X88,0X88,0X42,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X96,0X66,0X66,0X66,0X66,0X6D,0XFF,0XFF,0XF8,0X66,0X66,
-0X66,0X66,0X66,0XEF,0XFF,0XFF,0XF6,0X66,0X56,0X66,0X66,0X66,0XFF,0XFF,0XFF,0XE6,
-0X66,0X66,0X66,0X66,0X68,0XFF,0XFF,0XFF,0XD5,0X33,0X33,0X33,0X33,0X49,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,};
-
-const unsigned char gImage_dang5[7560] = { 
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF3,0X02,0X22,0X22,0X22,0X22,0X32,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFD,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X0F,0XFF,0XFF,0XFF,0XFF,0XFE,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0X37,0X77,0X77,0X77,0X77,0X76,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA1,
-0X56,0X66,0X66,0X66,0X41,0XBF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X15,
-0X66,0X66,0X64,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X31,0X56,
-0X66,0X40,0X4F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X15,0X64,
-0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X43,0X61,0X5F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE1,0X52,0XEF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE3,0X72,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X57,0X96,0X6F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF5,0X4C,0XAD,0X47,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,
-0XFE,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0X55,0XFF,0XAE,0XF4,0X5F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X86,0XF3,0XDF,0XF8,0X4C,0XF8,
-0X4F,0XFF,0XFF,0XFF,0XFF,0XF6,0X6F,0XFC,0XBF,0XFF,0X47,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X1B,0XF8,0X4F,0XD1,0X45,0X84,0X28,
-0XEF,0XFF,0XFF,0XFF,0XB3,0XFF,0XFE,0XAE,0XFF,0XF2,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE3,0X7F,0XFF,0X36,0XC2,0X45,0X04,0X22,0XBF,
-0XFF,0XFF,0XFF,0X4B,0XFF,0XF9,0XA9,0XFF,0XFA,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XA2,0X00,0X00,0X06,0XE9,0X08,0X08,0X44,0XBF,0XFF,
-0XFF,0XFF,0X1F,0XFF,0XA5,0X55,0XCF,0XFF,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0XEF,0X0F,0XC0,0X00,0X00,0X00,0XBF,0XFF,0XFF,
-0XFE,0X2F,0XF7,0X56,0X66,0X58,0XFF,0X2F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0X84,0XFB,0X0F,0XFF,0X0E,0X66,0X37,0XDF,0XFF,0XFF,0XFD,
-0X2B,0X66,0X66,0X66,0X66,0X5E,0X2E,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XF8,0X2C,0XC8,0X3F,0XFE,0X01,0XE8,0X4F,0XFF,0XFF,0XFF,0XF4,0X05,
-0X66,0X66,0X66,0X56,0X55,0X05,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XC4,0XCF,0X54,0X9F,0XFC,0X8E,0XF8,0X5F,0XFF,0XFF,0XFF,0XE0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XDD,0XEE,0XDD,
-0XDD,0XDD,0XDD,0XDE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0X81,0X00,0X17,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XD3,0X00,0X00,0X00,0X3D,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0X60,0X00,0X00,0X00,0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFC,0X00,0X00,0X00,0X00,0X01,0XAF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,
-0X00,0X00,0X00,0X00,0X00,0X6F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,
-0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X00,
-0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XEE,0XEF,0XFF,0XFF,0XFF,0XFF,0XFB,0X00,0X00,0X00,
-0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XA1,0X00,0X05,0XDF,0XFF,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,
-0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XF6,0X00,0X00,0X00,0X1B,0XFF,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,
-0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X90,0X00,0X00,0X00,0X02,0XEF,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0X10,0X00,0X00,0X00,0X00,0X8F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X00,
-0X00,0X00,0X00,0X00,0X4F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,
-0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X00,
-0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFE,0XDD,0XDE,0XFF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,
-0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XB4,0X00,0X04,0XBF,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,
-0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XF9,0X00,0X00,0X00,0X09,0XFF,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,
-0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XC0,0X00,0X00,0X00,0X00,0XCF,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,
-0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X40,
-0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,
-0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,
-0X00,0X00,0X00,0X2F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,
-0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,
-0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,
-0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,
-0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,
-0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,
-0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,
-0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFE,0XCC,0XCD,0XFF,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,
-0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,
-0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XB3,0X00,0X01,0X9E,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,
-0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,
-0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,
-0X00,0X00,0X00,0X06,0XFF,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,
-0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,
-0X00,0X00,0X00,0X9F,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,
-0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X50,0X00,0X00,
-0X00,0X00,0X3E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X00,
-0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,
-0X00,0X0E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,
-0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XEC,0XBB,0XDF,0XFF,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,
-0X0E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,
-0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFC,0X50,0X00,0X18,0XEF,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0D,
-0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,
-0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XB1,0X00,0X00,0X00,0X4E,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0D,0XFF,
-0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,
-0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0X20,0X00,0X00,0X00,0X08,0XFF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,
-0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,
-0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF7,0X00,
-0X00,0X00,0X00,0X01,0XDF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,
-0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,
-0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,
-0X00,0X00,0X00,0XCF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,0X10,
-0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,
-0XFB,0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,
-0X00,0X00,0XCF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,0X10,0X00,
-0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,
-0X00,0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,
-0X00,0XCF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0X10,0X00,0X00,
-0X00,0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,
-0X00,0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,
-0XCF,0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,
-0X00,0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFC,0X00,0X00,
-0X00,0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,0XCF,
-0XFF,0XFF,0X30,0X00,0X00,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,
-0X1F,0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,
-0X00,0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,0XCF,0XFF,
-0XFF,0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,
-0XFF,0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFC,0X00,0X00,0X00,0X00,
-0X00,0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF4,0X00,0X00,0X00,0X00,0X00,0XCF,0XFF,0XFF,
-0X30,0X00,0X00,0X00,0X00,0X0E,0XFF,0XFF,0XFF,0X10,0X00,0X00,0X00,0X00,0X1F,0XFF,
-0XFF,0XFD,0X00,0X00,0X00,0X00,0X00,0X3F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,
-0X5F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0X00,0X00,0X00,0X00,0X00,0XBF,0XFF,0XFF,0X10,
-0X00,0X00,0X00,0X00,0X0D,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X00,0X0F,0XFF,0XFF,
-0XFD,0X00,0X00,0X00,0X00,0X00,0X1F,0XFF,0XFF,0XFB,0X00,0X00,0X00,0X00,0X00,0X4F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0X66,0X66,0X66,0X66,0X66,0XDF,0XFF,0XFF,0X86,0X66,
-0X66,0X66,0X66,0X6E,0XFF,0XFF,0XFF,0X66,0X66,0X66,0X66,0X66,0X6F,0XFF,0XFF,0XFE,
-0X66,0X66,0X66,0X66,0X66,0X8F,0XFF,0XFF,0XFD,0X66,0X66,0X66,0X66,0X66,0X9F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,};
+/* 126x174，原始10962字节 */
+static const unsigned char s_gImage_mode3_126x174_rle[2403] ASSET_SECTION = {
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0X86,0X80,0X00,0X10,0X90,0XFF,0X69,0XB0,0X03,0XB0,0XFF,0X68,0X20,0X03,0X10,
+0XE0,0XFF,0X66,0X90,0X05,0X40,0XFF,0X65,0XE0,0X10,0X06,0X90,0XFF,0X64,0X70,0X07,
+0X10,0XE0,0XFF,0X62,0XD0,0X04,0X40,0X03,0X50,0XFF,0X62,0X50,0X03,0X80,0XE0,0X10,
+0X03,0XB0,0XFF,0X60,0XC0,0X03,0X20,0XF1,0XA0,0X03,0X20,0XFF,0X60,0X30,0X03,0XA0,
+0XF2,0X30,0X03,0X70,0XFF,0X5E,0XA0,0X03,0X30,0XF3,0XD0,0X04,0XD0,0XFF,0X5D,0X10,
+0X03,0XC0,0XF4,0X70,0X03,0X30,0XFF,0X5C,0X70,0X03,0X60,0XF6,0X20,0X03,0X90,0XFF,
+0X5A,0XE0,0X04,0XE0,0XF6,0XB0,0X03,0X10,0XE0,0XFF,0X59,0X50,0X03,0X80,0XF8,0X50,
+0X03,0X60,0XFF,0X58,0XC0,0X03,0X10,0XF9,0XE0,0X10,0X03,0XC0,0XFF,0X57,0X30,0X03,
+0XA0,0XFA,0X90,0X03,0X20,0XFF,0X56,0XA0,0X03,0X30,0XFC,0X30,0X03,0X80,0XFF,0X55,
+0X10,0X03,0XC0,0XFC,0XD0,0X04,0XE0,0XFF,0X53,0X80,0X03,0X50,0XFE,0X60,0X03,0X50,
+0XFF,0X52,0XE0,0X04,0XE0,0XFF,0X00,0X10,0X03,0XB0,0XFF,0X51,0X60,0X03,0X70,0XFF,
+0X01,0XA0,0X03,0X20,0XFF,0X50,0XC0,0X03,0X10,0XFF,0X03,0X30,0X03,0X80,0XFF,0X4F,
+0X30,0X03,0X90,0XFF,0X03,0XD0,0X04,0XE0,0XFF,0X4D,0XA0,0X03,0X30,0XFF,0X05,0X70,
+0X03,0X50,0XFF,0X4D,0X20,0X03,0XC0,0XFF,0X06,0X10,0X03,0XB0,0XFF,0X4B,0X80,0X03,
+0X50,0XFF,0X07,0XA0,0X03,0X20,0XFF,0X4A,0XE0,0X04,0XD0,0XFF,0X08,0X40,0X03,0X80,
+0XFF,0X49,0X60,0X03,0X70,0XFF,0X09,0XD0,0X04,0XD0,0XFF,0X47,0XD0,0X03,0X10,0XE0,
+0XFF,0X0A,0X70,0X03,0X40,0XFF,0X47,0X40,0X03,0X90,0XFF,0X0C,0X10,0X03,0XB0,0XFF,
+0X45,0XB0,0X03,0X20,0XFF,0X0D,0XB0,0X03,0X20,0XFF,0X45,0X20,0X03,0XB0,0XFF,0X0E,
+0X40,0X03,0X70,0XFF,0X43,0X90,0X03,0X40,0XFF,0X08,0XE0,0XD0,0XF4,0XD0,0X04,0XD0,
+0XFF,0X41,0XE0,0X10,0X03,0XD0,0XFF,0X06,0XD0,0X40,0X02,0X40,0XE0,0XF2,0X80,0X03,
+0X40,0XFF,0X41,0X70,0X03,0X60,0XFF,0X06,0XD0,0X10,0X04,0X20,0XE0,0XF2,0X20,0X03,
+0XA0,0XFF,0X3F,0XD0,0X03,0X10,0XE0,0XFF,0X06,0X40,0X06,0X70,0XF2,0XB0,0X03,0X10,
+0XFF,0X3F,0X40,0X03,0X90,0XFF,0X07,0X07,0X20,0XF3,0X50,0X03,0X70,0XFF,0X3D,0XB0,
+0X03,0X20,0XFF,0X08,0X07,0X10,0XF3,0XD0,0X04,0XD0,0XFF,0X3C,0X20,0X03,0XB0,0XFF,
+0X08,0X10,0X06,0X30,0XF4,0X80,0X03,0X30,0XFF,0X3B,0X90,0X03,0X40,0XFF,0X09,0X80,
+0X06,0XA0,0XF5,0X20,0X03,0XA0,0XFF,0X3A,0X10,0X03,0XD0,0XFF,0X0A,0X05,0X70,0XF6,
+0XB0,0X03,0X10,0XFF,0X39,0X70,0X03,0X60,0XFF,0X0B,0X04,0XB0,0XF8,0X50,0X03,0X60,
+0XFF,0X37,0XE0,0X04,0XE0,0XFF,0X0A,0XD0,0X03,0X60,0XF9,0XE0,0X04,0XD0,0XFF,0X36,
+0X70,0X03,0X80,0XFF,0X0B,0XB0,0X03,0X90,0XFA,0X80,0X03,0X40,0XFF,0X36,0X10,0X02,
+0X10,0XFF,0X0C,0X50,0X03,0XB0,0XFB,0X20,0X03,0XD0,0XFF,0X34,0XA0,0X03,0X80,0XFF,
+0X09,0XE0,0X70,0X20,0X04,0XB0,0XFB,0XA0,0X03,0X70,0XFF,0X34,0X50,0X03,0XE0,0XFF,
+0X08,0X80,0X07,0X20,0XD0,0XFB,0X20,0X02,0X20,0XFF,0X34,0X03,0X40,0XFF,0X08,0X50,
+0X09,0X10,0XD0,0XFA,0X80,0X03,0XE0,0XFF,0X32,0XC0,0X03,0X90,0XFF,0X07,0X90,0X0B,
+0X20,0XFA,0XC0,0X03,0XA0,0XFF,0X32,0X80,0X03,0XE0,0XFF,0X07,0X20,0X0C,0XA0,0XFA,
+0X03,0X90,0XFF,0X32,0X50,0X02,0X10,0XFF,0X07,0XE0,0X0D,0X50,0XFA,0X03,0X80,0XF6,
+0XC0,0X90,0X80,0X90,0XC0,0XFF,0X26,0X30,0X02,0X40,0XFF,0X07,0XC0,0X0D,0X20,0XFA,
+0X40,0X02,0XB0,0XF4,0XA0,0X20,0X04,0X20,0XA0,0XFF,0X24,0X10,0X02,0X60,0XFF,0X07,
+0XA0,0X0D,0X10,0XFA,0XE0,0X60,0X40,0X90,0XF4,0X60,0X08,0X60,0XFF,0X23,0X03,0X80,
+0XFF,0X06,0X90,0X10,0X0D,0X20,0XFF,0X03,0X70,0X0A,0X80,0XFF,0X22,0X03,0X80,0XFE,
+0XA0,0X50,0X30,0X50,0X90,0X70,0X10,0X0F,0X00,0X60,0XFF,0X02,0XD0,0X0C,0XD0,0XFF,
+0X21,0X03,0X80,0XFD,0X40,0X0F,0X07,0X90,0XFF,0X02,0X60,0X0C,0X60,0XFF,0X21,0X03,
+0X80,0XFC,0X80,0X0F,0X08,0X20,0XE0,0XFF,0X01,0X10,0X0C,0X10,0XFF,0X21,0X10,0X02,
+0X60,0XFC,0X10,0X09,0X30,0X60,0X0C,0X20,0XD0,0XFF,0X00,0X0E,0XFF,0X21,0X30,0X02,
+0X40,0XFC,0X08,0X30,0XC0,0XF1,0XD0,0X30,0X0C,0X81,0X30,0X02,0X30,0X80,0XF6,0XC0,
+0X0E,0XFF,0X21,0X60,0X02,0X10,0XFC,0X07,0X10,0XF5,0XB0,0X60,0X30,0X20,0X30,0X70,
+0X90,0X20,0X0C,0X10,0XC0,0XF2,0XE0,0X90,0X10,0X0D,0X20,0XFF,0X21,0X80,0X03,0XE0,
+0XFB,0X50,0X06,0X70,0XFD,0X50,0X0D,0X90,0XA0,0X50,0X0F,0X01,0X60,0XFF,0X21,0XC0,
+0X03,0X90,0XFB,0XE0,0X10,0X04,0X20,0XE0,0XFE,0X70,0X0F,0X11,0XD0,0XFF,0X22,0X03,
+0X50,0XFC,0XE0,0X40,0X02,0X50,0XE0,0XFF,0X01,0X30,0X0F,0X0F,0X80,0XFF,0X23,0X40,
+0X03,0XE0,0XFE,0XE0,0XFF,0X04,0X30,0X0F,0X02,0X30,0X70,0X50,0X08,0X70,0XFF,0X24,
+0XA0,0X03,0X90,0XFF,0X14,0X0F,0X00,0X50,0XA0,0XF3,0XB0,0X20,0X04,0X30,0XB0,0XFF,
+0X26,0X10,0X02,0X10,0XFF,0X14,0X0E,0XA0,0XF7,0XD0,0XA0,0X90,0XA0,0XD0,0XFF,0X28,
+0X60,0X03,0X90,0XFF,0X13,0X0E,0XFF,0X36,0XE0,0X03,0X10,0XE0,0XFF,0X12,0X40,0X0C,
+0X40,0XFF,0X37,0X70,0X03,0X60,0XFF,0X12,0XA0,0X0C,0XA0,0XFF,0X37,0XE0,0X04,0XB0,
+0XFF,0X12,0X30,0X0A,0X30,0XFF,0X39,0X90,0X03,0X10,0XE0,0XFF,0X11,0XE0,0X10,0X08,
+0X10,0XD0,0XFF,0X3A,0X30,0X03,0X20,0XFF,0X12,0XE0,0X07,0X40,0XE0,0XFF,0X3B,0XE0,
+0X10,0X03,0X30,0XFF,0X12,0X30,0X03,0X10,0X60,0XB0,0XFF,0X3E,0XB0,0X04,0X30,0XFF,
+0X11,0X20,0X03,0XE0,0XFF,0X41,0X80,0X04,0X20,0XE0,0XFF,0X0E,0XC0,0X03,0X30,0XFF,
+0X43,0X70,0X04,0X10,0XB0,0XFF,0X0C,0X80,0X04,0X40,0XFF,0X44,0X70,0X05,0X60,0XFF,
+0X0A,0X90,0X06,0XE0,0XFF,0X44,0X90,0X05,0X10,0XA0,0XFF,0X08,0X10,0X06,0X70,0XFF,
+0X45,0XB0,0X10,0X05,0X20,0XA0,0XFF,0X01,0XC0,0XB0,0XF1,0XD0,0X07,0X30,0XFF,0X46,
+0XD0,0X30,0X07,0X60,0XB0,0XFA,0XC0,0X70,0X20,0X01,0X20,0XF0,0XC0,0X07,0X40,0XFF,
+0X48,0X90,0X09,0X20,0X50,0X70,0X80,0X91,0X80,0X60,0X30,0X06,0XA0,0XF0,0X07,0X70,
+0XFF,0X49,0XE0,0X60,0X0F,0X08,0XB0,0XF0,0X80,0X05,0X10,0XE0,0XFF,0X4B,0XE0,0X60,
+0X0F,0X05,0X50,0XF2,0X70,0X03,0X20,0XC0,0XFF,0X4F,0XA0,0X40,0X0E,0X20,0X80,0XD0,
+0XF4,0XD0,0X90,0X80,0XB0,0XFF,0X54,0XB0,0X80,0X50,0X20,0X10,0X03,0X20,0X40,0X70,
+0XA0,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF2,0XE0,
+0XF3,0XE0,0XFF,0X02,0XE1,0XFF,0X3D,0X50,0XB0,0XF3,0X90,0XE0,0XF7,0XC0,0X70,0X81,
+0XC0,0XF1,0X40,0X60,0XF1,0X80,0X30,0XFA,0XC0,0XA1,0XC0,0XF2,0XA0,0X10,0XE0,0XFC,
+0XD0,0XB0,0XA1,0X90,0XA0,0XB0,0XA0,0X90,0XA1,0X90,0XB0,0XFF,0X1C,0XB0,0X50,0X60,
+0XB0,0X90,0X70,0X10,0X40,0X80,0XC0,0XF0,0X70,0X10,0XE0,0XF7,0XA0,0X31,0X00,0X30,
+0XF1,0X80,0X00,0XD0,0XE0,0X00,0X70,0XF9,0XE0,0X10,0X21,0X10,0XD1,0XC1,0X00,0X50,
+0XC1,0XD0,0XF9,0X40,0X00,0X21,0X31,0X00,0X10,0X30,0X21,0X10,0X40,0XFF,0X1C,0X40,
+0X20,0X31,0X80,0X70,0X20,0X40,0X60,0XE0,0XA0,0X00,0XB0,0XFB,0XA0,0X30,0XF0,0X80,
+0X20,0X00,0X31,0X00,0X20,0X60,0XE0,0XF7,0XC0,0X10,0XD1,0X30,0X80,0X21,0X30,0X20,
+0X10,0X30,0X10,0X20,0XD0,0XF8,0X20,0X40,0XF2,0XB0,0X00,0XB0,0XF3,0XE0,0XFF,0X1C,
+0X40,0XC0,0XB0,0X60,0XF0,0XD0,0X10,0X80,0XF0,0X90,0X00,0X90,0XFC,0X90,0X50,0XF0,
+0X00,0X50,0XB0,0X30,0X10,0XB0,0X70,0X00,0XB0,0XF7,0XC0,0X20,0XF1,0X30,0XB1,0XA0,
+0X80,0XC0,0XA0,0X80,0XB1,0XE0,0XF8,0X20,0X70,0XF0,0X80,0X50,0X10,0X00,0X42,0X50,
+0XA0,0XFF,0X1D,0X50,0XA1,0X70,0XA0,0X50,0X41,0X70,0X50,0XA0,0XF0,0X80,0X70,0XF8,
+0X50,0X20,0X00,0X40,0XF0,0X10,0XA0,0XF0,0X60,0X30,0XF0,0XC0,0X10,0XB0,0XF7,0XD0,
+0X20,0X41,0X10,0XF1,0X30,0X80,0XF0,0XD0,0X30,0XA0,0XFA,0X20,0X70,0XD0,0X00,0X50,
+0XB0,0XC0,0XB0,0XA1,0X30,0X20,0XFF,0X1D,0X50,0XA0,0X90,0X60,0XE0,0XC1,0XB0,0XC0,
+0XF1,0XB0,0X00,0X90,0XF7,0XD0,0X00,0X70,0X91,0XF0,0X30,0X10,0X40,0X10,0X00,0X40,
+0X11,0XD0,0XF7,0XD0,0X10,0X50,0X40,0X20,0XD0,0X40,0X30,0XE0,0XF1,0XA0,0X10,0X90,
+0XF9,0X20,0X70,0XD0,0X10,0X60,0XA0,0X90,0XA2,0X30,0X40,0XFF,0X1D,0X50,0XA1,0X70,
+0X90,0X30,0X50,0X40,0X30,0XF0,0XE0,0X10,0X70,0XF8,0XA0,0X10,0XD0,0XF1,0XD0,0X10,
+0X90,0XF0,0X60,0X30,0XF0,0XB0,0X10,0XB0,0XF7,0XC0,0X20,0XE0,0XF0,0X40,0X30,0X20,
+0XB0,0XF2,0XC0,0X40,0X30,0XE0,0XF8,0X20,0X60,0XE0,0X10,0X30,0X61,0X50,0X61,0X10,
+0X40,0XFF,0X1D,0X50,0XA1,0X70,0X60,0X70,0XF0,0XD0,0X30,0X90,0X20,0X50,0XF9,0XA0,
+0X00,0X50,0X90,0XD0,0XE0,0X10,0X50,0XA0,0X40,0X20,0XA0,0X70,0X00,0XB0,0XF7,0XD0,
+0X20,0XB1,0X20,0X90,0XC0,0X10,0X90,0XF0,0XD0,0X00,0XA0,0XE0,0XF9,0X20,0X70,0XD0,
+0X00,0X70,0XC1,0XD0,0XC1,0X40,0X20,0XFF,0X1D,0X50,0XB1,0X71,0X20,0X50,0X40,0X31,
+0X70,0XF1,0X90,0XF7,0XD0,0X60,0X40,0X00,0X30,0XF0,0X30,0X10,0X40,0X10,0X00,0X40,
+0X20,0X00,0XC0,0XF7,0XE0,0X10,0X01,0X10,0XF1,0X40,0X20,0XF0,0X70,0X00,0XFB,0X20,
+0X80,0XD0,0X10,0X30,0X40,0X10,0X00,0X10,0X40,0X00,0X50,0XFF,0X1D,0X50,0X90,0X71,
+0XA0,0X70,0X90,0X70,0X50,0XE0,0XF1,0X50,0X00,0XFA,0X80,0X20,0XF0,0XE0,0XF1,0X80,
+0X40,0XF1,0XE0,0XF8,0XD0,0X10,0X80,0X90,0X20,0XD0,0XF0,0XD0,0X00,0X70,0X20,0X90,
+0XFA,0XE0,0X20,0X90,0XF0,0XC0,0X80,0XD0,0X90,0X00,0XB0,0XA0,0XB0,0XD0,0XFF,0X1D,
+0X60,0X01,0X90,0XE0,0X50,0XF0,0XA0,0X70,0XF1,0XA0,0X00,0XB0,0XFA,0X80,0X50,0XA0,
+0X50,0X61,0X20,0X10,0X61,0X50,0X90,0XF7,0XC0,0X10,0XF1,0X20,0XC0,0XF1,0X80,0X00,
+0X50,0XFB,0XB0,0X10,0XC0,0XF0,0X80,0X20,0XF0,0XC0,0X20,0XF0,0X70,0X30,0XE0,0XFF,
+0X1D,0X51,0XC0,0XF1,0X50,0XA0,0X20,0X60,0XF0,0XB0,0X00,0X80,0XFB,0X60,0X50,0XA0,
+0X40,0X50,0X60,0X20,0X10,0X61,0X40,0X80,0XF7,0X90,0X20,0XF0,0XD0,0X20,0XD0,0XF0,
+0XD0,0X40,0X00,0X20,0XA0,0XFA,0X50,0X10,0XF0,0XA0,0X00,0XA0,0XF0,0XB0,0X10,0XD0,
+0XE0,0X21,0XD0,0XFF,0X1C,0XD0,0XE0,0XF0,0XC0,0X50,0X30,0X11,0X20,0X40,0X10,0X70,
+0XF9,0XC0,0X91,0X00,0X60,0XF3,0X60,0X30,0XFB,0X30,0X50,0XE0,0X80,0X00,0XA0,0X70,
+0X10,0X40,0XE0,0X70,0X00,0X30,0XA0,0XF7,0XC0,0X00,0X90,0XB0,0X00,0X90,0XE0,0X90,
+0X50,0X00,0XE0,0XF0,0XE0,0X10,0X30,0XE0,0XFF,0X1E,0XA0,0X30,0X60,0X90,0XD0,0XC0,
+0X20,0X70,0XFA,0XB0,0X21,0X50,0XE0,0XF3,0X60,0X30,0XFA,0XE0,0X40,0XC0,0X90,0X10,
+0X70,0X60,0X20,0X90,0XF2,0XB0,0X20,0X40,0XF7,0XA0,0X30,0XE0,0XB0,0X90,0XF0,0X80,
+0X11,0X80,0XF2,0XC0,0X80,0XFF,0X25,0XE0,0XFD,0XE0,0XF5,0XE0,0XD0,0XFD,0XE0,0XD0,
+0XF0,0XE1,0XFF,0X06,0XE1,0XFF,0XFF,0XFF,0X28,0XD0,0XF5,0XD0,0XE0,0XFF,0X4D,0XE0,
+0X90,0X40,0X30,0X40,0XA0,0XFF,0X01,0XD0,0X20,0X90,0XF3,0XE0,0X10,0X70,0XFF,0X4C,
+0XC0,0X11,0X20,0X30,0X21,0XD0,0XFF,0X00,0XD0,0X00,0X80,0XF3,0XE0,0X00,0X60,0XFF,
+0X4B,0XC0,0X00,0X30,0XC0,0XF2,0XC0,0XE0,0XFF,0X00,0XD0,0X10,0X90,0XF3,0XE0,0X00,
+0X60,0XFF,0X4A,0XE0,0X20,0X10,0XFC,0XA0,0X70,0X80,0XD0,0XF5,0XD0,0X10,0X80,0XF3,
+0XE0,0X00,0X60,0XF5,0XB0,0X71,0XC0,0XF7,0XB0,0X70,0XA0,0XF0,0XD1,0XF6,0X90,0X70,
+0XA0,0XF5,0XE0,0XC0,0XF0,0XC0,0X70,0X90,0XFF,0X1C,0X90,0X00,0X80,0XFA,0XE0,0X40,
+0X03,0X90,0XF4,0XD0,0X10,0X80,0XF3,0XE0,0X00,0X60,0XF4,0X70,0X03,0XB0,0XF5,0X60,
+0X02,0X30,0X10,0X80,0XF4,0XD0,0X30,0X02,0X60,0XF4,0XA0,0X10,0X50,0X20,0X01,0X40,
+0XE0,0XFF,0X1A,0X50,0X00,0XC0,0XFA,0X30,0X00,0XB0,0XE0,0XD0,0X40,0X00,0XC0,0XF3,
+0XD0,0X10,0X80,0XF3,0XE0,0X00,0X60,0XF4,0X80,0XA0,0XE1,0X20,0X10,0XF4,0X70,0X00,
+0X90,0XE0,0XD0,0X30,0X00,0X80,0XF4,0X30,0X10,0XC0,0XF0,0XA0,0X00,0XA0,0XF3,0XB0,
+0X00,0X10,0XC0,0XE0,0X80,0X00,0X90,0XFF,0X1A,0X40,0X00,0XD0,0XF9,0XC0,0X00,0X80,
+0XF3,0X10,0X50,0XF3,0XD0,0X10,0X80,0XF3,0XE0,0X00,0X60,0XF6,0XE0,0XC0,0X30,0X00,
+0XE0,0XF3,0X10,0X30,0XF2,0XD0,0X10,0X80,0XF3,0XB0,0X00,0X80,0XF0,0XE0,0XF0,0X20,
+0X30,0XF3,0XB0,0X00,0XA0,0XF2,0X10,0X50,0XFF,0X1A,0X60,0X00,0XB0,0XF9,0X80,0X00,
+0XC0,0XF3,0X21,0XF3,0XD0,0X10,0X90,0XF3,0XE0,0X00,0X60,0XF4,0XA0,0X20,0X10,0X30,
+0X11,0XE0,0XF2,0XD0,0X10,0X70,0XF3,0X20,0X70,0XF3,0X90,0X00,0X14,0X40,0XF3,0XB0,
+0X00,0XB0,0XF2,0X20,0X50,0XFF,0X1A,0XB0,0X00,0X50,0XF9,0X90,0X00,0XB0,0XF3,0X21,
+0XF3,0XD0,0X10,0X80,0XF3,0XE0,0X00,0X60,0XF3,0XC0,0X00,0X40,0XC0,0XF0,0X70,0X00,
+0XE0,0XF2,0XD0,0X10,0X70,0XF3,0X10,0X70,0XF3,0X80,0X00,0X90,0XA2,0XC0,0XD0,0XF3,
+0XB0,0X00,0XB0,0XF2,0X20,0X50,0XFF,0X1B,0X50,0X00,0X90,0XF3,0XE0,0XF3,0XD0,0X00,
+0X50,0XF2,0XC0,0X00,0X80,0XF3,0XD0,0X10,0X90,0XF3,0XE0,0X00,0X70,0XF3,0X70,0X00,
+0XE0,0XF1,0X30,0X00,0XE0,0XF3,0X10,0X20,0XF2,0X80,0X00,0X90,0XF3,0XC0,0X00,0X90,
+0XF8,0XB0,0X00,0XB0,0XF2,0X20,0X60,0XFF,0X1C,0X30,0X00,0X50,0X81,0X50,0X20,0XC0,
+0XF3,0X70,0X00,0X50,0XA0,0X80,0X00,0X30,0XF4,0XC0,0X00,0X70,0XF3,0XE0,0X00,0X50,
+0XF3,0XA0,0X00,0X50,0X90,0X60,0X01,0XE0,0XF3,0X90,0X00,0X40,0X90,0X70,0X10,0X00,
+0X80,0XF4,0X50,0X00,0X60,0XA0,0X70,0X20,0XC0,0XF3,0XA0,0X00,0XA0,0XF1,0XE0,0X10,
+0X40,0XFF,0X1D,0X80,0X10,0X01,0X10,0X80,0XF5,0X90,0X10,0X01,0X60,0XE0,0XF4,0XE0,
+0X50,0XA0,0XF4,0X50,0X80,0XF4,0X80,0X01,0X70,0X90,0X50,0XE0,0XF4,0X90,0X01,0X30,
+0XC0,0X20,0X70,0XF5,0X70,0X02,0X70,0XF4,0XC0,0X50,0XC0,0XF2,0X60,0X80,0XFF,0X1E,
+0XE0,0XD1,0XE0,0XF7,0XE0,0XC0,0XD0,0XFF,0X07,0XD0,0XC0,0XF9,0XE0,0XD0,0XF0,0XD0,
+0X10,0X90,0XF6,0XE0,0XC0,0XE0,0XFF,0X5C,0XC1,0XF1,0XE0,0X20,0X00,0XE0,0XFF,0X66,
+0X80,0X00,0X20,0X30,0X00,0X10,0XB0,0XFF,0X67,0XC0,0X40,0X20,0X10,0X30,0XA0,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XAB,0XE1,
+0XD0,0XC1,0XB1,0XA1,0X91,0X80,0X72,0X61,0X52,0X41,0X33,0X23,0X13,0X0F,0X08,0X13,
+0X23,0X33,0X41,0X52,0X61,0X71,0X81,0X92,0XA0,0XB1,0XC1,0XD0,0XE1,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XD4,};
+const image_rle_t gImage_mode3_126x174 = { s_gImage_mode3_126x174_rle, sizeof(s_gImage_mode3_126x174_rle), 126, 174 };
+
+/* 126x174，原始10962字节 */
+static const unsigned char s_gImage_mode4_126x174_rle[2987] ASSET_SECTION = {
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0X75,0XD0,0XA0,0X70,0X50,0X30,0X10,0X05,0X10,0X30,0X50,0X70,0XA0,
+0XD0,0XFF,0X58,0XD0,0X90,0X40,0X0F,0X04,0X40,0X90,0XD0,0XFF,0X51,0XE0,0X80,0X20,
+0X0F,0X0A,0X20,0X80,0XE0,0XFF,0X4C,0XC0,0X50,0X0C,0X11,0X21,0X11,0X0C,0X50,0XC0,
+0XFF,0X48,0XB0,0X30,0X08,0X20,0X60,0X90,0XC0,0XE0,0XF7,0XE0,0XC0,0X90,0X60,0X20,
+0X08,0X30,0XB0,0XFF,0X44,0XD0,0X40,0X06,0X10,0X60,0XA0,0XFF,0X04,0XA0,0X60,0X10,
+0X06,0X40,0XD0,0XFF,0X41,0X70,0X06,0X40,0XA0,0XFF,0X0A,0XA0,0X40,0X06,0X70,0XFF,
+0X3E,0XD0,0X20,0X05,0X60,0XD0,0XFF,0X0E,0XD0,0X60,0X05,0X20,0XD0,0XFF,0X3B,0X90,
+0X05,0X50,0XD0,0XFF,0X12,0XD0,0X50,0X05,0X90,0XFF,0X39,0X50,0X04,0X20,0XC0,0XFF,
+0X16,0XC0,0X20,0X04,0X50,0XFF,0X36,0XE0,0X30,0X04,0X70,0XFF,0X1A,0X70,0X04,0X30,
+0XE0,0XFF,0X33,0XE0,0X20,0X03,0X10,0XC0,0XFF,0X1C,0XC0,0X10,0X03,0X20,0XE0,0XFF,
+0X31,0XE0,0X20,0X03,0X30,0XE0,0XFE,0X70,0X20,0X40,0XD0,0XFF,0X0B,0XE0,0X30,0X03,
+0X20,0XE0,0XFF,0X2F,0XE0,0X20,0X03,0X50,0XFF,0X00,0XA0,0X02,0X50,0XFF,0X0D,0X50,
+0X03,0X20,0XE0,0XFF,0X2E,0X30,0X03,0X60,0XFF,0X01,0X10,0X02,0X30,0XFF,0X0E,0X60,
+0X03,0X30,0XFF,0X2D,0X50,0X03,0X60,0XFF,0X01,0X90,0X03,0X80,0XFF,0X0F,0X60,0X03,
+0X50,0XFF,0X2B,0X90,0X03,0X50,0XFF,0X02,0X10,0X02,0X10,0XF2,0XC0,0X90,0X70,0X60,
+0X52,0X60,0X80,0XA0,0XD0,0XFF,0X03,0X50,0X03,0X90,0XFF,0X29,0XD0,0X03,0X30,0XFF,
+0X02,0X70,0X03,0X81,0X30,0X0C,0X40,0X90,0XE0,0XFF,0X00,0X30,0X03,0XD0,0XFF,0X28,
+0X20,0X02,0X10,0XE0,0XFF,0X01,0XE0,0X03,0X10,0X0F,0X03,0X40,0XB0,0XFD,0XE0,0X10,
+0X02,0X20,0XFF,0X27,0X70,0X03,0XC0,0XFF,0X02,0X60,0X03,0X30,0X0F,0X05,0X30,0XB0,
+0XFC,0XC0,0X03,0X70,0XFF,0X25,0XD0,0X03,0X70,0XFF,0X03,0X20,0X0A,0X20,0X30,0X42,
+0X30,0X10,0X09,0X50,0XE0,0XFB,0X70,0X03,0XD0,0XFF,0X24,0X40,0X02,0X20,0XFF,0X04,
+0X40,0X07,0X30,0XB0,0XF8,0XB0,0X70,0X20,0X06,0X10,0XA0,0XFB,0X20,0X02,0X40,0XFF,
+0X23,0XB0,0X03,0XC0,0XFF,0X04,0XE0,0X40,0X07,0X20,0XFB,0XC0,0X60,0X06,0X70,0XFA,
+0XC0,0X03,0XC0,0XFF,0X22,0X30,0X02,0X50,0XFF,0X07,0XD0,0X60,0X06,0XD0,0XF0,0XA0,
+0X30,0XA0,0XF8,0XE0,0X60,0X05,0X50,0XFA,0X50,0X02,0X30,0XFF,0X21,0XC0,0X03,0XD0,
+0XFE,0XD0,0XF8,0XE0,0X80,0X10,0X03,0XF1,0X20,0X00,0X20,0XFA,0XC0,0X20,0X04,0X40,
+0XF9,0XD0,0X03,0XC0,0XFF,0X20,0X50,0X02,0X60,0XFE,0X90,0X00,0X50,0XFA,0XA0,0X50,
+0X40,0XC0,0XF1,0X10,0X00,0X10,0XFC,0X50,0X04,0X50,0XF9,0X60,0X02,0X50,0XFF,0X1F,
+0XE0,0X03,0XD0,0XFD,0XE0,0X10,0X01,0XA0,0XFF,0X00,0X10,0X00,0X10,0XFD,0X80,0X04,
+0X70,0XF8,0XD0,0X03,0XE0,0XFF,0X1E,0X80,0X02,0X40,0XFE,0X70,0X00,0X10,0X00,0X10,
+0XE0,0XFE,0X10,0X00,0X10,0XFE,0X90,0X04,0XB0,0XF8,0X40,0X02,0X80,0XFF,0X1E,0X20,
+0X02,0XA0,0XFD,0XD0,0X01,0XD0,0X30,0X00,0X60,0XFE,0X10,0X00,0X10,0XFF,0X00,0X70,
+0X03,0X10,0XF8,0XA0,0X02,0X30,0XFF,0X1D,0XD0,0X02,0X10,0XFE,0X50,0X00,0X60,0XF0,
+0XD0,0X01,0XC0,0XFD,0X10,0X00,0X10,0XFF,0X01,0X40,0X03,0X70,0XF8,0X10,0X02,0XD0,
+0XFF,0X1C,0X90,0X02,0X60,0XFD,0XC0,0X01,0XE0,0XF1,0X70,0X00,0X30,0XFD,0X10,0X00,
+0X10,0XFF,0X01,0XE0,0X10,0X03,0XD0,0XF7,0X60,0X02,0X90,0XFF,0X1C,0X40,0X02,0XA0,
+0XFD,0X30,0X00,0X80,0XF3,0X10,0X00,0X90,0XFC,0X10,0X00,0X10,0XFF,0X02,0XA0,0X03,
+0X50,0XF7,0XA0,0X02,0X40,0XFF,0X1C,0X03,0XFD,0XA0,0X00,0X10,0XF4,0XB0,0X00,0X10,
+0XE0,0XFB,0X10,0X00,0X10,0XFF,0X03,0X40,0X03,0XD0,0XF7,0X03,0XFF,0X1B,0XD0,0X02,
+0X30,0XFD,0X10,0X00,0XA0,0XF5,0X40,0X00,0X60,0XFB,0X10,0X00,0X10,0XFF,0X03,0XC0,
+0X03,0X70,0XF7,0X20,0X02,0XD0,0XFF,0X1A,0XA0,0X02,0X60,0XFC,0X80,0X00,0X30,0XF0,
+0X70,0X60,0XF3,0XD0,0X01,0XC0,0XFA,0X10,0X00,0X10,0XFF,0X04,0X30,0X02,0X10,0XF7,
+0X60,0X02,0XA0,0XFF,0X1A,0X70,0X02,0X90,0XFB,0XE0,0X01,0XC0,0X90,0X01,0XC0,0XF3,
+0X70,0X00,0X30,0XFA,0X10,0X00,0X10,0XFF,0X04,0X90,0X03,0XC0,0XF6,0X90,0X02,0X70,
+0XFF,0X1A,0X50,0X02,0XC0,0XFB,0X60,0X00,0X50,0XE0,0X01,0X20,0XF5,0X10,0X00,0X90,
+0XF9,0X10,0X00,0X10,0XFF,0X05,0X03,0X80,0XF6,0XC0,0X02,0X50,0XFF,0X1A,0X30,0X02,
+0XE0,0XFA,0XC0,0X01,0XD0,0X60,0X01,0XC0,0XF5,0XB0,0X00,0X10,0XE0,0XF8,0X10,0X00,
+0X10,0XFF,0X05,0X30,0X02,0X40,0XF6,0XE0,0X02,0X30,0XFF,0X1A,0X10,0X02,0XFB,0X40,
+0X00,0X70,0XE0,0X01,0X50,0XF7,0X40,0X00,0X60,0XF8,0X10,0X00,0X10,0XFF,0X05,0X80,
+0X02,0X10,0XF7,0X02,0X10,0XFF,0X1A,0X02,0X10,0XFA,0XB0,0X00,0X10,0XF0,0X80,0X01,
+0XD0,0XF7,0XD0,0X01,0XC0,0XF7,0X10,0X00,0X10,0XFF,0X05,0XB0,0X03,0XE0,0XF6,0X10,
+0X02,0XFF,0X1A,0X02,0X10,0XFA,0X20,0X00,0X90,0XF0,0X30,0X00,0X30,0XF9,0X70,0X00,
+0X30,0XF7,0X10,0X00,0X10,0XFF,0X05,0XD0,0X03,0XC0,0XF6,0X10,0X02,0XFF,0X1A,0X02,
+0X20,0XF9,0XB0,0X00,0X20,0XF1,0X01,0X70,0XFA,0X10,0X00,0XC0,0XF6,0X10,0X01,0X52,
+0X60,0X54,0X61,0X50,0X90,0XF8,0X03,0XB0,0XF6,0X20,0X02,0XFF,0X1A,0X02,0X20,0XF9,
+0X60,0X00,0X80,0XF1,0X01,0X90,0XFA,0X70,0X00,0X60,0XF6,0X20,0X0E,0XE0,0XF7,0X03,
+0XA0,0XF6,0X20,0X02,0XFF,0X1A,0X02,0X10,0XF9,0X20,0X00,0XC0,0XF1,0X01,0XA0,0XFA,
+0XC0,0X00,0X30,0XF6,0X60,0X0D,0X20,0XF8,0X03,0XA0,0XF6,0X10,0X02,0XFF,0X1A,0X02,
+0X10,0XF9,0X01,0XF2,0X80,0X60,0XE0,0XFB,0X00,0X10,0XF8,0XEB,0XFA,0X03,0XA0,0XF6,
+0X10,0X02,0XFF,0X1A,0X10,0X02,0XF9,0X01,0XFF,0X02,0X01,0XFF,0X0F,0XE0,0X03,0XB0,
+0XF6,0X02,0X10,0XFF,0X1A,0X30,0X02,0XE0,0XF8,0X10,0X00,0XE0,0XF2,0X31,0XE0,0XF9,
+0XD0,0X00,0X20,0XFF,0X0F,0XC0,0X03,0XD0,0XF5,0XE0,0X02,0X30,0XFF,0X1A,0X50,0X02,
+0XC0,0XF8,0X40,0X00,0XA0,0XF1,0XE0,0X01,0X50,0XF9,0X90,0X00,0X50,0XFF,0X0F,0X90,
+0X03,0XF6,0XC0,0X02,0X50,0XFF,0X1A,0X70,0X02,0X90,0XF8,0X80,0X00,0X50,0XF2,0X50,
+0X01,0X30,0XF8,0X30,0X00,0XA0,0XFF,0X0F,0X60,0X02,0X20,0XF6,0X90,0X02,0X70,0XFF,
+0X1A,0XA0,0X02,0X60,0XF8,0XE0,0X01,0XC0,0XF2,0X30,0X01,0XB0,0XF6,0XA0,0X00,0X10,
+0XFF,0X10,0X20,0X02,0X50,0XF6,0X60,0X02,0XA0,0XFF,0X1A,0XD0,0X02,0X20,0XF9,0X60,
+0X00,0X30,0XF3,0X81,0XF6,0XD0,0X10,0X00,0X90,0XFF,0X0F,0XD0,0X03,0X90,0XF6,0X20,
+0X02,0XD0,0XFF,0X1B,0X03,0XFA,0X10,0X00,0X40,0XFA,0XE0,0X20,0X00,0X40,0XFF,0X10,
+0X70,0X03,0XE0,0XF6,0X03,0XFF,0X1C,0X40,0X02,0XA0,0XF9,0XD0,0X01,0X40,0XE0,0XF7,
+0XB0,0X10,0X00,0X20,0XE0,0XFF,0X10,0X10,0X02,0X40,0XF6,0XA0,0X02,0X40,0XFF,0X1C,
+0X90,0X02,0X60,0XFA,0XC0,0X10,0X01,0X70,0XD0,0XF3,0XB0,0X40,0X01,0X30,0XE0,0XFF,
+0X10,0X80,0X03,0XA0,0XF6,0X60,0X02,0X90,0XFF,0X1C,0XD0,0X03,0XFB,0XE0,0X40,0X02,
+0X20,0X40,0X30,0X10,0X02,0X70,0XFF,0X11,0XE0,0X10,0X02,0X10,0XF7,0X10,0X02,0XD0,
+0XFF,0X1D,0X20,0X02,0XA0,0XFC,0XC0,0X50,0X04,0X20,0X70,0XE0,0XFF,0X12,0X60,0X03,
+0X80,0XF6,0XA0,0X02,0X30,0XFF,0X1E,0X80,0X02,0X40,0XFF,0X00,0XD0,0XC1,0XE0,0XFF,
+0X14,0XB0,0X03,0X10,0XF7,0X40,0X02,0X80,0XFF,0X1E,0XE0,0X03,0XD0,0XFF,0X26,0XE0,
+0X10,0X03,0XB0,0XF6,0XD0,0X03,0XE0,0XFF,0X1F,0X50,0X02,0X60,0XFF,0X25,0XE0,0X20,
+0X03,0X50,0XF7,0X60,0X02,0X50,0XFF,0X20,0XC0,0X03,0XD0,0XFF,0X23,0XE0,0X30,0X03,
+0X20,0XF7,0XD0,0X03,0XC0,0XFF,0X21,0X30,0X02,0X50,0XFF,0X22,0XE0,0X20,0X04,0XC0,
+0XF7,0X50,0X02,0X30,0XFF,0X22,0XB0,0X03,0XC0,0XFF,0X20,0XB0,0X10,0X04,0XB0,0XF7,
+0XC0,0X03,0XB0,0XFF,0X23,0X40,0X02,0X20,0XFF,0X1E,0XE0,0X50,0X05,0XA0,0XF8,0X20,
+0X02,0X40,0XFF,0X24,0XD0,0X03,0X70,0XFF,0X1B,0XE0,0X80,0X06,0XB0,0XF8,0X70,0X03,
+0XD0,0XFF,0X25,0X70,0X03,0XC0,0XFF,0X06,0X40,0X00,0X10,0X70,0XD0,0XFC,0XC0,0X60,
+0X06,0X20,0XD0,0XF8,0XC0,0X03,0X70,0XFF,0X27,0X20,0X02,0X10,0XE0,0XFF,0X04,0X90,
+0X04,0X10,0X50,0X80,0XB0,0XD1,0XE0,0XD0,0XC0,0XA0,0X80,0X40,0X08,0X50,0XF9,0XE0,
+0X10,0X02,0X20,0XFF,0X28,0XC0,0X03,0X30,0XFF,0X04,0X80,0X0F,0X08,0X20,0XB0,0XFA,
+0X30,0X03,0XC0,0XFF,0X29,0X90,0X03,0X50,0XFF,0X03,0XE0,0X10,0X0F,0X05,0X20,0X90,
+0XFB,0X50,0X03,0X90,0XFF,0X2B,0X50,0X03,0X60,0XFF,0X04,0XA0,0X40,0X0F,0X01,0X50,
+0XB0,0XFC,0X60,0X03,0X50,0XFF,0X2D,0X30,0X03,0X60,0XFF,0X05,0XE0,0XA0,0X60,0X30,
+0X07,0X10,0X30,0X70,0XB0,0XFE,0X60,0X03,0X30,0XFF,0X2E,0XE0,0X20,0X03,0X50,0XFF,
+0X09,0XE0,0XD0,0XC0,0XB0,0XC0,0XD0,0XE0,0XFF,0X02,0X50,0X03,0X20,0XE0,0XFF,0X2F,
+0XE0,0X20,0X03,0X30,0XE0,0XFF,0X1E,0XE0,0X30,0X03,0X20,0XE0,0XFF,0X31,0XE0,0X20,
+0X03,0X10,0XC0,0XFF,0X1C,0XC0,0X10,0X03,0X20,0XE0,0XFF,0X33,0XE0,0X30,0X04,0X70,
+0XFF,0X1A,0X70,0X04,0X30,0XE0,0XFF,0X36,0X50,0X04,0X20,0XC0,0XFF,0X16,0XC0,0X20,
+0X04,0X50,0XFF,0X39,0X90,0X05,0X50,0XD0,0XFF,0X12,0XD0,0X50,0X05,0X90,0XFF,0X3B,
+0XD0,0X20,0X05,0X60,0XD0,0XFF,0X0E,0XD0,0X60,0X05,0X20,0XD0,0XFF,0X3E,0X70,0X06,
+0X40,0XA0,0XFF,0X0A,0XA0,0X40,0X06,0X70,0XFF,0X41,0XD0,0X40,0X06,0X10,0X60,0XA0,
+0XFF,0X04,0XA0,0X60,0X10,0X06,0X40,0XD0,0XFF,0X44,0XB0,0X30,0X08,0X20,0X60,0X90,
+0XC0,0XE0,0XF7,0XE0,0XC0,0X90,0X60,0X20,0X08,0X30,0XC0,0XFF,0X48,0XC0,0X50,0X0C,
+0X11,0X21,0X11,0X0C,0X50,0XC0,0XFF,0X4C,0XE0,0X80,0X20,0X0F,0X0A,0X30,0X80,0XE0,
+0XFF,0X51,0XD0,0X90,0X40,0X0F,0X04,0X40,0X90,0XD0,0XFF,0X58,0XD0,0XA0,0X70,0X50,
+0X30,0X10,0X05,0X10,0X30,0X50,0X70,0XA0,0XD0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XDD,0XE0,0XFF,0X33,0XE0,0XF3,0XE0,0XFF,0X24,0X20,0X60,0XF1,
+0XC0,0XB2,0XC0,0XD1,0XF9,0XB0,0X60,0XF1,0XD0,0XC0,0XB0,0XC0,0XA0,0X90,0XA0,0X80,
+0XD0,0XF9,0X70,0XA0,0XF3,0XE0,0X60,0XB0,0XFD,0XC0,0X50,0XF3,0X50,0X90,0XFF,0X22,
+0X40,0X20,0X10,0X40,0XE0,0X60,0X10,0X20,0X10,0X30,0X00,0X30,0XF9,0X30,0X40,0XF0,
+0XC0,0X10,0X20,0X11,0X23,0XC0,0XF8,0XC0,0X00,0XA0,0XF0,0X80,0X40,0X50,0X40,0X00,
+0X20,0X60,0X40,0X50,0XE0,0XF7,0X80,0X70,0X50,0X10,0X70,0X80,0XF0,0X90,0X00,0X30,
+0X71,0XD0,0XFF,0X1E,0X70,0X10,0XF1,0X40,0X30,0XC0,0XB1,0XD0,0X60,0X00,0XA0,0XF8,
+0XE0,0X20,0XD0,0XE0,0XB0,0X30,0X70,0XD0,0X40,0XA0,0XF0,0X60,0X70,0XF9,0X60,0X00,
+0X50,0X60,0XA2,0X80,0X10,0X50,0XA2,0XF8,0X80,0X60,0X40,0X10,0X70,0X80,0X90,0X20,
+0X80,0XA0,0X20,0X00,0XE0,0XFF,0X1D,0X80,0X00,0X80,0XD0,0XC0,0XA0,0X40,0XF0,0X90,
+0X40,0X90,0X20,0XA0,0XF9,0X81,0XF0,0X40,0X90,0XC0,0X60,0XF0,0XB0,0XC1,0X20,0XE0,
+0XF8,0XD0,0X10,0XA0,0XB0,0XA0,0XF0,0X80,0X70,0X60,0X10,0X40,0X71,0XF9,0XC0,0X70,
+0X50,0X10,0X70,0XC0,0X40,0X70,0XF0,0XE0,0X20,0XA0,0XFF,0X1D,0XC0,0X20,0X50,0X30,
+0X10,0X20,0X30,0XC0,0XF0,0XE0,0X50,0X00,0XB0,0XF9,0XC0,0X00,0X80,0X70,0X30,0XC0,
+0X31,0X42,0X11,0X50,0XA0,0XF7,0X41,0XF0,0XE0,0XF0,0XE0,0X20,0X80,0XA0,0XB0,0XA0,
+0X70,0X00,0XD0,0XF8,0XD0,0XB0,0X70,0X10,0XB0,0XD0,0X70,0X30,0X40,0X10,0X00,0X50,
+0X30,0XC0,0XFF,0X1C,0XE0,0XF0,0XD0,0X10,0X80,0XE0,0XF0,0XA0,0XC0,0XA0,0X00,0X90,
+0XB0,0XC0,0XE0,0XF6,0XC0,0X51,0X00,0XA0,0XF0,0XA0,0X20,0X40,0XA0,0X90,0XA1,0X80,
+0XC0,0XF7,0XA0,0X60,0X11,0XA0,0XF0,0X30,0X70,0X82,0X60,0X10,0XD0,0XF7,0XC0,0X50,
+0X60,0X50,0X30,0X70,0X40,0XC0,0XF0,0XC0,0X30,0XB0,0XE0,0X00,0X90,0XFF,0X1C,0X80,
+0X61,0X10,0X40,0X71,0X31,0X20,0X00,0X21,0X00,0X90,0XF8,0X61,0XF0,0XB0,0X60,0X20,
+0X30,0X73,0X60,0X90,0XF9,0X20,0X80,0XF0,0XE0,0X20,0X90,0XA2,0X80,0X20,0XD0,0XF7,
+0XE0,0XA0,0X83,0X91,0XA0,0X90,0X20,0X70,0XA0,0X10,0X50,0XFF,0X1C,0X70,0X61,0X10,
+0X40,0X60,0X70,0XF1,0XA0,0X20,0XD0,0XE0,0X10,0XA0,0XF7,0XD0,0X40,0XF1,0XB0,0X50,
+0X10,0X60,0X93,0X70,0X90,0XF7,0XB0,0X90,0X20,0X50,0X90,0XD0,0X30,0X70,0X82,0X60,
+0X10,0XD0,0XF8,0XB0,0X40,0X80,0X90,0X60,0X70,0X80,0X41,0X10,0X30,0X50,0X00,0X30,
+0XE0,0XFF,0X1D,0XD0,0X10,0X90,0XF3,0XB0,0X20,0XD0,0XF0,0X10,0XD0,0XF7,0X30,0X20,
+0X40,0X30,0XF1,0X10,0X60,0X81,0X91,0XD0,0XF8,0X70,0X20,0X00,0X10,0X30,0XC0,0X30,
+0X70,0X82,0X70,0X10,0XD0,0XF8,0X80,0X20,0X90,0XB0,0X31,0XF2,0X50,0XD0,0XF0,0X20,
+0X90,0XFF,0X1C,0XC0,0X20,0X12,0X20,0X90,0XF1,0XB0,0X20,0XD0,0XF0,0XC0,0XF8,0X70,
+0X60,0X80,0X90,0XF0,0X90,0X00,0X20,0X61,0X50,0X00,0X80,0XF9,0XE0,0X20,0X70,0XF1,
+0X30,0X90,0XA2,0X80,0X20,0XE0,0XF8,0X90,0X30,0X80,0XA0,0X30,0X80,0XA0,0X40,0X50,
+0X10,0X30,0X50,0X00,0XA0,0XFF,0X1C,0XA0,0X00,0XC0,0XD0,0XC0,0X20,0X70,0XF1,0XB0,
+0X20,0XD0,0XFE,0XE0,0X20,0X70,0X50,0XD0,0XF0,0X60,0X40,0XFB,0X20,0X90,0XF0,0X60,
+0X00,0X80,0X90,0X80,0X90,0X80,0X10,0X50,0XC0,0XF7,0X90,0X30,0X90,0XA0,0X40,0X70,
+0XC0,0X71,0X10,0X50,0X80,0X30,0XB0,0XFF,0X1C,0XA0,0X20,0XF2,0X50,0X80,0XF1,0XB0,
+0X20,0XC0,0XFA,0X80,0X40,0X20,0X60,0X70,0X20,0XF0,0XC0,0X21,0X40,0XFC,0X30,0X20,
+0XC0,0X70,0X90,0X40,0X30,0X60,0X40,0X30,0X80,0X70,0XB0,0XF7,0X90,0X20,0X60,0X80,
+0X30,0X50,0XF2,0X50,0XA0,0XF0,0XE0,0XFF,0X1D,0XA0,0X00,0X51,0X60,0X00,0X80,0XE0,
+0XD0,0X80,0X10,0XD0,0XFA,0X51,0XB0,0X70,0X00,0XB0,0XC0,0X80,0X00,0X10,0X30,0XB0,
+0XC0,0XE0,0XF8,0XD0,0X10,0X00,0XC0,0XD0,0X90,0X20,0X90,0XF0,0XC0,0X20,0X60,0XC0,
+0XF8,0X80,0X40,0XE1,0X60,0X40,0XF0,0XD0,0XB0,0X20,0XA0,0XFF,0X1F,0XB0,0X00,0X50,
+0X61,0X20,0X81,0X01,0X60,0XFE,0XB0,0X80,0X60,0X00,0X30,0XA0,0XE0,0X60,0X20,0X00,
+0X70,0XF8,0XD0,0X40,0XB0,0XF0,0X21,0XA0,0XF2,0XC0,0X30,0X10,0XC0,0XF7,0X80,0X50,
+0XD0,0X40,0X00,0X90,0XF0,0X20,0X00,0X30,0XFF,0X20,0XD0,0XB0,0XF2,0XC0,0XD1,0X80,
+0XA0,0XFF,0X02,0X90,0XB0,0XF4,0XB0,0XC0,0XFC,0XA0,0XF6,0XB0,0XE0,0XF7,0XD0,0XC0,
+0XE0,0X90,0XA0,0XF1,0XA0,0X90,0XE0,0XFF,0XFF,0XFF,0XB6,0X71,0XF9,0XA0,0X60,0XE0,
+0XFF,0X57,0XD0,0XE0,0XF5,0X31,0XF9,0X60,0X10,0XD0,0XFF,0X56,0XD0,0X10,0X90,0XF5,
+0X31,0XFA,0XE0,0XFF,0X36,0XC0,0XB0,0XF8,0XB1,0XF9,0XD0,0XB0,0XD0,0XF6,0X90,0X00,
+0X80,0XE0,0XF4,0X30,0X40,0XF0,0XD0,0XB0,0XFF,0X02,0XB0,0XD0,0XF8,0XC0,0XB0,0XF1,
+0XE0,0XFF,0X1B,0XB0,0X30,0X01,0X20,0XD0,0XF4,0XA0,0X20,0X01,0X20,0XB0,0XF6,0X60,
+0X02,0X50,0XE0,0XF3,0XA0,0X02,0X10,0X80,0XF3,0X31,0X60,0X01,0X30,0XE0,0XF4,0X70,
+0X40,0XE0,0XF3,0XD0,0X50,0X90,0X20,0X00,0X10,0XA0,0XF5,0XC0,0X40,0X01,0X62,0XFF,
+0X1A,0XD0,0X10,0X30,0XB1,0X80,0XD0,0XF3,0XA0,0X00,0X50,0XB1,0X40,0X00,0XC0,0XF4,
+0X60,0X00,0X90,0XB0,0X90,0X00,0X30,0XF3,0XD0,0X60,0X00,0X50,0X90,0XC0,0XF3,0X30,
+0X00,0X30,0XA0,0XB0,0X00,0X50,0XF4,0X40,0X00,0XE0,0XF3,0XC0,0X00,0X10,0X80,0XB0,
+0X20,0X00,0XD0,0XF4,0X30,0X00,0XA0,0XB0,0X60,0X00,0X30,0XFF,0X1A,0XC0,0X00,0X70,
+0XF7,0X20,0X30,0XF2,0XE0,0X00,0X60,0XF3,0XB0,0X00,0X80,0XF2,0X90,0X00,0XA0,0XF3,
+0XC0,0X00,0X90,0XF5,0X30,0X10,0XE0,0XF1,0X80,0X00,0XD0,0XF3,0X50,0X10,0XE0,0XF3,
+0XC0,0X10,0X80,0XF1,0XA0,0X00,0X90,0XF3,0X80,0X00,0XB0,0XF2,0X40,0X30,0XFF,0X1A,
+0XE0,0X50,0X00,0X20,0XA0,0XF4,0XA0,0X00,0X90,0XF3,0X40,0X30,0XF3,0X80,0X00,0XD0,
+0XF2,0XD0,0X00,0X90,0XF3,0XB0,0X00,0X90,0XF5,0X31,0XF2,0XA0,0X00,0XC0,0XF3,0X50,
+0X10,0XE0,0XF3,0XC0,0X10,0XD0,0XF1,0XE0,0X10,0X80,0XF3,0X40,0X00,0XF3,0X50,0X20,
+0XFF,0X1C,0X90,0X30,0X00,0X50,0XE0,0XF2,0X90,0X00,0XA0,0XF3,0X50,0X30,0XF3,0X70,
+0X00,0XE0,0XF2,0XE0,0X00,0X80,0XF3,0XB0,0X00,0X90,0XF5,0X31,0XF2,0XA0,0X00,0XC0,
+0XF3,0X50,0X10,0XE0,0XF3,0XC0,0X10,0XC0,0XF1,0XD0,0X10,0X80,0XF3,0X40,0X10,0XF3,
+0X60,0X20,0XFF,0X1E,0XA0,0X00,0X90,0XF2,0XD0,0X10,0X50,0XF3,0X10,0X60,0XF3,0XA0,
+0X00,0XA0,0XF2,0XC0,0X00,0XA0,0XF3,0XA0,0X00,0XA0,0XF5,0X31,0XF2,0XA0,0X00,0XC0,
+0XF3,0X50,0X10,0XE0,0XF3,0XC0,0X10,0XC0,0XF1,0XD0,0X10,0X80,0XF3,0X50,0X00,0XE0,
+0XF2,0X40,0X30,0XFF,0X1A,0XC0,0X80,0XC0,0XE0,0X80,0X00,0XA0,0XF3,0X80,0X00,0X70,
+0XD1,0X50,0X00,0XB0,0XF3,0XE0,0X20,0X10,0XB0,0XE0,0XB0,0X10,0X20,0XF4,0XC0,0X00,
+0X40,0XD0,0XE0,0XF3,0X30,0X20,0XF2,0X90,0X00,0XC0,0XF3,0X50,0X00,0XE0,0XF3,0XC0,
+0X10,0XC0,0XF1,0XC0,0X00,0X80,0XF3,0XC0,0X00,0X40,0XD1,0X60,0X00,0X40,0XFF,0X1A,
+0XB0,0X01,0X10,0X00,0X70,0XF5,0X70,0X03,0XA0,0XF5,0XD0,0X30,0X00,0X10,0X00,0X30,
+0XE0,0XF5,0X70,0X01,0X80,0XF3,0X41,0XF2,0XA0,0X00,0XC0,0XF3,0X60,0X20,0XE0,0XF3,
+0XC0,0X10,0XC0,0XF1,0XD0,0X10,0X90,0XF4,0X90,0X02,0X60,0X40,0X30,0XFF,0X1B,0XC0,
+0X91,0XC0,0XF7,0XC0,0X91,0XD0,0XF8,0XA0,0X90,0XB0,0XF8,0XB0,0X90,0XD0,0XF3,0XE1,
+0XF3,0XD0,0XF4,0XE0,0XD0,0XF5,0XD0,0XF3,0XD0,0XE0,0XF5,0XD0,0X90,0XA0,0XF0,0X60,
+0X30,0XFF,0X6B,0XD0,0X00,0X70,0XFF,0X66,0XE0,0X30,0X50,0X80,0X60,0X00,0X10,0XC0,
+0XFF,0X67,0X40,0X10,0X21,0X10,0XB0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X8F,0XE1,0XD0,0XC1,0XB1,0XA0,0X92,0X81,0X71,0X61,
+0X52,0X41,0X33,0X23,0X13,0X0F,0X08,0X13,0X23,0X33,0X41,0X52,0X61,0X71,0X81,0X91,
+0XA1,0XB1,0XC1,0XD0,0XE1,0XFF,0XFF,0XFF,0XFF,0XFF,0XD8,};
+const image_rle_t gImage_mode4_126x174 = { s_gImage_mode4_126x174_rle, sizeof(s_gImage_mode4_126x174_rle), 126, 174 };
+
+/* 126x174，原始10962字节 */
+static const unsigned char s_gImage_mode5_126x174_rle[3056] ASSET_SECTION = {
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XF5,0XD0,0XA0,0X70,0X50,0X30,0X10,0X05,0X10,0X30,0X50,0X70,0XA0,
+0XD0,0XFF,0X58,0XD0,0X90,0X40,0X0F,0X04,0X40,0X90,0XD0,0XFF,0X51,0XE0,0X80,0X20,
+0X0F,0X0A,0X20,0X80,0XE0,0XFF,0X4C,0XC0,0X50,0X0C,0X10,0X23,0X10,0X0C,0X50,0XC0,
+0XFF,0X48,0XB0,0X30,0X08,0X30,0X70,0XA0,0XC0,0XE0,0XF7,0XE0,0XC0,0X90,0X70,0X30,
+0X08,0X30,0XC0,0XFF,0X44,0XD0,0X40,0X06,0X10,0X60,0XB0,0XFF,0X04,0XB0,0X60,0X10,
+0X06,0X40,0XD0,0XFF,0X41,0X70,0X06,0X40,0XB0,0XFF,0X0A,0XB0,0X50,0X06,0X70,0XFF,
+0X3E,0XC0,0X20,0X05,0X60,0XD0,0XFF,0X0E,0XE0,0X70,0X05,0X20,0XD0,0XF6,0XD0,0X60,
+0X70,0XFF,0X31,0X90,0X05,0X60,0XE0,0XFF,0X12,0XE0,0X60,0X05,0X90,0XF5,0X20,0X01,
+0X60,0XFF,0X2F,0X50,0X04,0X30,0XC0,0XFF,0X16,0XC0,0X30,0X04,0X60,0XF4,0X02,0X20,
+0XFF,0X2D,0XE0,0X30,0X04,0X80,0XFF,0X02,0XB0,0X10,0X00,0X60,0XFF,0X04,0X80,0X04,
+0X30,0XF3,0X02,0X10,0XFF,0X2C,0XE0,0X20,0X03,0X20,0XC0,0XFF,0X02,0XE0,0X10,0X02,
+0X80,0XFF,0X04,0XC0,0X20,0X03,0X20,0XE0,0XF1,0X10,0X02,0XFF,0X2B,0XE0,0X20,0X03,
+0X40,0XE0,0XFF,0X03,0X70,0X04,0XC0,0XFF,0X04,0XE0,0X40,0X03,0X20,0XE0,0XF0,0X30,
+0X02,0XFF,0X2A,0XE0,0X20,0X03,0X60,0XFF,0X04,0XD0,0X05,0X20,0XFF,0X06,0X60,0X03,
+0X20,0XE0,0X40,0X02,0XE0,0XFF,0X29,0X30,0X03,0X70,0XFF,0X05,0X50,0X06,0X80,0XFF,
+0X06,0X70,0X03,0X30,0X50,0X02,0XD0,0XFF,0X28,0X50,0X03,0X70,0XFF,0X05,0XC0,0X08,
+0XD0,0XFF,0X06,0X70,0X03,0X20,0X02,0XB0,0XFF,0X27,0X90,0X03,0X60,0XFF,0X06,0X30,
+0X03,0X70,0X03,0X40,0XFF,0X02,0XE0,0XF3,0X60,0X06,0XA0,0XFF,0X26,0XD0,0X03,0X40,
+0XFF,0X06,0XA0,0X03,0X60,0XF0,0X30,0X03,0XA0,0XFE,0XE0,0X20,0X01,0X30,0X60,0X90,
+0XD0,0X40,0X05,0X90,0XFF,0X26,0X20,0X02,0X10,0XE0,0XFF,0X06,0X10,0X03,0XE0,0XF0,
+0XD0,0X03,0X10,0XFE,0X90,0X0D,0X80,0XFF,0X25,0X70,0X03,0XC0,0XFF,0X06,0X80,0X03,
+0X80,0XF2,0X70,0X03,0X60,0XFD,0XB0,0X0D,0X70,0XFF,0X24,0XD0,0X03,0X80,0XFF,0X06,
+0XE0,0X03,0X20,0XF4,0X20,0X03,0XD0,0XFD,0XA0,0X40,0X10,0X0A,0X50,0XFF,0X24,0X40,
+0X02,0X30,0XFF,0X07,0X60,0X03,0XA0,0XF4,0XB0,0X03,0X30,0XFF,0X01,0XD0,0XA0,0X70,
+0X30,0X06,0X60,0XFF,0X23,0XB0,0X03,0XC0,0XFF,0X06,0XC0,0X03,0X30,0XF6,0X50,0X03,
+0XA0,0XFF,0X05,0XD0,0X90,0X50,0X01,0X10,0XD0,0XFF,0X23,0X30,0X02,0X60,0XFF,0X07,
+0X40,0X03,0XC0,0XF6,0XE0,0X03,0X10,0XFF,0X3E,0XC0,0X03,0XE0,0XFF,0X06,0XB0,0X03,
+0X50,0XF8,0X80,0X03,0X60,0XFF,0X3D,0X50,0X02,0X60,0XFF,0X07,0X20,0X03,0XE0,0XF9,
+0X20,0X03,0XD0,0XFF,0X09,0X80,0X50,0XC0,0XFF,0X1F,0XE0,0X03,0XD0,0XFF,0X06,0X90,
+0X03,0X70,0XFA,0XB0,0X03,0X30,0XFF,0X08,0X90,0X02,0XE0,0XFF,0X1E,0X80,0X02,0X40,
+0XFF,0X06,0XE0,0X10,0X02,0X10,0XFC,0X50,0X03,0XA0,0XFF,0X07,0X70,0X02,0X80,0XFF,
+0X1E,0X20,0X02,0XB0,0XFF,0X06,0X60,0X03,0X90,0XFC,0XE0,0X03,0X10,0XFF,0X07,0XB0,
+0X02,0X20,0XFF,0X1D,0XD0,0X02,0X10,0XFF,0X06,0XD0,0X03,0X20,0XFE,0X80,0X03,0X70,
+0XFF,0X07,0X10,0X02,0XD0,0XFF,0X1C,0X90,0X02,0X60,0XFF,0X06,0X40,0X03,0XB0,0XFF,
+0X00,0X20,0X03,0XD0,0XFF,0X06,0X60,0X02,0X90,0XFF,0X1C,0X40,0X02,0XB0,0XFF,0X05,
+0XC0,0X03,0X40,0XFF,0X01,0XB0,0X03,0X30,0XFF,0X06,0XB0,0X02,0X40,0XFF,0X1C,0X03,
+0XFF,0X06,0X30,0X03,0XD0,0XFF,0X02,0X50,0X03,0XA0,0XFF,0X06,0X03,0XFF,0X1B,0XD0,
+0X02,0X30,0XFF,0X05,0XA0,0X03,0X60,0XFF,0X03,0XE0,0X03,0X10,0XFF,0X06,0X30,0X02,
+0XD0,0XFF,0X1A,0XA0,0X02,0X70,0XFF,0X05,0X10,0X03,0XE0,0XFF,0X04,0X80,0X03,0X70,
+0XFF,0X05,0X70,0X02,0XA0,0XFF,0X1A,0X70,0X02,0X90,0XFF,0X04,0X80,0X03,0X80,0XFF,
+0X06,0X20,0X03,0XD0,0XFF,0X04,0X90,0X02,0X70,0XFF,0X1A,0X50,0X02,0XC0,0XFF,0X03,
+0XE0,0X03,0X20,0XFF,0X07,0XB0,0X03,0X30,0XFF,0X04,0XC0,0X02,0X50,0XFF,0X1A,0X30,
+0X02,0XE0,0XFF,0X03,0X60,0X03,0XA0,0XFF,0X08,0X50,0X03,0XA0,0XFF,0X03,0XE0,0X02,
+0X30,0XFF,0X1A,0X10,0X02,0XFF,0X03,0XE0,0X03,0X30,0XFF,0X09,0XE0,0X03,0X10,0XFF,
+0X04,0X02,0X10,0XFF,0X1A,0X02,0X10,0XFF,0X03,0X60,0X03,0XC0,0XFF,0X0A,0X80,0X03,
+0XA0,0XFF,0X03,0X10,0X02,0XFF,0X1A,0X02,0X20,0XFF,0X03,0X10,0X02,0X40,0XFF,0X0C,
+0X10,0X02,0X40,0XFF,0X03,0X10,0X02,0XFF,0X1A,0X02,0X20,0XFF,0X02,0XB0,0X03,0XB0,
+0XFF,0X0C,0X80,0X03,0XE0,0XFF,0X02,0X20,0X02,0XFF,0X1A,0X02,0X20,0XFF,0X02,0X70,
+0X02,0X10,0XFF,0X0D,0XE0,0X03,0XA0,0XFF,0X02,0X20,0X02,0XFF,0X1A,0X02,0X20,0XFF,
+0X02,0X40,0X02,0X50,0XF3,0XE0,0X90,0XB0,0XFF,0X07,0X20,0X02,0X60,0XFF,0X02,0X20,
+0X02,0XFF,0X1A,0X02,0X10,0XFF,0X02,0X10,0X02,0X80,0XF2,0XE0,0X02,0X80,0XFF,0X06,
+0X60,0X02,0X40,0XFF,0X02,0X10,0X02,0XFF,0X1A,0X10,0X02,0XFF,0X02,0X03,0XB0,0XF2,
+0X90,0X02,0X30,0XFF,0X06,0X80,0X02,0X20,0XFF,0X02,0X02,0X10,0XFF,0X1A,0X30,0X02,
+0XE0,0XFF,0X01,0X03,0XC0,0XF2,0X90,0X02,0X20,0XFF,0X06,0X90,0X02,0X10,0XFF,0X01,
+0XE0,0X02,0X30,0XFF,0X1A,0X50,0X02,0XC0,0XFF,0X01,0X03,0XB0,0XF2,0X90,0X02,0X10,
+0XFF,0X06,0X80,0X02,0X20,0XFF,0X01,0XC0,0X02,0X50,0XFF,0X1A,0X70,0X02,0XA0,0XFF,
+0X01,0X03,0XA0,0XF2,0XB0,0X03,0XE0,0XFF,0X05,0X70,0X02,0X30,0XFF,0X01,0X90,0X02,
+0X70,0XFF,0X1A,0XA0,0X02,0X60,0XFF,0X01,0X20,0X02,0X80,0XF2,0XD0,0X03,0XA0,0XFF,
+0X05,0X40,0X02,0X60,0XFF,0X01,0X70,0X02,0XA0,0XFF,0X1A,0XD0,0X02,0X30,0XFF,0X01,
+0X40,0X02,0X40,0XF3,0X10,0X02,0X40,0XFF,0X05,0X03,0X80,0XFF,0X01,0X30,0X02,0XD0,
+0XFF,0X1B,0X03,0XFF,0X01,0X80,0X03,0XF3,0X70,0X03,0XA0,0XFF,0X03,0XA0,0X03,0XD0,
+0XFF,0X01,0X03,0XFF,0X1C,0X40,0X02,0XB0,0XFF,0X00,0XD0,0X03,0X90,0XF2,0XE0,0X04,
+0XC0,0XFF,0X02,0X40,0X02,0X10,0XFF,0X01,0XB0,0X02,0X40,0XFF,0X1C,0X90,0X02,0X60,
+0XFF,0X01,0X20,0X02,0X20,0XF3,0X70,0X04,0X80,0XFF,0X00,0XC0,0X03,0X70,0XFF,0X01,
+0X60,0X02,0X90,0XFF,0X1C,0XD0,0X02,0X30,0XFF,0X01,0X80,0X03,0X90,0XF3,0X20,0X05,
+0XB0,0XFD,0X30,0X03,0XE0,0XFF,0X01,0X10,0X02,0XD0,0XFF,0X1D,0X30,0X01,0X50,0XFF,
+0X02,0X10,0X03,0XE0,0XF2,0XE0,0X20,0X04,0X20,0XFC,0X80,0X03,0X60,0XFF,0X01,0XB0,
+0X02,0X20,0XFF,0X1E,0XE0,0X70,0X80,0XFF,0X03,0X80,0X03,0X30,0XF3,0XE0,0X40,0X03,
+0X10,0XFB,0XB0,0X04,0XE0,0XFF,0X01,0X50,0X02,0X80,0XFF,0X35,0X20,0X03,0X50,0XF4,
+0XA0,0X20,0X01,0X90,0XFA,0XC0,0X04,0X90,0XFF,0X01,0XD0,0X03,0XE0,0XFF,0X35,0XD0,
+0X04,0X50,0XF5,0XD0,0XE0,0XFA,0XB0,0X04,0X50,0XFF,0X02,0X60,0X02,0X50,0XFF,0X22,
+0X30,0X00,0X10,0X90,0XFF,0X01,0XA0,0X04,0X30,0XE0,0XFF,0X00,0X70,0X04,0X20,0XFF,
+0X02,0XE0,0X03,0XC0,0XFF,0X21,0XA0,0X03,0X10,0X70,0XD0,0XFE,0X80,0X05,0X90,0XFC,
+0XB0,0X20,0X04,0X20,0XE0,0XFF,0X02,0X60,0X02,0X30,0XFF,0X22,0XA0,0X06,0X30,0X90,
+0XFD,0X80,0X05,0X20,0X80,0XE0,0XF7,0XA0,0X30,0X05,0X30,0XE0,0XFF,0X02,0XC0,0X03,
+0XC0,0XFF,0X22,0XB0,0X09,0X60,0XC0,0XFB,0XA0,0X07,0X30,0X60,0X80,0X90,0X80,0X70,
+0X40,0X07,0X50,0XFF,0X04,0X30,0X02,0X40,0XFF,0X23,0XC0,0X0B,0X50,0XFB,0XD0,0X30,
+0X0F,0X03,0X10,0X90,0XFF,0X04,0X80,0X03,0XD0,0XFF,0X23,0XC0,0X0C,0XE0,0XFC,0X90,
+0X10,0X0F,0X00,0X70,0XE0,0XFF,0X04,0XC0,0X03,0X70,0XFF,0X24,0XD0,0X05,0X20,0X90,
+0X30,0X03,0XFF,0X00,0X90,0X30,0X0A,0X20,0X80,0XE0,0XFF,0X05,0XE0,0X20,0X02,0X20,
+0XFF,0X25,0XE0,0X06,0X40,0XF0,0XD0,0X70,0X60,0XC0,0XFF,0X02,0XE0,0X90,0X60,0X30,
+0X20,0X10,0X20,0X30,0X50,0X80,0XD0,0XFF,0X08,0X40,0X03,0XD0,0XFF,0X25,0XE0,0X02,
+0X20,0X03,0X60,0XFF,0X28,0X60,0X03,0X90,0XFF,0X27,0X02,0X30,0X50,0X03,0X70,0XFF,
+0X26,0X70,0X03,0X50,0XFF,0X28,0X02,0X30,0XF0,0X30,0X03,0X70,0XFF,0X24,0X70,0X03,
+0X30,0XFF,0X29,0X02,0X20,0XF1,0X20,0X03,0X60,0XFF,0X22,0X60,0X03,0X20,0XE0,0XFF,
+0X29,0X02,0X20,0XF1,0XE0,0X20,0X03,0X40,0XFF,0X1F,0XE0,0X40,0X03,0X20,0XE0,0XFF,
+0X2A,0X10,0X01,0X30,0XF2,0XE0,0X20,0X03,0X20,0XC0,0XFF,0X1C,0XC0,0X20,0X03,0X20,
+0XE0,0XFF,0X2B,0XB0,0X10,0X20,0XC0,0XF3,0XE0,0X30,0X04,0X80,0XFF,0X1A,0X80,0X04,
+0X30,0XE0,0XFF,0X36,0X60,0X04,0X30,0XD0,0XFF,0X16,0XC0,0X30,0X04,0X50,0XFF,0X39,
+0X90,0X05,0X60,0XE0,0XFF,0X12,0XE0,0X60,0X05,0X90,0XFF,0X3B,0XC0,0X20,0X05,0X60,
+0XE0,0XFF,0X0E,0XD0,0X60,0X05,0X20,0XC0,0XFF,0X3E,0X70,0X06,0X50,0XB0,0XFF,0X0A,
+0XB0,0X40,0X06,0X70,0XFF,0X41,0XD0,0X40,0X06,0X10,0X60,0XB0,0XFF,0X04,0XB0,0X60,
+0X10,0X06,0X40,0XD0,0XFF,0X44,0XB0,0X40,0X08,0X30,0X70,0XA0,0XC0,0XE0,0XF7,0XE0,
+0XC0,0XA0,0X70,0X30,0X08,0X30,0XB0,0XFF,0X48,0XC0,0X50,0X0C,0X10,0X23,0X10,0X0C,
+0X50,0XC0,0XFF,0X4C,0XE0,0X80,0X30,0X0F,0X0A,0X20,0X80,0XE0,0XFF,0X51,0XD0,0X90,
+0X40,0X10,0X0F,0X03,0X40,0X90,0XD0,0XFF,0X58,0XD0,0XA0,0X70,0X50,0X30,0X10,0X05,
+0X10,0X30,0X50,0X70,0XA0,0XD0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XED,
+0XE0,0XF3,0XE0,0XFF,0X00,0XE0,0XF4,0XE0,0XFF,0X1C,0XD0,0XFF,0X23,0XB0,0X90,0XD0,
+0XF1,0XC0,0X50,0XC0,0XFD,0XD0,0X40,0XD0,0XF3,0XA1,0XE0,0XFC,0XE0,0X60,0XB0,0XD0,
+0XB0,0X94,0XB0,0XE0,0XF8,0X90,0X50,0XE0,0XF3,0X80,0X30,0XFF,0X23,0X50,0X60,0XC0,
+0XF0,0XE0,0X40,0X30,0X60,0X82,0XB0,0XF9,0XC0,0X00,0XD0,0XF1,0XE0,0XC0,0X80,0X40,
+0X80,0XD0,0XE0,0XFB,0X00,0XB0,0X90,0X30,0X51,0X41,0X51,0X90,0XF8,0XA0,0X20,0X40,
+0XC0,0XF0,0XE0,0X80,0X40,0X80,0XF0,0X90,0X80,0XD0,0XFF,0X1F,0X10,0X60,0XB0,0XD0,
+0X90,0X00,0X50,0X80,0X90,0X40,0X00,0XA0,0XF7,0XD0,0X90,0X70,0X00,0X70,0XC1,0X70,
+0X50,0X60,0X10,0X30,0X61,0X90,0XF8,0XE0,0XA0,0X20,0XE0,0X50,0X10,0XA0,0X92,0XA0,
+0X60,0X40,0XF9,0X90,0X20,0XA0,0XC0,0X60,0X10,0X40,0XC0,0XA0,0X30,0X00,0X70,0XE0,
+0XFF,0X1D,0XC0,0X10,0X60,0X90,0X70,0X50,0X40,0X50,0XD1,0X60,0X30,0XE0,0XF7,0XB0,
+0X30,0X20,0X01,0X90,0X80,0X10,0X50,0X62,0X30,0X10,0X40,0XE0,0XF7,0XC0,0X30,0X90,
+0XF0,0X40,0X50,0XF4,0XA0,0X40,0XF8,0XE1,0XC0,0XD0,0X60,0X10,0X30,0X60,0X40,0X30,
+0X50,0X30,0X40,0XA0,0XFF,0X1C,0XD0,0X40,0X30,0X80,0X90,0X70,0X90,0XF0,0X40,0X30,
+0X10,0X50,0XE0,0XF8,0XE0,0XC0,0X90,0X00,0XA0,0XF0,0X90,0X40,0XF3,0XD0,0X60,0X40,
+0XE0,0XF7,0X90,0X10,0XD0,0XF0,0X40,0X30,0XD0,0XB0,0XD0,0XC1,0X70,0X50,0XF7,0XE0,
+0X81,0XF1,0X91,0XC0,0X80,0X00,0XA0,0XE1,0XA0,0X90,0XFF,0X1C,0XC0,0X10,0X30,0X81,
+0XA0,0XF0,0XA0,0X40,0X20,0X10,0X30,0X80,0XB0,0XD0,0XF8,0XD0,0X00,0XC0,0XF0,0XA0,
+0X50,0XF3,0XD0,0X60,0X50,0XE0,0XF6,0XD0,0X50,0X00,0XD0,0XF0,0X50,0X00,0X41,0X20,
+0X30,0X40,0X30,0X60,0XF8,0X60,0X00,0X60,0XE0,0X60,0X71,0X10,0X00,0X51,0X70,0X60,
+0X70,0XFF,0X1C,0X70,0X40,0X20,0X80,0X90,0X60,0X50,0X60,0XA0,0XB0,0X80,0X60,0X50,
+0X30,0X90,0XE0,0XF7,0XC0,0X00,0X40,0XA0,0X90,0X40,0XA0,0XB2,0X90,0X41,0XE0,0XF6,
+0X80,0X00,0X10,0XD0,0XF0,0XB0,0X90,0XC0,0XB0,0X00,0X70,0XC0,0XB1,0XF8,0XD0,0X80,
+0X70,0XF0,0XE0,0X90,0X20,0X40,0XD0,0XA0,0X00,0X50,0XD0,0XE0,0XFF,0X1C,0X80,0XA0,
+0X10,0X70,0X90,0X71,0XA0,0X90,0X80,0XA0,0XD0,0XB0,0X80,0XC0,0XF6,0XD0,0X70,0X40,
+0X00,0X20,0XB0,0X90,0X10,0X32,0X40,0X20,0X00,0X40,0XE0,0XF6,0X80,0X21,0XD0,0XF0,
+0XC1,0XF1,0X00,0X90,0XF0,0XE1,0XFA,0XD0,0XC0,0XA0,0X60,0X50,0X90,0XA0,0XC0,0X90,
+0X50,0X70,0XC0,0XFF,0X1C,0XD0,0XE0,0X10,0X70,0X90,0XA0,0XD0,0XA0,0X70,0X60,0X80,
+0XC0,0XD0,0XF8,0XA0,0X31,0X00,0X80,0XF0,0XA0,0X10,0X60,0X72,0X50,0X40,0X70,0XF7,
+0XD0,0X80,0X30,0XD0,0XF0,0X71,0XF0,0XE0,0X10,0X40,0X71,0X90,0XE0,0XF8,0XE0,0XB0,
+0X70,0X21,0X80,0X90,0X60,0XA0,0XD0,0X90,0X30,0X50,0XFF,0X1E,0X20,0X70,0X80,0XA0,
+0XB0,0X50,0X90,0XB0,0X80,0X50,0X90,0XE0,0XF7,0XD0,0XA0,0XB0,0X00,0XD0,0XF0,0X90,
+0X50,0XF4,0XE0,0XD0,0XF8,0XC0,0X20,0XD0,0XF0,0X41,0XF0,0XE0,0X10,0X20,0X50,0X40,
+0X50,0XE0,0XF7,0XD0,0X80,0X40,0X81,0X60,0X50,0X70,0X90,0X71,0XD0,0XB0,0X70,0XFF,
+0X1D,0XE0,0X20,0X70,0X80,0XA0,0XE0,0XB0,0X70,0X40,0X70,0XA0,0X90,0X50,0XE0,0XF8,
+0XC0,0X00,0XC0,0XF0,0X80,0X50,0XFF,0X00,0XB0,0X20,0XD0,0XF0,0X41,0XF0,0XE0,0X10,
+0X90,0XFB,0XB0,0X50,0X90,0XF1,0XB0,0X81,0X61,0XB0,0X80,0X90,0XFF,0X1E,0XE0,0X10,
+0XA0,0XE0,0XD0,0XB0,0X50,0X90,0XB0,0XA0,0X50,0X20,0X80,0XF9,0XE0,0X00,0XD0,0XB0,
+0X40,0X80,0XFF,0X00,0XB0,0X20,0XE0,0XB0,0X50,0X20,0X70,0XF0,0X10,0XA0,0XFB,0X70,
+0X20,0XD0,0XF1,0X90,0X60,0X90,0XA1,0X60,0X20,0X70,0XFF,0X1E,0XE0,0X00,0XB0,0XF1,
+0XD0,0X90,0X70,0X50,0X40,0X70,0XA0,0XE0,0XF7,0XE0,0XB0,0X80,0X00,0XC0,0X50,0X30,
+0XE0,0XFF,0X00,0XB0,0X20,0XC0,0X20,0X80,0X90,0X20,0X40,0X00,0X40,0X82,0XA0,0XF7,
+0X50,0X10,0XF2,0XB0,0X80,0X70,0X50,0X40,0X60,0X90,0XD0,0XFF,0X1E,0XE0,0X00,0XB0,
+0XF0,0XD0,0X70,0X62,0X80,0XD0,0XF9,0XB0,0X40,0X20,0X50,0XA0,0X40,0X70,0XFF,0X01,
+0XB0,0X20,0XA0,0X30,0XB0,0XF0,0X80,0X45,0X80,0XF7,0X70,0X40,0XF1,0XB0,0X70,0X60,
+0X50,0X60,0X80,0XC0,0XFF,0X21,0X70,0XD0,0XF0,0XC0,0X40,0X60,0X90,0XE0,0XFB,0XC0,
+0X61,0XD0,0XB0,0XA0,0XD0,0XFF,0X01,0XD0,0X80,0XC0,0XB0,0XE0,0XF1,0XE0,0XC0,0XB0,
+0XA0,0X90,0XA0,0XD0,0XF7,0XB1,0XF1,0X80,0X60,0X70,0X90,0XE0,0XFF,0X69,0XE0,0XFF,
+0XFF,0XFF,0X13,0XE0,0XD0,0XB1,0XC0,0XFF,0X23,0XE0,0XA0,0X90,0XFF,0X32,0XE0,0X80,
+0X50,0X31,0X40,0X70,0XD0,0XFF,0X08,0XE1,0XFF,0X07,0XD0,0X50,0X20,0XE0,0XFF,0X31,
+0XD0,0X40,0X00,0X40,0X50,0X30,0X10,0X50,0XE0,0XFF,0X07,0X90,0XA0,0XFF,0X07,0XE0,
+0X80,0X70,0XE0,0XFF,0X31,0XD0,0X40,0X20,0XD0,0XF1,0X70,0X00,0XD0,0XF5,0XE1,0XF6,
+0XE2,0XF3,0XE0,0X30,0X70,0XE0,0XF6,0XE1,0XF8,0XE1,0XFB,0XE1,0XF7,0XE1,0XFF,0X1F,
+0XD0,0X50,0X20,0XC0,0XF1,0XB0,0X00,0XB0,0XF4,0X70,0X31,0X80,0XF4,0XD0,0X50,0X30,
+0X20,0X80,0XF1,0XE0,0X50,0X00,0X20,0X40,0X70,0XF3,0XC0,0X50,0X31,0X70,0XE0,0XF3,
+0XB0,0XA1,0X50,0X30,0XD0,0XF0,0XE0,0XB0,0XA0,0XF2,0XD0,0XA0,0XB0,0X90,0X40,0X30,
+0X90,0XF5,0XB0,0X30,0X20,0X80,0XB0,0XA0,0XFF,0X1C,0XD0,0X50,0X30,0XE0,0XF0,0XE0,
+0X60,0X00,0XD0,0XF2,0XE0,0X50,0X20,0X51,0X20,0X60,0XF2,0XB0,0X40,0X30,0X60,0X20,
+0X70,0XE0,0XF0,0XE0,0X40,0X00,0X10,0X30,0X60,0XF2,0XB0,0X21,0X50,0X40,0X00,0X50,
+0XD0,0XF2,0X70,0X10,0X30,0X50,0X40,0XD0,0XF0,0XD0,0X60,0X40,0XE0,0XF1,0XC0,0X40,
+0X20,0X40,0X60,0X21,0X90,0XF3,0XA0,0X10,0X30,0X50,0X40,0X10,0X40,0XE0,0XFF,0X1B,
+0XD0,0X50,0X10,0X50,0X70,0X50,0X40,0X90,0XF3,0X90,0X00,0XA0,0XE1,0X70,0X00,0XE0,
+0XF1,0X70,0X00,0XA0,0XE0,0XC0,0XD0,0XF2,0XC0,0X30,0X60,0XB0,0XC0,0XF1,0XE0,0X40,
+0X10,0XA0,0XD0,0XC0,0X60,0X10,0X60,0XF2,0X60,0X00,0X50,0XC1,0XF1,0XC0,0X50,0X30,
+0XE0,0XF1,0XC0,0X20,0X00,0X90,0XD0,0XB0,0X40,0X20,0XF2,0XC0,0X50,0X30,0XB0,0XD0,
+0XB0,0X30,0X10,0XE0,0XFF,0X1B,0XD0,0X50,0X00,0X30,0X20,0X00,0X50,0XF3,0XD0,0X60,
+0X00,0X90,0XA1,0X50,0X00,0XC0,0XF1,0X90,0X20,0X70,0XA0,0XE0,0XF4,0X40,0X90,0XF3,
+0XA0,0X20,0X60,0XF2,0XE0,0X40,0X10,0XE0,0XF1,0X60,0X20,0XA0,0XF3,0XD0,0X60,0X40,
+0XE0,0XF1,0XC0,0X31,0XF2,0X80,0X00,0XF2,0X80,0X20,0XB0,0XF2,0X80,0X20,0XE0,0XFF,
+0X1B,0XD0,0X50,0X20,0XA1,0X41,0XD0,0XF2,0XD0,0X60,0X10,0X21,0X11,0X40,0XD0,0XF1,
+0XE0,0X80,0X11,0X50,0XC0,0XF3,0X40,0X70,0XF3,0X70,0X20,0X70,0XF3,0X60,0X10,0XD0,
+0XF1,0X60,0X30,0XC0,0XF3,0XD0,0X60,0X40,0XE0,0XF1,0XB0,0X30,0X60,0XE0,0XF1,0X80,
+0X10,0XF2,0X70,0X10,0XE0,0XF2,0X90,0X30,0XE0,0XFF,0X1B,0XD0,0X50,0X20,0XD0,0XF0,
+0XB0,0X30,0X50,0XE0,0XF1,0XD0,0X60,0X20,0XC0,0XD0,0XC1,0XE0,0XF4,0XD0,0X80,0X00,
+0X20,0XB0,0XF2,0X40,0X80,0XF3,0X90,0X20,0X60,0XF3,0X50,0X20,0XE0,0XF1,0X60,0X30,
+0XB0,0XF3,0XD0,0X60,0X40,0XE0,0XF1,0XC0,0X30,0X50,0XE0,0XF1,0X80,0X10,0XF2,0X80,
+0X10,0XC0,0XF2,0X80,0X20,0XE0,0XFF,0X1B,0XD0,0X40,0X20,0XC0,0XF1,0X80,0X00,0XB0,
+0XF1,0XE0,0X70,0X00,0XE0,0XF2,0XE0,0XF6,0X60,0X00,0X70,0XF2,0X40,0X70,0XF3,0XD0,
+0X30,0X20,0XE0,0XF1,0X90,0X10,0X50,0XF2,0X60,0X20,0XB0,0XF3,0XD0,0X50,0X40,0XE0,
+0XF1,0XC0,0X30,0X50,0XE0,0XF1,0X80,0X10,0XF2,0XA0,0X20,0X60,0XF1,0XC0,0X30,0X20,
+0XE0,0XFF,0X1B,0XD0,0X30,0X10,0XC0,0XF1,0XD0,0X21,0XB0,0XF1,0XC0,0X21,0X50,0X60,
+0X40,0X50,0XF2,0X90,0X20,0X61,0X00,0X40,0XC0,0XF2,0X70,0X10,0X20,0X80,0XF2,0X90,
+0X10,0X20,0X60,0X40,0X00,0X40,0XD0,0XF2,0X50,0X10,0XA0,0XF3,0XC0,0X40,0X20,0XE0,
+0XF1,0XB0,0X20,0X30,0XE0,0XF1,0X70,0X00,0XF2,0XE0,0X70,0X00,0X40,0X50,0X40,0X10,
+0X30,0XE0,0XFF,0X1B,0XE0,0X90,0X80,0XE0,0XF2,0XB0,0X50,0XB0,0XF2,0XB0,0X50,0X30,
+0X40,0X50,0X90,0XF2,0XB0,0X42,0X60,0XC0,0XF3,0XD0,0X60,0X20,0X70,0XF2,0XE0,0X90,
+0X42,0X60,0XC0,0XF3,0XA0,0X80,0XD0,0XF3,0XE0,0XA0,0X90,0XF2,0XD0,0X80,0X90,0XF2,
+0XB0,0X70,0XF3,0XD0,0X70,0X41,0X90,0X60,0X20,0XE0,0XFF,0X23,0XE1,0XF3,0XE0,0XC0,
+0XB0,0XE0,0XF4,0XD0,0XB1,0XF6,0XE0,0XC0,0XD0,0XF4,0XE0,0XB0,0XC0,0XFF,0X11,0XD1,
+0XF0,0X80,0X10,0XE0,0XFF,0X65,0XE0,0XC1,0XE1,0X90,0X30,0X50,0XFF,0X66,0XD0,0X60,
+0X10,0X31,0X00,0X40,0XE0,0XFF,0X67,0XB0,0X60,0X31,0X80,0XD0,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X8E,0XE1,0XD0,0XC1,0XB1,
+0XA0,0X92,0X81,0X71,0X61,0X52,0X41,0X33,0X23,0X13,0X0F,0X08,0X13,0X23,0X33,0X41,
+0X52,0X61,0X72,0X80,0X91,0XA1,0XB1,0XC1,0XD0,0XE1,0XFF,0XFF,0XFF,0XFF,0XFF,0XDA,};
+const image_rle_t gImage_mode5_126x174 = { s_gImage_mode5_126x174_rle, sizeof(s_gImage_mode5_126x174_rle), 126, 174 };
+
+/* 126x120，原始7560字节 */
+static const unsigned char s_gImage_dang1_rle[1380] ASSET_SECTION = {
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X8F,0XB0,0X2D,0X50,0XFF,0X5E,0XB0,0X01,0X1A,
+0X00,0X40,0XFF,0X5F,0X80,0X50,0XD9,0XB0,0X40,0XD0,0XFF,0X5F,0XA0,0X50,0XF9,0XD0,
+0X40,0XFF,0X60,0XA0,0X40,0XF9,0XB0,0X40,0XFF,0X60,0XB0,0X40,0X99,0X61,0XFF,0X60,
+0XE0,0X60,0X20,0X50,0X66,0X30,0X20,0XB0,0XFF,0X61,0XB0,0X21,0X50,0X64,0X40,0X10,
+0X60,0XFF,0X63,0X90,0X10,0X20,0X50,0X62,0X40,0X10,0X40,0XE0,0XFF,0X64,0X90,0X20,
+0X30,0X50,0X60,0X40,0X10,0X50,0XD0,0XFF,0X66,0XA0,0X20,0X40,0X50,0X10,0X50,0XE0,
+0XFF,0X68,0X80,0X20,0X40,0X30,0XD0,0XFF,0X69,0XB0,0X30,0X51,0XFF,0X69,0XE0,0X70,
+0X60,0X70,0X50,0XB0,0XFF,0X68,0X70,0X50,0XB0,0XA0,0X90,0X40,0XB0,0XFF,0X65,0XE0,
+0X70,0X50,0XC0,0XD0,0XB0,0XE0,0X80,0X40,0XB0,0XFF,0X55,0X90,0X50,0XFB,0XE0,0X70,
+0X50,0XD0,0XF0,0XC0,0XB0,0XF1,0X90,0X40,0XC0,0XFF,0X62,0XA0,0X40,0XD0,0XF1,0XD0,
+0XC0,0XF2,0X80,0X50,0XE0,0XFF,0X49,0XA0,0XF0,0X91,0XF0,0XD0,0X90,0XA0,0XF1,0XD0,
+0XC0,0XF0,0XC0,0XD0,0XA0,0X90,0XD0,0XF4,0XD0,0X60,0XA0,0XF2,0XB0,0XA0,0XC0,0XF1,
+0XE0,0X60,0X90,0XFF,0X49,0X20,0X40,0X80,0X42,0X90,0X20,0X80,0XF0,0X90,0X50,0XF0,
+0X50,0X30,0X71,0X10,0XD0,0XF3,0XB0,0X40,0XF2,0XB0,0X61,0X80,0XF2,0XA0,0X50,0XFF,
+0X49,0X20,0XC0,0XF1,0X00,0XF1,0X90,0X40,0XF0,0X90,0X50,0XF0,0X50,0X70,0XF1,0X50,
+0X90,0XF3,0XA0,0X50,0XF1,0XA0,0X70,0X52,0X90,0XD0,0XF0,0XC0,0X40,0XFF,0X49,0X20,
+0XF2,0X20,0XF1,0X90,0X20,0XF0,0X90,0X50,0XF0,0X50,0X90,0XF1,0X50,0X90,0XF3,0XA0,
+0X60,0XD0,0X90,0X51,0X62,0X50,0X70,0XC1,0X50,0XFF,0X49,0X20,0XF2,0X20,0XF1,0X90,
+0X20,0XF0,0X90,0X50,0XF0,0X50,0X90,0XF1,0X50,0X90,0XF2,0XE0,0X60,0X30,0X80,0X50,
+0X65,0X50,0X60,0X70,0X30,0XB0,0XFF,0X48,0X20,0XF2,0X20,0XF1,0X90,0X20,0XF0,0X90,
+0X50,0XF0,0X50,0X90,0XF1,0X50,0X90,0XF2,0XA0,0X01,0X10,0X20,0X14,0X21,0X10,0X01,
+0X30,0XFF,0X48,0X20,0XF2,0X20,0XF1,0X90,0X20,0XF0,0X90,0X50,0XF0,0X50,0X90,0XF1,
+0X50,0X90,0XF2,0XC0,0X61,0X50,0X63,0X50,0X62,0X50,0X61,0X80,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0X97,0XD0,0XC1,0XD0,0XFF,0X68,0XD0,0X80,0X42,0X50,0XA0,
+0XE0,0XFF,0X65,0XC0,0X40,0X30,0X60,0X90,0X80,0X60,0X30,0X70,0XE0,0XFF,0X63,0XE0,
+0X50,0X20,0XB0,0XF3,0XA0,0X30,0X70,0XFF,0X63,0X90,0X20,0XA0,0XF5,0XA0,0X40,0XC0,
+0XFF,0X62,0X70,0X40,0XF6,0XE0,0X60,0X70,0XFF,0X62,0X70,0X50,0XF6,0XE0,0X70,0X50,
+0XFF,0X62,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X54,0XE0,0XD1,0XE0,0XF9,0X70,0X50,
+0XF6,0XE0,0X70,0X50,0XFF,0X52,0XE0,0X90,0X42,0X60,0XA0,0XF8,0X70,0X50,0XF6,0XE0,
+0X70,0X50,0XFF,0X51,0XE0,0X60,0X30,0X60,0X81,0X60,0X40,0X80,0XF7,0X70,0X50,0XF6,
+0XE0,0X70,0X50,0XFF,0X51,0X70,0X30,0XA0,0XF3,0X90,0X40,0X80,0XF6,0X70,0X50,0XF6,
+0XE0,0X70,0X50,0XFF,0X50,0XA0,0X30,0X90,0XF5,0X90,0X50,0XC0,0XF5,0X70,0X50,0XF6,
+0XE0,0X70,0X50,0XFF,0X50,0X70,0X50,0XF6,0XE0,0X60,0X70,0XF5,0X70,0X50,0XF6,0XE0,
+0X70,0X50,0XFF,0X50,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,
+0XFF,0X50,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X43,
+0XE1,0XFA,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X41,
+0XC0,0X70,0X41,0X70,0XC0,0XF8,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,
+0X70,0X50,0XFF,0X40,0X80,0X40,0X70,0X81,0X70,0X40,0X80,0XF7,0X70,0X60,0XF7,0X70,
+0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X3F,0X90,0X40,0X90,0XE0,0XF1,0XE0,
+0X90,0X40,0X90,0XF6,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,
+0XFF,0X3E,0XC0,0X50,0X90,0XF5,0X90,0X50,0XC0,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,
+0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X3E,0X80,0X60,0XE0,0XF5,0XE0,0X60,0X90,0XF5,
+0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X3E,0X60,0X70,
+0XF7,0X71,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,
+0X3E,0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,
+0XE0,0X70,0X50,0XFF,0X3E,0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,
+0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X3E,0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,
+0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X2F,0XC0,0X60,0X41,
+0X60,0XC0,0XF8,0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,
+0X50,0XF6,0XE0,0X70,0X50,0XFF,0X2E,0X80,0X40,0X50,0X81,0X60,0X40,0X90,0XF7,0X60,
+0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,
+0X50,0XFF,0X2D,0X90,0X40,0X90,0XE0,0XF1,0XE0,0X90,0X40,0X90,0XF6,0X60,0X70,0XF7,
+0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,
+0X2C,0XC0,0X50,0X80,0XF5,0X80,0X50,0XC0,0XF5,0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,
+0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X2C,0X70,0X50,0XD0,
+0XF5,0XE0,0X60,0X90,0XF5,0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,
+0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X2C,0X50,0X70,0XF7,0X60,0X70,0XF5,0X60,
+0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,
+0X50,0XFF,0X1E,0XD0,0X90,0X70,0X60,0X90,0XD0,0XF7,0X50,0X70,0XF7,0X60,0X70,0XF5,
+0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,
+0X70,0X50,0XFF,0X1D,0XA0,0X40,0X10,0X01,0X10,0X40,0XA0,0XF6,0X50,0X70,0XF7,0X60,
+0X70,0XF5,0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,
+0XF6,0XE0,0X70,0X50,0XFF,0X1C,0XB0,0X20,0X05,0X20,0XB0,0XF5,0X50,0X70,0XF7,0X60,
+0X70,0XF5,0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,
+0XF6,0XE0,0X70,0X50,0XFF,0X1B,0XD0,0X40,0X07,0X40,0XD0,0XF4,0X50,0X70,0XF7,0X60,
+0X70,0XF5,0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,
+0XF6,0XE0,0X70,0X50,0XFF,0X1B,0X90,0X09,0X90,0XF4,0X50,0X70,0XF7,0X60,0X70,0XF5,
+0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,
+0X70,0X50,0XFF,0X1B,0X70,0X09,0X80,0XF4,0X50,0X70,0XF7,0X60,0X70,0XF5,0X60,0X70,
+0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,
+0XFF,0X1B,0X60,0X09,0X80,0XF4,0X50,0X70,0XF7,0X60,0X70,0XF5,0X60,0X70,0XF7,0X70,
+0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X1B,
+0X60,0X09,0X80,0XF4,0X50,0X70,0XF7,0X60,0X70,0XF5,0X60,0X70,0XF7,0X70,0X60,0XF5,
+0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X1B,0X60,0X09,
+0X80,0XF4,0X50,0X70,0XF7,0X60,0X70,0XF5,0X60,0X70,0XF7,0X70,0X60,0XF5,0X70,0X60,
+0XF7,0X70,0X50,0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X1B,0X60,0X09,0X80,0XF4,
+0X50,0X70,0XF7,0X60,0X70,0XF5,0X71,0XF7,0X70,0X60,0XF5,0X70,0X60,0XF7,0X70,0X50,
+0XF5,0X70,0X50,0XF6,0XE0,0X70,0X50,0XFF,0X1B,0X60,0X09,0X80,0XF4,0X50,0X70,0XF7,
+0X60,0X70,0XF5,0X60,0X70,0XF7,0X71,0XF5,0X70,0X60,0XF7,0X70,0X50,0XF5,0X70,0X50,
+0XF6,0XE0,0X70,0X50,0XFF,0X1B,0X60,0X09,0X80,0XF4,0X50,0X80,0XF7,0X60,0X70,0XF5,
+0X60,0X80,0XF7,0X80,0X60,0XF5,0X70,0X60,0XF7,0X80,0X50,0XF5,0X70,0X50,0XF7,0X70,
+0X50,0XFF,0X1B,0X60,0X09,0X80,0XF4,0X50,0X20,0X67,0X10,0X70,0XF5,0X60,0X20,0X67,
+0X20,0X60,0XF5,0X70,0X10,0X67,0X20,0X50,0XF5,0X70,0X10,0X67,0X20,0X50,0XFF,0X1B,
+0XB0,0X79,0XB0,0XF4,0XB0,0X69,0XB0,0XF5,0XB0,0X69,0XB0,0XF5,0XB0,0X69,0XB0,0XF5,
+0XC0,0X68,0X70,0XB0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0X62,};
+const image_rle_t gImage_dang1 = { s_gImage_dang1_rle, sizeof(s_gImage_dang1_rle), 126, 120 };
+
+/* 126x120，原始7560字节 */
+static const unsigned char s_gImage_dang2_rle[1235] ASSET_SECTION = {
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7B,0XE0,0X0E,0XFF,0X5F,0X30,0X00,
+0X2A,0X00,0X30,0XFF,0X5F,0XE0,0X20,0XFA,0X20,0XE0,0XFF,0X5F,0XE0,0X20,0XFA,0X10,
+0XFF,0X61,0X00,0XF9,0XE0,0X20,0XFF,0X61,0X40,0X79,0X60,0X40,0XFF,0X61,0XA0,0X10,
+0X50,0X66,0X40,0X10,0XB0,0XFF,0X62,0X40,0X10,0X50,0X64,0X40,0X00,0X50,0XFF,0X64,
+0X30,0X10,0X50,0X62,0X40,0X00,0X40,0XFF,0X66,0X40,0X10,0X50,0X60,0X40,0X00,0X50,
+0XFF,0X68,0X40,0X30,0X60,0X10,0X50,0XFF,0X69,0XD0,0X10,0X50,0X20,0XE0,0XFF,0X69,
+0XE0,0X30,0X70,0X20,0XFF,0X6A,0X50,0X80,0X90,0X61,0XFF,0X68,0X60,0X40,0XC0,0XA0,
+0XD0,0X40,0X70,0XFF,0X56,0XD0,0XF1,0XE0,0XD0,0XFA,0X51,0XF1,0XA0,0XE0,0XF0,0X40,
+0X50,0XFF,0X4D,0X80,0X60,0XF0,0X30,0XD0,0XF1,0X80,0X40,0XC0,0XF0,0X80,0X40,0XF9,
+0X61,0XF1,0XC0,0XB0,0XF2,0X40,0X70,0XFF,0X4B,0XE0,0X10,0XB0,0XF0,0X80,0X40,0XF0,
+0XD0,0X10,0X40,0X50,0X80,0X40,0X10,0X80,0XE0,0XF6,0XB0,0X30,0XF3,0XA0,0XE0,0XF2,
+0X20,0XC0,0XFF,0X49,0XE0,0X30,0X70,0XF2,0X30,0X60,0XC0,0X20,0X40,0X50,0X00,0X40,
+0X20,0X10,0XB0,0XF6,0X40,0XB0,0XF2,0X90,0XA0,0X90,0XF2,0XA0,0X50,0XFF,0X49,0XA0,
+0X20,0X04,0X60,0XE0,0X90,0X00,0X80,0X00,0X80,0X41,0XB0,0XF6,0X10,0XF2,0XA0,0X52,
+0XC0,0XF2,0X10,0XFF,0X4C,0X00,0XE1,0X00,0XF0,0XC0,0X06,0XB0,0XF5,0XE0,0X20,0XF1,
+0X70,0X50,0X62,0X50,0X80,0XF1,0X20,0XFF,0X4B,0X80,0X40,0XF0,0XB0,0X00,0XF2,0X00,
+0XE0,0X61,0X30,0X70,0XD0,0XF5,0XD0,0X20,0XB0,0X67,0X50,0XE0,0X20,0XE0,0XFF,0X49,
+0X80,0X20,0XC1,0X80,0X30,0XF1,0XE0,0X00,0X10,0XE0,0X80,0X40,0XF7,0X40,0X00,0X50,
+0X63,0X51,0X62,0X50,0X00,0X50,0XFF,0X48,0XC0,0X40,0XC0,0XF0,0X50,0X40,0X90,0XF1,
+0XC0,0X80,0XE0,0XF0,0X80,0X50,0XF6,0XE0,0X0E,0XFF,0X5F,0XE0,0XD1,0XE1,0XD2,0XE0,
+0XD4,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X19,0XE3,0XFF,0X68,0XE0,
+0X80,0X20,0X11,0X20,0X70,0XFF,0X66,0XD0,0X30,0X20,0XA0,0XE0,0XF0,0XC0,0X40,0X30,
+0XD0,0XFF,0X64,0X60,0X30,0XE0,0XF4,0X70,0X30,0XFF,0X63,0XC0,0X10,0XB0,0XF5,0XD0,
+0X50,0X90,0XFF,0X62,0XB0,0X20,0XF7,0X80,0X40,0XFF,0X62,0XA0,0X20,0XF7,0X90,0X30,
+0XFF,0X62,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X54,0XE0,0XD2,0XF9,0XA0,0X20,0XF7,0X90,
+0X30,0XFF,0X53,0X90,0X20,0X11,0X20,0X60,0XD0,0XF7,0XA0,0X20,0XF7,0X90,0X30,0XFF,
+0X51,0XE0,0X60,0X20,0XA0,0XF1,0XD0,0X70,0X20,0XB0,0XF6,0XA0,0X20,0XF7,0X90,0X30,
+0XFF,0X51,0X90,0X20,0XE0,0XF4,0XA0,0X20,0XE0,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,
+0X50,0XD0,0X20,0XA0,0XF5,0XE0,0X71,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X50,0XD0,
+0X10,0XF7,0XA0,0X20,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X50,0XD0,0X10,0XF7,0XB0,
+0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X50,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,
+0X20,0XF7,0X90,0X30,0XFF,0X42,0XE0,0XD0,0XC0,0XD0,0XE0,0XF8,0XD0,0X10,0XF7,0XB0,
+0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X41,0XB0,0X50,0X20,0X10,0X20,0X50,0XB0,
+0XF7,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X40,0X90,0X20,
+0X90,0XE0,0XF0,0XE0,0X90,0X20,0X90,0XF6,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,
+0XF7,0X90,0X30,0XFF,0X3F,0XC0,0X20,0XD0,0XF4,0XD0,0X20,0XC0,0XF5,0XD0,0X10,0XF7,
+0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,0X40,0X90,0XF6,0X90,0X50,0XF5,
+0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,0X10,0XD0,0XF6,
+0XD0,0X20,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,
+0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,
+0X30,0XFF,0X3F,0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,
+0X20,0XF7,0X90,0X30,0XFF,0X3F,0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,
+0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X30,0XE0,0XC2,0XD0,0XF9,0X10,0XE0,0XF6,
+0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2F,
+0XB0,0X30,0X02,0X10,0X90,0XF8,0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,
+0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2E,0X90,0X06,0X60,0XF7,0X10,0XE0,0XF6,
+0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2D,
+0XD0,0X08,0X90,0XF6,0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,
+0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2D,0X50,0X08,0X30,0XE0,0XF5,0X10,0XE0,0XF6,0XE0,
+0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2D,0X30,
+0X09,0XE0,0XF5,0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,
+0X20,0XF7,0X90,0X30,0XFF,0X1F,0XE0,0XC0,0XB1,0XD0,0XF8,0X30,0X09,0XE0,0XF5,0X10,
+0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,
+0XFF,0X1E,0XC0,0X50,0X02,0X10,0X80,0XE0,0XF6,0X30,0X09,0XD0,0XF5,0X10,0XE0,0XF6,
+0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1D,
+0XB0,0X10,0X05,0X40,0XE0,0XF5,0X30,0X09,0XE0,0XF5,0X10,0XE0,0XF6,0XE0,0X10,0XF5,
+0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0XE0,0X20,0X07,
+0X80,0XF5,0X30,0X09,0XE0,0XF5,0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,
+0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X70,0X08,0X10,0XD0,0XF4,0X30,0X09,
+0XE0,0XF5,0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,
+0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0XE0,0XF6,
+0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,
+0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,
+0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,
+0X09,0XD0,0XF5,0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,
+0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XD0,0XF5,0X10,0XE0,
+0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,
+0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,
+0X10,0XF7,0XC0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,
+0X30,0X09,0XE0,0XF5,0X10,0XE0,0XF6,0XE0,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,
+0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XD0,0XF5,0X10,
+0XF8,0X10,0XF5,0XD0,0X10,0XF7,0XD0,0X10,0XF5,0XA0,0X20,0XF7,0XA0,0X20,0XFF,0X1C,
+0X30,0X09,0XB0,0XF4,0X10,0X09,0XD0,0XF5,0X00,0X70,0X86,0X70,0X00,0XF5,0XD0,0X00,
+0X87,0X50,0X00,0XF5,0XA0,0X00,0X87,0X40,0X20,0XFF,0X1C,0X90,0X69,0XD0,0XF4,0X80,
+0X69,0XE0,0XF5,0X60,0X40,0X37,0X60,0XF5,0XE0,0X50,0X37,0X40,0X80,0XF5,0XD0,0X50,
+0X37,0X40,0X90,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0X63,};
+const image_rle_t gImage_dang2 = { s_gImage_dang2_rle, sizeof(s_gImage_dang2_rle), 126, 120 };
+
+/* 126x120，原始7560字节 */
+static const unsigned char s_gImage_dang3_rle[1173] ASSET_SECTION = {
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7C,0XE0,0X0E,0XFF,0X5F,0X30,0X00,
+0X28,0X30,0X20,0X00,0X30,0XFF,0X5F,0XD0,0X20,0XFA,0X20,0XFF,0X60,0XE0,0X20,0XFA,
+0X20,0XFF,0X61,0X00,0XF9,0XE0,0X10,0XFF,0X61,0X30,0X79,0X60,0X40,0XFF,0X61,0XA0,
+0X10,0X50,0X66,0X40,0X10,0XB0,0XFF,0X62,0X40,0X10,0X50,0X64,0X40,0X00,0X50,0XFF,
+0X64,0X30,0X10,0X50,0X62,0X40,0X00,0X40,0XFF,0X66,0X40,0X10,0X50,0X60,0X40,0X00,
+0X50,0XFF,0X68,0X40,0X30,0X60,0X10,0X50,0XFF,0X69,0XE0,0X10,0X50,0X20,0XE0,0XFF,
+0X69,0XE0,0X30,0X70,0X20,0XFF,0X6A,0X50,0X70,0X90,0X61,0XFF,0X68,0X50,0X40,0XC0,
+0XA0,0XD0,0X40,0X70,0XFF,0X56,0XD0,0XF1,0XE0,0XD0,0XFA,0X51,0XF1,0XA0,0XE0,0XF0,
+0X40,0X50,0XFF,0X4D,0X80,0X60,0XF0,0X30,0XD0,0XF1,0X80,0X40,0XC0,0XF0,0X80,0X40,
+0XF9,0X61,0XF1,0XC0,0XB0,0XF2,0X40,0X70,0XFF,0X4B,0XE0,0X10,0XB0,0XF0,0X80,0X40,
+0XF0,0XD0,0X10,0X40,0X50,0X80,0X40,0X20,0X80,0XE0,0XF6,0XB0,0X30,0XF2,0XE0,0XA0,
+0XE0,0XF2,0X20,0XC0,0XFF,0X49,0XE0,0X30,0X70,0XF2,0X30,0X60,0XC0,0X20,0X40,0X50,
+0X00,0X40,0X21,0XB0,0XF6,0X40,0XB0,0XF2,0X90,0XA0,0X90,0XF2,0XA0,0X50,0XFF,0X49,
+0XA0,0X20,0X04,0X60,0XE0,0X90,0X00,0X80,0X00,0X80,0X41,0XB0,0XF6,0X10,0XF2,0XA0,
+0X52,0XC0,0XF2,0X10,0XFF,0X4C,0X00,0XE0,0XF0,0X00,0XF0,0XC0,0X06,0XB0,0XF5,0XE0,
+0X20,0XF1,0X70,0X50,0X62,0X50,0X80,0XF1,0X20,0XFF,0X4B,0X80,0X40,0XF0,0XB0,0X00,
+0XF2,0X00,0XE0,0X61,0X30,0X70,0XD0,0XF5,0XD0,0X20,0XB0,0X67,0X50,0XE0,0X20,0XE0,
+0XFF,0X49,0X80,0X20,0XC1,0X80,0X30,0XF1,0XE0,0X00,0X10,0XE0,0X80,0X40,0XF7,0X40,
+0X00,0X50,0X65,0X50,0X60,0X51,0X00,0X50,0XFF,0X48,0XC0,0X40,0XC0,0XF0,0X50,0X40,
+0X90,0XF1,0XC0,0X80,0XE0,0XF0,0X80,0X50,0XF6,0XE0,0X0E,0XFF,0X5F,0XE0,0XD1,0XE1,
+0XD8,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X1A,0XE2,0XFF,0X68,0XE0,
+0X80,0X20,0X11,0X20,0X70,0XFF,0X66,0XD0,0X30,0X20,0XA0,0XE0,0XF0,0XC0,0X40,0X30,
+0XD0,0XFF,0X64,0X60,0X30,0XE0,0XF4,0X70,0X30,0XFF,0X63,0XC0,0X10,0XB0,0XF5,0XD0,
+0X50,0X90,0XFF,0X62,0XB0,0X20,0XF7,0X80,0X40,0XFF,0X62,0XA0,0X20,0XF7,0X90,0X30,
+0XFF,0X62,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X54,0XE0,0XD1,0XE1,0XF8,0XA0,0X20,0XF7,
+0X90,0X30,0XFF,0X53,0X90,0X20,0X11,0X20,0X60,0XD0,0XF7,0XA0,0X20,0XF7,0X90,0X30,
+0XFF,0X51,0XE0,0X60,0X20,0XA0,0XF1,0XD0,0X70,0X20,0XB0,0XF6,0XA0,0X20,0XF7,0X90,
+0X30,0XFF,0X51,0X90,0X20,0XE0,0XF4,0XA0,0X20,0XE0,0XF5,0XA0,0X20,0XF7,0X90,0X30,
+0XFF,0X50,0XD0,0X20,0XA0,0XF6,0X71,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X50,0XD0,
+0X10,0XF7,0XA0,0X20,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X50,0XD0,0X10,0XF7,0XB0,
+0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X50,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,
+0X20,0XF7,0X90,0X30,0XFF,0X42,0XE0,0XD2,0XE0,0XF8,0XD0,0X10,0XF7,0XB0,0X10,0XF5,
+0XA0,0X20,0XF7,0X90,0X30,0XFF,0X41,0XB0,0X40,0X02,0X40,0XB0,0XF7,0XD0,0X10,0XF7,
+0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X40,0X90,0X06,0X90,0XF6,0XD0,0X10,
+0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,0XC0,0X08,0XC0,0XF5,0XD0,
+0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,0X40,0X08,0X50,0XF5,
+0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,0X10,0X08,0X20,
+0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,0X10,0X08,
+0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,0X10,
+0X08,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,
+0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,
+0X30,0XE0,0XC2,0XD0,0XF9,0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,
+0X20,0XF7,0X90,0X30,0XFF,0X2F,0XB0,0X30,0X02,0X10,0X90,0XE0,0XF7,0X10,0X08,0X10,
+0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2E,0X90,0X06,
+0X60,0XF7,0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,
+0X30,0XFF,0X2D,0XD0,0X08,0X90,0XF6,0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,
+0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2D,0X50,0X08,0X30,0XE0,0XF5,0X10,0X08,0X10,
+0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2D,0X30,0X09,
+0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,
+0X30,0XFF,0X1F,0XE0,0XC0,0XB1,0XD0,0XF8,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,
+0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1E,0XC0,0X50,0X02,
+0X10,0X80,0XE0,0XF6,0X30,0X09,0XD0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XB0,
+0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1D,0XB0,0X10,0X05,0X40,0XE0,0XF5,0X30,
+0X09,0XD0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,
+0X90,0X30,0XFF,0X1C,0XE0,0X20,0X07,0X80,0XF5,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,
+0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X70,0X08,
+0X10,0XD0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,
+0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,
+0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,
+0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,
+0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,
+0XD0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,
+0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,
+0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,
+0X30,0X09,0XD0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XC0,0X10,0XF5,0XA0,0X20,
+0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,
+0XF5,0XD0,0X10,0XF7,0XB0,0X10,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,
+0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X10,0XF7,0XD0,0X10,0XF5,
+0XA0,0X20,0XF7,0XA0,0X20,0XFF,0X1C,0X30,0X09,0XB0,0XF4,0X10,0X09,0XD0,0XF5,0X0A,
+0XF5,0XD0,0X00,0X87,0X50,0X00,0XF5,0XA0,0X00,0X87,0X40,0X20,0XFF,0X1C,0X90,0X69,
+0XD0,0XF4,0X80,0X69,0XE0,0XF5,0X66,0X50,0X62,0XF5,0XE0,0X50,0X37,0X40,0X80,0XF5,
+0XD0,0X50,0X37,0X40,0X90,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0X62,};
+const image_rle_t gImage_dang3 = { s_gImage_dang3_rle, sizeof(s_gImage_dang3_rle), 126, 120 };
+
+/* 126x120，原始7560字节 */
+static const unsigned char s_gImage_dang4_rle[1096] ASSET_SECTION = {
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7B,0XE0,0X0E,0XFF,0X5F,0X30,0X00,
+0X2A,0X00,0X30,0XFF,0X5F,0XE0,0X20,0XFA,0X20,0XE0,0XFF,0X5F,0XE0,0X20,0XFA,0X10,
+0XFF,0X61,0X00,0XF9,0XE0,0X20,0XFF,0X61,0X40,0X79,0X60,0X40,0XFF,0X61,0XA0,0X10,
+0X50,0X66,0X40,0X10,0XB0,0XFF,0X62,0X40,0X10,0X50,0X64,0X40,0X00,0X50,0XFF,0X64,
+0X30,0X10,0X50,0X62,0X40,0X00,0X40,0XFF,0X66,0X40,0X10,0X50,0X60,0X40,0X00,0X50,
+0XFF,0X68,0X40,0X30,0X60,0X10,0X50,0XFF,0X69,0XD0,0X10,0X50,0X20,0XE0,0XFF,0X69,
+0XE0,0X30,0X70,0X20,0XFF,0X6A,0X50,0X80,0X90,0X61,0XFF,0X68,0X60,0X40,0XC0,0XA0,
+0XD0,0X40,0X70,0XFF,0X56,0XD0,0XF1,0XE0,0XD0,0XFA,0X51,0XF1,0XA0,0XE0,0XF0,0X40,
+0X50,0XFF,0X4D,0X80,0X60,0XF0,0X30,0XD0,0XF1,0X80,0X40,0XC0,0XF0,0X80,0X40,0XF9,
+0X61,0XF1,0XC0,0XB0,0XF2,0X40,0X70,0XFF,0X4B,0XE0,0X10,0XB0,0XF0,0X80,0X40,0XF0,
+0XD0,0X10,0X40,0X50,0X80,0X40,0X10,0X80,0XE0,0XF6,0XB0,0X30,0XF3,0XA0,0XE0,0XF2,
+0X20,0XC0,0XFF,0X49,0XE0,0X30,0X70,0XF2,0X30,0X60,0XC0,0X20,0X40,0X50,0X00,0X40,
+0X20,0X10,0XB0,0XF6,0X40,0XB0,0XF2,0X90,0XA0,0X90,0XF2,0XA0,0X50,0XFF,0X49,0XA0,
+0X20,0X04,0X60,0XE0,0X90,0X00,0X80,0X00,0X80,0X41,0XB0,0XF6,0X10,0XF2,0XA0,0X52,
+0XC0,0XF2,0X10,0XFF,0X4C,0X00,0XE1,0X00,0XF0,0XC0,0X06,0XB0,0XF5,0XE0,0X20,0XF1,
+0X70,0X50,0X62,0X50,0X80,0XF1,0X20,0XFF,0X4B,0X80,0X40,0XF0,0XB0,0X00,0XF2,0X00,
+0XE0,0X61,0X30,0X70,0XD0,0XF5,0XD0,0X20,0XB0,0X67,0X50,0XE0,0X20,0XE0,0XFF,0X49,
+0X80,0X20,0XC1,0X80,0X30,0XF1,0XE0,0X00,0X10,0XE0,0X80,0X40,0XF7,0X40,0X00,0X50,
+0X63,0X51,0X62,0X50,0X00,0X50,0XFF,0X48,0XC0,0X40,0XC0,0XF0,0X50,0X40,0X90,0XF1,
+0XC0,0X80,0XE0,0XF0,0X80,0X50,0XF6,0XE0,0X0E,0XFF,0X5F,0XE0,0XD1,0XE1,0XD2,0XE0,
+0XD4,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X19,0XE3,0XFF,0X68,0XE0,
+0X80,0X20,0X11,0X20,0X70,0XFF,0X66,0XD0,0X30,0X20,0XA0,0XE0,0XF0,0XC0,0X40,0X30,
+0XD0,0XFF,0X64,0X60,0X30,0XE0,0XF4,0X70,0X30,0XFF,0X63,0XC0,0X10,0XB0,0XF5,0XD0,
+0X50,0X90,0XFF,0X62,0XB0,0X20,0XF7,0X80,0X40,0XFF,0X62,0XA0,0X20,0XF7,0X90,0X30,
+0XFF,0X62,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X54,0XE4,0XF8,0XA0,0X20,0XF7,0X90,0X30,
+0XFF,0X53,0XA0,0X10,0X02,0X60,0XD0,0XF7,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X52,0X60,
+0X05,0X10,0XB0,0XF6,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X51,0X90,0X07,0X20,0XE0,0XF5,
+0XA0,0X20,0XF7,0X90,0X30,0XFF,0X50,0XE0,0X10,0X08,0X80,0XF5,0XA0,0X20,0XF7,0X90,
+0X30,0XFF,0X50,0XE0,0X09,0X40,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X50,0XD0,0X09,
+0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X50,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,
+0X90,0X30,0XFF,0X42,0XE0,0XD2,0XE0,0XF8,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,
+0X30,0XFF,0X41,0XB0,0X40,0X02,0X40,0XB0,0XF7,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,
+0X90,0X30,0XFF,0X40,0X90,0X06,0X90,0XF6,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,
+0X30,0XFF,0X3F,0XC0,0X08,0XC0,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,
+0XFF,0X3F,0X40,0X08,0X50,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,
+0X3F,0X10,0X08,0X20,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,
+0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,0X10,
+0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X3F,0X10,0X08,
+0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X30,0XE0,0XC2,0XD0,
+0XF9,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2F,
+0XB0,0X30,0X02,0X10,0X90,0XF8,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,
+0XF7,0X90,0X30,0XFF,0X2E,0X90,0X06,0X60,0XF7,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,
+0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2D,0XD0,0X08,0X90,0XF6,0X10,0X08,0X10,0XF5,
+0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2D,0X50,0X08,0X30,0XE0,0XF5,
+0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X2D,0X30,
+0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,
+0XFF,0X1F,0XE0,0XC0,0XB1,0XD0,0XF8,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,
+0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1E,0XC0,0X50,0X02,0X10,0X80,0XE0,
+0XF6,0X30,0X09,0XD0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,
+0X90,0X30,0XFF,0X1D,0XB0,0X10,0X05,0X40,0XE0,0XF5,0X30,0X09,0XE0,0XF5,0X10,0X08,
+0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0XE0,0X20,0X07,
+0X80,0XF5,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,
+0XF7,0X90,0X30,0XFF,0X1C,0X70,0X08,0X10,0XD0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,
+0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,
+0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,
+0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,
+0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,
+0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,
+0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XD0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,
+0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,
+0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,
+0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,
+0XA0,0X20,0XF7,0X90,0X30,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XD0,0XF5,0X10,
+0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XA0,0X20,0XF7,0XA0,0X20,0XFF,0X1C,0X30,0X09,
+0XB0,0XF4,0X10,0X09,0XD0,0XF5,0X0A,0XF5,0XD0,0X09,0X10,0XF5,0XA0,0X00,0X87,0X40,
+0X20,0XFF,0X1C,0X90,0X69,0XD0,0XF4,0X80,0X69,0XE0,0XF5,0X62,0X50,0X66,0XF5,0XE0,
+0X69,0X80,0XF5,0XD0,0X50,0X37,0X40,0X90,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X63,};
+const image_rle_t gImage_dang4 = { s_gImage_dang4_rle, sizeof(s_gImage_dang4_rle), 126, 120 };
+
+/* 126x120，原始7560字节 */
+static const unsigned char s_gImage_dang5_rle[1004] ASSET_SECTION = {
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7C,0XE0,0X0E,0XFF,0X5F,0X30,0X00,
+0X28,0X30,0X20,0X00,0X30,0XFF,0X5F,0XD0,0X20,0XFA,0X20,0XFF,0X60,0XE0,0X20,0XFA,
+0X20,0XFF,0X61,0X00,0XF9,0XE0,0X10,0XFF,0X61,0X30,0X79,0X60,0X40,0XFF,0X61,0XA0,
+0X10,0X50,0X66,0X40,0X10,0XB0,0XFF,0X62,0X40,0X10,0X50,0X64,0X40,0X00,0X50,0XFF,
+0X64,0X30,0X10,0X50,0X62,0X40,0X00,0X40,0XFF,0X66,0X40,0X10,0X50,0X60,0X40,0X00,
+0X50,0XFF,0X68,0X40,0X30,0X60,0X10,0X50,0XFF,0X69,0XE0,0X10,0X50,0X20,0XE0,0XFF,
+0X69,0XE0,0X30,0X70,0X20,0XFF,0X6A,0X50,0X70,0X90,0X61,0XFF,0X68,0X50,0X40,0XC0,
+0XA0,0XD0,0X40,0X70,0XFF,0X56,0XD0,0XF1,0XE0,0XD0,0XFA,0X51,0XF1,0XA0,0XE0,0XF0,
+0X40,0X50,0XFF,0X4D,0X80,0X60,0XF0,0X30,0XD0,0XF1,0X80,0X40,0XC0,0XF0,0X80,0X40,
+0XF9,0X61,0XF1,0XC0,0XB0,0XF2,0X40,0X70,0XFF,0X4B,0XE0,0X10,0XB0,0XF0,0X80,0X40,
+0XF0,0XD0,0X10,0X40,0X50,0X80,0X40,0X20,0X80,0XE0,0XF6,0XB0,0X30,0XF2,0XE0,0XA0,
+0XE0,0XF2,0X20,0XC0,0XFF,0X49,0XE0,0X30,0X70,0XF2,0X30,0X60,0XC0,0X20,0X40,0X50,
+0X00,0X40,0X21,0XB0,0XF6,0X40,0XB0,0XF2,0X90,0XA0,0X90,0XF2,0XA0,0X50,0XFF,0X49,
+0XA0,0X20,0X04,0X60,0XE0,0X90,0X00,0X80,0X00,0X80,0X41,0XB0,0XF6,0X10,0XF2,0XA0,
+0X52,0XC0,0XF2,0X10,0XFF,0X4C,0X00,0XE0,0XF0,0X00,0XF0,0XC0,0X06,0XB0,0XF5,0XE0,
+0X20,0XF1,0X70,0X50,0X62,0X50,0X80,0XF1,0X20,0XFF,0X4B,0X80,0X40,0XF0,0XB0,0X00,
+0XF2,0X00,0XE0,0X61,0X30,0X70,0XD0,0XF5,0XD0,0X20,0XB0,0X67,0X50,0XE0,0X20,0XE0,
+0XFF,0X49,0X80,0X20,0XC1,0X80,0X30,0XF1,0XE0,0X00,0X10,0XE0,0X80,0X40,0XF7,0X40,
+0X00,0X50,0X65,0X50,0X60,0X51,0X00,0X50,0XFF,0X48,0XC0,0X40,0XC0,0XF0,0X50,0X40,
+0X90,0XF1,0XC0,0X80,0XE0,0XF0,0X80,0X50,0XF6,0XE0,0X0E,0XFF,0X5F,0XE0,0XD1,0XE1,
+0XD8,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X1B,0XE0,0XFF,0X69,0XE0,
+0X80,0X10,0X01,0X10,0X70,0XFF,0X66,0XD0,0X30,0X05,0X30,0XD0,0XFF,0X64,0X60,0X07,
+0X40,0XFF,0X63,0XC0,0X08,0X10,0XA0,0XFF,0X62,0XC0,0X09,0X60,0XFF,0X62,0XB0,0X09,
+0X50,0XFF,0X62,0XB0,0X09,0X50,0XFF,0X54,0XE3,0XF9,0XB0,0X09,0X50,0XFF,0X53,0XA0,
+0X10,0X02,0X50,0XD0,0XF7,0XB0,0X09,0X50,0XFF,0X52,0X60,0X05,0X10,0XB0,0XF6,0XB0,
+0X09,0X50,0XFF,0X51,0X90,0X07,0X20,0XE0,0XF5,0XB0,0X09,0X50,0XFF,0X50,0XE0,0X10,
+0X08,0X80,0XF5,0XB0,0X09,0X50,0XFF,0X50,0XE0,0X09,0X40,0XF5,0XB0,0X09,0X50,0XFF,
+0X50,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X50,0XD0,0X09,0X30,0XF5,0XB0,0X09,
+0X50,0XFF,0X42,0XE0,0XD2,0XE0,0XF8,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X41,
+0XB0,0X40,0X02,0X40,0XB0,0XF7,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X40,0X90,
+0X06,0X90,0XF6,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X3F,0XC0,0X08,0XC0,0XF5,
+0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X3F,0X40,0X08,0X50,0XF5,0XD0,0X09,0X30,
+0XF5,0XB0,0X09,0X50,0XFF,0X3F,0X10,0X08,0X20,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,
+0X50,0XFF,0X3F,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X3F,
+0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X3F,0X10,0X08,0X10,
+0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X30,0XE0,0XC2,0XD0,0XF9,0X10,0X08,
+0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X2F,0XB0,0X30,0X02,0X10,0X90,
+0XE0,0XF7,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X2E,0X90,
+0X06,0X60,0XF7,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X2D,
+0XD0,0X08,0X90,0XF6,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,
+0X2D,0X50,0X08,0X30,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,
+0X50,0XFF,0X2D,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,
+0X09,0X50,0XFF,0X1F,0XE0,0XC0,0XB1,0XD0,0XF8,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,
+0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X1E,0XC0,0X50,0X02,0X10,0X80,0XE0,
+0XF6,0X30,0X09,0XD0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,
+0XFF,0X1D,0XB0,0X10,0X05,0X40,0XE0,0XF5,0X30,0X09,0XD0,0XF5,0X10,0X08,0X10,0XF5,
+0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X1C,0XE0,0X20,0X07,0X80,0XF5,0X30,0X09,
+0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X1C,0X70,
+0X08,0X10,0XD0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,
+0XB0,0X09,0X50,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,
+0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,
+0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X1C,0X40,
+0X09,0XC0,0XF4,0X30,0X09,0XD0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,
+0X09,0X50,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,
+0XD0,0X09,0X30,0XF5,0XC0,0X09,0X50,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XD0,
+0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X1C,0X40,0X09,
+0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,0X09,0X30,0XF5,0XC0,0X09,
+0X50,0XFF,0X1C,0X40,0X09,0XC0,0XF4,0X30,0X09,0XE0,0XF5,0X10,0X08,0X10,0XF5,0XD0,
+0X09,0X30,0XF5,0XB0,0X09,0X50,0XFF,0X1C,0X30,0X09,0XB0,0XF4,0X10,0X09,0XD0,0XF5,
+0X0A,0XF5,0XD0,0X09,0X10,0XF5,0XB0,0X09,0X40,0XFF,0X1C,0X90,0X69,0XD0,0XF4,0X80,
+0X69,0XE0,0XF5,0X6A,0XF5,0XE0,0X69,0X80,0XF5,0XD0,0X69,0X90,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X62,};
+const image_rle_t gImage_dang5 = { s_gImage_dang5_rle, sizeof(s_gImage_dang5_rle), 126, 120 };
+
+/* 资源索引 */
+static const asset_entry_t s_asset_entries[11] ASSET_SECTION = {
+    { gImage_shalou_40x40, sizeof(gImage_shalou_40x40), 40, 40, ASSET_FORMAT_RGB565 },
+    { s_gImage_mode1_126x174_rle, sizeof(s_gImage_mode1_126x174_rle), 126, 174, ASSET_FORMAT_GRAY4_RLE },
+    { s_gImage_mode2_126x174_rle, sizeof(s_gImage_mode2_126x174_rle), 126, 174, ASSET_FORMAT_GRAY4_RLE },
+    { s_gImage_mode3_126x174_rle, sizeof(s_gImage_mode3_126x174_rle), 126, 174, ASSET_FORMAT_GRAY4_RLE },
+    { s_gImage_mode4_126x174_rle, sizeof(s_gImage_mode4_126x174_rle), 126, 174, ASSET_FORMAT_GRAY4_RLE },
+    { s_gImage_mode5_126x174_rle, sizeof(s_gImage_mode5_126x174_rle), 126, 174, ASSET_FORMAT_GRAY4_RLE },
+    { s_gImage_dang1_rle, sizeof(s_gImage_dang1_rle), 126, 120, ASSET_FORMAT_GRAY4_RLE },
+    { s_gImage_dang2_rle, sizeof(s_gImage_dang2_rle), 126, 120, ASSET_FORMAT_GRAY4_RLE },
+    { s_gImage_dang3_rle, sizeof(s_gImage_dang3_rle), 126, 120, ASSET_FORMAT_GRAY4_RLE },
+    { s_gImage_dang4_rle, sizeof(s_gImage_dang4_rle), 126, 120, ASSET_FORMAT_GRAY4_RLE },
+    { s_gImage_dang5_rle, sizeof(s_gImage_dang5_rle), 126, 120, ASSET_FORMAT_GRAY4_RLE },
+};
+const asset_index_t g_asset_index ASSET_INDEX_SECTION = {
+    ASSET_INDEX_MAGIC, ASSET_INDEX_VERSION, 11, 0xA31CE80EU, s_asset_entries
+};
@@ -2,19 +2,22 @@
 #define __IMAGE_LOGO_H__
 
 #include <stdint.h>
+#include "image_rle.h"
+
+/* 沙漏为RGB565原始数据，其余为16灰度RLE压缩数据（见 image_logo.c 生成说明） */
 extern const unsigned char gImage_shalou_40x40[3200]; 
 
-extern const unsigned char gImage_mode1_126x174[];
-extern const unsigned char gImage_mode2_126x174[];
-extern const unsigned char gImage_mode3_126x174[];
-extern const unsigned char gImage_mode4_126x174[];
-extern const unsigned char gImage_mode5_126x174[];
+extern const image_rle_t gImage_mode1_126x174;
+extern const image_rle_t gImage_mode2_126x174;
+extern const image_rle_t gImage_mode3_126x174;
+extern const image_rle_t gImage_mode4_126x174;
+extern const image_rle_t gImage_mode5_126x174;
 
-extern const unsigned char gImage_dang1[];
+extern const image_rle_t gImage_dang1;
 
-extern const unsigned char gImage_dang2[];
-extern const unsigned char gImage_dang3[];
-extern const unsigned char gImage_dang4[];
-extern const unsigned char gImage_dang5[];
+extern const image_rle_t gImage_dang2;
+extern const image_rle_t gImage_dang3;
+extern const image_rle_t gImage_dang4;
+extern const image_rle_t gImage_dang5;
 
 #endif
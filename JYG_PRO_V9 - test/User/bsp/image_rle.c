@@ -0,0 +1,109 @@
+#include "image_rle.h"
+
+void image_rle_reader_init(image_rle_reader_t *reader, const image_rle_t *image)
+{
+    reader->src = image->data;
+    reader->end = image->data + image->size;
+    reader->run = 0U;
+    reader->gray = 0U;
+}
+
+/* 读取下一个游程头，数据结束返回0 */
+static uint8_t image_rle_fetch(image_rle_reader_t *reader)
+{
+    uint8_t code;
+
+    if (reader->src >= reader->end)
+    {
+        return 0U;
+    }
+
+    code = *reader->src++;
+    reader->gray = code >> 4;
+    if ((code & 0x0FU) == IMAGE_RLE_RUN_EXT)
+    {
+        if (reader->src >= reader->end)
+        {
+            return 0U;
+        }
+        reader->run = (uint16_t)(IMAGE_RLE_RUN_EXT_BASE + *reader->src++);
+    }
+    else
+    {
+        reader->run = (uint16_t)((code & 0x0FU) + 1U);
+    }
+    return 1U;
+}
+
+/**
+ * 取出最多max_pixels个同灰度像素
+ * 返回实际取出的像素数，数据结束时返回0
+ */
+uint32_t image_rle_read_run(image_rle_reader_t *reader, uint32_t max_pixels, uint8_t *gray)
+{
+    uint32_t count;
+
+    if (reader->run == 0U && !image_rle_fetch(reader))
+    {
+        return 0U;
+    }
+
+    count = (reader->run < max_pixels) ? reader->run : max_pixels;
+    reader->run -= (uint16_t)count;
+    *gray = reader->gray;
+    return count;
+}
+
+void image_rle_skip(image_rle_reader_t *reader, uint32_t pixels)
+{
+    uint8_t gray;
+
+    while (pixels > 0U)
+    {
+        uint32_t count = image_rle_read_run(reader, pixels, &gray);
+        if (count == 0U)
+        {
+            break;
+        }
+        pixels -= count;
+    }
+}
+
+/**
+ * 解码为未压缩的16灰度格式（每字节2像素，高4位在前），从dst字节的高4位开始写
+ * 数据提前结束时剩余像素填0
+ */
+void image_rle_read_packed(image_rle_reader_t *reader, uint8_t *dst, uint32_t pixels)
+{
+    uint32_t index = 0U;
+    uint8_t gray = 0U;
+
+    while (index < pixels)
+    {
+        uint32_t count = image_rle_read_run(reader, pixels - index, &gray);
+        if (count == 0U)
+        {
+            gray = 0U;
+            count = pixels - index;
+        }
+
+        /* 先补齐半字节，再按整字节填充 */
+        if ((index & 1U) != 0U)
+        {
+            dst[index >> 1] = (uint8_t)((dst[index >> 1] & 0xF0U) | gray);
+            index++;
+            count--;
+        }
+        while (count >= 2U)
+        {
+            dst[index >> 1] = (uint8_t)((gray << 4) | gray);
+            index += 2U;
+            count -= 2U;
+        }
+        if (count != 0U)
+        {
+            dst[index >> 1] = (uint8_t)(gray << 4);
+            index++;
+        }
+    }
+}
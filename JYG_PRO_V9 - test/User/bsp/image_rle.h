@@ -0,0 +1,36 @@
+#ifndef __IMAGE_RLE_H
+#define __IMAGE_RLE_H
+
+#include <stdint.h>
+
+/* 16灰度图片RLE压缩格式（由 User/SCRIPT/image_rle.py 离线生成）
+ * 像素按行连续编码，每个字节高4位为灰度值，低4位n为游程：
+ *   n < 15 ：游程长度 n + 1
+ *   n == 15：后跟1字节m，游程长度 16 + m（最长271）
+ */
+#define IMAGE_RLE_RUN_EXT        0x0FU
+#define IMAGE_RLE_RUN_EXT_BASE   16U
+
+typedef struct
+{
+    const uint8_t *data;
+    uint32_t size;
+    uint16_t width;
+    uint16_t height;
+} image_rle_t;
+
+/* 顺序解码器状态 */
+typedef struct
+{
+    const uint8_t *src;
+    const uint8_t *end;
+    uint16_t run;       /* 当前游程剩余像素数 */
+    uint8_t gray;       /* 当前游程灰度值 */
+} image_rle_reader_t;
+
+void image_rle_reader_init(image_rle_reader_t *reader, const image_rle_t *image);
+uint32_t image_rle_read_run(image_rle_reader_t *reader, uint32_t max_pixels, uint8_t *gray);
+void image_rle_skip(image_rle_reader_t *reader, uint32_t pixels);
+void image_rle_read_packed(image_rle_reader_t *reader, uint8_t *dst, uint32_t pixels);
+
+#endif
@@ -1,17 +1,51 @@
 #include "key.h"
-#include "./SYSTEM/delay/delay.h"
+#include "version.h"
+#include "profiler.h"
 
 typedef struct
 {
-    uint8_t last_state;         
-    uint8_t current_state;      
-    uint32_t press_start_time;  
-    uint8_t is_pressed;         
-    uint8_t event_flag;         
+    uint8_t raw_state;          /* 最近一次采样的原始电平 */
+    uint32_t raw_change_time;   /* 原始电平最近一次变化的时刻 */
+    uint8_t is_pressed;         /* 去抖后的状态 */
+    uint32_t press_start_time;  /* 去抖后确认按下的时刻（取电平开始稳定的时刻） */
+    uint8_t event_flag;         /* 本次按下已产生长按/连发事件，松开时不再产生短按 */
+    uint8_t chord_member;       /* 本次按下属于组合键，不再产生单键事件 */
+    uint32_t repeat_time;       /* 下一次连发的时刻 */
 } key_state_t;
 
 static key_state_t key_states[4] = {0};
 
+static uint8_t s_chord_mask = 0U;           /* 当前组合键成员，0表示无组合键 */
+static uint32_t s_chord_start_time = 0U;
+static uint8_t s_chord_long_sent = 0U;
+
+static uint8_t s_event_queue[KEY_EVENT_QUEUE_SIZE];
+static uint8_t s_event_head = 0U;
+static uint8_t s_event_tail = 0U;
+
+static const uint8_t s_key_values[4] = {KEY_VAL_KEY1, KEY_VAL_KEY2, KEY_VAL_KEY3, KEY_VAL_KEY4};
+static const uint8_t s_key_repeat_mask = KEY_MASK_KEY3 | KEY_MASK_KEY4;
+
+/* 以按下位图为下标的两键组合键值，其余组合不产生事件 */
+static const uint8_t s_chord_values[16] =
+{
+    0U, 0U, 0U, KEY_VAL_KEY1_KEY2,
+    0U, KEY_VAL_KEY1_KEY3, KEY_VAL_KEY2_KEY3, 0U,
+    0U, KEY_VAL_KEY1_KEY4, KEY_VAL_KEY2_KEY4, 0U,
+    KEY_VAL_KEY3_KEY4, 0U, 0U, 0U
+};
+
+static void key_push_event(uint8_t key_event)
+{
+    uint8_t next = (uint8_t)((s_event_tail + 1U) & (KEY_EVENT_QUEUE_SIZE - 1U));
+
+    if (next != s_event_head)
+    {
+        s_event_queue[s_event_tail] = key_event;
+        s_event_tail = next;
+    }
+}
+
 void key_init(void)
 {
     GPIO_InitTypeDef gpio_init_struct;
@@ -23,7 +57,11 @@ void key_init(void)
 
     
     gpio_init_struct.Pin = KEY1_GPIO_PIN;
+#if ENABLE_LOW_POWER_MODE
+    gpio_init_struct.Mode = GPIO_MODE_EVT_FALLING;  /* 仍按输入轮询，按下沿同时产生唤醒事件（WFE） */
+#else
     gpio_init_struct.Mode = GPIO_MODE_INPUT;
+#endif
     gpio_init_struct.Pull = GPIO_PULLUP;
     gpio_init_struct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
     HAL_GPIO_Init(KEY1_GPIO_PORT, &gpio_init_struct);
@@ -39,15 +77,20 @@ void key_init(void)
     gpio_init_struct.Pin = KEY4_GPIO_PIN;
     HAL_GPIO_Init(KEY4_GPIO_PORT, &gpio_init_struct);
 
-    
-    for (int i = 0; i < 4; i++)
+    for (uint8_t i = 0; i < 4; i++)
     {
-        key_states[i].last_state = 0;
-        key_states[i].current_state = 0;
-        key_states[i].press_start_time = 0;
+        key_states[i].raw_state = 0;
+        key_states[i].raw_change_time = 0;
         key_states[i].is_pressed = 0;
+        key_states[i].press_start_time = 0;
         key_states[i].event_flag = 0;
+        key_states[i].chord_member = 0;
+        key_states[i].repeat_time = 0;
     }
+    s_chord_mask = 0U;
+    s_chord_long_sent = 0U;
+    s_event_head = 0U;
+    s_event_tail = 0U;
 }
 
 static uint8_t key_read_state(uint8_t key_index)
@@ -71,91 +114,185 @@ uint8_t key_get_pressed_key(void)
     return 0;
 }
 
-uint8_t key_scan(void)
+/* 去抖：原始电平连续稳定KEY_DEBOUNCE_TIME_MS后才改变确认状态，返回1表示确认状态发生变化 */
+static uint8_t key_debounce(key_state_t *ks, uint8_t raw, uint32_t now)
 {
-    uint8_t key_event = KEY_EVENT_NONE;
-    uint32_t current_time = HAL_GetTick();
-    
-    
-    for (uint8_t i = 0; i < 4; i++)
+    if (raw != ks->raw_state)
+    {
+        ks->raw_state = raw;
+        ks->raw_change_time = now;
+        return 0U;
+    }
+
+    if (raw == ks->is_pressed || (now - ks->raw_change_time) < KEY_DEBOUNCE_TIME_MS)
+    {
+        return 0U;
+    }
+
+    ks->is_pressed = raw;
+    if (raw)
+    {
+        ks->press_start_time = ks->raw_change_time;
+        ks->event_flag = 0;
+    }
+    return 1U;
+}
+
+static void key_process_single(uint8_t i, uint8_t changed, uint32_t now)
+{
+    key_state_t *ks = &key_states[i];
+    uint32_t press_duration;
+
+    if (ks->chord_member)
     {
-        key_state_t *ks = &key_states[i];
-        
-        
-        ks->current_state = key_read_state(i);
-        
-        
-        if (ks->current_state && !ks->last_state && !ks->is_pressed)
+        return;
+    }
+
+    if (!ks->is_pressed)
+    {
+        /* 松开：未产生过长按/连发时为短按 */
+        if (changed && !ks->event_flag)
         {
-            
-            delay_ms(KEY_DEBOUNCE_TIME_MS);
-            if (key_read_state(i))
+            key_push_event(s_key_values[i] | KEY_EVENT_SHORT_PRESS);
+        }
+        return;
+    }
+
+    press_duration = now - ks->press_start_time;
+
+    if (s_key_repeat_mask & (1U << i))
+    {
+        if (!ks->event_flag)
+        {
+            if (press_duration >= KEY_REPEAT_DELAY_MS)
             {
-                ks->is_pressed = 1;
-                ks->press_start_time = HAL_GetTick();
+                key_push_event(s_key_values[i] | KEY_EVENT_REPEAT);
+                ks->event_flag = 1;
+                ks->repeat_time = ks->press_start_time + KEY_REPEAT_DELAY_MS + KEY_REPEAT_INTERVAL_MS;
             }
         }
-        
-        
-        else if (!ks->current_state && ks->last_state && ks->is_pressed)
+        else if ((int32_t)(now - ks->repeat_time) >= 0)
         {
-            
-            delay_ms(KEY_DEBOUNCE_TIME_MS);
-            if (!key_read_state(i))
+            key_push_event(s_key_values[i] | KEY_EVENT_REPEAT);
+            ks->repeat_time += KEY_REPEAT_INTERVAL_MS;
+            if ((int32_t)(now - ks->repeat_time) >= 0)
             {
-                
-                uint32_t press_duration = current_time - ks->press_start_time;
-                
-                
-                if (press_duration < KEY_LONG_PRESS_TIME_MS)
-                {
-                    
-                    if (press_duration >= KEY_DEBOUNCE_TIME_MS)  
-                    {
-                        switch (i)
-                        {
-                            case 0: key_event = KEY1_SHORT_PRESS; break;
-                            case 1: key_event = KEY2_SHORT_PRESS; break;
-                            case 2: key_event = KEY3_SHORT_PRESS; break;
-                            case 3: key_event = KEY4_SHORT_PRESS; break;
-                        }
-                        ks->event_flag = 1;
-                    }
-                }
-                
-                ks->is_pressed = 0;
-                ks->press_start_time = 0;
+                ks->repeat_time = now + KEY_REPEAT_INTERVAL_MS;     /* 扫描被拖延时不补发 */
             }
         }
-        
-        
-        else if (ks->is_pressed && ks->current_state)
+    }
+    else if (press_duration >= KEY_LONG_PRESS_TIME_MS && !ks->event_flag)
+    {
+        key_push_event(s_key_values[i] | KEY_EVENT_LONG_PRESS);
+        ks->event_flag = 1;
+    }
+}
+
+static void key_process_chord(uint8_t pressed_mask, uint32_t now)
+{
+    if (s_chord_mask == 0U)
+    {
+        /* 两个及以上按键同时处于按下状态：形成组合键，成员不再产生单键事件 */
+        if ((pressed_mask & (uint8_t)(pressed_mask - 1U)) == 0U)
+        {
+            return;
+        }
+        s_chord_mask = pressed_mask;
+        s_chord_start_time = now;
+        s_chord_long_sent = 0U;
+        for (uint8_t i = 0; i < 4; i++)
         {
-            uint32_t press_duration = current_time - ks->press_start_time;
-            
-            
-            if (press_duration >= KEY_LONG_PRESS_TIME_MS && !ks->event_flag)
+            if (pressed_mask & (1U << i))
             {
-                switch (i)
-                {
-                    case 0: key_event = KEY1_LONG_PRESS; break;
-                    case 1: key_event = KEY2_LONG_PRESS; break;
-                    case 2: key_event = KEY3_LONG_PRESS; break;
-                    case 3: key_event = KEY4_LONG_PRESS; break;
-                }
-                ks->event_flag = 1;  
+                key_states[i].chord_member = 1;
             }
         }
-        
-        
-        ks->last_state = ks->current_state;
-        
-        
-        if (!ks->is_pressed && !ks->current_state)
+        return;
+    }
+
+    if ((pressed_mask & s_chord_mask) == s_chord_mask)
+    {
+        if (!s_chord_long_sent && (now - s_chord_start_time) >= KEY_CHORD_LONG_TIME_MS)
         {
-            ks->event_flag = 0;
+            if (s_chord_values[s_chord_mask & 0x0FU] != 0U)
+            {
+                key_push_event(s_chord_values[s_chord_mask & 0x0FU] | KEY_EVENT_LONG_PRESS);
+            }
+            s_chord_long_sent = 1U;
         }
     }
-    
+    else if ((pressed_mask & s_chord_mask) == 0U)
+    {
+        /* 成员全部松开后才结束组合键，先松开的成员不会被当成单键 */
+        if (!s_chord_long_sent && s_chord_values[s_chord_mask & 0x0FU] != 0U)
+        {
+            key_push_event(s_chord_values[s_chord_mask & 0x0FU] | KEY_EVENT_SHORT_PRESS);
+        }
+        s_chord_mask = 0U;
+    }
+}
+
+void key_process(uint8_t raw_mask, uint32_t now)
+{
+    uint8_t changed[4];
+    uint8_t pressed_mask = 0U;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        changed[i] = key_debounce(&key_states[i], (raw_mask >> i) & 0x01U, now);
+        if (key_states[i].is_pressed)
+        {
+            pressed_mask |= (uint8_t)(1U << i);
+        }
+    }
+
+    key_process_chord(pressed_mask, now);
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        key_process_single(i, changed[i], now);
+        if (!key_states[i].is_pressed && !(s_chord_mask & (1U << i)))
+        {
+            key_states[i].chord_member = 0;
+        }
+    }
+}
+
+/* 所有按键均已松开且电平稳定、组合键已结束，可以进入低功耗 */
+uint8_t key_is_idle(void)
+{
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        if (key_states[i].is_pressed || key_states[i].raw_state)
+        {
+            return 0U;
+        }
+    }
+    return (s_chord_mask == 0U) ? 1U : 0U;
+}
+
+/* 非阻塞扫描：采样一次并推进状态机，每次调用返回一个排队的事件 */
+uint8_t key_scan(void)
+{
+    uint8_t key_event = KEY_EVENT_NONE;
+    uint8_t raw_mask = 0U;
+    PROF_ZONE_BEGIN(PROF_ZONE_KEY_SCAN);
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        if (key_read_state(i))
+        {
+            raw_mask |= (uint8_t)(1U << i);
+        }
+    }
+    key_process(raw_mask, HAL_GetTick());
+
+    if (s_event_head != s_event_tail)
+    {
+        key_event = s_event_queue[s_event_head];
+        s_event_head = (uint8_t)((s_event_head + 1U) & (KEY_EVENT_QUEUE_SIZE - 1U));
+    }
+
+    PROF_ZONE_END(PROF_ZONE_KEY_SCAN);
     return key_event;
 }
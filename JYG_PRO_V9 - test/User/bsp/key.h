@@ -33,6 +33,7 @@
 #define KEY_EVENT_NONE          0x00    
 #define KEY_EVENT_SHORT_PRESS   0x01    
 #define KEY_EVENT_LONG_PRESS    0x02    
+#define KEY_EVENT_REPEAT        0x03    /* 按住连发（仅KEY3/KEY4） */
 
 #define KEY_VAL_NONE    0x00
 #define KEY_VAL_KEY1    0x10
@@ -40,6 +41,14 @@
 #define KEY_VAL_KEY3    0x30
 #define KEY_VAL_KEY4    0x40
 
+/* 组合键：两键同时按下，松开时产生SHORT_PRESS，按住超过KEY_CHORD_LONG_TIME_MS产生LONG_PRESS */
+#define KEY_VAL_KEY1_KEY2   0x50
+#define KEY_VAL_KEY1_KEY3   0x60
+#define KEY_VAL_KEY1_KEY4   0x70
+#define KEY_VAL_KEY2_KEY3   0x80
+#define KEY_VAL_KEY2_KEY4   0x90
+#define KEY_VAL_KEY3_KEY4   0xA0
+
 #define KEY1_SHORT_PRESS    (KEY_VAL_KEY1 | KEY_EVENT_SHORT_PRESS)  
 #define KEY1_LONG_PRESS     (KEY_VAL_KEY1 | KEY_EVENT_LONG_PRESS)   
 #define KEY2_SHORT_PRESS    (KEY_VAL_KEY2 | KEY_EVENT_SHORT_PRESS)  
@@ -48,20 +57,36 @@
 #define KEY3_LONG_PRESS     (KEY_VAL_KEY3 | KEY_EVENT_LONG_PRESS)   
 #define KEY4_SHORT_PRESS    (KEY_VAL_KEY4 | KEY_EVENT_SHORT_PRESS)  
 #define KEY4_LONG_PRESS     (KEY_VAL_KEY4 | KEY_EVENT_LONG_PRESS)   
+#define KEY3_REPEAT         (KEY_VAL_KEY3 | KEY_EVENT_REPEAT)
+#define KEY4_REPEAT         (KEY_VAL_KEY4 | KEY_EVENT_REPEAT)
 
 #define KEY1_PRES    KEY1_SHORT_PRESS
 #define KEY2_PRES    KEY2_SHORT_PRESS
 #define KEY3_PRES    KEY3_SHORT_PRESS
 #define KEY4_PRES    KEY4_SHORT_PRESS
 
-#define KEY_DEBOUNCE_TIME_MS       50      
+#define KEY_DEBOUNCE_TIME_MS       50      /* 电平需稳定该时长才被确认，不再阻塞延时 */
 #define KEY_SHORT_PRESS_TIME_MS    500     
 #define KEY_LONG_PRESS_TIME_MS     2000    
 #define KEY_SCAN_INTERVAL_MS       10      
+#define KEY_REPEAT_DELAY_MS        500     /* KEY3/KEY4按住多久后开始连发 */
+#define KEY_REPEAT_INTERVAL_MS     150     
+#define KEY_CHORD_LONG_TIME_MS     2000    
+#define KEY_EVENT_QUEUE_SIZE       8U      /* 需为2的幂 */
+
+#define KEY_MASK_KEY1   0x01U
+#define KEY_MASK_KEY2   0x02U
+#define KEY_MASK_KEY3   0x04U
+#define KEY_MASK_KEY4   0x08U
 
 void key_init(void);                        
 uint8_t key_scan(void);                     
 uint8_t key_get_pressed_key(void);          
+/* 去抖状态机本体，与硬件无关：输入原始按下位图（KEY_MASK_*）和毫秒时间戳，
+ * 事件进入内部队列，由key_scan()取出；主机仿真直接调用即可得到相同的事件序列
+ */
+void key_process(uint8_t raw_mask, uint32_t now);
+uint8_t key_is_idle(void);
 
 #define KEY_GET_KEY_VAL(key_event)  ((key_event) & 0xF0)
 
@@ -1,11 +1,71 @@
 #include "lcd.h"
+#include <string.h>
 #include "stm32h7xx_hal_spi.h"
 #include "stm32h7xx_hal.h"
+#include "dma_buf.h"
+#include "profiler.h"
 
 SPI_HandleTypeDef hspi1;
 
+/* DMA像素缓冲区：LCD_Init中从不可缓存的DMA缓冲池分配，DMA1/DMA2D可直接访问；两块交替使用 */
+static uint8_t (*s_lcd_dma_buffer)[LCD_DMA_BUFFER_SIZE];
+
+/* 纯色填充的颜色源（DMA源地址不递增，单独占一个Cache行） */
+static uint16_t *s_lcd_fill_color;
+
+#if (LCD_GRAY_STRIP_BYTES > LCD_DMA_BUFFER_SIZE) || ((LCD_GRAY_STRIP_BYTES % 4U) != 0U)
+#error "LCD_GRAY_STRIP_BYTES must be a multiple of 4 and not exceed LCD_DMA_BUFFER_SIZE"
+#endif
+
+static lcd_done_callback_t s_lcd_done_callback = 0;
+static lcd_strip_stats_t s_lcd_strip_stats;
+static uint32_t s_lcd_tx_bytes = 0U;      /* SPI累计发送字节数（命令+参数+像素） */
+
+#if LCD_USE_DMA
+static DMA_HandleTypeDef s_lcd_dma_tx;
+static uint8_t s_lcd_dma_ready = 0U;
+static volatile uint8_t s_lcd_dma_busy = 0U;
+static const uint8_t *s_lcd_dma_src = 0;
+static volatile uint32_t s_lcd_dma_remaining = 0U;   /* 剩余传输单位数：普通模式为字节，填充模式为像素 */
+static uint8_t s_lcd_dma_fill = 0U;                  /* 1：16位帧纯色填充模式 */
+#endif
+
+#if LCD_USE_DMA && LCD_USE_DMA2D
+#define LCD_GRAY2D_FREE         0U
+#define LCD_GRAY2D_CONVERTING   1U
+#define LCD_GRAY2D_READY        2U
+#define LCD_GRAY2D_SENDING      3U
+
+/* DMA2D转换+SPI发送流水线，仅在DMA2D与SPI中断（同一抢占优先级）中推进 */
+typedef struct
+{
+    const uint8_t *src;             /* 下一段转换的源数据 */
+    uint16_t line_bytes;            /* 每行源字节数 */
+    uint16_t stride;                /* 源数据行跨度 */
+    uint32_t lines_left;            /* 尚未转换的行数 */
+    uint32_t lines_per_strip;
+    uint32_t bytes[2];              /* 各缓冲区转换出的RGB565字节数 */
+    uint8_t state[2];
+    uint8_t convert_index;
+    uint8_t send_index;
+} lcd_gray2d_job_t;
+
+static lcd_gray2d_job_t s_lcd_gray2d;
+static uint8_t s_lcd_dma2d_ready = 0U;
+static volatile uint8_t s_lcd_gray2d_active = 0U;
+
+static void LCD_DMA2D_Init(void);
+static void LCD_Gray2D_Kick(void);
+static void LCD_Gray2D_Abort(void);
+#endif
+
+/* 写一个字节到TXDR；主机测试(test/)中替换为捕获函数，记录发往屏幕的字节流 */
+#ifndef LCD_SPI_WRITE_BYTE
+#define LCD_SPI_WRITE_BYTE(spi, byte)   (*((__IO uint8_t *)&(spi)->TXDR) = (byte))
+#endif
+
 /* 直接寄存器发送，绕过HAL等待路径；返回0表示超时失败 */
-static uint8_t SPI1_TX_Blocking(const uint8_t *pdata, uint16_t size, uint32_t timeout_ms)
+ITCM_CODE static uint8_t SPI1_TX_Blocking(const uint8_t *pdata, uint16_t size, uint32_t timeout_ms)
 {
   uint32_t start = HAL_GetTick();
   SPI_TypeDef *SPIx = hspi1.Instance;
@@ -15,8 +75,9 @@ static uint8_t SPI1_TX_Blocking(const uint8_t *pdata, uint16_t size, uint32_t ti
   /* 等待SPI就绪（确保上一次传输完成） */
   /* 检查是否有正在进行的传输，等待EOT标志或TXP标志 */
   /* 如果TXP为0且EOT为0，说明可能有传输正在进行，需要等待 */
+  /* SPI已禁用（如DMA传输结束后）时不可能有传输在进行，无需等待 */
   uint32_t wait_start = HAL_GetTick();
-  while ((SPIx->SR & (SPI_SR_EOT | SPI_SR_TXP)) == 0U) {
+  while (((SPIx->CR1 & SPI_CR1_SPE) != 0U) && ((SPIx->SR & (SPI_SR_EOT | SPI_SR_TXP)) == 0U)) {
     /* 如果EOT和TXP都为0，可能正在传输中，等待 */
     if ((HAL_GetTick() - wait_start) > 10U) {
       /* 超时10ms，假设SPI空闲或可以继续，清除可能的状态 */
@@ -71,7 +132,7 @@ static uint8_t SPI1_TX_Blocking(const uint8_t *pdata, uint16_t size, uint32_t ti
       }
     }
     /* 写入一个字节到TXDR */
-    *((__IO uint8_t *)&SPIx->TXDR) = pdata[idx++];
+    LCD_SPI_WRITE_BYTE(SPIx, pdata[idx++]);
     /* 若有接收标志则读出抛弃，避免状态机堵塞 */
 #ifdef SPI_SR_RXP
     if ((SPIx->SR & SPI_SR_RXP) != 0U) {
@@ -124,6 +185,8 @@ static uint8_t SPI1_TX_WithFallback(const uint8_t *pdata, uint16_t size)
 {
   uint32_t timeout_ms;
   
+  s_lcd_tx_bytes += size;
+
   // 根据数据量动态调整超时时间（大块数据需要更长时间）
   if (size > 50000) {
     timeout_ms = 1000;  // 大块数据使用1秒超时
@@ -146,6 +209,345 @@ static uint8_t SPI1_TX_WithFallback(const uint8_t *pdata, uint16_t size)
   return SPI1_TX_Blocking(pdata, size, timeout_ms);
 }
 
+#if LCD_USE_DMA
+/* DMA1只能访问FLASH/AXI SRAM/SRAM1~4，ITCM和DTCM仅CPU可访问 */
+static uint8_t LCD_DMA_IsAddressable(const uint8_t *pdata)
+{
+  uint32_t addr = (uint32_t)pdata;
+
+  if (addr < 0x00010000U) return 0;                           /* ITCM */
+  if (addr >= 0x20000000U && addr < 0x20020000U) return 0;    /* DTCM */
+  return 1;
+}
+
+/* 结束DMA传输：关闭SPI/DMA请求，释放片选并通知上层 */
+static void LCD_DMA_Finish(void)
+{
+  SPI_TypeDef *SPIx = hspi1.Instance;
+
+  CLEAR_BIT(SPIx->IER, SPI_IER_EOTIE);
+  SPIx->IFCR = SPI_IFCR_EOTC | SPI_IFCR_TXTFC;
+  CLEAR_BIT(SPIx->CR1, SPI_CR1_SPE);
+  CLEAR_BIT(SPIx->CFG1, SPI_CFG1_TXDMAEN);
+
+  if (s_lcd_dma_fill) {
+    /* 恢复8位帧和字节递增DMA配置（此时SPI与DMA流均已停止） */
+    MODIFY_REG(SPIx->CFG1, SPI_CFG1_DSIZE, SPI_DATASIZE_8BIT);
+    MODIFY_REG(((DMA_Stream_TypeDef *)s_lcd_dma_tx.Instance)->CR,
+               DMA_SxCR_MINC | DMA_SxCR_PSIZE | DMA_SxCR_MSIZE, DMA_SxCR_MINC);
+    s_lcd_dma_fill = 0U;
+  }
+
+  HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+  s_lcd_dma_remaining = 0U;
+  s_lcd_dma_busy = 0U;
+
+#if LCD_USE_DMA2D
+  /* 灰度流水线：释放刚发送完的缓冲区，启动下一段发送/转换 */
+  if (s_lcd_gray2d_active) {
+    s_lcd_gray2d.state[s_lcd_gray2d.send_index] = LCD_GRAY2D_FREE;
+    s_lcd_gray2d.send_index ^= 1U;
+    LCD_Gray2D_Kick();
+  }
+#endif
+
+  if (s_lcd_done_callback != 0) {
+    s_lcd_done_callback();
+  }
+}
+
+/* 启动一段DMA发送（最长LCD_DMA_MAX_CHUNK个单位），剩余部分由EOT中断续传；返回0表示启动失败 */
+static uint8_t LCD_DMA_StartChunk(void)
+{
+  SPI_TypeDef *SPIx = hspi1.Instance;
+  uint32_t chunk = (s_lcd_dma_remaining > LCD_DMA_MAX_CHUNK) ? LCD_DMA_MAX_CHUNK : s_lcd_dma_remaining;
+
+  /* TSIZE、方向和TXDMAEN只能在SPI禁用时修改 */
+  CLEAR_BIT(SPIx->CR1, SPI_CR1_SPE);
+  SPIx->IFCR = 0xFFFFFFFFU;
+  SPI_1LINE_TX(&hspi1);
+  MODIFY_REG(SPIx->CR2, SPI_CR2_TSIZE, chunk);
+  SET_BIT(SPIx->CFG1, SPI_CFG1_TXDMAEN);
+
+  if (HAL_DMA_Start_IT(&s_lcd_dma_tx, (uint32_t)s_lcd_dma_src, (uint32_t)&SPIx->TXDR, chunk) != HAL_OK) {
+    LCD_DMA_Finish();
+    return 0;
+  }
+  if (!s_lcd_dma_fill) {
+    s_lcd_dma_src += chunk;
+  }
+  s_lcd_dma_remaining -= chunk;
+
+  /* 顺序：DMA流 -> TXDMAEN -> SPE -> CSTART（参考手册要求） */
+  SET_BIT(SPIx->IER, SPI_IER_EOTIE);
+  SET_BIT(SPIx->CR1, SPI_CR1_SPE);
+  SET_BIT(SPIx->CR1, SPI_CR1_CSTART);
+  return 1;
+}
+
+static void LCD_DMA_ErrorCallback(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  LCD_DMA_Finish();
+}
+
+/**
+  * @brief  初始化SPI1发送DMA
+  * @note   DMA中断优先级高于SPI中断，保证EOT中断处理时DMA句柄已回到READY状态
+  * @retval None
+  */
+static void LCD_DMA_Init(void)
+{
+  LCD_DMA_CLK_ENABLE();
+
+  s_lcd_dma_tx.Instance = LCD_DMA_STREAM;
+  s_lcd_dma_tx.Init.Request = LCD_DMA_REQUEST;
+  s_lcd_dma_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  s_lcd_dma_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+  s_lcd_dma_tx.Init.MemInc = DMA_MINC_ENABLE;
+  s_lcd_dma_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  s_lcd_dma_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  s_lcd_dma_tx.Init.Mode = DMA_NORMAL;
+  s_lcd_dma_tx.Init.Priority = DMA_PRIORITY_HIGH;
+  s_lcd_dma_tx.Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+  s_lcd_dma_tx.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  s_lcd_dma_tx.Init.MemBurst = DMA_MBURST_SINGLE;
+  s_lcd_dma_tx.Init.PeriphBurst = DMA_PBURST_SINGLE;
+
+  s_lcd_dma_ready = 0U;
+  (void)HAL_DMA_DeInit(&s_lcd_dma_tx);
+  if (HAL_DMA_Init(&s_lcd_dma_tx) != HAL_OK) {
+    return;
+  }
+  s_lcd_dma_tx.XferErrorCallback = LCD_DMA_ErrorCallback;
+  __HAL_LINKDMA(&hspi1, hdmatx, s_lcd_dma_tx);
+
+  HAL_NVIC_SetPriority(LCD_DMA_IRQn, 1, 0);
+  HAL_NVIC_EnableIRQ(LCD_DMA_IRQn);
+  HAL_NVIC_SetPriority(LCD_SPI_IRQn, 2, 0);
+  HAL_NVIC_EnableIRQ(LCD_SPI_IRQn);
+
+  s_lcd_dma_ready = 1U;
+}
+
+/**
+  * @brief  DMA1_Stream0中断服务函数（SPI1发送DMA）
+  * @retval None
+  */
+void LCD_DMA_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&s_lcd_dma_tx);
+}
+
+/**
+  * @brief  SPI1中断服务函数：EOT表示当前分段已全部移出，续传下一段或结束传输
+  * @retval None
+  */
+void LCD_SPI_IRQHandler(void)
+{
+  SPI_TypeDef *SPIx = hspi1.Instance;
+
+  if (((SPIx->IER & SPI_IER_EOTIE) != 0U) && ((SPIx->SR & SPI_SR_EOT) != 0U))
+  {
+    if (s_lcd_dma_remaining > 0U) {
+      (void)LCD_DMA_StartChunk();
+    } else {
+      LCD_DMA_Finish();
+    }
+  }
+}
+#endif
+
+/**
+  * @brief  查询是否有异步像素传输正在进行
+  * @retval 1：忙  0：空闲
+  */
+uint8_t LCD_IsBusy(void)
+{
+#if LCD_USE_DMA && LCD_USE_DMA2D
+  return (s_lcd_dma_busy || s_lcd_gray2d_active) ? 1U : 0U;
+#elif LCD_USE_DMA
+  return s_lcd_dma_busy;
+#else
+  return 0;
+#endif
+}
+
+/**
+  * @brief  等待异步像素传输结束（所有操作CS/DC的函数在开始前都要调用）
+  * @note   超时后强制终止DMA并释放片选，避免总线永久挂死
+  * @retval None
+  */
+void LCD_WaitIdle(void)
+{
+#if LCD_USE_DMA
+  uint32_t start = HAL_GetTick();
+
+  while (LCD_IsBusy())
+  {
+    if ((HAL_GetTick() - start) > LCD_DMA_TIMEOUT_MS)
+    {
+      HAL_NVIC_DisableIRQ(LCD_SPI_IRQn);
+#if LCD_USE_DMA2D
+      LCD_Gray2D_Abort();
+#endif
+      if (s_lcd_dma_busy) {
+        (void)HAL_DMA_Abort(&s_lcd_dma_tx);
+        LCD_DMA_Finish();
+      }
+      HAL_NVIC_EnableIRQ(LCD_SPI_IRQn);
+      break;
+    }
+  }
+#endif
+}
+
+/**
+  * @brief  设置传输完成回调
+  * @param  callback: 回调函数，DMA传输时在中断上下文中调用，传NULL取消
+  * @retval None
+  */
+void LCD_SetDoneCallback(lcd_done_callback_t callback)
+{
+  s_lcd_done_callback = callback;
+}
+
+/**
+  * @brief  读取16灰度转换流水线统计数据
+  * @param  stats: 输出统计数据
+  * @retval None
+  */
+void LCD_GetStripStats(lcd_strip_stats_t *stats)
+{
+  if (stats != 0) {
+    *stats = s_lcd_strip_stats;
+  }
+}
+
+/**
+  * @brief  清零16灰度转换流水线统计数据
+  * @retval None
+  */
+void LCD_ResetStripStats(void)
+{
+  memset(&s_lcd_strip_stats, 0, sizeof(s_lcd_strip_stats));
+}
+
+/**
+  * @brief  读取SPI累计发送字节数（用于统计刷新开销）
+  * @retval 字节数
+  */
+uint32_t LCD_GetTxByteCount(void)
+{
+  return s_lcd_tx_bytes;
+}
+
+/**
+  * @brief  清零SPI累计发送字节数
+  * @retval None
+  */
+void LCD_ResetTxByteCount(void)
+{
+  s_lcd_tx_bytes = 0U;
+}
+
+#if LCD_USE_DMA
+/* 启动DMA发送（片选和DC需已设置好），可在中断中调用 */
+static uint8_t LCD_DMA_StartBytes(const uint8_t *pdata, uint32_t size)
+{
+  /* 确保CPU写入的数据已到达内存（D-Cache为写回模式，DMA缓冲池内的数据无需处理） */
+  dma_buf_clean(pdata, size);
+
+  s_lcd_tx_bytes += size;
+  s_lcd_dma_src = pdata;
+  s_lcd_dma_remaining = size;
+  s_lcd_dma_busy = 1U;
+  return LCD_DMA_StartChunk();
+}
+#endif
+
+/**
+  * @brief  异步发送一段像素数据（DC=数据），调用前需已通过LCD_SetWindow设置窗口
+  * @param  pdata: 数据指针，传输结束前必须保持有效且不被修改
+  * @param  size: 字节数，可超过SPI单次TSIZE上限，由中断自动分段续传
+  * @retval 1：已启动（或轮询发送完成）  0：失败
+  * @note   数据位于FLASH/AXI SRAM且足够长时走DMA并立即返回，完成后在中断中拉高CS；
+  *         位于DTCM或数据很短时退回轮询发送
+  */
+uint8_t LCD_WriteBytesAsync(const uint8_t *pdata, uint32_t size)
+{
+  uint32_t sent_bytes = 0;
+  uint16_t chunk_size;
+  uint8_t ok = 1;
+
+  LCD_WaitIdle();
+
+  if (size == 0) return 1;
+
+  HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+  HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+
+#if LCD_USE_DMA
+  if (s_lcd_dma_ready && size >= LCD_DMA_MIN_BYTES && LCD_DMA_IsAddressable(pdata))
+  {
+    return LCD_DMA_StartBytes(pdata, size);
+  }
+#endif
+
+  // 分段发送数据（SPI TSIZE最大65535）
+  while (sent_bytes < size)
+  {
+    chunk_size = (size - sent_bytes > 60000) ? 60000 : (uint16_t)(size - sent_bytes);
+    if (!SPI1_TX_WithFallback(pdata + sent_bytes, chunk_size)) {
+      ok = 0;
+    }
+    sent_bytes += chunk_size;
+  }
+
+  HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+
+  if (s_lcd_done_callback != 0) {
+    s_lcd_done_callback();
+  }
+  return ok;
+}
+
+
+#if LCD_USE_DMA
+/**
+  * @brief  以16位帧启动纯色填充：DMA源地址不递增，反复发送同一个颜色值
+  * @param  color: RGB565颜色值
+  * @param  pixels: 像素数量（调用前需已通过LCD_SetWindow设置窗口）
+  * @retval 1：已启动  0：DMA不可用，需由调用者轮询发送
+  * @note   16位帧高位先行，颜色无需交换字节；TSIZE按帧计数，整屏37044像素一次完成
+  */
+static uint8_t LCD_DMA_StartFill(uint16_t color, uint32_t pixels)
+{
+  SPI_TypeDef *SPIx = hspi1.Instance;
+
+  if (!s_lcd_dma_ready) return 0;
+
+  LCD_WaitIdle();
+
+  s_lcd_fill_color[0] = color;
+
+  HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+  HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+
+  /* 切换为16位帧、半字传输且源地址不递增（SPI与DMA流此时均已停止） */
+  CLEAR_BIT(SPIx->CR1, SPI_CR1_SPE);
+  MODIFY_REG(SPIx->CFG1, SPI_CFG1_DSIZE, SPI_DATASIZE_16BIT);
+  MODIFY_REG(((DMA_Stream_TypeDef *)s_lcd_dma_tx.Instance)->CR,
+             DMA_SxCR_MINC | DMA_SxCR_PSIZE | DMA_SxCR_MSIZE, DMA_SxCR_PSIZE_0 | DMA_SxCR_MSIZE_0);
+
+  s_lcd_tx_bytes += pixels * 2U;
+  s_lcd_dma_fill = 1U;
+  s_lcd_dma_src = (const uint8_t *)s_lcd_fill_color;
+  s_lcd_dma_remaining = pixels;
+  s_lcd_dma_busy = 1U;
+  return LCD_DMA_StartChunk();
+}
+#endif
 
 /**
   * @brief 初始化JD9613显示屏所需的GPIO
@@ -229,6 +631,7 @@ void HAL_SPI_MspDeInit(SPI_HandleTypeDef *hspi)
   */
 void LCD_WriteCommand(uint8_t cmd)
 {
+    LCD_WaitIdle();
     // 设置DC线为低电平，表示发送的是命令
     HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
     // 拉低片选，选中LCD
@@ -248,6 +651,7 @@ void LCD_WriteCommand(uint8_t cmd)
   */
 void LCD_WriteData(uint8_t data)
 {
+    LCD_WaitIdle();
     // 设置DC线为高电平，表示发送的是数据
     HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
     // 拉低片选，选中LCD
@@ -260,6 +664,63 @@ void LCD_WriteData(uint8_t data)
     HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
 }
 
+/**
+  * @brief  发送一条带参数的命令（单次片选：命令字节DC=0，参数DC=1连续发送）
+  * @param  cmd: 命令
+  * @param  params: 参数数组，可为NULL
+  * @param  count: 参数个数
+  * @retval None
+  */
+void LCD_WriteCommandWithParams(uint8_t cmd, const uint8_t *params, uint8_t count)
+{
+    LCD_WaitIdle();
+    HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
+    HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+
+    // 发送命令（返回时命令字节已全部移出，可以切换DC）
+    (void)SPI1_TX_WithFallback(&cmd, 1);
+
+    if (params != 0 && count > 0U)
+    {
+        HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+        (void)SPI1_TX_WithFallback(params, count);
+    }
+
+    HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+}
+
+/**
+  * @brief  按命令表顺序发送命令序列
+  * @param  table: 命令表（格式：命令, 参数个数[|LCD_CMD_DELAY], 参数..., [延时ms]）
+  * @param  size: 命令表字节数
+  * @retval None
+  */
+void LCD_WriteCommandTable(const uint8_t *table, uint32_t size)
+{
+    const uint8_t *end = table + size;
+
+    while (table + 2 <= end)
+    {
+        uint8_t cmd = table[0];
+        uint8_t count = table[1] & (uint8_t)~LCD_CMD_DELAY;
+        uint8_t has_delay = table[1] & LCD_CMD_DELAY;
+
+        table += 2;
+        if (table + count + (has_delay ? 1 : 0) > end)
+        {
+            break;  // 命令表不完整
+        }
+
+        LCD_WriteCommandWithParams(cmd, table, count);
+        table += count;
+
+        if (has_delay)
+        {
+            HAL_Delay(*table++);
+        }
+    }
+}
+
 /**
   * @brief  向LCD发送16位数据（用于RGB565颜色等）
   * @param  data: 要发送的16位数据
@@ -273,6 +734,7 @@ void LCD_WriteData16(uint16_t data)
     data_buffer[0] = (data >> 8) & 0xFF; // 高字节
     data_buffer[1] = data & 0xFF;        // 低字节
 
+    LCD_WaitIdle();
     HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
     HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
 
@@ -293,6 +755,228 @@ void LCD_Reset(void)
     HAL_Delay(120);  // 再延时120ms
 }
 
+/* JD9613初始化命令表
+ * 格式：命令, 参数个数[|LCD_CMD_DELAY], 参数..., [延时ms]
+ * 参数个数带LCD_CMD_DELAY标志时，参数后紧跟一个字节的延时（毫秒）
+ */
+static const uint8_t s_jd9613_init_cmds[] =
+{
+    // 进入扩展命令模式
+    0xFE, 1, 0x01,
+    // 密码验证命令
+    0xF7, 3, 0x96, 0x13, 0xA9,
+    // 关闭MIPI接口
+    0x90, 1, 0x01,
+    // 电源配置命令1
+    0x2C, 14,
+        0x19, 0x0B, 0x24, 0x1B, 0x1B, 0x1B, 0xAA, 0x50, 0x01, 0x16, 0x04, 0x04,
+        0x04, 0xD7,
+    // 电源配置命令2
+    0x2D, 3, 0x66, 0x56, 0x55,
+    // 电源配置命令3
+    0x2E, 9, 0x24, 0x04, 0x3F, 0x30, 0x30, 0xA8, 0xB8, 0xB8, 0x07,
+    // Gamma设置命令
+    0x33, 12, 0x03, 0x03, 0x03, 0x19, 0x19, 0x19, 0x13, 0x13, 0x13, 0x1A, 0x1A, 0x1A,
+    // 电源时序设置
+    0x10, 13,
+        0x0B, 0x08, 0x64, 0xAE, 0x0B, 0x08, 0x64, 0xAE, 0x00, 0x80, 0x00, 0x00,
+        0x01,
+    // 电源控制命令
+    0x11, 5, 0x01, 0x1E, 0x01, 0x1E, 0x00,
+    // 胶合逻辑配置
+    0x03, 5, 0x93, 0x1C, 0x00, 0x01, 0x7E,
+    // 系统配置
+    0x19, 1, 0x00,
+    // 时序控制命令1
+    0x31, 6, 0x1B, 0x00, 0x06, 0x05, 0x05, 0x05,
+    // 面板驱动配置
+    0x35, 4, 0x00, 0x80, 0x80, 0x00,
+    // 显示延迟设置
+    0x12, 1, 0x1B,
+    // 面板配置命令
+    0x1A, 8, 0x01, 0x20, 0x00, 0x08, 0x01, 0x06, 0x06, 0x06,
+    // 源极驱动配置1
+    0x74, 7, 0xBD, 0x00, 0x01, 0x08, 0x01, 0xBB, 0x98,
+    // 源极驱动配置2
+    0x6C, 9, 0xDC, 0x08, 0x02, 0x01, 0x08, 0x01, 0x30, 0x08, 0x00,
+    // 源极驱动配置3
+    0x6D, 9, 0xDC, 0x08, 0x02, 0x01, 0x08, 0x02, 0x30, 0x08, 0x00,
+    // 源极驱动配置4
+    0x76, 9, 0xDA, 0x00, 0x02, 0x20, 0x39, 0x80, 0x80, 0x50, 0x05,
+    // 源极驱动配置5
+    0x6E, 9, 0xDC, 0x00, 0x02, 0x01, 0x00, 0x02, 0x4F, 0x02, 0x00,
+    // 源极驱动配置6
+    0x6F, 9, 0xDC, 0x00, 0x02, 0x01, 0x00, 0x01, 0x4F, 0x02, 0x00,
+    // 源极驱动配置7
+    0x80, 7, 0xBD, 0x00, 0x01, 0x08, 0x01, 0xBB, 0x98,
+    // 源极驱动配置8
+    0x78, 9, 0xDC, 0x08, 0x02, 0x01, 0x08, 0x01, 0x30, 0x08, 0x00,
+    // 源极驱动配置9
+    0x79, 9, 0xDC, 0x08, 0x02, 0x01, 0x08, 0x02, 0x30, 0x08, 0x00,
+    // 源极驱动配置10
+    0x82, 9, 0xDA, 0x40, 0x02, 0x20, 0x39, 0x00, 0x80, 0x50, 0x05,
+    // 源极驱动配置11
+    0x7A, 9, 0xDC, 0x00, 0x02, 0x01, 0x00, 0x02, 0x4F, 0x02, 0x00,
+    // 源极驱动配置12
+    0x7B, 9, 0xDC, 0x00, 0x02, 0x01, 0x00, 0x01, 0x4F, 0x02, 0x00,
+    // Gamma校正设置1
+    0x84, 10, 0x01, 0x00, 0x09, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    // Gamma校正设置2
+    0x85, 10, 0x19, 0x19, 0x19, 0x03, 0x02, 0x08, 0x19, 0x19, 0x19, 0x19,
+    // 显示配置命令1
+    0x20, 12, 0x20, 0x00, 0x08, 0x00, 0x02, 0x00, 0x40, 0x00, 0x10, 0x00, 0x04, 0x00,
+    // 显示配置命令2
+    0x1E, 12, 0x40, 0x00, 0x10, 0x00, 0x04, 0x00, 0x20, 0x00, 0x08, 0x00, 0x02, 0x00,
+    // 显示配置命令3
+    0x24, 12, 0x20, 0x00, 0x08, 0x00, 0x02, 0x00, 0x40, 0x00, 0x10, 0x00, 0x04, 0x00,
+    // 显示配置命令4
+    0x22, 12, 0x40, 0x00, 0x10, 0x00, 0x04, 0x00, 0x20, 0x00, 0x08, 0x00, 0x02, 0x00,
+    // RGB Gamma设置 - 红色分量
+    0x13, 3, 0x63, 0x52, 0x41,
+    // RGB Gamma设置 - 绿色分量
+    0x14, 3, 0x36, 0x25, 0x14,
+    // RGB Gamma设置 - 蓝色分量
+    0x15, 3, 0x63, 0x52, 0x41,
+    // RGB Gamma设置 - 全部颜色
+    0x16, 3, 0x36, 0x25, 0x14,
+    // 显示控制命令
+    0x1D, 3, 0x10, 0x00, 0x00,
+    // 列地址设置
+    0x2A, 2, 0x0D, 0x07,
+    // 查找表设置1
+    0x27, 6, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    // 查找表设置2
+    0x28, 6, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    // 均衡器切换
+    0x26, 2, 0x01, 0x01,
+    // VSR均衡器设置
+    0x86, 2, 0x01, 0x01,
+    // 进入页面2配置
+    0xFE, 1, 0x02,
+    // 页面2特定配置
+    0x16, 5, 0x81, 0x43, 0x23, 0x1E, 0x03,
+    // 进入页面3配置
+    0xFE, 1, 0x03,
+    // 开启数字Gamma校正
+    0x60, 1, 0x01,
+    // 数字Gamma校正参数设置1
+    0x61, 15,
+        0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x0D, 0x26, 0x5A, 0x80, 0x80, 0x95,
+        0xF8, 0x3B, 0x75,
+    // 数字Gamma校正参数设置2
+    0x62, 15,
+        0x21, 0x22, 0x32, 0x43, 0x44, 0xD7, 0x0A, 0x59, 0xA1, 0xE1, 0x52, 0xB7,
+        0x11, 0x64, 0xB1,
+    // 数字Gamma校正参数设置3
+    0x63, 11, 0x54, 0x55, 0x66, 0x06, 0xFB, 0x3F, 0x81, 0xC6, 0x06, 0x45, 0x83,
+    // 数字Gamma校正参数设置4
+    0x64, 15,
+        0x00, 0x00, 0x11, 0x11, 0x21, 0x00, 0x23, 0x6A, 0xF8, 0x63, 0x67, 0x70,
+        0xA5, 0xDC, 0x02,
+    // 数字Gamma校正参数设置5
+    0x65, 15,
+        0x22, 0x22, 0x32, 0x43, 0x44, 0x24, 0x44, 0x82, 0xC1, 0xF8, 0x61, 0xBF,
+        0x13, 0x62, 0xAD,
+    // 数字Gamma校正参数设置6
+    0x66, 11, 0x54, 0x55, 0x65, 0x06, 0xF5, 0x37, 0x76, 0xB8, 0xF5, 0x31, 0x6C,
+    // 数字Gamma校正参数设置7
+    0x67, 15,
+        0x00, 0x10, 0x22, 0x22, 0x22, 0x00, 0x37, 0xA4, 0x7E, 0x22, 0x25, 0x2C,
+        0x4C, 0x72, 0x9A,
+    // 数字Gamma校正参数设置8
+    0x68, 15,
+        0x22, 0x33, 0x43, 0x44, 0x55, 0xC1, 0xE5, 0x2D, 0x6F, 0xAF, 0x23, 0x8F,
+        0xF3, 0x50, 0xA6,
+    // 页面3 Gamma参数设置9（续）
+    0x69, 11, 0x65, 0x66, 0x77, 0x07, 0xFD, 0x4E, 0x9C, 0xED, 0x39, 0x86, 0xD3,
+    // 进入页面5配置
+    0xFE, 1, 0x05,
+    // 页面5 Gamma参数设置1
+    0x61, 15,
+        0x00, 0x31, 0x44, 0x54, 0x55, 0x00, 0x92, 0xB5, 0x88, 0x19, 0x90, 0xE8,
+        0x3E, 0x71, 0xA5,
+    // 页面5 Gamma参数设置2
+    0x62, 15,
+        0x55, 0x66, 0x76, 0x77, 0x88, 0xCE, 0xF2, 0x32, 0x6E, 0xC4, 0x34, 0x8B,
+        0xD9, 0x2A, 0x7D,
+    // 页面5 Gamma参数设置3
+    0x63, 11, 0x98, 0x99, 0xAA, 0x0A, 0xDC, 0x2E, 0x7D, 0xC3, 0x0D, 0x5B, 0x9E,
+    // 页面5 Gamma参数设置4
+    0x64, 15,
+        0x00, 0x31, 0x44, 0x54, 0x55, 0x00, 0xA2, 0xE5, 0xCD, 0x5C, 0x94, 0xCF,
+        0x09, 0x4A, 0x72,
+    // 页面5 Gamma参数设置5
+    0x65, 15,
+        0x55, 0x65, 0x66, 0x77, 0x87, 0x9C, 0xC2, 0xFF, 0x36, 0x6A, 0xEC, 0x45,
+        0x91, 0xD8, 0x20,
+    // 页面5 Gamma参数设置6
+    0x66, 11, 0x88, 0x98, 0x99, 0x0A, 0x68, 0xB0, 0xFB, 0x43, 0x8C, 0xD5, 0x0E,
+    // 页面5 Gamma参数设置7
+    0x67, 15,
+        0x00, 0x42, 0x55, 0x55, 0x55, 0x00, 0xCB, 0x62, 0xC5, 0x09, 0x44, 0x72,
+        0xA9, 0xD6, 0xFD,
+    // 页面5 Gamma参数设置8
+    0x68, 15,
+        0x66, 0x66, 0x77, 0x87, 0x98, 0x21, 0x45, 0x96, 0xED, 0x29, 0x90, 0xEE,
+        0x4B, 0xB1, 0x13,
+    // 页面5 Gamma参数设置9
+    0x69, 11, 0x99, 0xAA, 0xBA, 0x0B, 0x6A, 0xB8, 0x0D, 0x62, 0xB8, 0x0E, 0x54,
+    // 进入页面7配置
+    0xFE, 1, 0x07,
+    // 显示控制命令1
+    0x3E, 1, 0x00,
+    // 显示控制命令2
+    0x42, 2, 0x03, 0x10,
+    // 显示控制命令3
+    0x4A, 1, 0x31,
+    // 显示控制命令4
+    0x5C, 1, 0x01,
+    // 显示时序配置1
+    0x3C, 6, 0x07, 0x00, 0x24, 0x04, 0x3F, 0xE2,
+    // 显示时序配置2
+    0x44, 4, 0x03, 0x40, 0x3F, 0x02,
+    // Gamma曲线设置1（高位）
+    0x12, 10, 0xAA, 0xAA, 0xC0, 0xC8, 0xD0, 0xD8, 0xE0, 0xE8, 0xF0, 0xF8,
+    // Gamma曲线设置2（中位）
+    0x11, 15,
+        0xAA, 0xAA, 0xAA, 0x60, 0x68, 0x70, 0x78, 0x80, 0x88, 0x90, 0x98, 0xA0,
+        0xA8, 0xB0, 0xB8,
+    // Gamma曲线设置3（低位）
+    0x10, 15,
+        0xAA, 0xAA, 0xAA, 0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x40,
+        0x48, 0x50, 0x58,
+    // Gamma查找表设置
+    0x14, 16,
+        0x03, 0x1F, 0x3F, 0x5F, 0x7F, 0x9F, 0xBF, 0xDF, 0x03, 0x1F, 0x3F, 0x5F,
+        0x7F, 0x9F, 0xBF, 0xDF,
+    // 面板驱动配置
+    0x18, 1, 0x70,
+    // 系统配置命令
+    0x1A, 10, 0x22, 0xBB, 0xAA, 0xFF, 0x24, 0x71, 0x0F, 0x01, 0x00, 0x03,
+    // 返回主页面（页面0）
+    0xFE, 1, 0x00,
+    // 设置扫描方向，实现上下对调左右翻转
+    0x36, 1, LCD_MADCTL_INIT_VALUE,
+    // 设置像素格式为16位（5-6-5）RGB格式
+    0x3A, 1, 0x55,
+    // 设置DSPI模式
+    0xC4, 1, 0x80,
+    // 设置列地址（X方向显示区域）
+    0x2A, 4, 0x00, 0x00, 0x00, 0x7D,
+    // 设置页地址（Y方向显示区域）
+    0x2B, 4, 0x00, 0x00, 0x01, 0x25,
+    // 关闭撕裂效应输出
+    0x35, 1, 0x00,
+    // 设置背光控制
+    0x53, 1, 0x28,
+    // 设置显示亮度（最大亮度）
+    0x51, 1, 0xFF,
+    // 退出睡眠模式（唤醒显示器）
+    0x11, 0 | LCD_CMD_DELAY, 120,
+    // 开启显示
+    0x29, 0 | LCD_CMD_DELAY, 1,
+};
+
 /**
   * @brief  LCD初始化
   * @retval None
@@ -300,6 +984,11 @@ void LCD_Reset(void)
   */
 void LCD_Init(void)
 {
+  if (s_lcd_dma_buffer == NULL)
+  {
+    s_lcd_dma_buffer = (uint8_t (*)[LCD_DMA_BUFFER_SIZE])dma_buf_alloc(LCD_DMA_BUFFER_COUNT * LCD_DMA_BUFFER_SIZE);
+    s_lcd_fill_color = (uint16_t *)dma_buf_alloc(16U * sizeof(uint16_t));
+  }
 
   JD9613_GPIO_Init();
 
@@ -336,926 +1025,21 @@ void LCD_Init(void)
     // 显式使能SPI，确保外设开启
     __HAL_SPI_ENABLE(&hspi1);
 
+#if LCD_USE_DMA
+    // 初始化SPI1发送DMA（失败时自动退回轮询发送）
+    LCD_DMA_Init();
+#if LCD_USE_DMA2D
+    LCD_DMA2D_Init();
+#endif
+#endif
+
+    sys_dwt_enable();           // DWT周期计数器，用于转换流水线性能统计
+
     // 硬件复位
     LCD_Reset();
 
-    // JD9613初始化序列
-// 进入扩展命令模式
-LCD_WriteCommand(0xFE); 
-LCD_WriteData(0x01);
-
-// 密码验证命令
-LCD_WriteCommand(0xF7); 
-LCD_WriteData(0x96);    // 密码字节1
-LCD_WriteData(0x13);    // 密码字节2  
-LCD_WriteData(0xA9);    // 密码字节3
-
-// 关闭MIPI接口
-LCD_WriteCommand(0x90); // mipi off
-LCD_WriteData(0x01);
-
-// 电源配置命令1
-LCD_WriteCommand(0x2C); 
-LCD_WriteData(0x19);
-LCD_WriteData(0x0B);
-LCD_WriteData(0x24);
-LCD_WriteData(0x1B);
-LCD_WriteData(0x1B);
-LCD_WriteData(0x1B);
-LCD_WriteData(0xAA);
-LCD_WriteData(0x50);
-LCD_WriteData(0x01);
-LCD_WriteData(0x16);
-LCD_WriteData(0x04);
-LCD_WriteData(0x04);
-LCD_WriteData(0x04);
-LCD_WriteData(0xD7);
-
-// 电源配置命令2
-LCD_WriteCommand(0x2D); 
-LCD_WriteData(0x66);
-LCD_WriteData(0x56);
-LCD_WriteData(0x55);
-
-// 电源配置命令3
-LCD_WriteCommand(0x2E); 
-LCD_WriteData(0x24);
-LCD_WriteData(0x04);
-LCD_WriteData(0x3F);
-LCD_WriteData(0x30);
-LCD_WriteData(0x30);
-LCD_WriteData(0xA8);
-LCD_WriteData(0xB8);
-LCD_WriteData(0xB8);
-LCD_WriteData(0x07);
-
-// Gamma设置命令
-LCD_WriteCommand(0x33); 
-LCD_WriteData(0x03);
-LCD_WriteData(0x03);
-LCD_WriteData(0x03);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-LCD_WriteData(0x13);
-LCD_WriteData(0x13);
-LCD_WriteData(0x13);
-LCD_WriteData(0x1A);
-LCD_WriteData(0x1A);
-LCD_WriteData(0x1A);
-
-// 电源时序设置
-LCD_WriteCommand(0x10); 
-LCD_WriteData(0x0B);
-LCD_WriteData(0x08);
-LCD_WriteData(0x64);
-LCD_WriteData(0xAE);
-LCD_WriteData(0x0B);
-LCD_WriteData(0x08);
-LCD_WriteData(0x64);
-LCD_WriteData(0xAE);
-LCD_WriteData(0x00);
-LCD_WriteData(0x80);
-LCD_WriteData(0x00);
-LCD_WriteData(0x00);
-LCD_WriteData(0x01);
-
-// 电源控制命令
-LCD_WriteCommand(0x11); 
-LCD_WriteData(0x01);
-LCD_WriteData(0x1E);
-LCD_WriteData(0x01);
-LCD_WriteData(0x1E);
-LCD_WriteData(0x00);
-
-// 胶合逻辑配置
-LCD_WriteCommand(0x03); //r/ Glue
-LCD_WriteData(0x93);
-LCD_WriteData(0x1C);
-LCD_WriteData(0x00);
-LCD_WriteData(0x01);
-LCD_WriteData(0x7E);
-
-// 系统配置
-LCD_WriteCommand(0x19); // system 
-LCD_WriteData(0x00);
-
-// 时序控制命令1
-LCD_WriteCommand(0x31); 
-LCD_WriteData(0x1B);
-LCD_WriteData(0x00);
-LCD_WriteData(0x06);
-LCD_WriteData(0x05);
-LCD_WriteData(0x05);
-LCD_WriteData(0x05);
-
-// 面板驱动配置
-LCD_WriteCommand(0x35); 
-LCD_WriteData(0x00);
-LCD_WriteData(0x80);
-LCD_WriteData(0x80);
-LCD_WriteData(0x00);
-
-// 显示延迟设置
-LCD_WriteCommand(0x12); 
-LCD_WriteData(0x1B); //t_ld_dly
-
-// 面板配置命令
-LCD_WriteCommand(0x1A); 
-LCD_WriteData(0x01);
-LCD_WriteData(0x20);
-LCD_WriteData(0x00);
-LCD_WriteData(0x08);
-LCD_WriteData(0x01);
-LCD_WriteData(0x06);
-LCD_WriteData(0x06);
-LCD_WriteData(0x06);
-
-// 源极驱动配置1
-LCD_WriteCommand(0x74); 
-LCD_WriteData(0xBD);
-LCD_WriteData(0x00);
-LCD_WriteData(0x01);
-LCD_WriteData(0x08);
-LCD_WriteData(0x01);
-LCD_WriteData(0xBB);
-LCD_WriteData(0x98);
-
-// 源极驱动配置2
-LCD_WriteCommand(0x6C); 
-LCD_WriteData(0xDC);
-LCD_WriteData(0x08);
-LCD_WriteData(0x02);
-LCD_WriteData(0x01);
-LCD_WriteData(0x08);
-LCD_WriteData(0x01);
-LCD_WriteData(0x30);
-LCD_WriteData(0x08);
-LCD_WriteData(0x00);
-
-// 源极驱动配置3
-LCD_WriteCommand(0x6D); 
-LCD_WriteData(0xDC);  
-LCD_WriteData(0x08);  
-LCD_WriteData(0x02);  
-LCD_WriteData(0x01);  
-LCD_WriteData(0x08);  
-LCD_WriteData(0x02);  
-LCD_WriteData(0x30);  
-LCD_WriteData(0x08);  
-LCD_WriteData(0x00);  
-
-// 源极驱动配置4
-LCD_WriteCommand(0x76); 
-LCD_WriteData(0xDA);
-LCD_WriteData(0x00);
-LCD_WriteData(0x02);
-LCD_WriteData(0x20);
-LCD_WriteData(0x39);
-LCD_WriteData(0x80);
-LCD_WriteData(0x80);
-LCD_WriteData(0x50);
-LCD_WriteData(0x05);
-
-// 源极驱动配置5
-LCD_WriteCommand(0x6E);
-LCD_WriteData(0xDC);
-LCD_WriteData(0x00);
-LCD_WriteData(0x02);
-LCD_WriteData(0x01);
-LCD_WriteData(0x00);
-LCD_WriteData(0x02);
-LCD_WriteData(0x4F);
-LCD_WriteData(0x02);
-LCD_WriteData(0x00);
-
-// 源极驱动配置6
-LCD_WriteCommand(0x6F);
-LCD_WriteData(0xDC);
-LCD_WriteData(0x00);
-LCD_WriteData(0x02);
-LCD_WriteData(0x01);
-LCD_WriteData(0x00);
-LCD_WriteData(0x01);
-LCD_WriteData(0x4F);
-LCD_WriteData(0x02);
-LCD_WriteData(0x00);
-
-// 源极驱动配置7
-LCD_WriteCommand(0x80); 
-LCD_WriteData(0xBD);
-LCD_WriteData(0x00);
-LCD_WriteData(0x01);
-LCD_WriteData(0x08);
-LCD_WriteData(0x01);
-LCD_WriteData(0xBB);
-LCD_WriteData(0x98);
-
-// 源极驱动配置8
-LCD_WriteCommand(0x78);
-LCD_WriteData(0xDC);
-LCD_WriteData(0x08);
-LCD_WriteData(0x02);
-LCD_WriteData(0x01);
-LCD_WriteData(0x08);
-LCD_WriteData(0x01);
-LCD_WriteData(0x30);
-LCD_WriteData(0x08);
-LCD_WriteData(0x00);
-
-// 源极驱动配置9
-LCD_WriteCommand(0x79);
-LCD_WriteData(0xDC);
-LCD_WriteData(0x08);
-LCD_WriteData(0x02);
-LCD_WriteData(0x01);
-LCD_WriteData(0x08);
-LCD_WriteData(0x02);
-LCD_WriteData(0x30);
-LCD_WriteData(0x08);
-LCD_WriteData(0x00);
-
-// 源极驱动配置10
-LCD_WriteCommand(0x82); 
-LCD_WriteData(0xDA);
-LCD_WriteData(0x40);
-LCD_WriteData(0x02);
-LCD_WriteData(0x20);
-LCD_WriteData(0x39);
-LCD_WriteData(0x00);
-LCD_WriteData(0x80);
-LCD_WriteData(0x50);
-LCD_WriteData(0x05);
-
-// 源极驱动配置11
-LCD_WriteCommand(0x7A);  
-LCD_WriteData(0xDC);  
-LCD_WriteData(0x00);  
-LCD_WriteData(0x02);  
-LCD_WriteData(0x01);  
-LCD_WriteData(0x00);  
-LCD_WriteData(0x02);  
-LCD_WriteData(0x4F);  
-LCD_WriteData(0x02);  
-LCD_WriteData(0x00);  
-
-// 源极驱动配置12
-LCD_WriteCommand(0x7B); 
-LCD_WriteData(0xDC); 
-LCD_WriteData(0x00); 
-LCD_WriteData(0x02); 
-LCD_WriteData(0x01); 
-LCD_WriteData(0x00); 
-LCD_WriteData(0x01); 
-LCD_WriteData(0x4F); 
-LCD_WriteData(0x02); 
-LCD_WriteData(0x00); 
-
-// Gamma校正设置1
-LCD_WriteCommand(0x84); 
-LCD_WriteData(0x01);
-LCD_WriteData(0x00);
-LCD_WriteData(0x09);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-
-// Gamma校正设置2
-LCD_WriteCommand(0x85); 
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-LCD_WriteData(0x03);
-LCD_WriteData(0x02);
-LCD_WriteData(0x08);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-LCD_WriteData(0x19);
-
-// 显示配置命令1
-LCD_WriteCommand(0x20); 
-LCD_WriteData(0x20);
-LCD_WriteData(0x00);
-LCD_WriteData(0x08);
-LCD_WriteData(0x00);
-LCD_WriteData(0x02);
-LCD_WriteData(0x00);
-LCD_WriteData(0x40);
-LCD_WriteData(0x00);
-LCD_WriteData(0x10);
-LCD_WriteData(0x00);
-LCD_WriteData(0x04);
-LCD_WriteData(0x00);
-
-// 显示配置命令2
-LCD_WriteCommand(0x1E); 
-LCD_WriteData(0x40);
-LCD_WriteData(0x00);
-LCD_WriteData(0x10);
-LCD_WriteData(0x00);
-LCD_WriteData(0x04);
-LCD_WriteData(0x00);
-LCD_WriteData(0x20);
-LCD_WriteData(0x00);
-LCD_WriteData(0x08);
-LCD_WriteData(0x00);
-LCD_WriteData(0x02);
-LCD_WriteData(0x00);
-
-// 显示配置命令3
-LCD_WriteCommand(0x24); 
-LCD_WriteData(0x20);
-LCD_WriteData(0x00);
-LCD_WriteData(0x08);
-LCD_WriteData(0x00);
-LCD_WriteData(0x02);
-LCD_WriteData(0x00);
-LCD_WriteData(0x40);
-LCD_WriteData(0x00);
-LCD_WriteData(0x10);
-LCD_WriteData(0x00);
-LCD_WriteData(0x04);
-LCD_WriteData(0x00);
-
-// 显示配置命令4
-LCD_WriteCommand(0x22); 
-LCD_WriteData(0x40);
-LCD_WriteData(0x00);
-LCD_WriteData(0x10);
-LCD_WriteData(0x00);
-LCD_WriteData(0x04);
-LCD_WriteData(0x00);
-LCD_WriteData(0x20);
-LCD_WriteData(0x00);
-LCD_WriteData(0x08);
-LCD_WriteData(0x00);
-LCD_WriteData(0x02);
-LCD_WriteData(0x00);
-
-// RGB Gamma设置 - 红色分量
-LCD_WriteCommand(0x13); 
-LCD_WriteData(0x63);
-LCD_WriteData(0x52);
-LCD_WriteData(0x41);
-
-// RGB Gamma设置 - 绿色分量
-LCD_WriteCommand(0x14);
-LCD_WriteData(0x36);
-LCD_WriteData(0x25);
-LCD_WriteData(0x14);
-
-// RGB Gamma设置 - 蓝色分量
-LCD_WriteCommand(0x15); 
-LCD_WriteData(0x63);
-LCD_WriteData(0x52);
-LCD_WriteData(0x41);
-
-// RGB Gamma设置 - 全部颜色
-LCD_WriteCommand(0x16);
-LCD_WriteData(0x36);
-LCD_WriteData(0x25);
-LCD_WriteData(0x14);
-
-// 显示控制命令
-LCD_WriteCommand(0x1D);
-LCD_WriteData(0x10);
-LCD_WriteData(0x00);
-LCD_WriteData(0x00);
-
-// 列地址设置
-LCD_WriteCommand(0x2A);
-LCD_WriteData(0x0D);
-LCD_WriteData(0x07);
-
-// 查找表设置1
-LCD_WriteCommand(0x27);
-LCD_WriteData(0x00);
-LCD_WriteData(0x01);
-LCD_WriteData(0x02);
-LCD_WriteData(0x03);
-LCD_WriteData(0x04);
-LCD_WriteData(0x05);
-
-// 查找表设置2
-LCD_WriteCommand(0x28);
-LCD_WriteData(0x00);
-LCD_WriteData(0x01);
-LCD_WriteData(0x02);
-LCD_WriteData(0x03);
-LCD_WriteData(0x04);
-LCD_WriteData(0x05);
-
-// 均衡器切换
-LCD_WriteCommand(0x26); // switch eq
-LCD_WriteData(0x01);
-LCD_WriteData(0x01);
-
-// VSR均衡器设置
-LCD_WriteCommand(0x86); // VSR eq
-LCD_WriteData(0x01);
-LCD_WriteData(0x01);
-
-// 进入页面2配置
-LCD_WriteCommand(0xFE); // page 2
-LCD_WriteData(0x02);
-
-// 页面2特定配置
-LCD_WriteCommand(0x16);
-LCD_WriteData(0x81);
-LCD_WriteData(0x43);
-LCD_WriteData(0x23);
-LCD_WriteData(0x1E);
-LCD_WriteData(0x03);
-
-// 进入页面3配置
-LCD_WriteCommand(0xFE); // page 3
-LCD_WriteData(0x03);
-
-// 开启数字Gamma校正
-LCD_WriteCommand(0x60); // DGC On
-LCD_WriteData(0x01);
-
-// 数字Gamma校正参数设置1
-LCD_WriteCommand(0x61);
-LCD_WriteData(0x00);
-LCD_WriteData(0x00);
-LCD_WriteData(0x00);
-LCD_WriteData(0x00);
-LCD_WriteData(0x11);
-LCD_WriteData(0x00);
-LCD_WriteData(0x0D);
-LCD_WriteData(0x26);
-LCD_WriteData(0x5A);
-LCD_WriteData(0x80);
-LCD_WriteData(0x80);
-LCD_WriteData(0x95);
-LCD_WriteData(0xF8);
-LCD_WriteData(0x3B);
-LCD_WriteData(0x75);
-
-// 数字Gamma校正参数设置2
-LCD_WriteCommand(0x62);
-LCD_WriteData(0x21);
-LCD_WriteData(0x22);
-LCD_WriteData(0x32);
-LCD_WriteData(0x43);
-LCD_WriteData(0x44);
-LCD_WriteData(0xD7);
-LCD_WriteData(0x0A);
-LCD_WriteData(0x59);
-LCD_WriteData(0xA1);
-LCD_WriteData(0xE1);
-LCD_WriteData(0x52);
-LCD_WriteData(0xB7);
-LCD_WriteData(0x11);
-LCD_WriteData(0x64);
-LCD_WriteData(0xB1);
-
-// 数字Gamma校正参数设置3
-LCD_WriteCommand(0x63);
-LCD_WriteData(0x54);
-LCD_WriteData(0x55);
-LCD_WriteData(0x66);
-LCD_WriteData(0x06);
-LCD_WriteData(0xFB);
-LCD_WriteData(0x3F);
-LCD_WriteData(0x81);
-LCD_WriteData(0xC6);
-LCD_WriteData(0x06);
-LCD_WriteData(0x45);
-LCD_WriteData(0x83);
-
-// 数字Gamma校正参数设置4
-LCD_WriteCommand(0x64);
-LCD_WriteData(0x00);
-LCD_WriteData(0x00);
-LCD_WriteData(0x11);
-LCD_WriteData(0x11);
-LCD_WriteData(0x21);
-LCD_WriteData(0x00);
-LCD_WriteData(0x23);
-LCD_WriteData(0x6A);
-LCD_WriteData(0xF8);
-LCD_WriteData(0x63);
-LCD_WriteData(0x67);
-LCD_WriteData(0x70);
-LCD_WriteData(0xA5);
-LCD_WriteData(0xDC);
-LCD_WriteData(0x02);
-
-// 数字Gamma校正参数设置5
-LCD_WriteCommand(0x65);
-LCD_WriteData(0x22);
-LCD_WriteData(0x22);
-LCD_WriteData(0x32);
-LCD_WriteData(0x43);
-LCD_WriteData(0x44);
-LCD_WriteData(0x24);
-LCD_WriteData(0x44);
-LCD_WriteData(0x82);
-LCD_WriteData(0xC1);
-LCD_WriteData(0xF8);
-LCD_WriteData(0x61);
-LCD_WriteData(0xBF);
-LCD_WriteData(0x13);
-LCD_WriteData(0x62);
-LCD_WriteData(0xAD);
-
-// 数字Gamma校正参数设置6
-LCD_WriteCommand(0x66);
-LCD_WriteData(0x54);
-LCD_WriteData(0x55);
-LCD_WriteData(0x65);
-LCD_WriteData(0x06);
-LCD_WriteData(0xF5);
-LCD_WriteData(0x37);
-LCD_WriteData(0x76);
-LCD_WriteData(0xB8);
-LCD_WriteData(0xF5);
-LCD_WriteData(0x31);
-LCD_WriteData(0x6C);
-
-// 数字Gamma校正参数设置7
-LCD_WriteCommand(0x67);
-LCD_WriteData(0x00);
-LCD_WriteData(0x10);
-LCD_WriteData(0x22);
-LCD_WriteData(0x22);
-LCD_WriteData(0x22);
-LCD_WriteData(0x00);
-LCD_WriteData(0x37);
-LCD_WriteData(0xA4);
-LCD_WriteData(0x7E);
-LCD_WriteData(0x22);
-LCD_WriteData(0x25);
-LCD_WriteData(0x2C);
-LCD_WriteData(0x4C);
-LCD_WriteData(0x72);
-LCD_WriteData(0x9A);
-
-// 数字Gamma校正参数设置8
-LCD_WriteCommand(0x68);
-LCD_WriteData(0x22);
-LCD_WriteData(0x33);
-LCD_WriteData(0x43);
-LCD_WriteData(0x44);
-LCD_WriteData(0x55);
-LCD_WriteData(0xC1);
-LCD_WriteData(0xE5);
-LCD_WriteData(0x2D);
-LCD_WriteData(0x6F);
-LCD_WriteData(0xAF);
-LCD_WriteData(0x23);
-LCD_WriteData(0x8F);
-LCD_WriteData(0xF3);
-LCD_WriteData(0x50);
-LCD_WriteData(0xA6);
-
-// 页面3 Gamma参数设置9（续）
-LCD_WriteCommand(0x69);
-LCD_WriteData(0x65);
-LCD_WriteData(0x66);
-LCD_WriteData(0x77);
-LCD_WriteData(0x07);
-LCD_WriteData(0xFD);
-LCD_WriteData(0x4E);
-LCD_WriteData(0x9C);
-LCD_WriteData(0xED);
-LCD_WriteData(0x39);
-LCD_WriteData(0x86);
-LCD_WriteData(0xD3);
-
-// 进入页面5配置
-LCD_WriteCommand(0xFE);
-LCD_WriteData(0x05);
-
-// 页面5 Gamma参数设置1
-LCD_WriteCommand(0x61);
-LCD_WriteData(0x00);
-LCD_WriteData(0x31);
-LCD_WriteData(0x44);
-LCD_WriteData(0x54);
-LCD_WriteData(0x55);
-LCD_WriteData(0x00);
-LCD_WriteData(0x92);
-LCD_WriteData(0xB5);
-LCD_WriteData(0x88);
-LCD_WriteData(0x19);
-LCD_WriteData(0x90);
-LCD_WriteData(0xE8);
-LCD_WriteData(0x3E);
-LCD_WriteData(0x71);
-LCD_WriteData(0xA5);
-
-// 页面5 Gamma参数设置2
-LCD_WriteCommand(0x62);
-LCD_WriteData(0x55);
-LCD_WriteData(0x66);
-LCD_WriteData(0x76);
-LCD_WriteData(0x77);
-LCD_WriteData(0x88);
-LCD_WriteData(0xCE);
-LCD_WriteData(0xF2);
-LCD_WriteData(0x32);
-LCD_WriteData(0x6E);
-LCD_WriteData(0xC4);
-LCD_WriteData(0x34);
-LCD_WriteData(0x8B);
-LCD_WriteData(0xD9);
-LCD_WriteData(0x2A);
-LCD_WriteData(0x7D);
-
-// 页面5 Gamma参数设置3
-LCD_WriteCommand(0x63);
-LCD_WriteData(0x98);
-LCD_WriteData(0x99);
-LCD_WriteData(0xAA);
-LCD_WriteData(0x0A);
-LCD_WriteData(0xDC);
-LCD_WriteData(0x2E);
-LCD_WriteData(0x7D);
-LCD_WriteData(0xC3);
-LCD_WriteData(0x0D);
-LCD_WriteData(0x5B);
-LCD_WriteData(0x9E);
-
-// 页面5 Gamma参数设置4
-LCD_WriteCommand(0x64);
-LCD_WriteData(0x00);
-LCD_WriteData(0x31);
-LCD_WriteData(0x44);
-LCD_WriteData(0x54);
-LCD_WriteData(0x55);
-LCD_WriteData(0x00);
-LCD_WriteData(0xA2);
-LCD_WriteData(0xE5);
-LCD_WriteData(0xCD);
-LCD_WriteData(0x5C);
-LCD_WriteData(0x94);
-LCD_WriteData(0xCF);
-LCD_WriteData(0x09);
-LCD_WriteData(0x4A);
-LCD_WriteData(0x72);
-
-// 页面5 Gamma参数设置5
-LCD_WriteCommand(0x65);
-LCD_WriteData(0x55);
-LCD_WriteData(0x65);
-LCD_WriteData(0x66);
-LCD_WriteData(0x77);
-LCD_WriteData(0x87);
-LCD_WriteData(0x9C);
-LCD_WriteData(0xC2);
-LCD_WriteData(0xFF);
-LCD_WriteData(0x36);
-LCD_WriteData(0x6A);
-LCD_WriteData(0xEC);
-LCD_WriteData(0x45);
-LCD_WriteData(0x91);
-LCD_WriteData(0xD8);
-LCD_WriteData(0x20);
-
-// 页面5 Gamma参数设置6
-LCD_WriteCommand(0x66);
-LCD_WriteData(0x88);
-LCD_WriteData(0x98);
-LCD_WriteData(0x99);
-LCD_WriteData(0x0A);
-LCD_WriteData(0x68);
-LCD_WriteData(0xB0);
-LCD_WriteData(0xFB);
-LCD_WriteData(0x43);
-LCD_WriteData(0x8C);
-LCD_WriteData(0xD5);
-LCD_WriteData(0x0E);
-
-// 页面5 Gamma参数设置7
-LCD_WriteCommand(0x67);
-LCD_WriteData(0x00);
-LCD_WriteData(0x42);
-LCD_WriteData(0x55);
-LCD_WriteData(0x55);
-LCD_WriteData(0x55);
-LCD_WriteData(0x00);
-LCD_WriteData(0xCB);
-LCD_WriteData(0x62);
-LCD_WriteData(0xC5);
-LCD_WriteData(0x09);
-LCD_WriteData(0x44);
-LCD_WriteData(0x72);
-LCD_WriteData(0xA9);
-LCD_WriteData(0xD6);
-LCD_WriteData(0xFD);
-
-// 页面5 Gamma参数设置8
-LCD_WriteCommand(0x68);
-LCD_WriteData(0x66);
-LCD_WriteData(0x66);
-LCD_WriteData(0x77);
-LCD_WriteData(0x87);
-LCD_WriteData(0x98);
-LCD_WriteData(0x21);
-LCD_WriteData(0x45);
-LCD_WriteData(0x96);
-LCD_WriteData(0xED);
-LCD_WriteData(0x29);
-LCD_WriteData(0x90);
-LCD_WriteData(0xEE);
-LCD_WriteData(0x4B);
-LCD_WriteData(0xB1);
-LCD_WriteData(0x13);
-
-// 页面5 Gamma参数设置9
-LCD_WriteCommand(0x69);
-LCD_WriteData(0x99);
-LCD_WriteData(0xAA);
-LCD_WriteData(0xBA);
-LCD_WriteData(0x0B);
-LCD_WriteData(0x6A);
-LCD_WriteData(0xB8);
-LCD_WriteData(0x0D);
-LCD_WriteData(0x62);
-LCD_WriteData(0xB8);
-LCD_WriteData(0x0E);
-LCD_WriteData(0x54);
-
-// 进入页面7配置
-LCD_WriteCommand(0xFE); 
-LCD_WriteData(0x07);
-
-// 显示控制命令1
-LCD_WriteCommand(0x3E); 
-LCD_WriteData(0x00);
-
-// 显示控制命令2
-LCD_WriteCommand(0x42); 
-LCD_WriteData(0x03);
-LCD_WriteData(0x10);
-
-// 显示控制命令3
-LCD_WriteCommand(0x4A); 
-LCD_WriteData(0x31);
-
-// 显示控制命令4
-LCD_WriteCommand(0x5C); 
-LCD_WriteData(0x01);
-
-// 显示时序配置1
-LCD_WriteCommand(0x3C); 
-LCD_WriteData(0x07);
-LCD_WriteData(0x00);
-LCD_WriteData(0x24);
-LCD_WriteData(0x04);
-LCD_WriteData(0x3F);
-LCD_WriteData(0xE2);
-
-// 显示时序配置2
-LCD_WriteCommand(0x44);
-LCD_WriteData(0x03);
-LCD_WriteData(0x40);
-LCD_WriteData(0x3F);
-LCD_WriteData(0x02);
-
-// Gamma曲线设置1（高位）
-LCD_WriteCommand(0x12);
-LCD_WriteData(0xAA);
-LCD_WriteData(0xAA);
-LCD_WriteData(0xC0);
-LCD_WriteData(0xC8);
-LCD_WriteData(0xD0);
-LCD_WriteData(0xD8);
-LCD_WriteData(0xE0);
-LCD_WriteData(0xE8);
-LCD_WriteData(0xF0);
-LCD_WriteData(0xF8);
-
-// Gamma曲线设置2（中位）
-LCD_WriteCommand(0x11);
-LCD_WriteData(0xAA);
-LCD_WriteData(0xAA);
-LCD_WriteData(0xAA);
-LCD_WriteData(0x60);
-LCD_WriteData(0x68);
-LCD_WriteData(0x70);
-LCD_WriteData(0x78);
-LCD_WriteData(0x80);
-LCD_WriteData(0x88);
-LCD_WriteData(0x90);
-LCD_WriteData(0x98);
-LCD_WriteData(0xA0);
-LCD_WriteData(0xA8);
-LCD_WriteData(0xB0);
-LCD_WriteData(0xB8);
-
-// Gamma曲线设置3（低位）
-LCD_WriteCommand(0x10);
-LCD_WriteData(0xAA);
-LCD_WriteData(0xAA);
-LCD_WriteData(0xAA);
-LCD_WriteData(0x00);
-LCD_WriteData(0x08);
-LCD_WriteData(0x10);
-LCD_WriteData(0x18);
-LCD_WriteData(0x20);
-LCD_WriteData(0x28);
-LCD_WriteData(0x30);
-LCD_WriteData(0x38);
-LCD_WriteData(0x40);
-LCD_WriteData(0x48);
-LCD_WriteData(0x50);
-LCD_WriteData(0x58);
-
-// Gamma查找表设置
-LCD_WriteCommand(0x14);
-LCD_WriteData(0x03);
-LCD_WriteData(0x1F);
-LCD_WriteData(0x3F);
-LCD_WriteData(0x5F);
-LCD_WriteData(0x7F);
-LCD_WriteData(0x9F);
-LCD_WriteData(0xBF);
-LCD_WriteData(0xDF);
-LCD_WriteData(0x03);
-LCD_WriteData(0x1F);
-LCD_WriteData(0x3F);
-LCD_WriteData(0x5F);
-LCD_WriteData(0x7F);
-LCD_WriteData(0x9F);
-LCD_WriteData(0xBF);
-LCD_WriteData(0xDF);
-
-// 面板驱动配置
-LCD_WriteCommand(0x18);
-LCD_WriteData(0x70);
-
-// 系统配置命令
-LCD_WriteCommand(0x1A);
-LCD_WriteData(0x22);
-LCD_WriteData(0xBB);
-LCD_WriteData(0xAA);
-LCD_WriteData(0xFF);
-LCD_WriteData(0x24);
-LCD_WriteData(0x71);
-LCD_WriteData(0x0F);
-LCD_WriteData(0x01);
-LCD_WriteData(0x00);
-LCD_WriteData(0x03);
-
-// 返回主页面（页面0）
-LCD_WriteCommand(0xFE); 
-LCD_WriteData(0x00);
-
-// 设置扫描方向，实现上下对调左右翻转
-LCD_WriteCommand(0x36);
-LCD_WriteData(LCD_MADCTL_INIT_VALUE);
-
-// 设置像素格式为16位（5-6-5）RGB格式
-LCD_WriteCommand(0x3A); 
-LCD_WriteData(0x55);  // 16位像素格式
-
-// 设置DSPI模式
-LCD_WriteCommand(0xC4); 
-LCD_WriteData(0x80);  // 启用DSPI模式
-
-// 设置列地址（X方向显示区域）
-LCD_WriteCommand(0x2A);
-LCD_WriteData(0x00);  // 起始列地址高字节
-LCD_WriteData(0x00);  // 起始列地址低字节
-LCD_WriteData(0x00);  // 结束列地址高字节
-LCD_WriteData(0x7D);  // 结束列地址低字节（125列）
-
-// 设置页地址（Y方向显示区域）
-LCD_WriteCommand(0x2B);
-LCD_WriteData(0x00);  // 起始页地址高字节
-LCD_WriteData(0x00);  // 起始页地址低字节
-LCD_WriteData(0x01);  // 结束页地址高字节
-LCD_WriteData(0x25);  // 结束页地址低字节（293行）
-
-// 关闭撕裂效应输出
-LCD_WriteCommand(0x35); 
-LCD_WriteData(0x00);  // 撕裂效应关闭
-
-// 设置背光控制
-LCD_WriteCommand(0x53); 
-LCD_WriteData(0x28);  // 背光控制参数
-
-// 设置显示亮度（最大亮度）
-LCD_WriteCommand(0x51); 
-LCD_WriteData(0xFF);  // 亮度值（0x00-0xFF）
-
-// 退出睡眠模式（唤醒显示器）
-LCD_WriteCommand(0x11);  // SLPOUT命令
-HAL_Delay(120);         // 等待120ms确保电源稳定
-
-// 开启显示
-LCD_WriteCommand(0x29);  // DISPON命令
-HAL_Delay(1);           // 短暂延迟确保命令执行
-
+    // JD9613初始化序列（逐条命令单次片选发送，参数连续突发）
+    LCD_WriteCommandTable(s_jd9613_init_cmds, sizeof(s_jd9613_init_cmds));
 }
 
 /**
@@ -1266,22 +1050,24 @@ HAL_Delay(1);           // 短暂延迟确保命令执行
   */
 void LCD_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
-    // 设置列地址 (X坐标) 的命令和参数序列需要根据JD9613数据手册
-    LCD_WriteCommand(0x2A); // 列地址设置命令 (假设)
-    LCD_WriteData(x0 >> 8);
-    LCD_WriteData(x0 & 0xFF);
-    LCD_WriteData(x1 >> 8);
-    LCD_WriteData(x1 & 0xFF);
-
-    // 设置页地址 (Y坐标) 的命令和参数序列需要根据JD9613数据手册
-    LCD_WriteCommand(0x2B); // 页地址设置命令 (假设)
-    LCD_WriteData(y0 >> 8);
-    LCD_WriteData(y0 & 0xFF);
-    LCD_WriteData(y1 >> 8);
-    LCD_WriteData(y1 & 0xFF);
+    uint8_t params[4];
+
+    // 设置列地址 (X坐标)：一次片选发送命令和4个参数
+    params[0] = x0 >> 8;
+    params[1] = x0 & 0xFF;
+    params[2] = x1 >> 8;
+    params[3] = x1 & 0xFF;
+    LCD_WriteCommandWithParams(0x2A, params, 4);
+
+    // 设置页地址 (Y坐标)
+    params[0] = y0 >> 8;
+    params[1] = y0 & 0xFF;
+    params[2] = y1 >> 8;
+    params[3] = y1 & 0xFF;
+    LCD_WriteCommandWithParams(0x2B, params, 4);
 
     // 发送写入GRAM的命令
-    LCD_WriteCommand(0x2C); // 写GRAM命令 (假设)
+    LCD_WriteCommandWithParams(0x2C, 0, 0);
 }
 
 /**
@@ -1291,17 +1077,7 @@ void LCD_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
   */
 void LCD_Clear(uint16_t color)
 {
-    uint32_t index;
-    uint32_t total_pixels = LCD_WIDTH * LCD_HEIGHT;
-
-    // 设置全屏为窗口
-    LCD_SetWindow(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
-
-    // 发送写GRAM命令后，连续写入颜色值
-    for (index = 0; index < total_pixels; index++)
-    {
-        LCD_WriteData16(color);
-    }
+    LCD_FillRect(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1, color);
 }
 
 /**
@@ -1316,15 +1092,32 @@ void LCD_FillRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t c
     uint32_t index;
     uint32_t width = x1 - x0 + 1;
     uint32_t height = y1 - y0 + 1;
-    uint32_t total_pixels = width * height;
+    uint32_t total_bytes = width * height * 2;
+    uint32_t fill_bytes;
 
-    // 设置矩形区域为窗口
+    // 设置矩形区域为窗口（内部会等待上一次异步传输结束，之后才能改写缓冲区）
     LCD_SetWindow(x0, y0, x1, y1);
 
-    // 连续写入颜色值填充矩形
-    for (index = 0; index < total_pixels; index++)
+#if LCD_USE_DMA
+    // 整块区域一次DMA突发发送，CPU立即返回
+    if (LCD_DMA_StartFill(color, width * height)) {
+        return;
+    }
+#endif
+
+    // DMA不可用：用颜色值填满DMA缓冲区（高字节在前），然后反复发送同一缓冲区
+    fill_bytes = (total_bytes > LCD_DMA_BUFFER_SIZE) ? LCD_DMA_BUFFER_SIZE : total_bytes;
+    for (index = 0; index < fill_bytes; index += 2)
+    {
+        s_lcd_dma_buffer[0][index] = (color >> 8) & 0xFF;
+        s_lcd_dma_buffer[0][index + 1] = color & 0xFF;
+    }
+
+    while (total_bytes > 0)
     {
-        LCD_WriteData16(color);
+        uint32_t chunk = (total_bytes > fill_bytes) ? fill_bytes : total_bytes;
+        (void)LCD_WriteBytesAsync(s_lcd_dma_buffer[0], chunk);
+        total_bytes -= chunk;
     }
 }
 
@@ -1374,6 +1167,7 @@ static void LCD_WritePixels_Bulk(const uint16_t *data, uint32_t size)
     
     if (size == 0) return;
     
+    LCD_WaitIdle();
     HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
     HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
     
@@ -1451,24 +1245,12 @@ void LCD_ShowPartialImage(uint16_t x, uint16_t y, uint16_t width, uint16_t heigh
 void LCD_ShowImageBytes(const uint8_t *img_bytes)
 {
     uint32_t total_bytes = LCD_WIDTH * LCD_HEIGHT * 2;
-    uint32_t sent_bytes = 0;
-    uint16_t chunk_size;
     
     // 设置全屏为窗口
     LCD_SetWindow(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
     
-    HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-    HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-    
-    // 分段发送数据（SPI TSIZE最大65535）
-    while (sent_bytes < total_bytes)
-    {
-        chunk_size = (total_bytes - sent_bytes > 60000) ? 60000 : (uint16_t)(total_bytes - sent_bytes);
-        (void)SPI1_TX_WithFallback(img_bytes + sent_bytes, chunk_size);
-        sent_bytes += chunk_size;
-    }
-    
-    HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+    // 超过TSIZE上限的部分由DMA中断自动分段续传
+    (void)LCD_WriteBytesAsync(img_bytes, total_bytes);
 }
 
 /**
@@ -1487,8 +1269,6 @@ void LCD_ShowPartialImageBytes(uint16_t x, uint16_t y, uint16_t width, uint16_t
 {
     uint16_t x1, y1;
     uint32_t total_bytes;
-    uint32_t sent_bytes = 0;
-    uint16_t chunk_size;
     
     // 边界检查，确保不超出屏幕范围
     if (x >= LCD_WIDTH || y >= LCD_HEIGHT) return;
@@ -1503,18 +1283,8 @@ void LCD_ShowPartialImageBytes(uint16_t x, uint16_t y, uint16_t width, uint16_t
     // 计算实际字节数量
     total_bytes = (x1 - x + 1) * (y1 - y + 1) * 2;
     
-    HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-    HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-    
-    // 分段发送数据（SPI TSIZE最大65535）
-    while (sent_bytes < total_bytes)
-    {
-        chunk_size = (total_bytes - sent_bytes > 60000) ? 60000 : (uint16_t)(total_bytes - sent_bytes);
-        (void)SPI1_TX_WithFallback(img_bytes + sent_bytes, chunk_size);
-        sent_bytes += chunk_size;
-    }
-    
-    HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+    // 图片数据位于FLASH时走DMA，函数立即返回
+    (void)LCD_WriteBytesAsync(img_bytes, total_bytes);
 }
 
 /**
@@ -1532,6 +1302,7 @@ void LCD_ShowImageBytesOrder(const uint8_t *img_bytes, uint8_t byte_order)
     // 设置全屏为窗口
     LCD_SetWindow(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
     
+    LCD_WaitIdle();
     HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
     HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
     
@@ -1555,30 +1326,254 @@ void LCD_ShowImageBytesOrder(const uint8_t *img_bytes, uint8_t byte_order)
     HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
 }
 
+/* 4位灰度转RGB565（灰度值反转：0为白色RGB(31,63,31)，15为黑色），R、G、B按 值×max/15 线性映射 */
+#define LCD_GRAY_INV(g)         (15U - (g))
+#define LCD_GRAY_RGB565(g)      ((((LCD_GRAY_INV(g) * 31U) / 15U) << 11) | \
+                                 (((LCD_GRAY_INV(g) * 63U) / 15U) << 5) | \
+                                 ((LCD_GRAY_INV(g) * 31U) / 15U))
+/* 交换字节：小端存储后内存中为[高字节][低字节]，可直接发送 */
+#define LCD_GRAY_RGB565_BE(g)   (((LCD_GRAY_RGB565(g) >> 8) & 0xFFU) | ((LCD_GRAY_RGB565(g) & 0xFFU) << 8))
+/* 一个字节两个像素：高4位像素在低半字（先发送），低4位像素在高半字 */
+#define LCD_GRAY_PAIR(b)        (LCD_GRAY_RGB565_BE((uint32_t)(b) >> 4) | (LCD_GRAY_RGB565_BE((uint32_t)(b) & 0x0FU) << 16))
+#define LCD_GRAY_PAIR_ROW(h)    LCD_GRAY_PAIR((h) * 16U + 0U),  LCD_GRAY_PAIR((h) * 16U + 1U),  \
+                                LCD_GRAY_PAIR((h) * 16U + 2U),  LCD_GRAY_PAIR((h) * 16U + 3U),  \
+                                LCD_GRAY_PAIR((h) * 16U + 4U),  LCD_GRAY_PAIR((h) * 16U + 5U),  \
+                                LCD_GRAY_PAIR((h) * 16U + 6U),  LCD_GRAY_PAIR((h) * 16U + 7U),  \
+                                LCD_GRAY_PAIR((h) * 16U + 8U),  LCD_GRAY_PAIR((h) * 16U + 9U),  \
+                                LCD_GRAY_PAIR((h) * 16U + 10U), LCD_GRAY_PAIR((h) * 16U + 11U), \
+                                LCD_GRAY_PAIR((h) * 16U + 12U), LCD_GRAY_PAIR((h) * 16U + 13U), \
+                                LCD_GRAY_PAIR((h) * 16U + 14U), LCD_GRAY_PAIR((h) * 16U + 15U)
+
+/* 256项查找表：一个16灰度字节 -> 两个已交换字节序的RGB565像素（编译期生成） */
+static const uint32_t s_lcd_gray_pair_lut[256] =
+{
+    LCD_GRAY_PAIR_ROW(0U),  LCD_GRAY_PAIR_ROW(1U),  LCD_GRAY_PAIR_ROW(2U),  LCD_GRAY_PAIR_ROW(3U),
+    LCD_GRAY_PAIR_ROW(4U),  LCD_GRAY_PAIR_ROW(5U),  LCD_GRAY_PAIR_ROW(6U),  LCD_GRAY_PAIR_ROW(7U),
+    LCD_GRAY_PAIR_ROW(8U),  LCD_GRAY_PAIR_ROW(9U),  LCD_GRAY_PAIR_ROW(10U), LCD_GRAY_PAIR_ROW(11U),
+    LCD_GRAY_PAIR_ROW(12U), LCD_GRAY_PAIR_ROW(13U), LCD_GRAY_PAIR_ROW(14U), LCD_GRAY_PAIR_ROW(15U)
+};
+
 /**
-  * @brief  将4位灰度值转换为RGB565格式
-  * @param  gray_4bit: 4位灰度值（0-15）
-  * @retval RGB565格式的16位颜色值
-  * @note   将16级灰度线性映射到RGB565，使用相同的R、G、B值
-  *         灰度值反转：灰度值0映射到RGB(31,63,31)白色，灰度值15映射到RGB(0,0,0)黑色
+  * @brief  将一段16灰度数据展开为RGB565（高字节在前）
+  * @param  dst: 输出缓冲区（pixels×2 字节，需4字节对齐）
+  * @param  src: 16灰度数据，从偶数像素开始（高4位为第一个像素）
+  * @param  pixels: 像素数量，为奇数时只取最后一个字节的高4位
+  * @retval None
+  * @note   每个源字节查表一次并以32位写出两个像素，4字节一组展开循环
   */
-static uint16_t LCD_Convert16GrayToRGB565(uint8_t gray_4bit)
+ITCM_CODE static void LCD_ConvertGrayStrip(uint8_t *dst, const uint8_t *src, uint32_t pixels)
 {
-    // 反转灰度值：0→15, 1→14, ..., 15→0
-    uint8_t inverted_gray = 15 - gray_4bit;
-    
-    // 将反转后的4位灰度值（0-15）线性映射到RGB565的5-6-5位
-    // 使用线性插值：gray_value * (max_value / 15)
-    uint8_t r = (inverted_gray * 31) / 15;  // R: 0-31 (5位)
-    uint8_t g = (inverted_gray * 63) / 15;  // G: 0-63 (6位)
-    uint8_t b = (inverted_gray * 31) / 15;  // B: 0-31 (5位)
-    
-    // 组合成RGB565格式：R(5位) + G(6位) + B(5位)
-    uint16_t rgb565 = ((uint16_t)r << 11) |  // R: 5位，最高位
-                      ((uint16_t)g << 5) |    // G: 6位，中间
-                      (uint16_t)b;           // B: 5位，最低位
-    
-    return rgb565;
+    uint32_t *dst32 = (uint32_t *)dst;
+    uint32_t pairs = pixels / 2U;
+
+    while (pairs >= 4U)
+    {
+        dst32[0] = s_lcd_gray_pair_lut[src[0]];
+        dst32[1] = s_lcd_gray_pair_lut[src[1]];
+        dst32[2] = s_lcd_gray_pair_lut[src[2]];
+        dst32[3] = s_lcd_gray_pair_lut[src[3]];
+        dst32 += 4;
+        src += 4;
+        pairs -= 4U;
+    }
+    while (pairs > 0U)
+    {
+        *dst32++ = s_lcd_gray_pair_lut[*src++];
+        pairs--;
+    }
+
+    if ((pixels & 1U) != 0U)
+    {
+        /* 奇数像素：只写低半字（高4位像素） */
+        *(uint16_t *)dst32 = (uint16_t)s_lcd_gray_pair_lut[*src];
+    }
+}
+
+#if LCD_USE_DMA && LCD_USE_DMA2D
+/**
+  * @brief  初始化DMA2D并装载灰度CLUT
+  * @note   CLUT为s_lcd_gray_pair_lut（256项ARGB8888），装载一次后常驻DMA2D内部
+  * @retval None
+  */
+static void LCD_DMA2D_Init(void)
+{
+  uint32_t start = HAL_GetTick();
+
+  __HAL_RCC_DMA2D_CLK_ENABLE();
+
+  DMA2D->CR = 0U;
+  DMA2D->IFCR = 0x3FU;
+  DMA2D->FGCMAR = (uint32_t)s_lcd_gray_pair_lut;
+  DMA2D->FGPFCCR = (255U << DMA2D_FGPFCCR_CS_Pos) | DMA2D_FGPFCCR_START;   /* CCM=0：CLUT为ARGB8888 */
+  while ((DMA2D->ISR & DMA2D_ISR_CTCIF) == 0U)
+  {
+    if ((DMA2D->ISR & DMA2D_ISR_CAEIF) != 0U || (HAL_GetTick() - start) > 10U) {
+      return;     /* CLUT装载失败，始终使用CPU转换 */
+    }
+  }
+  DMA2D->IFCR = DMA2D_IFCR_CCTCIF;
+
+  HAL_NVIC_SetPriority(LCD_DMA2D_IRQn, 2, 0);   /* 与SPI中断同一抢占优先级，流水线状态不会被重入 */
+  HAL_NVIC_EnableIRQ(LCD_DMA2D_IRQn);
+
+  s_lcd_dma2d_ready = 1U;
+}
+
+/* 启动一段DMA2D转换：L8源（每字节一个CLUT索引）-> ARGB8888输出（每字节展开为两个RGB565像素） */
+static void LCD_Gray2D_StartConvert(void)
+{
+  lcd_gray2d_job_t *job = &s_lcd_gray2d;
+  uint32_t lines = (job->lines_left > job->lines_per_strip) ? job->lines_per_strip : job->lines_left;
+  uint8_t index = job->convert_index;
+
+  job->state[index] = LCD_GRAY2D_CONVERTING;
+  job->bytes[index] = lines * job->line_bytes * 4U;
+
+  DMA2D->CR = DMA2D_CR_MODE_0 | DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE;   /* 存储器到存储器并转换像素格式 */
+  DMA2D->FGMAR = (uint32_t)job->src;
+  DMA2D->FGOR = (uint32_t)(job->stride - job->line_bytes);
+  DMA2D->FGPFCCR = (255U << DMA2D_FGPFCCR_CS_Pos) | (5U << DMA2D_FGPFCCR_CM_Pos); /* L8，沿用已装载的CLUT */
+  DMA2D->OMAR = (uint32_t)s_lcd_dma_buffer[index];
+  DMA2D->OOR = 0U;
+  DMA2D->OPFCCR = 0U;                                                               /* ARGB8888，原样写出CLUT项 */
+  DMA2D->NLR = ((uint32_t)job->line_bytes << DMA2D_NLR_PL_Pos) | lines;
+  DMA2D->CR |= DMA2D_CR_START;
+
+  job->src += lines * job->stride;
+  job->lines_left -= lines;
+  s_lcd_strip_stats.strips++;
+  s_lcd_strip_stats.dma2d_strips++;
+}
+
+/* 推进流水线：按顺序发送已转换的缓冲区，空闲缓冲区用于转换下一段，全部发送完毕后结束 */
+static void LCD_Gray2D_Kick(void)
+{
+  lcd_gray2d_job_t *job = &s_lcd_gray2d;
+  uint8_t send = job->send_index;
+  uint8_t convert = job->convert_index;
+
+  if (!s_lcd_dma_busy && job->state[send] == LCD_GRAY2D_READY)
+  {
+    job->state[send] = LCD_GRAY2D_SENDING;
+    HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+    HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+    if (!LCD_DMA_StartBytes(s_lcd_dma_buffer[send], job->bytes[send])) {
+      LCD_Gray2D_Abort();
+      return;
+    }
+  }
+
+  if (job->lines_left > 0U && job->state[convert] == LCD_GRAY2D_FREE &&
+      job->state[convert ^ 1U] != LCD_GRAY2D_CONVERTING)
+  {
+    LCD_Gray2D_StartConvert();
+  }
+
+  if (job->lines_left == 0U &&
+      job->state[0] == LCD_GRAY2D_FREE && job->state[1] == LCD_GRAY2D_FREE)
+  {
+    s_lcd_gray2d_active = 0U;
+  }
+}
+
+/* 终止流水线（超时或出错），SPI传输由调用者另行处理 */
+static void LCD_Gray2D_Abort(void)
+{
+  if (!s_lcd_gray2d_active) {
+    return;
+  }
+  DMA2D->CR |= DMA2D_CR_ABORT;
+  while ((DMA2D->CR & DMA2D_CR_START) != 0U)
+  {
+  }
+  DMA2D->IFCR = 0x3FU;
+  s_lcd_gray2d.lines_left = 0U;
+  s_lcd_gray2d.state[0] = LCD_GRAY2D_FREE;
+  s_lcd_gray2d.state[1] = LCD_GRAY2D_FREE;
+  s_lcd_gray2d_active = 0U;
+}
+
+/**
+  * @brief  DMA2D中断：一段转换完成，交给SPI发送并启动下一段转换
+  * @retval None
+  */
+void LCD_DMA2D_IRQHandler(void)
+{
+  uint32_t isr = DMA2D->ISR;
+
+  DMA2D->IFCR = isr & 0x3FU;
+  if ((isr & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF)) != 0U) {
+    LCD_Gray2D_Abort();
+    return;
+  }
+  if ((isr & DMA2D_ISR_TCIF) != 0U && s_lcd_gray2d_active) {
+    s_lcd_gray2d.state[s_lcd_gray2d.convert_index] = LCD_GRAY2D_READY;
+    s_lcd_gray2d.convert_index ^= 1U;
+    LCD_Gray2D_Kick();
+  }
+}
+
+/**
+  * @brief  用DMA2D流水线显示16灰度数据（窗口需已设置）
+  * @param  src: 源数据（DMA2D可访问的存储器）
+  * @param  line_bytes: 每行源字节数（像素数/2）
+  * @param  stride: 源数据行跨度（字节）
+  * @param  lines: 行数
+  * @retval 1：已启动，立即返回，源数据在后台读取  0：不可用，需CPU转换
+  * @note   源数据为FLASH中的常量时无需等待；调用者要改写源缓冲区时先调用LCD_WaitSourceRead()
+  */
+static uint8_t LCD_ShowGray2D(const uint8_t *src, uint32_t line_bytes, uint32_t stride, uint32_t lines)
+{
+  lcd_gray2d_job_t *job = &s_lcd_gray2d;
+
+  if (!s_lcd_dma2d_ready || !s_lcd_dma_ready || !LCD_DMA_IsAddressable(src) ||
+      line_bytes == 0U || line_bytes * 4U > LCD_GRAY_STRIP_BYTES || line_bytes > 0x3FFFU)
+  {
+    return 0;
+  }
+
+  /* DMA2D直接读存储器：CPU刚写入的源数据（如RAM中解压出的图块）需先写回 */
+  dma_buf_clean(src, lines * stride);
+
+  job->src = src;
+  job->line_bytes = (uint16_t)line_bytes;
+  job->stride = (uint16_t)stride;
+  job->lines_left = lines;
+  job->lines_per_strip = LCD_GRAY_STRIP_BYTES / (line_bytes * 4U);
+  job->state[0] = LCD_GRAY2D_FREE;
+  job->state[1] = LCD_GRAY2D_FREE;
+  job->convert_index = 0U;
+  job->send_index = 0U;
+
+  HAL_NVIC_DisableIRQ(LCD_DMA2D_IRQn);
+  s_lcd_gray2d_active = 1U;
+  LCD_Gray2D_StartConvert();
+  HAL_NVIC_EnableIRQ(LCD_DMA2D_IRQn);
+  return 1;
+}
+#endif
+
+/**
+  * @brief  等待DMA2D读完上一次灰度显示的源数据（发送仍在后台进行）
+  * @note   LCD_ShowPartialImage16Gray*交给DMA2D后立即返回，调用者改写同一源缓冲区前调用；
+  *         超时后终止传输
+  * @retval None
+  */
+void LCD_WaitSourceRead(void)
+{
+#if LCD_USE_DMA && LCD_USE_DMA2D
+  uint32_t start = HAL_GetTick();
+
+  while (s_lcd_gray2d_active &&
+         (s_lcd_gray2d.lines_left > 0U ||
+          s_lcd_gray2d.state[0] == LCD_GRAY2D_CONVERTING || s_lcd_gray2d.state[1] == LCD_GRAY2D_CONVERTING))
+  {
+    if ((HAL_GetTick() - start) > LCD_DMA_TIMEOUT_MS) {
+      LCD_WaitIdle();
+      break;
+    }
+  }
+#endif
 }
 
 /**
@@ -1593,78 +1588,247 @@ static uint16_t LCD_Convert16GrayToRGB565(uint8_t gray_4bit)
   *         字节顺序：[高字节][低字节]格式
   *         16灰度值（0-15）会自动转换为RGB565格式显示
   *         用于在屏幕指定位置显示任意尺寸的16灰度图片，适合UI绘制
-  *         实现方式：使用批量转换和分段传输，提高传输效率
+  *         实现方式：乒乓缓冲流水线，CPU转换下一段的同时DMA发送上一段，
+  *         整屏刷新耗时约为 max(转换, 发送) 而不是两者之和；最后一段发出后立即返回
+  *         DMA2D转换时源数据在返回后仍被读取，改写img_bytes前需调用LCD_WaitSourceRead()
   */
 void LCD_ShowPartialImage16Gray(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *img_bytes)
 {
     uint16_t x1, y1;
     uint32_t total_pixels;
-    uint32_t byte_index;
-    uint8_t gray_high, gray_low;
-    uint16_t rgb565_value;
+    uint32_t strip_pixels;
+    uint32_t start_cycles;
+    uint32_t cycles;
+    uint8_t buffer_index = 0;
     
     // 边界检查，确保不超出屏幕范围
     if (x >= LCD_WIDTH || y >= LCD_HEIGHT) return;
+
+    PROF_ZONE_BEGIN(PROF_ZONE_LCD_GRAY16);
     
     // 计算实际显示区域（限制在屏幕范围内）
     x1 = (x + width - 1 < LCD_WIDTH) ? (x + width - 1) : (LCD_WIDTH - 1);
     y1 = (y + height - 1 < LCD_HEIGHT) ? (y + height - 1) : (LCD_HEIGHT - 1);
     
-    // 设置显示窗口
+    // 设置显示窗口（内部等待上一次异步传输结束，两块缓冲区此时均空闲）
     LCD_SetWindow(x, y, x1, y1);
     
     // 计算实际像素数量
     total_pixels = (x1 - x + 1) * (y1 - y + 1);
+
+#if LCD_USE_DMA && LCD_USE_DMA2D
+    // 宽度为偶数时整块交给DMA2D（每行源字节连续存放）
+    if (((x1 - x + 1U) & 1U) == 0U &&
+        LCD_ShowGray2D(img_bytes, (x1 - x + 1U) / 2U, (x1 - x + 1U) / 2U, (uint32_t)(y1 - y + 1U)))
+    {
+        PROF_ZONE_END(PROF_ZONE_LCD_GRAY16);
+        return;
+    }
+#endif
     
-    // 计算16灰度数据的总字节数（每个字节包含2个像素）
-    uint32_t total_gray_bytes = (total_pixels + 1) / 2;
-    
-    // 使用缓冲区批量转换和传输
-    // 缓冲区大小：每次处理最多30000字节（约15000像素，30000字节RGB565数据）
-    #define CONVERSION_BUFFER_SIZE 30000
-    static uint8_t rgb565_buffer[CONVERSION_BUFFER_SIZE];
-    uint32_t converted_bytes = 0;
-    uint16_t chunk_size;
-    
-    HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-    HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-    
-    // 批量转换16灰度数据为RGB565格式并发送
-    for (byte_index = 0; byte_index < total_gray_bytes; byte_index++)
+    while (total_pixels > 0U)
     {
-        // 读取一个字节（包含2个4位灰度值）
-        uint8_t byte_data = img_bytes[byte_index];
-        
-        // 提取高4位和低4位灰度值
-        gray_high = (byte_data >> 4) & 0x0F;  // 高4位（第一个像素）
-        gray_low = byte_data & 0x0F;           // 低4位（第二个像素）
-        
-        // 转换为RGB565格式并存储到缓冲区（高字节在前，低字节在后）
-        rgb565_value = LCD_Convert16GrayToRGB565(gray_high);
-        rgb565_buffer[converted_bytes++] = (rgb565_value >> 8) & 0xFF;  // 高字节
-        rgb565_buffer[converted_bytes++] = rgb565_value & 0xFF;         // 低字节
-        
-        // 如果还有第二个像素需要处理
-        if ((byte_index * 2 + 1) < total_pixels) {
-            rgb565_value = LCD_Convert16GrayToRGB565(gray_low);
-            rgb565_buffer[converted_bytes++] = (rgb565_value >> 8) & 0xFF;  // 高字节
-            rgb565_buffer[converted_bytes++] = rgb565_value & 0xFF;         // 低字节
+        strip_pixels = (total_pixels > (LCD_GRAY_STRIP_BYTES / 2U)) ? (LCD_GRAY_STRIP_BYTES / 2U) : total_pixels;
+
+        // 转换到当前缓冲区：另一块可能仍在DMA发送中
+        start_cycles = DWT->CYCCNT;
+        LCD_ConvertGrayStrip(s_lcd_dma_buffer[buffer_index], img_bytes, strip_pixels);
+        cycles = DWT->CYCCNT - start_cycles;
+
+        s_lcd_strip_stats.strips++;
+        s_lcd_strip_stats.convert_cycles_last = cycles;
+        s_lcd_strip_stats.convert_cycles_total += cycles;
+        if (cycles > s_lcd_strip_stats.convert_cycles_max) {
+            s_lcd_strip_stats.convert_cycles_max = cycles;
         }
-        
-        // 当缓冲区满或处理完所有数据时，批量发送
-        if (converted_bytes >= CONVERSION_BUFFER_SIZE || (byte_index + 1) >= total_gray_bytes)
+
+        // 等待上一段发送完毕后启动本段（段长为偶数像素，源数据按整字节推进）
+        start_cycles = DWT->CYCCNT;
+        LCD_WaitIdle();
+        s_lcd_strip_stats.wait_cycles_total += DWT->CYCCNT - start_cycles;
+        (void)LCD_WriteBytesAsync(s_lcd_dma_buffer[buffer_index], strip_pixels * 2U);
+
+        img_bytes += strip_pixels / 2U;
+        total_pixels -= strip_pixels;
+        buffer_index ^= 1U;
+    }
+
+    PROF_ZONE_END(PROF_ZONE_LCD_GRAY16);
+}
+
+/**
+  * @brief  显示16灰度图片中的一个子矩形（源数据每行跨度可大于显示宽度）
+  * @param  x: 显示位置的X坐标起点
+  * @param  y: 显示位置的Y坐标起点
+  * @param  width: 子矩形宽度（像素，必须为偶数）
+  * @param  height: 子矩形高度（像素）
+  * @param  img_bytes: 子矩形左上角所在字节（该像素需位于字节高4位）
+  * @param  stride: 源图片每行字节数
+  * @retval None
+  * @note   用于局部刷新：只发送整幅图片中变化的区域，流水线方式同LCD_ShowPartialImage16Gray
+  */
+void LCD_ShowPartialImage16GrayStride(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                      const uint8_t *img_bytes, uint16_t stride)
+{
+    uint16_t x1, y1;
+    uint32_t row_bytes;
+    uint32_t rows_per_strip;
+    uint32_t rows_left;
+    uint32_t strip_rows;
+    uint32_t row;
+    uint8_t buffer_index = 0;
+
+    if (x >= LCD_WIDTH || y >= LCD_HEIGHT || width == 0U || (width & 1U) != 0U) return;
+
+    // 计算实际显示区域（限制在屏幕范围内，宽度保持偶数）
+    x1 = (x + width - 1 < LCD_WIDTH) ? (x + width - 1) : (LCD_WIDTH - 1);
+    y1 = (y + height - 1 < LCD_HEIGHT) ? (y + height - 1) : (LCD_HEIGHT - 1);
+    if (((x1 - x + 1U) & 1U) != 0U) {
+        if (x1 == x) return;
+        x1--;
+    }
+
+    LCD_SetWindow(x, y, x1, y1);
+
+    row_bytes = (uint32_t)(x1 - x + 1U) * 2U;
+    rows_per_strip = LCD_GRAY_STRIP_BYTES / row_bytes;
+    rows_left = (uint32_t)(y1 - y + 1U);
+
+#if LCD_USE_DMA && LCD_USE_DMA2D
+    if (LCD_ShowGray2D(img_bytes, row_bytes / 4U, stride, rows_left))
+    {
+        return;
+    }
+#endif
+
+    while (rows_left > 0U)
+    {
+        strip_rows = (rows_left > rows_per_strip) ? rows_per_strip : rows_left;
+
+        for (row = 0; row < strip_rows; row++)
+        {
+            LCD_ConvertGrayStrip(&s_lcd_dma_buffer[buffer_index][row * row_bytes], img_bytes, row_bytes / 2U);
+            img_bytes += stride;
+        }
+
+        LCD_WaitIdle();
+        (void)LCD_WriteBytesAsync(s_lcd_dma_buffer[buffer_index], strip_rows * row_bytes);
+
+        rows_left -= strip_rows;
+        buffer_index ^= 1U;
+    }
+}
+
+/* 用同一灰度填充count个RGB565像素（dst需2字节对齐），返回写入结束位置 */
+ITCM_CODE static uint8_t *LCD_FillGrayRun(uint8_t *dst, uint8_t gray, uint32_t count)
+{
+    uint32_t pair = s_lcd_gray_pair_lut[gray * 0x11U];
+    uint32_t *dst32;
+
+    if (count == 0U) return dst;
+
+    if (((uint32_t)dst & 2U) != 0U)
+    {
+        *(uint16_t *)dst = (uint16_t)pair;
+        dst += 2;
+        count--;
+    }
+
+    dst32 = (uint32_t *)dst;
+    while (count >= 2U)
+    {
+        *dst32++ = pair;
+        count -= 2U;
+    }
+    dst = (uint8_t *)dst32;
+
+    if (count != 0U)
+    {
+        *(uint16_t *)dst = (uint16_t)pair;
+        dst += 2;
+    }
+    return dst;
+}
+
+/**
+  * @brief  在指定位置显示RLE压缩的16灰度图片
+  * @param  x: 显示位置的X坐标起点
+  * @param  y: 显示位置的Y坐标起点
+  * @param  image: 压缩图片（格式见image_rle.h）
+  * @retval None
+  * @note   边解码边按游程直接填充RGB565，无需先解压整幅图片；
+  *         超出屏幕的部分在解码时跳过，流水线方式同LCD_ShowPartialImage16Gray
+  */
+void LCD_ShowImage16GrayRle(uint16_t x, uint16_t y, const image_rle_t *image)
+{
+    image_rle_reader_t reader;
+    uint16_t x1, y1;
+    uint32_t visible_width;
+    uint32_t skip_width;
+    uint32_t rows_per_strip;
+    uint32_t rows_left;
+    uint32_t strip_rows;
+    uint32_t row;
+    uint32_t start_cycles;
+    uint32_t cycles;
+    uint8_t buffer_index = 0;
+
+    if (image == 0 || image->width == 0U || image->height == 0U) return;
+    if (x >= LCD_WIDTH || y >= LCD_HEIGHT) return;
+
+    x1 = (x + image->width - 1 < LCD_WIDTH) ? (x + image->width - 1) : (LCD_WIDTH - 1);
+    y1 = (y + image->height - 1 < LCD_HEIGHT) ? (y + image->height - 1) : (LCD_HEIGHT - 1);
+
+    LCD_SetWindow(x, y, x1, y1);
+
+    visible_width = (uint32_t)(x1 - x + 1U);
+    skip_width = image->width - visible_width;
+    rows_per_strip = LCD_GRAY_STRIP_BYTES / (visible_width * 2U);
+    rows_left = (uint32_t)(y1 - y + 1U);
+
+    image_rle_reader_init(&reader, image);
+
+    while (rows_left > 0U)
+    {
+        uint8_t *dst = s_lcd_dma_buffer[buffer_index];
+
+        strip_rows = (rows_left > rows_per_strip) ? rows_per_strip : rows_left;
+
+        start_cycles = DWT->CYCCNT;
+        for (row = 0; row < strip_rows; row++)
         {
-            // 分段发送数据（SPI TSIZE最大65535）
-            uint32_t buffer_sent = 0;
-            while (buffer_sent < converted_bytes)
+            uint32_t pixels = visible_width;
+            uint8_t gray = 0U;
+
+            while (pixels > 0U)
             {
-                chunk_size = (converted_bytes - buffer_sent > 60000) ? 60000 : (uint16_t)(converted_bytes - buffer_sent);
-                (void)SPI1_TX_WithFallback(rgb565_buffer + buffer_sent, chunk_size);
-                buffer_sent += chunk_size;
+                uint32_t count = image_rle_read_run(&reader, pixels, &gray);
+                if (count == 0U)
+                {
+                    // 数据不完整：剩余像素按灰度0填充
+                    gray = 0U;
+                    count = pixels;
+                }
+                dst = LCD_FillGrayRun(dst, gray, count);
+                pixels -= count;
             }
-            converted_bytes = 0;  // 重置缓冲区计数器
+            image_rle_skip(&reader, skip_width);
         }
+        cycles = DWT->CYCCNT - start_cycles;
+
+        s_lcd_strip_stats.strips++;
+        s_lcd_strip_stats.convert_cycles_last = cycles;
+        s_lcd_strip_stats.convert_cycles_total += cycles;
+        if (cycles > s_lcd_strip_stats.convert_cycles_max) {
+            s_lcd_strip_stats.convert_cycles_max = cycles;
+        }
+
+        start_cycles = DWT->CYCCNT;
+        LCD_WaitIdle();
+        s_lcd_strip_stats.wait_cycles_total += DWT->CYCCNT - start_cycles;
+        (void)LCD_WriteBytesAsync(s_lcd_dma_buffer[buffer_index], strip_rows * visible_width * 2U);
+
+        rows_left -= strip_rows;
+        buffer_index ^= 1U;
     }
-    
-    HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
 }
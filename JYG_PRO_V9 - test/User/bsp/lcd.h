@@ -7,6 +7,7 @@ extern "C" {
 
 /* 包含必要的头文件 */
 #include "./SYSTEM/sys/sys.h"
+#include "image_rle.h"
 
 /* 屏幕分辨率定义 (请根据您的JD9613屏幕实际参数修改) */
 #define LCD_WIDTH   126
@@ -62,10 +63,74 @@ extern "C" {
 #define LCD_SPI_PRESCALER  SPI_BAUDRATEPRESCALER_32  // 6.875MHz，JD9613推荐频率
 #endif
 
+/* SPI1发送DMA配置（DMA1_Stream0，经DMAMUX映射到SPI1_TX请求）
+ * 1：大块像素数据走DMA发送，CPU立即返回主循环  0：全部使用轮询发送
+ */
+#ifndef LCD_USE_DMA
+#define LCD_USE_DMA        1
+#endif
+
+#define LCD_DMA_STREAM             DMA1_Stream0
+#define LCD_DMA_REQUEST            DMA_REQUEST_SPI1_TX
+#define LCD_DMA_IRQn               DMA1_Stream0_IRQn
+#define LCD_DMA_IRQHandler         DMA1_Stream0_IRQHandler
+#define LCD_DMA_CLK_ENABLE()       do{ __HAL_RCC_DMA1_CLK_ENABLE(); }while(0)
+#define LCD_SPI_IRQn               SPI1_IRQn
+#define LCD_SPI_IRQHandler         SPI1_IRQHandler
+
+#define LCD_DMA_MIN_BYTES          64U      /* 小于该长度仍走轮询发送，DMA启动开销不划算 */
+#define LCD_DMA_MAX_CHUNK          60000U   /* 单段DMA长度（字节，纯色填充时为像素；SPI TSIZE最大65535），超长数据在中断中自动续传 */
+#define LCD_DMA_TIMEOUT_MS         1000U
+
+/* DMA1无法访问DTCM(0x20000000)，而链接器默认把全部RW/ZI放在DTCM，
+ * 因此DMA用的像素缓冲区从AXI SRAM中的不可缓存DMA缓冲池分配（见dma_buf.h）
+ */
+#define LCD_DMA_BUFFER_SIZE        30000U   /* 单个缓冲区字节数 */
+#define LCD_DMA_BUFFER_COUNT       2U       /* 乒乓缓冲：CPU转换一块的同时DMA发送另一块 */
+
+/* 16灰度图片每段转换的RGB565字节数（需为4的倍数且不超过LCD_DMA_BUFFER_SIZE）
+ * 段越小首段转换等待越短，但每段多一次DMA启动开销；默认8064字节=全宽32行
+ */
+#ifndef LCD_GRAY_STRIP_BYTES
+#define LCD_GRAY_STRIP_BYTES       8064U
+#endif
+
+/* DMA2D展开16灰度（需LCD_USE_DMA）：
+ * 以L8格式把每个源字节作为索引，查256项ARGB8888 CLUT（即两个已交换字节序的RGB565像素）输出32位，
+ * 与CPU查表结果逐位一致；L4格式的半字节顺序与图片数据相反，因此不直接使用L4
+ * DMA2D转换完成中断启动SPI发送，SPI发送完成后再启动下一段转换，CPU只负责启动
+ * 源数据位于DTCM/ITCM（DMA2D不可访问）或宽度为奇数时退回CPU转换
+ */
+#ifndef LCD_USE_DMA2D
+#define LCD_USE_DMA2D      LCD_USE_DMA
+#endif
+
+#define LCD_DMA2D_IRQn             DMA2D_IRQn
+#define LCD_DMA2D_IRQHandler       DMA2D_IRQHandler
+
+/* 16灰度转换流水线性能统计（DWT周期计数，CPU主频480MHz） */
+typedef struct
+{
+    uint32_t strips;                /* 已处理段数 */
+    uint32_t convert_cycles_last;   /* 最近一段转换耗时 */
+    uint32_t convert_cycles_max;    /* 单段转换最大耗时 */
+    uint32_t convert_cycles_total;  /* 转换累计耗时 */
+    uint32_t wait_cycles_total;     /* 等待DMA空闲累计耗时（转换比发送快时增长） */
+    uint32_t dma2d_strips;          /* 其中由DMA2D转换的段数 */
+} lcd_strip_stats_t;
+
+/* 命令表中参数个数字节的延时标志：参数后紧跟一个字节的延时（毫秒） */
+#define LCD_CMD_DELAY              0x80U
+
+/* 传输完成回调（在中断上下文中调用） */
+typedef void (*lcd_done_callback_t)(void);
+
 /* 函数声明 */
 void LCD_WriteCommand(uint8_t cmd);
 void LCD_WriteData(uint8_t data);
 void LCD_WriteData16(uint16_t data);
+void LCD_WriteCommandWithParams(uint8_t cmd, const uint8_t *params, uint8_t count);
+void LCD_WriteCommandTable(const uint8_t *table, uint32_t size);
 void LCD_Reset(void);
 void LCD_Init(void);
 void LCD_Clear(uint16_t color);
@@ -78,6 +143,18 @@ void LCD_ShowImageBytes(const uint8_t *img_bytes);
 void LCD_ShowPartialImageBytes(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *img_bytes);
 void LCD_ShowImageBytesOrder(const uint8_t *img_bytes, uint8_t byte_order);
 void LCD_ShowPartialImage16Gray(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *img_bytes);
+void LCD_ShowPartialImage16GrayStride(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                      const uint8_t *img_bytes, uint16_t stride);
+void LCD_ShowImage16GrayRle(uint16_t x, uint16_t y, const image_rle_t *image);
+uint8_t LCD_WriteBytesAsync(const uint8_t *pdata, uint32_t size);
+uint8_t LCD_IsBusy(void);
+void LCD_WaitIdle(void);
+void LCD_WaitSourceRead(void);
+void LCD_SetDoneCallback(lcd_done_callback_t callback);
+void LCD_GetStripStats(lcd_strip_stats_t *stats);
+void LCD_ResetStripStats(void);
+uint32_t LCD_GetTxByteCount(void);
+void LCD_ResetTxByteCount(void);
 
 #ifdef __cplusplus
 }
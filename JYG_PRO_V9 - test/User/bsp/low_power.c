@@ -0,0 +1,108 @@
+#include "low_power.h"
+
+static uint8_t s_low_power_initialized = 0U;
+static volatile uint8_t s_wakeup_expired = 0U;
+
+void low_power_init(void)
+{
+    if (s_low_power_initialized)
+    {
+        return;
+    }
+
+    __HAL_RCC_LSI_ENABLE();
+    while (__HAL_RCC_GET_FLAG(RCC_FLAG_LSIRDY) == 0U)
+    {
+    }
+
+    __HAL_RCC_LPTIM1_CONFIG(RCC_LPTIM1CLKSOURCE_LSI);
+    __HAL_RCC_LPTIM1_CLK_ENABLE();
+
+    LPTIM1->CR = 0U;
+    LPTIM1->CFGR = (5U << LPTIM_CFGR_PRESC_Pos);    /* 32分频 */
+    LPTIM1->IER = LPTIM_IER_ARRMIE;                 /* IER只能在LPTIM关闭时修改 */
+
+    EXTI_D1->IMR2 |= EXTI_IMR2_IM47;                /* LPTIM1唤醒线，STOP模式下唤醒CPU */
+    HAL_NVIC_SetPriority(LOW_POWER_LPTIM_IRQn, 3, 1);
+    HAL_NVIC_EnableIRQ(LOW_POWER_LPTIM_IRQn);
+
+    s_low_power_initialized = 1U;
+}
+
+void LOW_POWER_LPTIM_IRQHandler(void)
+{
+    if (LPTIM1->ISR & LPTIM_ISR_ARRM)
+    {
+        LPTIM1->ICR = LPTIM_ICR_ARRMCF;
+        s_wakeup_expired = 1U;
+    }
+}
+
+/* LPTIM计数器与总线时钟异步，需连续两次读到相同值 */
+static uint32_t low_power_read_counter(void)
+{
+    uint32_t first;
+    uint32_t second;
+
+    do
+    {
+        first = LPTIM1->CNT;
+        second = LPTIM1->CNT;
+    } while (first != second);
+
+    return second;
+}
+
+/**
+ * 休眠至多max_ms毫秒，期间SysTick暂停
+ * allow_stop为1时进入STOP模式（所有时钟停止，PWM等外设输出冻结），否则进入SLEEP模式
+ * 由任一EXTI事件/中断（按键、运动唤醒）或LPTIM1到期唤醒，醒来后按实际休眠时长补偿HAL时基
+ * 返回实际休眠的毫秒数
+ */
+uint32_t low_power_sleep(uint32_t max_ms, uint8_t allow_stop)
+{
+    uint32_t elapsed;
+
+    if (max_ms < LOW_POWER_MIN_SLEEP_MS)
+    {
+        return 0U;
+    }
+    if (max_ms > LOW_POWER_MAX_SLEEP_MS)
+    {
+        max_ms = LOW_POWER_MAX_SLEEP_MS;
+    }
+
+    if (!s_low_power_initialized)
+    {
+        low_power_init();
+    }
+
+    s_wakeup_expired = 0U;
+    LPTIM1->CR = LPTIM_CR_ENABLE;
+    LPTIM1->ICR = LPTIM_ICR_ARROKCF | LPTIM_ICR_ARRMCF;
+    LPTIM1->ARR = max_ms;
+    while ((LPTIM1->ISR & LPTIM_ISR_ARROK) == 0U)
+    {
+    }
+    LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+    LPTIM1->CR |= LPTIM_CR_SNGSTRT;
+
+    HAL_SuspendTick();
+    if (allow_stop)
+    {
+        HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFE);
+        (void)LOW_POWER_CLOCK_RESTORE();
+    }
+    else
+    {
+        HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFE);
+    }
+
+    elapsed = s_wakeup_expired ? max_ms : low_power_read_counter();
+    LPTIM1->CR = 0U;
+
+    uwTick += elapsed;
+    HAL_ResumeTick();
+
+    return elapsed;
+}
@@ -0,0 +1,19 @@
+#ifndef __LOW_POWER_H
+#define __LOW_POWER_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/* 唤醒定时使用LPTIM1，时钟源LSI(32kHz)经32分频，约1ms计数一次（LSI精度约±5%） */
+#define LOW_POWER_LPTIM_IRQn            LPTIM1_IRQn
+#define LOW_POWER_LPTIM_IRQHandler      LPTIM1_IRQHandler
+
+#define LOW_POWER_MIN_SLEEP_MS          20U       /* 短于该时间不进入休眠 */
+#define LOW_POWER_MAX_SLEEP_MS          60000U    /* 单次休眠上限（LPTIM为16位） */
+
+/* STOP模式唤醒后PLL关闭、系统时钟回到HSI，需按main()中的参数重新配置时钟 */
+#define LOW_POWER_CLOCK_RESTORE()       sys_stm32_clock_init(192, 5, 2, 4)
+
+void low_power_init(void);
+uint32_t low_power_sleep(uint32_t max_ms, uint8_t allow_stop);
+
+#endif
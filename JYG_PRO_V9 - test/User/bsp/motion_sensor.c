@@ -1,8 +1,12 @@
 #include "motion_sensor.h"
+#include "version.h"
+#include "./SYSTEM/delay/delay.h"
+#include "soft_i2c.h"
+#include "dma_buf.h"
+#include "profiler.h"
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
-#include <math.h>
 
 #define REG_DEVICE_CONFIG           0x11U
 #define REG_WHO_AM_I                0x75U
@@ -10,12 +14,65 @@
 #define REG_GYRO_CONFIG0            0x4FU
 #define REG_ACCEL_CONFIG0           0x50U
 #define REG_ACCEL_DATA_X1           0x1FU
+#define REG_INT_CONFIG              0x14U
+#define REG_INT_CONFIG1             0x64U
+#define REG_INT_SOURCE0             0x65U
+#define REG_FIFO_CONFIG             0x16U
+#define REG_FIFO_COUNTH             0x2EU
+#define REG_FIFO_DATA               0x30U
+#define REG_SIGNAL_PATH_RESET       0x4BU
+#define REG_INTF_CONFIG0            0x4CU
+#define REG_FIFO_CONFIG1            0x5FU
+#define REG_FIFO_CONFIG2            0x60U
+#define REG_FIFO_CONFIG3            0x61U
+#define REG_INT_STATUS2             0x37U
+#define REG_SMD_CONFIG              0x57U
+#define REG_INT_SOURCE1             0x66U
+#define REG_BANK_SEL                0x76U
+#define REG_B4_ACCEL_WOM_X_THR      0x4AU   /* Bank 4 */
+#define REG_B4_ACCEL_WOM_Y_THR      0x4BU
+#define REG_B4_ACCEL_WOM_Z_THR      0x4CU
+
+#define INT_CONFIG_INT1_PUSH_PULL_HIGH   0x03U   /* INT1脉冲模式、推挽输出、高电平有效 */
+#define INT_CONFIG1_ASYNC_RESET_OFF      0x00U   /* 清除INT_ASYNC_RESET，INT1才能正常输出 */
+#define INT_SOURCE0_UI_DRDY_INT1         0x08U   /* 数据就绪中断路由到INT1 */
+#define INT_SOURCE0_FIFO_THS_INT1        0x04U   /* FIFO水位中断路由到INT1 */
+#define INT_SOURCE1_WOM_XYZ_INT1         0x07U   /* 三轴运动唤醒中断路由到INT1 */
+#define INT_STATUS2_WOM_XYZ              0x07U
+
+#define PWR_MGMT0_ACCEL_GYRO_LN          0x0FU   /* 加速度计+陀螺仪低噪声模式 */
+#define PWR_MGMT0_ACCEL_LP               0x02U   /* 仅加速度计低功耗模式，陀螺仪关闭 */
+#define ACCEL_CONFIG0_4G_100HZ           0x48U
+#define ACCEL_CONFIG0_4G_50HZ            0x49U
+#define SMD_CONFIG_WOM_INITIAL_OR        0x01U   /* 与进入时的初始样本比较，任一轴超过门限即触发 */
+#define SMD_CONFIG_OFF                   0x00U
+
+#define FIFO_CONFIG_BYPASS               0x00U
+#define FIFO_CONFIG_STREAM               0x40U   /* 流模式：满后覆盖最旧数据 */
+#define FIFO_CONFIG1_ACCEL_WM_GT_TH      0x21U   /* 仅加速度计入FIFO（包1，8字节），计数>=水位持续触发 */
+#define INTF_CONFIG0_FIFO_COUNT_REC      0x70U   /* FIFO计数以包为单位，计数与数据均为大端 */
+#define SIGNAL_PATH_RESET_FIFO_FLUSH     0x02U
+#define FIFO_PACKET_BYTES                8U      /* 头1 + 加速度6 + 温度1 */
+#define FIFO_HEADER_EMPTY                0x80U
+#define FIFO_HEADER_ACCEL                0x40U
 
 #define ICM42688_WHO_AM_I_VALUE     0x47U
 
 #if !MOTION_SENSOR_USE_SOFT_I2C
 static I2C_HandleTypeDef s_motion_i2c = {0};
+static DMA_HandleTypeDef s_motion_i2c_dma_rx;
+static uint8_t s_i2c_dma_ready = 0U;
+/* I2C接收DMA缓冲区：从不可缓存的DMA缓冲池分配，DMA1可直接写入 */
+static uint8_t *s_i2c_dma_buffer = NULL;
+#else
+static soft_i2c_t s_motion_soft_i2c =
+{
+    MOTION_SENSOR_I2C_SCL_PORT, MOTION_SENSOR_I2C_SCL_PIN,
+    MOTION_SENSOR_I2C_SDA_PORT, MOTION_SENSOR_I2C_SDA_PIN,
+    0U, 0U
+};
 #endif
+static motion_sensor_bus_stats_t s_bus_stats;
 static uint8_t s_initialized = 0U;
 static uint8_t s_enabled = 0U;
 static uint8_t s_i2c_ready = 0U;
@@ -23,265 +80,209 @@ static uint8_t s_device_available = 0U;
 static uint8_t s_i2c_address = MOTION_SENSOR_I2C_ADDRESS;
 
 static uint8_t s_sample_valid = 0U;
-static int32_t s_norm_baseline_mg = MOTION_SENSOR_GRAVITY_MG;
+static int32_t s_norm_baseline_mg DTCM_DATA = MOTION_SENSOR_GRAVITY_MG;
 static uint8_t s_motion_state = 0U;
 static uint8_t s_motion_confirm_count = 0U;
 static uint8_t s_static_confirm_count = 0U;
 static uint32_t s_last_motion_tick = 0U;
 static uint8_t s_last_motion_valid = 0U;
-static int16_t s_last_sample[3] = {0};
+static int16_t s_last_sample[3] DTCM_DATA = {0};
 static uint8_t s_last_sample_valid = 0U;
 static int32_t s_last_valid_norm_mg = MOTION_SENSOR_GRAVITY_MG;
-static int16_t s_prev_sample[3] = {0};
+static int16_t s_prev_sample[3] DTCM_DATA = {0};
 static uint8_t s_prev_sample_valid = 0U;
 static uint8_t s_sensitivity_level = MOTION_SENSOR_SENSITIVITY_LEVEL_DEFAULT;
+#if MOTION_SENSOR_USE_FIFO
+static uint8_t s_fifo_raw[MOTION_SENSOR_FIFO_BATCH_MAX * FIFO_PACKET_BYTES] DTCM_DATA;
+static int16_t s_fifo_samples[MOTION_SENSOR_FIFO_BATCH_MAX][3] DTCM_DATA;
+#endif
+#if ENABLE_MOTION_SENSOR_INTERRUPT
+static volatile uint8_t s_data_ready = 0U;
+static uint32_t s_last_read_tick = 0U;
+#endif
 
-static uint32_t motion_sensor_get_moving_threshold(void)
+/* 各灵敏度等级的判定门限；变化量相关门限在编译期展开为平方值，运行时直接比较平方和，无需开方 */
+typedef struct
 {
-    const uint32_t thresholds[] = {100U, 95U, 90U, 85U, 80U};
-    uint8_t idx = (s_sensitivity_level >= MOTION_SENSOR_SENSITIVITY_LEVEL_MIN && 
-                    s_sensitivity_level <= MOTION_SENSOR_SENSITIVITY_LEVEL_MAX) ? 
-                   (s_sensitivity_level - 1U) : 0U;
-    return thresholds[idx];
-}
-
-static uint32_t motion_sensor_get_static_threshold(void)
+    uint32_t moving_mg;
+    uint32_t static_mg;
+    uint32_t moving_2_3_mg;         /* moving_mg * 2 / 3 */
+    uint32_t moving_3_5_mg;         /* moving_mg * 3 / 5 */
+    uint32_t change_moving_sq;      /* 变化量 >= moving_mg */
+    uint32_t change_moving_x2_sq;   /* 变化量 >= moving_mg * 2 */
+    uint32_t change_moving_3_5_sq;  /* 变化量 >= moving_mg * 3 / 5 */
+    uint32_t change_static_sq;      /* 变化量 <= static_mg，即平方和 < (static_mg + 1)^2 */
+    uint8_t moving_debounce;
+    uint8_t static_debounce;
+} motion_sensor_thresholds_t;
+
+#define MOTION_SENSOR_SQ(x)   ((uint32_t)(x) * (uint32_t)(x))
+#define MOTION_SENSOR_LEVEL_THRESHOLDS(moving, stat, moving_debounce, static_debounce) \
+    { (moving), (stat), (moving) * 2U / 3U, (moving) * 3U / 5U,                      \
+      MOTION_SENSOR_SQ(moving), MOTION_SENSOR_SQ((moving) * 2U),                     \
+      MOTION_SENSOR_SQ((moving) * 3U / 5U), MOTION_SENSOR_SQ((stat) + 1U),           \
+      (moving_debounce), (static_debounce) }
+
+static const motion_sensor_thresholds_t s_level_thresholds[MOTION_SENSOR_SENSITIVITY_LEVEL_MAX] =
 {
-    const uint32_t thresholds[] = {40U, 38U, 35U, 32U, 30U};
-    uint8_t idx = (s_sensitivity_level >= MOTION_SENSOR_SENSITIVITY_LEVEL_MIN && 
-                    s_sensitivity_level <= MOTION_SENSOR_SENSITIVITY_LEVEL_MAX) ? 
-                   (s_sensitivity_level - 1U) : 0U;
-    return thresholds[idx];
-}
-
-static uint8_t motion_sensor_get_moving_debounce(void)
+    MOTION_SENSOR_LEVEL_THRESHOLDS(100U, 40U, 2U, 6U),
+    MOTION_SENSOR_LEVEL_THRESHOLDS(95U,  38U, 2U, 6U),
+    MOTION_SENSOR_LEVEL_THRESHOLDS(90U,  35U, 2U, 6U),
+    MOTION_SENSOR_LEVEL_THRESHOLDS(85U,  32U, 1U, 5U),
+    MOTION_SENSOR_LEVEL_THRESHOLDS(80U,  30U, 1U, 5U),
+};
+
+static const motion_sensor_thresholds_t *motion_sensor_get_thresholds(void)
 {
-    const uint8_t debounces[] = {2U, 2U, 2U, 1U, 1U};
     uint8_t idx = (s_sensitivity_level >= MOTION_SENSOR_SENSITIVITY_LEVEL_MIN && 
                     s_sensitivity_level <= MOTION_SENSOR_SENSITIVITY_LEVEL_MAX) ? 
                    (s_sensitivity_level - 1U) : 0U;
-    return debounces[idx];
+    return &s_level_thresholds[idx];
 }
 
-static uint8_t motion_sensor_get_static_debounce(void)
+static void motion_sensor_gpio_init(void)
 {
-    const uint8_t debounces[] = {6U, 6U, 6U, 5U, 5U};
-    uint8_t idx = (s_sensitivity_level >= MOTION_SENSOR_SENSITIVITY_LEVEL_MIN && 
-                    s_sensitivity_level <= MOTION_SENSOR_SENSITIVITY_LEVEL_MAX) ? 
-                   (s_sensitivity_level - 1U) : 0U;
-    return debounces[idx];
-}
-
-#if MOTION_SENSOR_USE_SOFT_I2C
-#ifndef MOTION_SENSOR_SOFT_I2C_DELAY_CYCLES
-#define MOTION_SENSOR_SOFT_I2C_DELAY_CYCLES   500U
-#endif
+    GPIO_InitTypeDef gpio = {0};
 
-static void motion_sensor_soft_i2c_delay(void)
-{
-    for (volatile uint32_t i = 0U; i < MOTION_SENSOR_SOFT_I2C_DELAY_CYCLES; i++)
-    {
-        __NOP();
-    }
-}
+    MOTION_SENSOR_I2C_GPIO_CLK_ENABLE();
+    MOTION_SENSOR_AD0_GPIO_CLK_ENABLE();
 
-static void motion_sensor_soft_i2c_set_sda_mode(uint32_t mode)
-{
-    GPIO_InitTypeDef gpio = {0};
-    gpio.Pin = MOTION_SENSOR_I2C_SDA_PIN;
-    gpio.Mode = mode;
+#if !MOTION_SENSOR_USE_SOFT_I2C
+    gpio.Pin = MOTION_SENSOR_I2C_SCL_PIN;
+    gpio.Mode = GPIO_MODE_AF_OD;
     gpio.Pull = GPIO_PULLUP;
+    gpio.Alternate = MOTION_SENSOR_I2C_SCL_AF;
     gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
-    HAL_GPIO_Init(MOTION_SENSOR_I2C_SDA_PORT, &gpio);
-}
-
-static void motion_sensor_soft_i2c_set_sda(uint8_t high)
-{
-    HAL_GPIO_WritePin(MOTION_SENSOR_I2C_SDA_PORT,
-                      MOTION_SENSOR_I2C_SDA_PIN,
-                      high ? GPIO_PIN_SET : GPIO_PIN_RESET);
-    motion_sensor_soft_i2c_delay();
-}
-
-static void motion_sensor_soft_i2c_set_scl(uint8_t high)
-{
-    HAL_GPIO_WritePin(MOTION_SENSOR_I2C_SCL_PORT,
-                      MOTION_SENSOR_I2C_SCL_PIN,
-                      high ? GPIO_PIN_SET : GPIO_PIN_RESET);
-    motion_sensor_soft_i2c_delay();
-}
+    HAL_GPIO_Init(MOTION_SENSOR_I2C_SCL_PORT, &gpio);
 
-static uint8_t motion_sensor_soft_i2c_read_sda(void)
-{
-    return (uint8_t)HAL_GPIO_ReadPin(MOTION_SENSOR_I2C_SDA_PORT, MOTION_SENSOR_I2C_SDA_PIN);
-}
+    gpio.Pin = MOTION_SENSOR_I2C_SDA_PIN;
+    gpio.Alternate = MOTION_SENSOR_I2C_SDA_AF;
+    HAL_GPIO_Init(MOTION_SENSOR_I2C_SDA_PORT, &gpio);
+#endif
 
-static void motion_sensor_soft_i2c_start(void)
-{
-    motion_sensor_soft_i2c_set_sda_mode(GPIO_MODE_OUTPUT_OD);
-    motion_sensor_soft_i2c_set_sda(1U);
-    motion_sensor_soft_i2c_set_scl(1U);
-    motion_sensor_soft_i2c_set_sda(0U);
-    motion_sensor_soft_i2c_set_scl(0U);
-}
+    gpio.Pin = MOTION_SENSOR_AD0_PIN;
+    gpio.Mode = GPIO_MODE_OUTPUT_PP;
+    gpio.Pull = GPIO_NOPULL;
+    gpio.Speed = GPIO_SPEED_FREQ_LOW;
+    HAL_GPIO_Init(MOTION_SENSOR_AD0_PORT, &gpio);
+    HAL_GPIO_WritePin(MOTION_SENSOR_AD0_PORT, MOTION_SENSOR_AD0_PIN, GPIO_PIN_SET);
 
-static void motion_sensor_soft_i2c_stop(void)
-{
-    motion_sensor_soft_i2c_set_sda_mode(GPIO_MODE_OUTPUT_OD);
-    motion_sensor_soft_i2c_set_sda(0U);
-    motion_sensor_soft_i2c_set_scl(1U);
-    motion_sensor_soft_i2c_set_sda(1U);
+#if ENABLE_MOTION_SENSOR_INTERRUPT || ENABLE_LOW_POWER_MODE
+    MOTION_SENSOR_INT_GPIO_CLK_ENABLE();
+    gpio.Pin = MOTION_SENSOR_INT_PIN;
+#if ENABLE_MOTION_SENSOR_INTERRUPT
+    gpio.Mode = GPIO_MODE_IT_RISING;
+#else
+    gpio.Mode = GPIO_MODE_EVT_RISING;   /* 仅作为运动唤醒事件，用于唤醒WFE，不进入中断 */
+#endif
+    gpio.Pull = GPIO_PULLDOWN;
+    gpio.Speed = GPIO_SPEED_FREQ_LOW;
+    HAL_GPIO_Init(MOTION_SENSOR_INT_PORT, &gpio);
+#endif
 }
 
-static uint8_t motion_sensor_soft_i2c_write_byte(uint8_t value)
+#if !MOTION_SENSOR_USE_SOFT_I2C
+/* 总线卡死恢复：SDA被从机拉低时，以GPIO输出最多9个SCL脉冲并产生STOP */
+static void motion_sensor_i2c_bus_recover(void)
 {
-    motion_sensor_soft_i2c_set_sda_mode(GPIO_MODE_OUTPUT_OD);
-    for (uint8_t i = 0U; i < 8U; i++)
-    {
-        uint8_t bit = (value & 0x80U) ? 1U : 0U;
-        motion_sensor_soft_i2c_set_sda(bit);
-        motion_sensor_soft_i2c_set_scl(1U);
-        motion_sensor_soft_i2c_set_scl(0U);
-        value <<= 1U;
-    }
+    GPIO_InitTypeDef gpio = {0};
 
-    motion_sensor_soft_i2c_set_sda_mode(GPIO_MODE_INPUT);
-    motion_sensor_soft_i2c_set_scl(1U);
-    uint8_t ack = (motion_sensor_soft_i2c_read_sda() == 0U) ? 1U : 0U;
-    motion_sensor_soft_i2c_set_scl(0U);
-    motion_sensor_soft_i2c_set_sda_mode(GPIO_MODE_OUTPUT_OD);
-    motion_sensor_soft_i2c_set_sda(1U);
-    return ack;
-}
+    gpio.Mode = GPIO_MODE_OUTPUT_OD;
+    gpio.Pull = GPIO_PULLUP;
+    gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+    gpio.Pin = MOTION_SENSOR_I2C_SCL_PIN;
+    HAL_GPIO_WritePin(MOTION_SENSOR_I2C_SCL_PORT, MOTION_SENSOR_I2C_SCL_PIN, GPIO_PIN_SET);
+    HAL_GPIO_Init(MOTION_SENSOR_I2C_SCL_PORT, &gpio);
+    gpio.Pin = MOTION_SENSOR_I2C_SDA_PIN;
+    HAL_GPIO_WritePin(MOTION_SENSOR_I2C_SDA_PORT, MOTION_SENSOR_I2C_SDA_PIN, GPIO_PIN_SET);
+    HAL_GPIO_Init(MOTION_SENSOR_I2C_SDA_PORT, &gpio);
+    delay_us(5);
 
-static uint8_t motion_sensor_soft_i2c_read_byte(uint8_t nack)
-{
-    uint8_t value = 0U;
-    motion_sensor_soft_i2c_set_sda_mode(GPIO_MODE_INPUT);
-    for (uint8_t i = 0U; i < 8U; i++)
+    for (uint8_t i = 0U; i < 9U; i++)
     {
-        motion_sensor_soft_i2c_set_scl(1U);
-        value <<= 1U;
-        if (motion_sensor_soft_i2c_read_sda())
+        if (HAL_GPIO_ReadPin(MOTION_SENSOR_I2C_SDA_PORT, MOTION_SENSOR_I2C_SDA_PIN) == GPIO_PIN_SET)
         {
-            value |= 0x01U;
+            break;
         }
-        motion_sensor_soft_i2c_set_scl(0U);
+        HAL_GPIO_WritePin(MOTION_SENSOR_I2C_SCL_PORT, MOTION_SENSOR_I2C_SCL_PIN, GPIO_PIN_RESET);
+        delay_us(5);
+        HAL_GPIO_WritePin(MOTION_SENSOR_I2C_SCL_PORT, MOTION_SENSOR_I2C_SCL_PIN, GPIO_PIN_SET);
+        delay_us(5);
     }
 
-    motion_sensor_soft_i2c_set_sda_mode(GPIO_MODE_OUTPUT_OD);
-    motion_sensor_soft_i2c_set_sda(nack ? 1U : 0U);
-    motion_sensor_soft_i2c_set_scl(1U);
-    motion_sensor_soft_i2c_set_scl(0U);
-    motion_sensor_soft_i2c_set_sda(1U);
+    /* STOP：SCL高时SDA由低变高 */
+    HAL_GPIO_WritePin(MOTION_SENSOR_I2C_SDA_PORT, MOTION_SENSOR_I2C_SDA_PIN, GPIO_PIN_RESET);
+    delay_us(5);
+    HAL_GPIO_WritePin(MOTION_SENSOR_I2C_SDA_PORT, MOTION_SENSOR_I2C_SDA_PIN, GPIO_PIN_SET);
+    delay_us(5);
 
-    return value;
+    gpio.Mode = GPIO_MODE_AF_OD;
+    gpio.Pin = MOTION_SENSOR_I2C_SCL_PIN;
+    gpio.Alternate = MOTION_SENSOR_I2C_SCL_AF;
+    HAL_GPIO_Init(MOTION_SENSOR_I2C_SCL_PORT, &gpio);
+    gpio.Pin = MOTION_SENSOR_I2C_SDA_PIN;
+    gpio.Alternate = MOTION_SENSOR_I2C_SDA_AF;
+    HAL_GPIO_Init(MOTION_SENSOR_I2C_SDA_PORT, &gpio);
 }
 
-static HAL_StatusTypeDef motion_sensor_soft_i2c_mem_write(uint8_t address, uint8_t reg, const uint8_t *buffer, uint16_t len)
+static void motion_sensor_i2c_dma_init(void)
 {
-    motion_sensor_soft_i2c_start();
-    if (!motion_sensor_soft_i2c_write_byte((address << 1U) | 0x00U))
+    MOTION_SENSOR_I2C_DMA_CLK_ENABLE();
+
+    s_motion_i2c_dma_rx.Instance = MOTION_SENSOR_I2C_DMA_STREAM;
+    s_motion_i2c_dma_rx.Init.Request = MOTION_SENSOR_I2C_DMA_REQUEST;
+    s_motion_i2c_dma_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    s_motion_i2c_dma_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+    s_motion_i2c_dma_rx.Init.MemInc = DMA_MINC_ENABLE;
+    s_motion_i2c_dma_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    s_motion_i2c_dma_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    s_motion_i2c_dma_rx.Init.Mode = DMA_NORMAL;
+    s_motion_i2c_dma_rx.Init.Priority = DMA_PRIORITY_LOW;
+    s_motion_i2c_dma_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+
+    s_i2c_dma_ready = 0U;
+    if (s_i2c_dma_buffer == NULL)
     {
-        motion_sensor_soft_i2c_stop();
-        return HAL_ERROR;
-    }
-    if (!motion_sensor_soft_i2c_write_byte(reg))
-    {
-        motion_sensor_soft_i2c_stop();
-        return HAL_ERROR;
-    }
-    for (uint16_t i = 0U; i < len; i++)
-    {
-        if (!motion_sensor_soft_i2c_write_byte(buffer[i]))
+        s_i2c_dma_buffer = (uint8_t *)dma_buf_alloc(MOTION_SENSOR_I2C_DMA_BUFFER_SIZE);
+        if (s_i2c_dma_buffer == NULL)
         {
-            motion_sensor_soft_i2c_stop();
-            return HAL_ERROR;
+            return;
         }
     }
-    motion_sensor_soft_i2c_stop();
-    return HAL_OK;
-}
-
-static HAL_StatusTypeDef motion_sensor_soft_i2c_mem_read(uint8_t address, uint8_t reg, uint8_t *buffer, uint16_t len)
-{
-    motion_sensor_soft_i2c_start();
-    if (!motion_sensor_soft_i2c_write_byte((address << 1U) | 0x00U))
-    {
-        motion_sensor_soft_i2c_stop();
-        return HAL_ERROR;
-    }
-    if (!motion_sensor_soft_i2c_write_byte(reg))
+    (void)HAL_DMA_DeInit(&s_motion_i2c_dma_rx);
+    if (HAL_DMA_Init(&s_motion_i2c_dma_rx) != HAL_OK)
     {
-        motion_sensor_soft_i2c_stop();
-        return HAL_ERROR;
-    }
-
-    motion_sensor_soft_i2c_start();
-    if (!motion_sensor_soft_i2c_write_byte((address << 1U) | 0x01U))
-    {
-        motion_sensor_soft_i2c_stop();
-        return HAL_ERROR;
-    }
-
-    for (uint16_t i = 0U; i < len; i++)
-    {
-        uint8_t nack = (i + 1U == len) ? 1U : 0U;
-        buffer[i] = motion_sensor_soft_i2c_read_byte(nack);
+        return;
     }
+    __HAL_LINKDMA(&s_motion_i2c, hdmarx, s_motion_i2c_dma_rx);
 
-    motion_sensor_soft_i2c_stop();
-    return HAL_OK;
+    HAL_NVIC_SetPriority(MOTION_SENSOR_I2C_DMA_IRQn, 2, 1);
+    HAL_NVIC_EnableIRQ(MOTION_SENSOR_I2C_DMA_IRQn);
+    s_i2c_dma_ready = 1U;
 }
-#endif
 
-static void motion_sensor_gpio_init(void)
+void MOTION_SENSOR_I2C_EV_IRQHandler(void)
 {
-    GPIO_InitTypeDef gpio = {0};
-
-    MOTION_SENSOR_I2C_GPIO_CLK_ENABLE();
-    MOTION_SENSOR_AD0_GPIO_CLK_ENABLE();
-
-    gpio.Pin = MOTION_SENSOR_I2C_SCL_PIN;
-#if MOTION_SENSOR_USE_SOFT_I2C
-    gpio.Mode = GPIO_MODE_OUTPUT_OD;
-    gpio.Pull = GPIO_PULLUP;
-#else
-    gpio.Mode = GPIO_MODE_AF_OD;
-    gpio.Pull = GPIO_PULLUP;
-    gpio.Alternate = MOTION_SENSOR_I2C_SCL_AF;
-#endif
-    gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
-    HAL_GPIO_Init(MOTION_SENSOR_I2C_SCL_PORT, &gpio);
-
-    gpio.Pin = MOTION_SENSOR_I2C_SDA_PIN;
-#if MOTION_SENSOR_USE_SOFT_I2C
-    gpio.Mode = GPIO_MODE_OUTPUT_OD;
-    gpio.Pull = GPIO_PULLUP;
-#else
-    gpio.Mode = GPIO_MODE_AF_OD;
-    gpio.Pull = GPIO_PULLUP;
-    gpio.Alternate = MOTION_SENSOR_I2C_SDA_AF;
-#endif
-    HAL_GPIO_Init(MOTION_SENSOR_I2C_SDA_PORT, &gpio);
+    HAL_I2C_EV_IRQHandler(&s_motion_i2c);
+}
 
-    gpio.Pin = MOTION_SENSOR_AD0_PIN;
-    gpio.Mode = GPIO_MODE_OUTPUT_PP;
-    gpio.Pull = GPIO_NOPULL;
-    gpio.Speed = GPIO_SPEED_FREQ_LOW;
-    HAL_GPIO_Init(MOTION_SENSOR_AD0_PORT, &gpio);
-    HAL_GPIO_WritePin(MOTION_SENSOR_AD0_PORT, MOTION_SENSOR_AD0_PIN, GPIO_PIN_SET);
+void MOTION_SENSOR_I2C_ER_IRQHandler(void)
+{
+    HAL_I2C_ER_IRQHandler(&s_motion_i2c);
+}
 
-#if MOTION_SENSOR_USE_SOFT_I2C
-    HAL_GPIO_WritePin(MOTION_SENSOR_I2C_SCL_PORT, MOTION_SENSOR_I2C_SCL_PIN, GPIO_PIN_SET);
-    HAL_GPIO_WritePin(MOTION_SENSOR_I2C_SDA_PORT, MOTION_SENSOR_I2C_SDA_PIN, GPIO_PIN_SET);
-#endif
+void MOTION_SENSOR_I2C_DMA_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&s_motion_i2c_dma_rx);
 }
+#endif
 
 static void motion_sensor_i2c_init(void)
 {
 #if MOTION_SENSOR_USE_SOFT_I2C
-    s_i2c_ready = 1U;
+    soft_i2c_init(&s_motion_soft_i2c, MOTION_SENSOR_SOFT_I2C_FREQ_HZ);
+    /* 频率偏差不影响通信，只有线路卡死时才判定总线不可用 */
+    s_i2c_ready = ((soft_i2c_self_test(&s_motion_soft_i2c) & ~SOFT_I2C_TEST_FREQ_ERROR) == SOFT_I2C_TEST_OK) ? 1U : 0U;
 #else
     MOTION_SENSOR_I2C_CLK_ENABLE();
 
@@ -297,53 +298,164 @@ static void motion_sensor_i2c_init(void)
 
     s_i2c_ready = 0U;
     (void)HAL_I2C_DeInit(&s_motion_i2c);
+    motion_sensor_i2c_bus_recover();   /* MCU在传输中途复位时从机可能仍拉住SDA */
     if (HAL_I2C_Init(&s_motion_i2c) == HAL_OK)
     {
         (void)HAL_I2CEx_ConfigAnalogFilter(&s_motion_i2c, I2C_ANALOGFILTER_ENABLE);
         (void)HAL_I2CEx_ConfigDigitalFilter(&s_motion_i2c, 0U);
+        motion_sensor_i2c_dma_init();
+
+        HAL_NVIC_SetPriority(MOTION_SENSOR_I2C_EV_IRQn, 2, 1);
+        HAL_NVIC_EnableIRQ(MOTION_SENSOR_I2C_EV_IRQn);
+        HAL_NVIC_SetPriority(MOTION_SENSOR_I2C_ER_IRQn, 2, 1);
+        HAL_NVIC_EnableIRQ(MOTION_SENSOR_I2C_ER_IRQn);
         s_i2c_ready = 1U;
     }
 #endif
 }
 
+#if !MOTION_SENSOR_USE_SOFT_I2C
+/* 等待中断/DMA传输结束；超时或出错时中止传输并恢复总线 */
+static HAL_StatusTypeDef motion_sensor_i2c_wait(uint16_t len)
+{
+    uint32_t start = HAL_GetTick();
+    uint32_t timeout = MOTION_SENSOR_I2C_TIMEOUT_MS + (len / 8U);
+
+    while (HAL_I2C_GetState(&s_motion_i2c) != HAL_I2C_STATE_READY)
+    {
+        if ((HAL_GetTick() - start) >= timeout)
+        {
+            break;
+        }
+    }
+
+    if (HAL_I2C_GetState(&s_motion_i2c) == HAL_I2C_STATE_READY &&
+        HAL_I2C_GetError(&s_motion_i2c) == HAL_I2C_ERROR_NONE)
+    {
+        return HAL_OK;
+    }
+
+    /* NACK只表示从机不应答（如探测备用地址），总线本身正常 */
+    if (HAL_I2C_GetState(&s_motion_i2c) == HAL_I2C_STATE_READY &&
+        HAL_I2C_GetError(&s_motion_i2c) == HAL_I2C_ERROR_AF)
+    {
+        return HAL_ERROR;
+    }
+
+    s_bus_stats.recoveries++;
+    if (s_i2c_dma_ready)
+    {
+        /* 超时时DMA流可能仍在运行，先停止，否则重新初始化后还会继续写接收缓冲区 */
+        (void)HAL_DMA_Abort(&s_motion_i2c_dma_rx);
+    }
+    (void)HAL_I2C_DeInit(&s_motion_i2c);
+    motion_sensor_i2c_bus_recover();
+    if (HAL_I2C_Init(&s_motion_i2c) != HAL_OK)
+    {
+        s_i2c_ready = 0U;
+    }
+    return HAL_ERROR;
+}
+#endif
+
+static void motion_sensor_bus_stats_update(uint32_t start_cycles, uint16_t len, HAL_StatusTypeDef status)
+{
+    uint32_t cycles = DWT->CYCCNT - start_cycles;
+
+    s_bus_stats.transfers++;
+    s_bus_stats.cycles_total += cycles;
+    if (cycles > s_bus_stats.cycles_max)
+    {
+        s_bus_stats.cycles_max = cycles;
+    }
+    if (status == HAL_OK)
+    {
+        s_bus_stats.bytes += len;
+    }
+    else
+    {
+        s_bus_stats.errors++;
+    }
+}
+
 static HAL_StatusTypeDef motion_sensor_write_reg_addr(uint8_t address, uint8_t reg, uint8_t value)
 {
+    HAL_StatusTypeDef status;
+    uint32_t start_cycles;
+
     if (!s_i2c_ready)
     {
         return HAL_ERROR;
     }
 
+    start_cycles = DWT->CYCCNT;
 #if MOTION_SENSOR_USE_SOFT_I2C
-    return motion_sensor_soft_i2c_mem_write(address, reg, &value, 1U);
+    status = soft_i2c_mem_write(&s_motion_soft_i2c, address, reg, &value, 1U);
 #else
-    return HAL_I2C_Mem_Write(&s_motion_i2c,
-                             (address << 1U),
-                             reg,
-                             I2C_MEMADD_SIZE_8BIT,
-                             &value,
-                             1U,
-                             MOTION_SENSOR_I2C_TIMEOUT_MS);
+    /* 数据在栈上（DTCM），DMA1无法访问，单字节写入走中断传输 */
+    status = HAL_I2C_Mem_Write_IT(&s_motion_i2c,
+                                  (address << 1U),
+                                  reg,
+                                  I2C_MEMADD_SIZE_8BIT,
+                                  &value,
+                                  1U);
+    if (status == HAL_OK)
+    {
+        status = motion_sensor_i2c_wait(1U);
+    }
 #endif
+    motion_sensor_bus_stats_update(start_cycles, 1U, status);
+    return status;
 }
 
 static HAL_StatusTypeDef motion_sensor_read_regs_addr(uint8_t address, uint8_t reg, uint8_t *buffer, uint16_t len)
 {
+    HAL_StatusTypeDef status;
+    uint32_t start_cycles;
+
     if (!s_i2c_ready)
     {
         return HAL_ERROR;
     }
 
+    start_cycles = DWT->CYCCNT;
 #if MOTION_SENSOR_USE_SOFT_I2C
-    return motion_sensor_soft_i2c_mem_read(address, reg, buffer, len);
+    status = soft_i2c_mem_read(&s_motion_soft_i2c, address, reg, buffer, len);
 #else
-    return HAL_I2C_Mem_Read(&s_motion_i2c,
-                            (address << 1U),
-                            reg,
-                            I2C_MEMADD_SIZE_8BIT,
-                            buffer,
-                            len,
-                            MOTION_SENSOR_I2C_TIMEOUT_MS);
+    if (s_i2c_dma_ready && len >= MOTION_SENSOR_I2C_DMA_MIN_BYTES && len <= MOTION_SENSOR_I2C_DMA_BUFFER_SIZE)
+    {
+        status = HAL_I2C_Mem_Read_DMA(&s_motion_i2c,
+                                      (address << 1U),
+                                      reg,
+                                      I2C_MEMADD_SIZE_8BIT,
+                                      s_i2c_dma_buffer,
+                                      len);
+        if (status == HAL_OK)
+        {
+            status = motion_sensor_i2c_wait(len);
+        }
+        if (status == HAL_OK)
+        {
+            dma_buf_invalidate(s_i2c_dma_buffer, len);
+            memcpy(buffer, s_i2c_dma_buffer, len);
+        }
+    }
+    else
+    {
+        status = HAL_I2C_Mem_Read_IT(&s_motion_i2c,
+                                     (address << 1U),
+                                     reg,
+                                     I2C_MEMADD_SIZE_8BIT,
+                                     buffer,
+                                     len);
+        if (status == HAL_OK)
+        {
+            status = motion_sensor_i2c_wait(len);
+        }
+    }
 #endif
+    motion_sensor_bus_stats_update(start_cycles, len, status);
+    return status;
 }
 
 static HAL_StatusTypeDef motion_sensor_write_reg(uint8_t reg, uint8_t value)
@@ -356,6 +468,33 @@ static HAL_StatusTypeDef motion_sensor_read_regs(uint8_t reg, uint8_t *buffer, u
     return motion_sensor_read_regs_addr(s_i2c_address, reg, buffer, len);
 }
 
+/* 正常采样配置：100Hz低噪声模式，FIFO与INT1路由（上电及退出运动唤醒模式时调用） */
+static void motion_sensor_config_sampling(uint8_t address)
+{
+    (void)motion_sensor_write_reg_addr(address, REG_ACCEL_CONFIG0, ACCEL_CONFIG0_4G_100HZ);
+    (void)motion_sensor_write_reg_addr(address, REG_GYRO_CONFIG0, 0x48U);
+
+#if MOTION_SENSOR_USE_FIFO
+    /* 加速度样本按ODR(100Hz)写入片上FIFO，主循环一次突发读出整批 */
+    (void)motion_sensor_write_reg_addr(address, REG_INTF_CONFIG0, INTF_CONFIG0_FIFO_COUNT_REC);
+    (void)motion_sensor_write_reg_addr(address, REG_FIFO_CONFIG1, FIFO_CONFIG1_ACCEL_WM_GT_TH);
+    (void)motion_sensor_write_reg_addr(address, REG_FIFO_CONFIG2, (uint8_t)(MOTION_SENSOR_FIFO_WATERMARK & 0xFFU));
+    (void)motion_sensor_write_reg_addr(address, REG_FIFO_CONFIG3, (uint8_t)((MOTION_SENSOR_FIFO_WATERMARK >> 8) & 0x0FU));
+    (void)motion_sensor_write_reg_addr(address, REG_FIFO_CONFIG, FIFO_CONFIG_STREAM);
+    (void)motion_sensor_write_reg_addr(address, REG_SIGNAL_PATH_RESET, SIGNAL_PATH_RESET_FIFO_FLUSH);
+#endif
+
+#if ENABLE_MOTION_SENSOR_INTERRUPT
+    (void)motion_sensor_write_reg_addr(address, REG_INT_CONFIG, INT_CONFIG_INT1_PUSH_PULL_HIGH);
+    (void)motion_sensor_write_reg_addr(address, REG_INT_CONFIG1, INT_CONFIG1_ASYNC_RESET_OFF);
+#if MOTION_SENSOR_USE_FIFO
+    (void)motion_sensor_write_reg_addr(address, REG_INT_SOURCE0, INT_SOURCE0_FIFO_THS_INT1);
+#else
+    (void)motion_sensor_write_reg_addr(address, REG_INT_SOURCE0, INT_SOURCE0_UI_DRDY_INT1);
+#endif
+#endif
+}
+
 static HAL_StatusTypeDef motion_sensor_device_config(uint8_t address)
 {
     HAL_StatusTypeDef status;
@@ -380,15 +519,14 @@ static HAL_StatusTypeDef motion_sensor_device_config(uint8_t address)
         return HAL_ERROR;
     }
 
-    status = motion_sensor_write_reg_addr(address, REG_PWR_MGMT0, 0x0FU);
+    status = motion_sensor_write_reg_addr(address, REG_PWR_MGMT0, PWR_MGMT0_ACCEL_GYRO_LN);
     if (status != HAL_OK)
     {
         return status;
     }
     HAL_Delay(2U);
 
-    (void)motion_sensor_write_reg_addr(address, REG_ACCEL_CONFIG0, 0x48U);
-    (void)motion_sensor_write_reg_addr(address, REG_GYRO_CONFIG0, 0x48U);
+    motion_sensor_config_sampling(address);
 
     s_i2c_address = address;
 
@@ -410,25 +548,139 @@ static HAL_StatusTypeDef motion_sensor_read_sample(int16_t sample[3])
     return HAL_OK;
 }
 
-static int32_t motion_sensor_calculate_norm_mg(const int16_t sample[3])
+#if MOTION_SENSOR_USE_FIFO
+/* 读取FIFO计数后一次突发读出最多MOTION_SENSOR_FIFO_BATCH_MAX个包，解析到s_fifo_samples */
+static HAL_StatusTypeDef motion_sensor_read_fifo(uint16_t *count)
 {
-    int64_t sum = 0;
+    uint8_t raw_count[2];
+    uint16_t records;
+    uint16_t valid = 0U;
+    HAL_StatusTypeDef status;
 
-    for (uint8_t i = 0U; i < 3U; i++)
+    *count = 0U;
+
+    status = motion_sensor_read_regs(REG_FIFO_COUNTH, raw_count, sizeof(raw_count));
+    if (status != HAL_OK)
+    {
+        return status;
+    }
+
+    records = (uint16_t)((raw_count[0] << 8) | raw_count[1]);
+    if (records == 0U)
+    {
+        return HAL_OK;
+    }
+    if (records > MOTION_SENSOR_FIFO_BATCH_MAX)
+    {
+        records = MOTION_SENSOR_FIFO_BATCH_MAX;   /* 剩余的包留到下一次读取 */
+    }
+
+    status = motion_sensor_read_regs(REG_FIFO_DATA, s_fifo_raw, (uint16_t)(records * FIFO_PACKET_BYTES));
+    if (status != HAL_OK)
+    {
+        return status;
+    }
+
+    for (uint16_t i = 0U; i < records; i++)
+    {
+        const uint8_t *packet = &s_fifo_raw[i * FIFO_PACKET_BYTES];
+        int16_t *sample = s_fifo_samples[valid];
+
+        if (packet[0] & FIFO_HEADER_EMPTY)
+        {
+            break;
+        }
+        if ((packet[0] & FIFO_HEADER_ACCEL) == 0U)
+        {
+            continue;
+        }
+
+        sample[0] = (int16_t)((packet[1] << 8) | packet[2]);
+        sample[1] = (int16_t)((packet[3] << 8) | packet[4]);
+        sample[2] = (int16_t)((packet[5] << 8) | packet[6]);
+        if (sample[0] == INT16_MIN)   /* -32768表示该包数据无效 */
+        {
+            continue;
+        }
+        valid++;
+    }
+
+    *count = valid;
+    return HAL_OK;
+}
+#endif
+
+#if ENABLE_MOTION_SENSOR_INTERRUPT
+ITCM_CODE void MOTION_SENSOR_INT_IRQHandler(void)
+{
+    if (__HAL_GPIO_EXTI_GET_IT(MOTION_SENSOR_INT_PIN) != 0U)
+    {
+        __HAL_GPIO_EXTI_CLEAR_IT(MOTION_SENSOR_INT_PIN);
+        s_data_ready = 1U;
+    }
+}
+
+/* 有新数据（或超过MOTION_SENSOR_INT_FALLBACK_MS未收到中断）时返回1 */
+static uint8_t motion_sensor_take_data_ready(void)
+{
+    uint32_t now = HAL_GetTick();
+
+    if (s_data_ready || (now - s_last_read_tick) >= MOTION_SENSOR_INT_FALLBACK_MS)
+    {
+        s_data_ready = 0U;
+        s_last_read_tick = now;
+        return 1U;
+    }
+    return 0U;
+}
+#endif
+
+/* 整数平方根（向下取整），逐位试商，16次迭代 */
+ITCM_CODE static uint32_t motion_sensor_isqrt(uint32_t value)
+{
+    uint32_t root = 0U;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > value)
     {
-        int32_t mg = (int32_t)((sample[i] * 1000) / MOTION_SENSOR_ACCEL_SENSITIVITY_LSB_PER_G);
-        sum += (int64_t)mg * (int64_t)mg;
+        bit >>= 2;
+    }
+    while (bit != 0U)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
     }
+    return root;
+}
+
+ITCM_CODE static int32_t motion_sensor_sample_to_mg(int16_t raw)
+{
+    return ((int32_t)raw * 1000) / MOTION_SENSOR_ACCEL_SENSITIVITY_LSB_PER_G;
+}
 
-    float norm = sqrtf((float)sum);
-    if (norm > (float)INT32_MAX)
+/* 每轴不超过±4000mg，三轴平方和不超过4.8e7，32位无溢出 */
+ITCM_CODE static int32_t motion_sensor_calculate_norm_mg(const int16_t sample[3])
+{
+    uint32_t sum = 0U;
+
+    for (uint8_t i = 0U; i < 3U; i++)
     {
-        norm = (float)INT32_MAX;
+        int32_t mg = motion_sensor_sample_to_mg(sample[i]);
+        sum += (uint32_t)(mg * mg);
     }
-    return (int32_t)norm;
+
+    return (int32_t)motion_sensor_isqrt(sum);
 }
 
-static void motion_sensor_adapt_baseline(int32_t norm_mg)
+ITCM_CODE static void motion_sensor_adapt_baseline(int32_t norm_mg)
 {
     int32_t diff = norm_mg - s_norm_baseline_mg;
 #if MOTION_SENSOR_BASELINE_FILTER_COEFF == 0
@@ -484,37 +736,45 @@ void motion_sensor_init(void)
 
     motion_sensor_set_sensitivity_level(3);
 
-    s_initialized = 1U;
-}
-
-uint8_t motion_sensor_is_moving(void)
-{
-    int16_t sample[3] = {0};
-    int32_t norm_mg = MOTION_SENSOR_GRAVITY_MG;
-    uint32_t delta_mg;
-    uint8_t sample_valid = 0U;
-    HAL_StatusTypeDef status;
-
-    if (!s_initialized)
+#if ENABLE_MOTION_SENSOR_INTERRUPT
+    s_data_ready = 0U;
+    s_last_read_tick = HAL_GetTick();
+    if (s_device_available)
     {
-        motion_sensor_init();
+        HAL_NVIC_SetPriority(MOTION_SENSOR_INT_IRQn, 3, 0);
+        HAL_NVIC_EnableIRQ(MOTION_SENSOR_INT_IRQn);
     }
+#endif
 
-    if (!s_enabled)
-    {
-        return 0U;
-    }
+    s_initialized = 1U;
+}
 
-    if (!s_device_available)
+/* 不读取新数据，按当前状态返回（运动中时刷新最后运动时间） */
+static uint8_t motion_sensor_current_state(void)
+{
+    if (s_motion_state)
     {
         s_last_motion_tick = HAL_GetTick();
         s_last_motion_valid = 1U;
         return 1U;
     }
+    return 0U;
+}
 
-    status = motion_sensor_read_sample(sample);
-    if (status == HAL_OK)
+/**
+ * 处理一个加速度样本，更新基线与去抖状态
+ * sample_in为NULL表示读取失败；返回1表示处于运动状态
+ */
+ITCM_CODE static uint8_t motion_sensor_process_sample(const int16_t *sample_in)
+{
+    int16_t sample[3] = {0};
+    int32_t norm_mg = MOTION_SENSOR_GRAVITY_MG;
+    uint32_t delta_mg;
+    uint8_t sample_valid = 0U;
+
+    if (sample_in != NULL)
     {
+        memcpy(sample, sample_in, sizeof(sample));
         int32_t candidate_norm = motion_sensor_calculate_norm_mg(sample);
         if (candidate_norm >= MOTION_SENSOR_MIN_VALID_NORM_MG &&
             candidate_norm <= MOTION_SENSOR_MAX_VALID_NORM_MG)
@@ -569,24 +829,15 @@ uint8_t motion_sensor_is_moving(void)
         delta_mg = (uint32_t)diff;
     }
 
-    uint32_t accel_change_mg = 0U;
+    /* 相邻样本变化量的平方和（每轴差值不超过8000mg，三轴之和不超过1.92e8） */
+    uint32_t change_sq = 0U;
     if (s_prev_sample_valid)
     {
-        int64_t change_sum = 0;
         for (uint8_t i = 0U; i < 3U; i++)
         {
-            int32_t prev_mg = (int32_t)((s_prev_sample[i] * 1000) / MOTION_SENSOR_ACCEL_SENSITIVITY_LSB_PER_G);
-            int32_t curr_mg = (int32_t)((sample[i] * 1000) / MOTION_SENSOR_ACCEL_SENSITIVITY_LSB_PER_G);
-            int32_t diff = curr_mg - prev_mg;
-            if (diff < 0) diff = -diff;
-            change_sum += (int64_t)diff * (int64_t)diff;
-        }
-        float change_norm = sqrtf((float)change_sum);
-        if (change_norm > (float)UINT32_MAX)
-        {
-            change_norm = (float)UINT32_MAX;
+            int32_t diff = motion_sensor_sample_to_mg(sample[i]) - motion_sensor_sample_to_mg(s_prev_sample[i]);
+            change_sq += (uint32_t)(diff * diff);
         }
-        accel_change_mg = (uint32_t)change_norm;
     }
 
     if (sample_valid)
@@ -595,38 +846,36 @@ uint8_t motion_sensor_is_moving(void)
         s_prev_sample_valid = 1U;
     }
 
-    uint32_t moving_threshold = motion_sensor_get_moving_threshold();
-    uint32_t static_threshold = motion_sensor_get_static_threshold();
-    uint8_t moving_debounce = motion_sensor_get_moving_debounce();
-    uint8_t static_debounce = motion_sensor_get_static_debounce();
+    const motion_sensor_thresholds_t *th = motion_sensor_get_thresholds();
+    uint8_t change_static = (change_sq < th->change_static_sq) ? 1U : 0U;
 
-    if (delta_mg <= static_threshold &&
+    if (delta_mg <= th->static_mg &&
         delta_mg <= MOTION_SENSOR_BASELINE_TRACK_THRESHOLD_MG &&
-        accel_change_mg <= static_threshold)
+        change_static)
     {
         motion_sensor_adapt_baseline(norm_mg);
     }
 
     uint8_t motion_detected = 0U;
     
-    if (delta_mg >= moving_threshold)
+    if (delta_mg >= th->moving_mg)
     {
         motion_detected = 1U;
     }
-    else if (accel_change_mg >= moving_threshold && 
-             delta_mg >= (moving_threshold * 2U / 3U))
+    else if (change_sq >= th->change_moving_sq && 
+             delta_mg >= th->moving_2_3_mg)
     {
         motion_detected = 1U;
     }
-    else if (accel_change_mg >= (moving_threshold * 2U) &&
-             delta_mg >= static_threshold)
+    else if (change_sq >= th->change_moving_x2_sq &&
+             delta_mg >= th->static_mg)
     {
         motion_detected = 1U;
     }
     else if (s_sensitivity_level >= 4U)
     {
-        if (delta_mg >= (moving_threshold * 3U / 5U) ||
-            accel_change_mg >= (moving_threshold * 3U / 5U))
+        if (delta_mg >= th->moving_3_5_mg ||
+            change_sq >= th->change_moving_3_5_sq)
         {
             motion_detected = 1U;
         }
@@ -640,8 +889,7 @@ uint8_t motion_sensor_is_moving(void)
         }
         s_static_confirm_count = 0U;
     }
-    else if (delta_mg <= static_threshold && 
-             accel_change_mg <= static_threshold)
+    else if (delta_mg <= th->static_mg && change_static)
     {
         if (s_static_confirm_count < 0xFFU)
         {
@@ -667,13 +915,13 @@ uint8_t motion_sensor_is_moving(void)
         }
     }
 
-    if (!s_motion_state && (s_motion_confirm_count >= moving_debounce))
+    if (!s_motion_state && (s_motion_confirm_count >= th->moving_debounce))
     {
         s_motion_state = 1U;
         s_motion_confirm_count = 0U;
     }
 
-    if (s_motion_state && (s_static_confirm_count >= static_debounce))
+    if (s_motion_state && (s_static_confirm_count >= th->static_debounce))
     {
         s_motion_state = 0U;
         s_static_confirm_count = 0U;
@@ -689,6 +937,78 @@ uint8_t motion_sensor_is_moving(void)
     return 0U;
 }
 
+static uint8_t motion_sensor_check_moving(void)
+{
+#if !MOTION_SENSOR_USE_FIFO
+    int16_t sample[3] = {0};
+#endif
+    HAL_StatusTypeDef status;
+
+    if (!s_initialized)
+    {
+        motion_sensor_init();
+    }
+
+    if (!s_enabled)
+    {
+        return 0U;
+    }
+
+    if (!s_device_available)
+    {
+        s_last_motion_tick = HAL_GetTick();
+        s_last_motion_valid = 1U;
+        return 1U;
+    }
+
+#if ENABLE_MOTION_SENSOR_INTERRUPT
+    /* 没有新数据时沿用上次判定结果，不访问I2C */
+    if (s_sample_valid && !motion_sensor_take_data_ready())
+    {
+        return motion_sensor_current_state();
+    }
+#endif
+
+#if MOTION_SENSOR_USE_FIFO
+    {
+        uint16_t count = 0U;
+        uint8_t moving = 0U;
+
+        status = motion_sensor_read_fifo(&count);
+        if (status != HAL_OK)
+        {
+            return motion_sensor_process_sample(NULL);
+        }
+        if (count == 0U)
+        {
+            /* FIFO中暂无新样本：沿用上次判定结果 */
+            return motion_sensor_current_state();
+        }
+
+        /* 整批样本依次经过基线/去抖逻辑，返回最后一个样本后的状态 */
+        for (uint16_t i = 0U; i < count; i++)
+        {
+            moving = motion_sensor_process_sample(s_fifo_samples[i]);
+        }
+        return moving;
+    }
+#else
+    status = motion_sensor_read_sample(sample);
+    return motion_sensor_process_sample((status == HAL_OK) ? sample : NULL);
+#endif
+}
+
+uint8_t motion_sensor_is_moving(void)
+{
+    uint8_t moving;
+    PROF_ZONE_BEGIN(PROF_ZONE_MOTION_IS_MOVING);
+
+    moving = motion_sensor_check_moving();
+
+    PROF_ZONE_END(PROF_ZONE_MOTION_IS_MOVING);
+    return moving;
+}
+
 void motion_sensor_enable(void)
 {
     if (!s_initialized)
@@ -709,6 +1029,14 @@ void motion_sensor_enable(void)
     s_prev_sample_valid = 0U;
     s_last_motion_tick = HAL_GetTick();
     s_last_motion_valid = 1U;
+
+#if MOTION_SENSOR_USE_FIFO
+    /* 丢弃关闭期间积累的旧样本 */
+    if (s_device_available)
+    {
+        (void)motion_sensor_write_reg(REG_SIGNAL_PATH_RESET, SIGNAL_PATH_RESET_FIFO_FLUSH);
+    }
+#endif
 }
 
 void motion_sensor_disable(void)
@@ -765,3 +1093,118 @@ uint8_t motion_sensor_get_sensitivity_level(void)
 {
     return s_sensitivity_level;
 }
+
+#if ENABLE_LOW_POWER_MODE
+/**
+ * 进入运动唤醒(WOM)模式：加速度计切换为50Hz低功耗模式、陀螺仪关闭，
+ * 任一轴相对进入时的样本变化超过当前灵敏度等级的运动门限即在INT1输出脉冲
+ */
+HAL_StatusTypeDef motion_sensor_wom_enter(void)
+{
+    uint32_t threshold;
+
+    if (!s_initialized || !s_enabled || !s_device_available)
+    {
+        return HAL_ERROR;
+    }
+
+    /* WOM门限单位为1g/256 */
+    threshold = (motion_sensor_get_thresholds()->moving_mg * 256U) / 1000U;
+    if (threshold == 0U)
+    {
+        threshold = 1U;
+    }
+    else if (threshold > 0xFFU)
+    {
+        threshold = 0xFFU;
+    }
+
+    /* 低功耗期间INT1只输出WOM事件 */
+    if (motion_sensor_write_reg(REG_INT_SOURCE0, 0x00U) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+    (void)motion_sensor_write_reg(REG_INT_CONFIG, INT_CONFIG_INT1_PUSH_PULL_HIGH);
+    (void)motion_sensor_write_reg(REG_INT_CONFIG1, INT_CONFIG1_ASYNC_RESET_OFF);
+#if MOTION_SENSOR_USE_FIFO
+    (void)motion_sensor_write_reg(REG_FIFO_CONFIG, FIFO_CONFIG_BYPASS);
+#endif
+
+    (void)motion_sensor_write_reg(REG_ACCEL_CONFIG0, ACCEL_CONFIG0_4G_50HZ);
+    (void)motion_sensor_write_reg(REG_PWR_MGMT0, PWR_MGMT0_ACCEL_LP);
+    HAL_Delay(1U);
+
+    (void)motion_sensor_write_reg(REG_BANK_SEL, 4U);
+    (void)motion_sensor_write_reg(REG_B4_ACCEL_WOM_X_THR, (uint8_t)threshold);
+    (void)motion_sensor_write_reg(REG_B4_ACCEL_WOM_Y_THR, (uint8_t)threshold);
+    (void)motion_sensor_write_reg(REG_B4_ACCEL_WOM_Z_THR, (uint8_t)threshold);
+    (void)motion_sensor_write_reg(REG_BANK_SEL, 0U);
+    HAL_Delay(1U);
+
+    (void)motion_sensor_write_reg(REG_INT_SOURCE1, INT_SOURCE1_WOM_XYZ_INT1);
+    HAL_Delay(50U);   /* 等待低功耗模式下的初始样本稳定 */
+
+    {
+        uint8_t status2;
+        (void)motion_sensor_read_regs(REG_INT_STATUS2, &status2, 1U);   /* 读清残留状态 */
+    }
+
+    return motion_sensor_write_reg(REG_SMD_CONFIG, SMD_CONFIG_WOM_INITIAL_OR);
+}
+
+/**
+ * 退出运动唤醒模式并恢复正常采样
+ * 返回1表示休眠期间检测到运动：检测状态直接置为运动并重新建立基线；
+ * 返回0时保持原有静止状态与静止计时
+ */
+uint8_t motion_sensor_wom_exit(void)
+{
+    uint8_t status2 = 0U;
+    uint8_t moved;
+
+    if (!s_device_available)
+    {
+        return 0U;
+    }
+
+    (void)motion_sensor_write_reg(REG_SMD_CONFIG, SMD_CONFIG_OFF);
+    (void)motion_sensor_write_reg(REG_INT_SOURCE1, 0x00U);
+    (void)motion_sensor_read_regs(REG_INT_STATUS2, &status2, 1U);
+    moved = (status2 & INT_STATUS2_WOM_XYZ) ? 1U : 0U;
+
+    (void)motion_sensor_write_reg(REG_PWR_MGMT0, PWR_MGMT0_ACCEL_GYRO_LN);
+    HAL_Delay(1U);
+    motion_sensor_config_sampling(s_i2c_address);
+
+    /* 休眠前后的样本不连续，不参与变化量计算 */
+    s_prev_sample_valid = 0U;
+    s_motion_confirm_count = 0U;
+    s_static_confirm_count = 0U;
+    if (moved)
+    {
+        s_sample_valid = 0U;
+        s_motion_state = 1U;
+        s_last_motion_tick = HAL_GetTick();
+        s_last_motion_valid = 1U;
+    }
+
+#if ENABLE_MOTION_SENSOR_INTERRUPT
+    s_data_ready = 1U;
+#endif
+
+    return moved;
+}
+#endif
+
+void motion_sensor_get_bus_stats(motion_sensor_bus_stats_t *stats)
+{
+    if (stats != NULL)
+    {
+        *stats = s_bus_stats;
+    }
+}
+
+void motion_sensor_reset_bus_stats(void)
+{
+    memset(&s_bus_stats, 0, sizeof(s_bus_stats));
+}
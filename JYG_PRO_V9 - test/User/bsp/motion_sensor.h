@@ -6,28 +6,79 @@
 #define MOTION_SENSOR_I2C_INSTANCE            I2C3
 #define MOTION_SENSOR_I2C_CLK_ENABLE()        do{ __HAL_RCC_I2C3_CLK_ENABLE(); }while(0)
 #define MOTION_SENSOR_I2C_GPIO_CLK_ENABLE()   do{ __HAL_RCC_GPIOA_CLK_ENABLE(); __HAL_RCC_GPIOC_CLK_ENABLE(); }while(0)
+
+/* 1：软件模拟I2C（GPIO翻转）  0：硬件I2C3，中断/DMA传输
+ * 本板传感器SCL接PC9、SDA接PA8，而I2C3的AF4复用为PA8=I2C3_SCL、PC9=I2C3_SDA，两根线正好相反，
+ * 只能用软件I2C；硬件I2C3需改板对调SCL/SDA，此时按下面的AF引脚配置
+ */
+#ifndef MOTION_SENSOR_USE_SOFT_I2C
+#define MOTION_SENSOR_USE_SOFT_I2C            1
+#endif
+
+#if MOTION_SENSOR_USE_SOFT_I2C
 #define MOTION_SENSOR_I2C_SCL_PIN             GPIO_PIN_9
 #define MOTION_SENSOR_I2C_SCL_PORT            GPIOC
-#define MOTION_SENSOR_I2C_SCL_AF              GPIO_AF4_I2C3
 #define MOTION_SENSOR_I2C_SDA_PIN             GPIO_PIN_8
 #define MOTION_SENSOR_I2C_SDA_PORT            GPIOA
+#else
+#define MOTION_SENSOR_I2C_SCL_PIN             GPIO_PIN_8
+#define MOTION_SENSOR_I2C_SCL_PORT            GPIOA
+#define MOTION_SENSOR_I2C_SDA_PIN             GPIO_PIN_9
+#define MOTION_SENSOR_I2C_SDA_PORT            GPIOC
+#endif
+#define MOTION_SENSOR_I2C_SCL_AF              GPIO_AF4_I2C3
 #define MOTION_SENSOR_I2C_SDA_AF              GPIO_AF4_I2C3
 
 #define MOTION_SENSOR_AD0_PORT                GPIOB
 #define MOTION_SENSOR_AD0_PIN                 GPIO_PIN_12
 #define MOTION_SENSOR_AD0_GPIO_CLK_ENABLE()   do{ __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)
 
+/* INT1中断引脚（ENABLE_MOTION_SENSOR_INTERRUPT为1时使用） */
+#define MOTION_SENSOR_INT_PORT                GPIOB
+#define MOTION_SENSOR_INT_PIN                 GPIO_PIN_13
+#define MOTION_SENSOR_INT_GPIO_CLK_ENABLE()   do{ __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)
+#define MOTION_SENSOR_INT_IRQn                EXTI15_10_IRQn
+#define MOTION_SENSOR_INT_IRQHandler          EXTI15_10_IRQHandler
+
+/* 超过该时间未收到数据就绪中断时仍读取一次，防止INT1未连接时检测停止 */
+#ifndef MOTION_SENSOR_INT_FALLBACK_MS
+#define MOTION_SENSOR_INT_FALLBACK_MS         200U
+#endif
+
+/* 片上FIFO批量读取：1=每次突发读出FIFO中的全部样本逐个处理  0=每次只读当前一组数据寄存器 */
+#ifndef MOTION_SENSOR_USE_FIFO
+#define MOTION_SENSOR_USE_FIFO                1
+#endif
+#define MOTION_SENSOR_FIFO_WATERMARK          8U    /* FIFO水位（包数），中断模式下达到该值才触发INT1 */
+#define MOTION_SENSOR_FIFO_BATCH_MAX          32U   /* 单次最多读出的包数 */
+
 #define MOTION_SENSOR_I2C_ADDRESS             0x69U
 
 #ifndef MOTION_SENSOR_I2C_TIMING
 #define MOTION_SENSOR_I2C_TIMING              0x30A0A7FBU  
 #endif
-#define MOTION_SENSOR_I2C_TIMEOUT_MS          50U
+#define MOTION_SENSOR_I2C_TIMEOUT_MS          5U    /* 单次传输基础超时，另按长度每8字节加1ms */
 
-#ifndef MOTION_SENSOR_USE_SOFT_I2C
-#define MOTION_SENSOR_USE_SOFT_I2C            1
+
+#ifndef MOTION_SENSOR_SOFT_I2C_FREQ_HZ
+#define MOTION_SENSOR_SOFT_I2C_FREQ_HZ        400000U
 #endif
 
+/* 硬件I2C3接收DMA（DMA1_Stream1，经DMAMUX映射到I2C3_RX请求） */
+#define MOTION_SENSOR_I2C_EV_IRQn             I2C3_EV_IRQn
+#define MOTION_SENSOR_I2C_EV_IRQHandler       I2C3_EV_IRQHandler
+#define MOTION_SENSOR_I2C_ER_IRQn             I2C3_ER_IRQn
+#define MOTION_SENSOR_I2C_ER_IRQHandler       I2C3_ER_IRQHandler
+#define MOTION_SENSOR_I2C_DMA_STREAM          DMA1_Stream1
+#define MOTION_SENSOR_I2C_DMA_REQUEST         DMA_REQUEST_I2C3_RX
+#define MOTION_SENSOR_I2C_DMA_IRQn            DMA1_Stream1_IRQn
+#define MOTION_SENSOR_I2C_DMA_IRQHandler      DMA1_Stream1_IRQHandler
+#define MOTION_SENSOR_I2C_DMA_CLK_ENABLE()    do{ __HAL_RCC_DMA1_CLK_ENABLE(); }while(0)
+#define MOTION_SENSOR_I2C_DMA_MIN_BYTES       16U   /* 小于该长度的读取走中断传输 */
+
+/* DMA1无法访问DTCM，接收缓冲区从AXI SRAM中的DMA缓冲池分配（32字节对齐，不可缓存） */
+#define MOTION_SENSOR_I2C_DMA_BUFFER_SIZE     256U
+
 #ifndef MOTION_SENSOR_ACCEL_SENSITIVITY_LSB_PER_G
 #define MOTION_SENSOR_ACCEL_SENSITIVITY_LSB_PER_G    8192
 #endif
@@ -76,6 +127,17 @@
 #define MOTION_SENSOR_SENSITIVITY_LEVEL_MAX   5U
 #define MOTION_SENSOR_SENSITIVITY_LEVEL_DEFAULT  1U
 
+/* 总线传输统计（DWT周期计数，CPU主频480MHz），用于软/硬件I2C吞吐对比 */
+typedef struct
+{
+    uint32_t transfers;         /* 传输次数 */
+    uint32_t bytes;             /* 数据字节数（不含地址与寄存器号） */
+    uint32_t cycles_total;      /* 传输累计耗时 */
+    uint32_t cycles_max;        /* 单次传输最大耗时 */
+    uint32_t errors;            /* 失败次数（NACK/超时/总线错误） */
+    uint32_t recoveries;        /* 总线恢复次数 */
+} motion_sensor_bus_stats_t;
+
 void motion_sensor_init(void);
 uint8_t motion_sensor_is_moving(void);  
 void motion_sensor_enable(void);         
@@ -84,5 +146,9 @@ void motion_sensor_reset_static_timer(void);
 uint32_t motion_sensor_get_static_time(void);
 void motion_sensor_set_sensitivity_level(uint8_t level);
 uint8_t motion_sensor_get_sensitivity_level(void); 
+HAL_StatusTypeDef motion_sensor_wom_enter(void);
+uint8_t motion_sensor_wom_exit(void);
+void motion_sensor_get_bus_stats(motion_sensor_bus_stats_t *stats);
+void motion_sensor_reset_bus_stats(void);
 
 #endif
@@ -0,0 +1,88 @@
+#include "mpu.h"
+#include "dma_buf.h"
+#include "qspi.h"
+#include "version.h"
+
+/**
+ * @brief       设置某个区域的MPU保护
+ * @param       baseaddr: 区域基址（需按区域大小对齐）
+ * @param       size: 区域大小，MPU_REGION_SIZE_xxx
+ * @param       rnum: 区域编号，MPU_REGION_NUMBERx，编号大的优先
+ * @param       de: 1禁止指令访问（XN）
+ * @param       ap: 访问权限，MPU_REGION_xxx_ACCESS
+ * @param       sen: 1可共享
+ * @param       cen: 1可缓存
+ * @param       ben: 1可缓冲（与cen同为1时为写回，cen=1、ben=0为透写）
+ * @retval      无
+ * @note        TEX固定为1：cen=ben=0时为普通不可缓存存储器，cen=ben=1时为写回+写分配
+ */
+void mpu_set_protection(uint32_t baseaddr, uint32_t size, uint32_t rnum, uint8_t de, uint8_t ap,
+                        uint8_t sen, uint8_t cen, uint8_t ben)
+{
+    MPU_Region_InitTypeDef mpu_region_init_handle = {0};
+
+    mpu_region_init_handle.Enable = MPU_REGION_ENABLE;
+    mpu_region_init_handle.Number = rnum;
+    mpu_region_init_handle.BaseAddress = baseaddr;
+    mpu_region_init_handle.Size = size;
+    mpu_region_init_handle.SubRegionDisable = 0x00;
+    mpu_region_init_handle.TypeExtField = MPU_TEX_LEVEL1;
+    mpu_region_init_handle.AccessPermission = ap;
+    mpu_region_init_handle.DisableExec = de ? MPU_INSTRUCTION_ACCESS_DISABLE : MPU_INSTRUCTION_ACCESS_ENABLE;
+    mpu_region_init_handle.IsShareable = sen ? MPU_ACCESS_SHAREABLE : MPU_ACCESS_NOT_SHAREABLE;
+    mpu_region_init_handle.IsCacheable = cen ? MPU_ACCESS_CACHEABLE : MPU_ACCESS_NOT_CACHEABLE;
+    mpu_region_init_handle.IsBufferable = ben ? MPU_ACCESS_BUFFERABLE : MPU_ACCESS_NOT_BUFFERABLE;
+    HAL_MPU_ConfigRegion(&mpu_region_init_handle);
+}
+
+/**
+ * @brief       配置MPU区域，需在使能D-Cache之前调用
+ * @param       无
+ * @retval      无
+ */
+void mpu_memory_protection(void)
+{
+    MPU_Region_InitTypeDef mpu_region_init_handle = {0};
+
+    HAL_MPU_Disable();
+
+    /* 区域0：4GB，禁用子区域0/1/2/7后只覆盖0x60000000~0xDFFFFFFF，禁止访问 */
+    mpu_region_init_handle.Enable = MPU_REGION_ENABLE;
+    mpu_region_init_handle.Number = MPU_REGION_NUMBER0;
+    mpu_region_init_handle.BaseAddress = 0x00000000U;
+    mpu_region_init_handle.Size = MPU_REGION_SIZE_4GB;
+    mpu_region_init_handle.SubRegionDisable = 0x87;
+    mpu_region_init_handle.TypeExtField = MPU_TEX_LEVEL0;
+    mpu_region_init_handle.AccessPermission = MPU_REGION_NO_ACCESS;
+    mpu_region_init_handle.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+    mpu_region_init_handle.IsShareable = MPU_ACCESS_SHAREABLE;
+    mpu_region_init_handle.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
+    mpu_region_init_handle.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+    HAL_MPU_ConfigRegion(&mpu_region_init_handle);
+
+    /* 区域1：AXI SRAM，写回+写分配 */
+    mpu_set_protection(MPU_AXI_SRAM_ADDR, MPU_AXI_SRAM_SIZE, MPU_REGION_NUMBER1, 0,
+                       MPU_REGION_FULL_ACCESS, 0, 1, 1);
+
+    /* 区域2：DMA缓冲池，不可缓存 */
+    mpu_set_protection(DMA_BUF_POOL_ADDR, DMA_BUF_POOL_MPU_SIZE, MPU_REGION_NUMBER2, 1,
+                       MPU_REGION_FULL_ACCESS, 0, 0, 0);
+
+#if ENABLE_QSPI_ASSETS || ENABLE_QSPI_BENCHMARK
+    /* 区域3：QSPI FLASH 8MB，只读、可执行，透写无写分配（TEX=0,C=1,B=0）；不使用QSPI时不配置，
+     * 避免对可缓存的空映射区域产生预取 */
+    mpu_region_init_handle.Number = MPU_REGION_NUMBER3;
+    mpu_region_init_handle.BaseAddress = QSPI_MEMMAP_ADDR;
+    mpu_region_init_handle.Size = MPU_REGION_SIZE_8MB;
+    mpu_region_init_handle.SubRegionDisable = 0x00;
+    mpu_region_init_handle.TypeExtField = MPU_TEX_LEVEL0;
+    mpu_region_init_handle.AccessPermission = MPU_REGION_PRIV_RO_URO;
+    mpu_region_init_handle.DisableExec = MPU_INSTRUCTION_ACCESS_ENABLE;
+    mpu_region_init_handle.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+    mpu_region_init_handle.IsCacheable = MPU_ACCESS_CACHEABLE;
+    mpu_region_init_handle.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+    HAL_MPU_ConfigRegion(&mpu_region_init_handle);
+#endif
+
+    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+}
@@ -0,0 +1,20 @@
+#ifndef __MPU_H
+#define __MPU_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/* MPU区域划分（编号大的区域优先）：
+ * 0：0x60000000~0xDFFFFFFF外部存储器空间禁止访问，阻止CPU推测读取未连接的FMC/QSPI地址
+ * 1：AXI SRAM 512KB，写回+写分配
+ * 2：AXI SRAM起始的DMA缓冲池，不可缓存（见dma_buf.h），DMA收发无需Cache维护
+ * 3：QSPI FLASH内存映射区，只读可执行，透写缓存（见qspi.h），需qspi_init()成功后才能访问
+ * DTCM/ITCM不经过Cache，FLASH使用默认存储器映射（透写）
+ */
+#define MPU_AXI_SRAM_ADDR           0x24000000U
+#define MPU_AXI_SRAM_SIZE           MPU_REGION_SIZE_512KB
+
+void mpu_set_protection(uint32_t baseaddr, uint32_t size, uint32_t rnum, uint8_t de, uint8_t ap,
+                        uint8_t sen, uint8_t cen, uint8_t ben);
+void mpu_memory_protection(void);
+
+#endif
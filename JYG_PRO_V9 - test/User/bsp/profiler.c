@@ -0,0 +1,165 @@
+#include "profiler.h"
+#include "scheduler.h"
+#include "./SYSTEM/usart/usart.h"
+#include <string.h>
+
+static const char *const s_zone_names[PROF_ZONE_COUNT] =
+{
+    "lcd_gray16",
+    "motion_moving",
+    "digipot_write",
+    "key_scan",
+    "key_event",
+};
+
+static prof_stats_t s_stats[PROF_ZONE_COUNT];
+static uint32_t s_reset_tick = 0U;
+static uint32_t s_overhead_cycles = 0U;    /* 一对BEGIN/END自身的开销，prof_init()中实测 */
+
+static void prof_update(prof_stats_t *stats, uint32_t cycles)
+{
+    uint32_t bin = (cycles != 0U) ? (31U - __CLZ(cycles)) : 0U;
+
+    stats->count++;
+    stats->total += cycles;
+    if (cycles < stats->min)
+    {
+        stats->min = cycles;
+    }
+    if (cycles > stats->max)
+    {
+        stats->max = cycles;
+    }
+    stats->hist[bin]++;
+}
+
+static void prof_clear(void)
+{
+    memset(s_stats, 0, sizeof(s_stats));
+    for (uint32_t i = 0U; i < PROF_ZONE_COUNT; i++)
+    {
+        s_stats[i].min = 0xFFFFFFFFUL;
+    }
+    s_reset_tick = HAL_GetTick();
+}
+
+void prof_init(void)
+{
+    prof_stats_t dummy;
+    uint32_t start;
+
+    sys_dwt_enable();
+
+    memset(&dummy, 0, sizeof(dummy));
+    start = DWT->CYCCNT;
+    prof_update(&dummy, DWT->CYCCNT - start);
+    s_overhead_cycles = DWT->CYCCNT - start;
+
+    prof_clear();
+}
+
+void prof_reset(void)
+{
+    prof_clear();
+    scheduler_reset_stats();
+}
+
+ITCM_CODE void prof_record(prof_zone_t zone, uint32_t cycles)
+{
+    if ((uint32_t)zone < PROF_ZONE_COUNT)
+    {
+        prof_update(&s_stats[zone], cycles);
+    }
+}
+
+uint8_t prof_get_stats(prof_zone_t zone, prof_stats_t *stats)
+{
+    if ((uint32_t)zone >= PROF_ZONE_COUNT || stats == 0)
+    {
+        return 0U;
+    }
+
+    *stats = s_stats[zone];
+    return 1U;
+}
+
+/* 输出各区统计；load为该区累计耗时占统计时长的万分比，overhead为剖析自身开销的估算 */
+void prof_dump(void)
+{
+    uint32_t cycles_per_ms = SystemCoreClock / 1000U;
+    uint64_t elapsed = (uint64_t)(HAL_GetTick() - s_reset_tick) * cycles_per_ms;
+    uint64_t overhead = 0U;
+    scheduler_stats_t sched;
+
+    if (elapsed == 0U)
+    {
+        elapsed = 1U;
+    }
+
+    printf("\r\n[PROF] %lu ms, %lu cycles/us\r\n",
+           (unsigned long)(HAL_GetTick() - s_reset_tick), (unsigned long)(cycles_per_ms / 1000U));
+    printf("%-14s %8s %8s %8s %8s %7s\r\n", "zone", "count", "min", "mean", "max", "load%");
+
+    for (uint32_t i = 0U; i < PROF_ZONE_COUNT; i++)
+    {
+        const prof_stats_t *stats = &s_stats[i];
+        uint32_t load;
+
+        if (stats->count == 0U)
+        {
+            printf("%-14s %8u\r\n", s_zone_names[i], 0U);
+            continue;
+        }
+
+        load = (uint32_t)((stats->total * 10000U) / elapsed);
+        overhead += (uint64_t)stats->count * s_overhead_cycles;
+        printf("%-14s %8lu %8lu %8lu %8lu %4lu.%02lu\r\n", s_zone_names[i],
+               (unsigned long)stats->count,
+               (unsigned long)stats->min,
+               (unsigned long)(stats->total / stats->count),
+               (unsigned long)stats->max,
+               (unsigned long)(load / 100U), (unsigned long)(load % 100U));
+
+        printf("  hist:");
+        for (uint32_t bin = 0U; bin < PROF_HIST_BINS; bin++)
+        {
+            if (stats->hist[bin] != 0U)
+            {
+                printf(" 2^%lu:%lu", (unsigned long)bin, (unsigned long)stats->hist[bin]);
+            }
+        }
+        printf("\r\n");
+    }
+
+    scheduler_get_stats(&sched);
+    printf("sched busy %lu idle %lu cycles, overhead %lu cycles/zone (%lu.%02lu%%)\r\n",
+           (unsigned long)sched.busy_cycles_total,
+           (unsigned long)sched.idle_cycles_total,
+           (unsigned long)s_overhead_cycles,
+           (unsigned long)((overhead * 10000U / elapsed) / 100U),
+           (unsigned long)((overhead * 10000U / elapsed) % 100U));
+}
+
+/* 处理串口收到的一行命令（usart.c按回车换行断行），由调度器周期调用 */
+void prof_poll_command(void)
+{
+    uint16_t len;
+
+    if ((g_usart_rx_sta & 0x8000U) == 0U)
+    {
+        return;
+    }
+
+    len = g_usart_rx_sta & 0x3FFFU;
+    if (len == 4U && memcmp(g_usart_rx_buf, "prof", 4U) == 0)
+    {
+        prof_dump();
+    }
+    else if (len == 10U && memcmp(g_usart_rx_buf, "prof reset", 10U) == 0)
+    {
+        prof_reset();
+        printf("[PROF] reset\r\n");
+    }
+
+    g_usart_rx_sta = 0U;
+}
@@ -0,0 +1,49 @@
+#ifndef __PROFILER_H
+#define __PROFILER_H
+
+#include "./SYSTEM/sys/sys.h"
+#include "version.h"
+
+/* DWT周期计数器分区剖析：在函数入口/出口放置PROF_ZONE_BEGIN/END，按区记录次数、最小/最大/平均周期
+ * 和log2延迟直方图，串口发送"prof"输出统计、"prof reset"清零
+ * ENABLE_PROFILER为0时宏展开为空，不产生任何代码；统计只在主循环上下文记录，中断中不要使用
+ */
+
+/* 剖析区编号，新增区时同步修改profiler.c中的名称表 */
+typedef enum
+{
+    PROF_ZONE_LCD_GRAY16 = 0,       /* LCD_ShowPartialImage16Gray */
+    PROF_ZONE_MOTION_IS_MOVING,     /* motion_sensor_is_moving */
+    PROF_ZONE_DIGIPOT_WRITE,        /* digipot_write（TEC/WSD电位器写入） */
+    PROF_ZONE_KEY_SCAN,             /* key_scan */
+    PROF_ZONE_KEY_EVENT,            /* 按键事件处理（含调档刷新和输出同步） */
+    PROF_ZONE_COUNT
+} prof_zone_t;
+
+#define PROF_HIST_BINS          32U     /* 第i格统计周期数在[2^i, 2^(i+1))内的次数，0周期计入第0格 */
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t hist[PROF_HIST_BINS];
+} prof_stats_t;
+
+#if ENABLE_PROFILER
+#define PROF_ZONE_BEGIN(zone)   uint32_t prof_start_##zone = DWT->CYCCNT
+#define PROF_ZONE_END(zone)     prof_record((zone), DWT->CYCCNT - prof_start_##zone)
+#else
+#define PROF_ZONE_BEGIN(zone)
+#define PROF_ZONE_END(zone)
+#endif
+
+void prof_init(void);
+void prof_reset(void);
+void prof_record(prof_zone_t zone, uint32_t cycles);
+uint8_t prof_get_stats(prof_zone_t zone, prof_stats_t *stats);
+void prof_dump(void);
+void prof_poll_command(void);
+
+#endif
@@ -0,0 +1,311 @@
+#include "qspi.h"
+#include "lcd.h"
+
+#define W25Q_CMD_WRITE_ENABLE           0x06U
+#define W25Q_CMD_READ_SR1               0x05U
+#define W25Q_CMD_READ_SR2               0x35U
+#define W25Q_CMD_WRITE_SR2              0x31U
+#define W25Q_CMD_ENABLE_RESET           0x66U
+#define W25Q_CMD_RESET                  0x99U
+#define W25Q_CMD_JEDEC_ID               0x9FU
+#define W25Q_CMD_FAST_READ_QUAD_IO      0xEBU   /* 地址/模式位/数据均为4线，模式位后4个空周期 */
+#define W25Q_CMD_FAST_READ_QUAD_IO_DTR  0xEDU
+
+#define W25Q_SR1_BUSY                   0x01U
+#define W25Q_SR2_QE                     0x02U
+#define W25Q_CONTINUOUS_READ_MODE       0x20U   /* 模式位M5-4=10：后续读取省略指令，配合SIOO */
+
+#define QSPI_CMD_TIMEOUT_MS             10U
+#define QSPI_WRITE_SR_TIMEOUT_MS        50U     /* 写状态寄存器tW最大15ms */
+
+static QSPI_HandleTypeDef s_qspi_handle;
+static uint8_t s_qspi_memmapped = 0U;
+static uint32_t s_qspi_jedec_id = 0U;
+static volatile uint32_t s_qspi_read_sink;
+
+static void qspi_gpio_init(void)
+{
+    GPIO_InitTypeDef gpio = {0};
+
+    QSPI_GPIO_CLK_ENABLE();
+
+    gpio.Mode = GPIO_MODE_AF_PP;
+    gpio.Pull = GPIO_NOPULL;
+    gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+
+    gpio.Pin = QSPI_CLK_PIN;
+    gpio.Alternate = QSPI_CLK_AF;
+    HAL_GPIO_Init(QSPI_CLK_PORT, &gpio);
+    gpio.Pin = QSPI_IO0_PIN;
+    gpio.Alternate = QSPI_IO0_AF;
+    HAL_GPIO_Init(QSPI_IO0_PORT, &gpio);
+    gpio.Pin = QSPI_IO1_PIN;
+    gpio.Alternate = QSPI_IO1_AF;
+    HAL_GPIO_Init(QSPI_IO1_PORT, &gpio);
+    gpio.Pin = QSPI_IO2_PIN;
+    gpio.Alternate = QSPI_IO2_AF;
+    HAL_GPIO_Init(QSPI_IO2_PORT, &gpio);
+    gpio.Pin = QSPI_IO3_PIN;
+    gpio.Alternate = QSPI_IO3_AF;
+    HAL_GPIO_Init(QSPI_IO3_PORT, &gpio);
+
+    /* 片选上拉，QSPI未接管前保持不选中 */
+    gpio.Pull = GPIO_PULLUP;
+    gpio.Pin = QSPI_NCS_PIN;
+    gpio.Alternate = QSPI_NCS_AF;
+    HAL_GPIO_Init(QSPI_NCS_PORT, &gpio);
+}
+
+/* 单线指令，可选单线数据阶段，无地址 */
+static void qspi_cmd_init(QSPI_CommandTypeDef *cmd, uint8_t instruction, uint32_t data_mode, uint32_t nbytes)
+{
+    cmd->InstructionMode = QSPI_INSTRUCTION_1_LINE;
+    cmd->Instruction = instruction;
+    cmd->AddressMode = QSPI_ADDRESS_NONE;
+    cmd->AddressSize = QSPI_ADDRESS_24_BITS;
+    cmd->Address = 0U;
+    cmd->AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
+    cmd->AlternateBytesSize = QSPI_ALTERNATE_BYTES_8_BITS;
+    cmd->AlternateBytes = 0U;
+    cmd->DummyCycles = 0U;
+    cmd->DataMode = data_mode;
+    cmd->NbData = nbytes;
+    cmd->DdrMode = QSPI_DDR_MODE_DISABLE;
+    cmd->DdrHoldHalfCycle = QSPI_DDR_HHC_ANALOG_DELAY;
+    cmd->SIOOMode = QSPI_SIOO_INST_EVERY_CMD;
+}
+
+static HAL_StatusTypeDef qspi_send_cmd(uint8_t instruction)
+{
+    QSPI_CommandTypeDef cmd;
+
+    qspi_cmd_init(&cmd, instruction, QSPI_DATA_NONE, 0U);
+    return HAL_QSPI_Command(&s_qspi_handle, &cmd, QSPI_CMD_TIMEOUT_MS);
+}
+
+static HAL_StatusTypeDef qspi_read_reg(uint8_t instruction, uint8_t *buffer, uint32_t len)
+{
+    QSPI_CommandTypeDef cmd;
+
+    qspi_cmd_init(&cmd, instruction, QSPI_DATA_1_LINE, len);
+    if (HAL_QSPI_Command(&s_qspi_handle, &cmd, QSPI_CMD_TIMEOUT_MS) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+    return HAL_QSPI_Receive(&s_qspi_handle, buffer, QSPI_CMD_TIMEOUT_MS);
+}
+
+static HAL_StatusTypeDef qspi_write_reg(uint8_t instruction, uint8_t *buffer, uint32_t len)
+{
+    QSPI_CommandTypeDef cmd;
+
+    qspi_cmd_init(&cmd, instruction, QSPI_DATA_1_LINE, len);
+    if (HAL_QSPI_Command(&s_qspi_handle, &cmd, QSPI_CMD_TIMEOUT_MS) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+    return HAL_QSPI_Transmit(&s_qspi_handle, buffer, QSPI_CMD_TIMEOUT_MS);
+}
+
+/* 硬件自动轮询SR1直到BUSY清零 */
+static HAL_StatusTypeDef qspi_wait_ready(uint32_t timeout_ms)
+{
+    QSPI_CommandTypeDef cmd;
+    QSPI_AutoPollingTypeDef cfg = {0};
+
+    qspi_cmd_init(&cmd, W25Q_CMD_READ_SR1, QSPI_DATA_1_LINE, 1U);
+    cfg.Match = 0U;
+    cfg.Mask = W25Q_SR1_BUSY;
+    cfg.MatchMode = QSPI_MATCH_MODE_AND;
+    cfg.StatusBytesSize = 1U;
+    cfg.Interval = 0x10U;
+    cfg.AutomaticStop = QSPI_AUTOMATIC_STOP_ENABLE;
+    return HAL_QSPI_AutoPolling(&s_qspi_handle, &cmd, &cfg, timeout_ms);
+}
+
+/* MCU复位而FLASH未掉电时，FLASH可能仍处于连续读模式（等待地址而非指令），
+ * 以4线发送8个时钟的全1（地址+模式位均为FF）使其退出，再发复位指令
+ */
+static void qspi_exit_continuous_read(void)
+{
+    QSPI_CommandTypeDef cmd;
+
+    qspi_cmd_init(&cmd, 0U, QSPI_DATA_NONE, 0U);
+    cmd.InstructionMode = QSPI_INSTRUCTION_NONE;
+    cmd.AddressMode = QSPI_ADDRESS_4_LINES;
+    cmd.AddressSize = QSPI_ADDRESS_32_BITS;
+    cmd.Address = 0xFFFFFFFFU;
+    (void)HAL_QSPI_Command(&s_qspi_handle, &cmd, QSPI_CMD_TIMEOUT_MS);
+}
+
+/* 置位SR2的QE位（非易失），允许4线读取 */
+static HAL_StatusTypeDef qspi_enable_quad(void)
+{
+    uint8_t sr2;
+
+    if (qspi_read_reg(W25Q_CMD_READ_SR2, &sr2, 1U) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+    if ((sr2 & W25Q_SR2_QE) != 0U)
+    {
+        return HAL_OK;
+    }
+
+    sr2 |= W25Q_SR2_QE;
+    if (qspi_send_cmd(W25Q_CMD_WRITE_ENABLE) != HAL_OK ||
+        qspi_write_reg(W25Q_CMD_WRITE_SR2, &sr2, 1U) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+    return qspi_wait_ready(QSPI_WRITE_SR_TIMEOUT_MS);
+}
+
+static HAL_StatusTypeDef qspi_enter_memmap(void)
+{
+    QSPI_CommandTypeDef cmd;
+    QSPI_MemoryMappedTypeDef cfg = {0};
+
+#if QSPI_USE_DDR
+    qspi_cmd_init(&cmd, W25Q_CMD_FAST_READ_QUAD_IO_DTR, QSPI_DATA_4_LINES, 0U);
+    cmd.DummyCycles = QSPI_DDR_DUMMY_CYCLES;
+    cmd.DdrMode = QSPI_DDR_MODE_ENABLE;
+#else
+    qspi_cmd_init(&cmd, W25Q_CMD_FAST_READ_QUAD_IO, QSPI_DATA_4_LINES, 0U);
+    cmd.DummyCycles = 4U;
+#endif
+    cmd.AddressMode = QSPI_ADDRESS_4_LINES;
+    cmd.AddressSize = QSPI_ADDRESS_24_BITS;
+    cmd.AlternateByteMode = QSPI_ALTERNATE_BYTES_4_LINES;
+    cmd.AlternateBytesSize = QSPI_ALTERNATE_BYTES_8_BITS;
+    cmd.AlternateBytes = W25Q_CONTINUOUS_READ_MODE;
+    cmd.SIOOMode = QSPI_SIOO_INST_ONLY_FIRST_CMD;
+
+    cfg.TimeOutActivation = (QSPI_MEMMAP_TIMEOUT_CYCLES == 0U) ? QSPI_TIMEOUT_COUNTER_DISABLE : QSPI_TIMEOUT_COUNTER_ENABLE;
+    cfg.TimeOutPeriod = QSPI_MEMMAP_TIMEOUT_CYCLES;
+    return HAL_QSPI_MemoryMapped(&s_qspi_handle, &cmd, &cfg);
+}
+
+/**
+ * @brief       初始化QSPI FLASH并进入内存映射模式
+ * @param       无
+ * @retval      0, 成功; 1, 失败（时钟脚被LCD_RST占用、未检测到FLASH或配置失败，0x90000000不可访问）
+ * @note        需在时钟初始化之后、访问任何位于QSPI的代码或资源之前调用
+ */
+uint8_t qspi_init(void)
+{
+    uint8_t id[3];
+
+    s_qspi_memmapped = 0U;
+
+    if (QSPI_CLK_PORT == LCD_RST_PORT && QSPI_CLK_PIN == LCD_RST_PIN)
+    {
+        return 1;
+    }
+
+    __HAL_RCC_QSPI_CLK_ENABLE();
+    __HAL_RCC_QSPI_FORCE_RESET();
+    __HAL_RCC_QSPI_RELEASE_RESET();
+    qspi_gpio_init();
+
+    s_qspi_handle.Instance = QUADSPI;
+    s_qspi_handle.Init.ClockPrescaler = QSPI_CLOCK_PRESCALER;
+    s_qspi_handle.Init.FifoThreshold = 4U;
+#if QSPI_USE_DDR
+    s_qspi_handle.Init.SampleShifting = QSPI_SAMPLE_SHIFTING_NONE;
+#else
+    s_qspi_handle.Init.SampleShifting = QSPI_SAMPLE_SHIFTING_HALFCYCLE;    /* 高频下补偿走线和FLASH输出延时 */
+#endif
+    s_qspi_handle.Init.FlashSize = QSPI_FLASH_SIZE_POS - 1U;
+    s_qspi_handle.Init.ChipSelectHighTime = QSPI_CS_HIGH_TIME_5_CYCLE;
+    s_qspi_handle.Init.ClockMode = QSPI_CLOCK_MODE_0;
+    s_qspi_handle.Init.FlashID = QSPI_FLASH_ID_1;
+    s_qspi_handle.Init.DualFlash = QSPI_DUALFLASH_DISABLE;
+    if (HAL_QSPI_Init(&s_qspi_handle) != HAL_OK)
+    {
+        return 1;
+    }
+
+    qspi_exit_continuous_read();
+    if (qspi_send_cmd(W25Q_CMD_ENABLE_RESET) != HAL_OK || qspi_send_cmd(W25Q_CMD_RESET) != HAL_OK)
+    {
+        return 1;
+    }
+    HAL_Delay(1);   /* tRST最大30us */
+
+    if (qspi_read_reg(W25Q_CMD_JEDEC_ID, id, 3U) != HAL_OK)
+    {
+        return 1;
+    }
+    s_qspi_jedec_id = ((uint32_t)id[0] << 16) | ((uint32_t)id[1] << 8) | id[2];
+    if (id[0] == 0x00U || id[0] == 0xFFU)
+    {
+        return 1;   /* 总线上没有器件 */
+    }
+
+    if (qspi_enable_quad() != HAL_OK || qspi_enter_memmap() != HAL_OK)
+    {
+        return 1;
+    }
+
+    s_qspi_memmapped = 1U;
+    return 0;
+}
+
+uint8_t qspi_is_memmapped(void)
+{
+    return s_qspi_memmapped;
+}
+
+/* JEDEC ID：制造商(0xEF为Winbond)、存储类型、容量 */
+uint32_t qspi_get_jedec_id(void)
+{
+    return s_qspi_jedec_id;
+}
+
+uint8_t qspi_is_mapped_addr(const void *addr)
+{
+    uint32_t a = (uint32_t)addr;
+
+    return (a >= QSPI_MEMMAP_ADDR && a < QSPI_MEMMAP_ADDR + QSPI_FLASH_SIZE) ? 1U : 0U;
+}
+
+/**
+ * @brief       测量内存映射顺序读取带宽
+ * @param       offset: FLASH内偏移（向下对齐到Cache行）
+ * @param       size: 读取字节数（按4字节取整）
+ * @param       result: 测量结果
+ * @retval      无
+ * @note        先使该范围的D-Cache失效，测得的是QSPI实际读取速度（含预取）而非Cache命中
+ */
+void qspi_measure_read_bandwidth(uint32_t offset, uint32_t size, qspi_bandwidth_t *result)
+{
+    const volatile uint32_t *src = (const volatile uint32_t *)(QSPI_MEMMAP_ADDR + (offset & ~0x1FU));
+    uint32_t words = size / 4U;
+    uint32_t sum = 0U;
+    uint32_t start;
+
+    result->bytes = words * 4U;
+    result->cycles = 0U;
+    result->bytes_per_sec = 0U;
+    if (!s_qspi_memmapped || words == 0U)
+    {
+        return;
+    }
+
+    sys_dwt_enable();
+
+    SCB_InvalidateDCache_by_Addr((uint32_t *)src, (int32_t)result->bytes);
+    start = DWT->CYCCNT;
+    for (uint32_t i = 0U; i < words; i++)
+    {
+        sum += src[i];
+    }
+    result->cycles = DWT->CYCCNT - start;
+    s_qspi_read_sink = sum;
+
+    if (result->cycles != 0U)
+    {
+        result->bytes_per_sec = (uint32_t)(((uint64_t)result->bytes * SystemCoreClock) / result->cycles);
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef __QSPI_H
+#define __QSPI_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/* W25Q系列QSPI FLASH（BK1），初始化后进入内存映射模式，0x90000000起可直接读取/执行
+ * 本模块与HAL QSPI/GPIO/RCC在XIP配置下必须留在内部FLASH（见User/SCRIPT/jyg_pro.sct），
+ * 且进入内存映射后不再发送其它命令（H7的QSPI不支持映射读取期间写FLASH）
+ */
+#define QSPI_MEMMAP_ADDR            0x90000000U
+#define QSPI_FLASH_SIZE             (8U * 1024U * 1024U)    /* W25Q64 */
+#define QSPI_FLASH_SIZE_POS         23U                     /* log2(QSPI_FLASH_SIZE) */
+
+/* 引脚（STM32H750VBT6，LQFP100）：该封装的QUADSPI_CLK只有PB2，而PB2现为LCD_RST，
+ * 需改板把LCD_RST移到其它引脚后才能使用QSPI；引脚冲突时qspi_init()直接返回失败，不接管PB2
+ * PB6/PD11/PD12/PE2/PD13当前未被占用
+ */
+#define QSPI_CLK_PORT               GPIOB
+#define QSPI_CLK_PIN                GPIO_PIN_2
+#define QSPI_CLK_AF                 GPIO_AF9_QUADSPI
+#define QSPI_NCS_PORT               GPIOB
+#define QSPI_NCS_PIN                GPIO_PIN_6
+#define QSPI_NCS_AF                 GPIO_AF10_QUADSPI
+#define QSPI_IO0_PORT               GPIOD
+#define QSPI_IO0_PIN                GPIO_PIN_11
+#define QSPI_IO0_AF                 GPIO_AF9_QUADSPI
+#define QSPI_IO1_PORT               GPIOD
+#define QSPI_IO1_PIN                GPIO_PIN_12
+#define QSPI_IO1_AF                 GPIO_AF9_QUADSPI
+#define QSPI_IO2_PORT               GPIOE
+#define QSPI_IO2_PIN                GPIO_PIN_2
+#define QSPI_IO2_AF                 GPIO_AF9_QUADSPI
+#define QSPI_IO3_PORT               GPIOD
+#define QSPI_IO3_PIN                GPIO_PIN_13
+#define QSPI_IO3_AF                 GPIO_AF9_QUADSPI
+#define QSPI_GPIO_CLK_ENABLE()      do{ __HAL_RCC_GPIOB_CLK_ENABLE(); __HAL_RCC_GPIOD_CLK_ENABLE(); __HAL_RCC_GPIOE_CLK_ENABLE(); }while(0)
+
+/* 读取时序（内核时钟为rcc_hclk3=240MHz）：
+ * 分频系数N -> SCK = 240 / (N + 1)MHz：1 -> 120MHz（W25Q64JV 0xEB最高133MHz），2 -> 80MHz，3 -> 60MHz
+ * 顺序读取带宽上限约为 SCK × 4bit，SDR 120MHz时约60MB/s；这只是理论值，实际带宽尚未在硬件上测量，
+ * 需改板后用ENABLE_QSPI_BENCHMARK实测
+ */
+#ifndef QSPI_CLOCK_PRESCALER
+#define QSPI_CLOCK_PRESCALER        1U
+#endif
+
+/* DDR（DTR）读取：只有型号带DTR的W25Q（如W25Q64JV-DTR，指令0xED）支持，
+ * 普通W25Q64JV必须保持0；开启后采样不再移半周期
+ */
+#ifndef QSPI_USE_DDR
+#define QSPI_USE_DDR                0
+#endif
+#define QSPI_DDR_DUMMY_CYCLES       6U
+
+/* 内存映射预取：0表示关闭超时计数，映射读取结束后片选保持有效、QSPI继续顺序预取，
+ * 适合逐段流式读取图片；非0时空闲该周期数后释放片选（省电，但下次读取需重新发地址）
+ */
+#ifndef QSPI_MEMMAP_TIMEOUT_CYCLES
+#define QSPI_MEMMAP_TIMEOUT_CYCLES  0U
+#endif
+
+/* 顺序读取带宽测量结果 */
+typedef struct
+{
+    uint32_t bytes;
+    uint32_t cycles;                /* DWT周期数，CPU主频480MHz */
+    uint32_t bytes_per_sec;
+} qspi_bandwidth_t;
+
+uint8_t qspi_init(void);
+uint8_t qspi_is_memmapped(void);
+uint32_t qspi_get_jedec_id(void);
+uint8_t qspi_is_mapped_addr(const void *addr);
+void qspi_measure_read_bandwidth(uint32_t offset, uint32_t size, qspi_bandwidth_t *result);
+
+#endif
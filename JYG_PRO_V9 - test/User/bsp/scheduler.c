@@ -0,0 +1,228 @@
+#include "scheduler.h"
+#include <string.h>
+
+typedef struct
+{
+    scheduler_task_fn_t fn;
+    uint32_t next_run;
+    scheduler_task_stats_t stats;
+} scheduler_task_t;
+
+static scheduler_task_t s_tasks[SCHEDULER_MAX_TASKS];
+static uint8_t s_task_count = 0U;
+
+static scheduler_event_t s_event_queue[SCHEDULER_EVENT_QUEUE_SIZE];
+static volatile uint32_t s_event_head = 0U;     /* 写入位置（可在中断中投递） */
+static volatile uint32_t s_event_tail = 0U;     /* 读取位置（仅在主循环中处理） */
+
+static scheduler_event_handler_t s_event_handler = 0;
+static scheduler_idle_hook_t s_idle_hook = 0;
+static scheduler_stats_t s_stats;
+
+void scheduler_init(void)
+{
+    memset(s_tasks, 0, sizeof(s_tasks));
+    s_task_count = 0U;
+    s_event_head = 0U;
+    s_event_tail = 0U;
+    s_event_handler = 0;
+    s_idle_hook = 0;
+    memset(&s_stats, 0, sizeof(s_stats));
+}
+
+/**
+ * 添加周期任务，offset_ms用于错开多个同周期任务的首次运行时刻
+ * 返回任务序号，任务表已满时返回-1
+ */
+int8_t scheduler_add_task(const char *name, scheduler_task_fn_t fn, uint32_t period_ms, uint32_t offset_ms)
+{
+    scheduler_task_t *task;
+
+    if (fn == 0 || period_ms == 0U || s_task_count >= SCHEDULER_MAX_TASKS)
+    {
+        return -1;
+    }
+
+    task = &s_tasks[s_task_count];
+    task->fn = fn;
+    task->next_run = HAL_GetTick() + offset_ms;
+    memset(&task->stats, 0, sizeof(task->stats));
+    task->stats.name = name;
+    task->stats.period_ms = period_ms;
+
+    return (int8_t)s_task_count++;
+}
+
+void scheduler_set_event_handler(scheduler_event_handler_t handler)
+{
+    s_event_handler = handler;
+}
+
+void scheduler_set_idle_hook(scheduler_idle_hook_t hook)
+{
+    s_idle_hook = hook;
+}
+
+/* 投递事件（可在中断中调用），队列满时返回0 */
+uint8_t scheduler_post_event(uint16_t id, uint16_t data)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint8_t ok = 0U;
+
+    __disable_irq();
+    if ((s_event_head - s_event_tail) < SCHEDULER_EVENT_QUEUE_SIZE)
+    {
+        scheduler_event_t *event = &s_event_queue[s_event_head & (SCHEDULER_EVENT_QUEUE_SIZE - 1U)];
+        event->id = id;
+        event->data = data;
+        s_event_head++;
+        ok = 1U;
+    }
+    else
+    {
+        s_stats.events_dropped++;
+    }
+    __set_PRIMASK(primask);
+
+    return ok;
+}
+
+static uint8_t scheduler_dispatch_events(void)
+{
+    uint8_t handled = 0U;
+
+    while (s_event_tail != s_event_head)
+    {
+        scheduler_event_t event = s_event_queue[s_event_tail & (SCHEDULER_EVENT_QUEUE_SIZE - 1U)];
+        s_event_tail++;
+
+        if (s_event_handler != 0)
+        {
+            s_event_handler(&event);
+        }
+        s_stats.events_dispatched++;
+        handled = 1U;
+    }
+
+    return handled;
+}
+
+static void scheduler_run_task(scheduler_task_t *task, uint32_t now)
+{
+    scheduler_task_stats_t *stats = &task->stats;
+    uint32_t late = now - task->next_run;
+    uint32_t start;
+    uint32_t cycles;
+
+    if (late > stats->late_max_ms)
+    {
+        stats->late_max_ms = late;
+    }
+
+    /* 按固定节拍推进；延迟超过一个周期时跳过错过的周期，避免连续补跑 */
+    task->next_run += stats->period_ms;
+    if ((int32_t)(now - task->next_run) >= 0)
+    {
+        stats->deadline_misses++;
+        task->next_run = now + stats->period_ms;
+    }
+
+    start = DWT->CYCCNT;
+    task->fn();
+    cycles = DWT->CYCCNT - start;
+
+    stats->runs++;
+    stats->cycles_last = cycles;
+    stats->cycles_total += cycles;
+    if (cycles > stats->cycles_max)
+    {
+        stats->cycles_max = cycles;
+    }
+}
+
+/* 运行一轮：处理事件、执行到期任务，没有任何工作时休眠到下一次SysTick */
+void scheduler_run_once(void)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint8_t busy = scheduler_dispatch_events();
+
+    for (uint8_t i = 0U; i < s_task_count; i++)
+    {
+        uint32_t now = HAL_GetTick();
+
+        if ((int32_t)(now - s_tasks[i].next_run) >= 0)
+        {
+            scheduler_run_task(&s_tasks[i], now);
+            busy = 1U;
+        }
+
+        /* 任务产生的事件（如按键）立即处理，不等下一轮 */
+        if (scheduler_dispatch_events())
+        {
+            busy = 1U;
+        }
+    }
+
+    if (busy)
+    {
+        s_stats.busy_cycles_total += DWT->CYCCNT - start;
+        return;
+    }
+
+    if (s_idle_hook != 0 && s_idle_hook())
+    {
+        return;
+    }
+
+    start = DWT->CYCCNT;
+    __disable_irq();
+    if (s_event_tail == s_event_head)
+    {
+        __DSB();
+        __WFI();    /* 关中断下执行WFI：中断挂起即唤醒，开中断后再进入服务函数，不会丢失唤醒 */
+    }
+    __enable_irq();
+    s_stats.idle_cycles_total += DWT->CYCCNT - start;
+}
+
+void scheduler_run(void)
+{
+    while (1)
+    {
+        scheduler_run_once();
+    }
+}
+
+uint8_t scheduler_get_task_stats(uint8_t index, scheduler_task_stats_t *stats)
+{
+    if (index >= s_task_count || stats == 0)
+    {
+        return 0U;
+    }
+
+    *stats = s_tasks[index].stats;
+    return 1U;
+}
+
+void scheduler_get_stats(scheduler_stats_t *stats)
+{
+    if (stats != 0)
+    {
+        *stats = s_stats;
+    }
+}
+
+void scheduler_reset_stats(void)
+{
+    for (uint8_t i = 0U; i < s_task_count; i++)
+    {
+        scheduler_task_stats_t *stats = &s_tasks[i].stats;
+        stats->runs = 0U;
+        stats->cycles_last = 0U;
+        stats->cycles_max = 0U;
+        stats->cycles_total = 0U;
+        stats->late_max_ms = 0U;
+        stats->deadline_misses = 0U;
+    }
+    memset(&s_stats, 0, sizeof(s_stats));
+}
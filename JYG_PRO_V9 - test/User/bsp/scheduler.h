@@ -0,0 +1,57 @@
+#ifndef __SCHEDULER_H
+#define __SCHEDULER_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/* 协作式调度器：以HAL_GetTick()毫秒为时基，任务按各自周期运行，事件队列在任务之间分发，
+ * 没有到期任务和待处理事件时执行WFI休眠（SysTick每1ms唤醒一次）
+ */
+#define SCHEDULER_MAX_TASKS         8U
+#define SCHEDULER_EVENT_QUEUE_SIZE  16U     /* 需为2的幂 */
+
+typedef void (*scheduler_task_fn_t)(void);
+
+typedef struct
+{
+    uint16_t id;
+    uint16_t data;
+} scheduler_event_t;
+
+typedef void (*scheduler_event_handler_t)(const scheduler_event_t *event);
+
+/* 空闲钩子：返回1表示钩子内部已自行休眠（如进入STOP），本轮不再执行WFI */
+typedef uint8_t (*scheduler_idle_hook_t)(void);
+
+/* 任务运行统计（DWT周期计数，CPU主频480MHz） */
+typedef struct
+{
+    const char *name;
+    uint32_t period_ms;
+    uint32_t runs;              /* 运行次数 */
+    uint32_t cycles_last;       /* 最近一次耗时 */
+    uint32_t cycles_max;        /* 单次最大耗时 */
+    uint32_t cycles_total;      /* 累计耗时 */
+    uint32_t late_max_ms;       /* 相对计划运行时刻的最大延迟 */
+    uint32_t deadline_misses;   /* 延迟超过一个周期的次数（该周期被跳过） */
+} scheduler_task_stats_t;
+
+typedef struct
+{
+    uint32_t events_dispatched;
+    uint32_t events_dropped;    /* 队列满时丢弃的事件数 */
+    uint32_t idle_cycles_total; /* WFI休眠累计周期 */
+    uint32_t busy_cycles_total; /* 任务与事件处理累计周期 */
+} scheduler_stats_t;
+
+void scheduler_init(void);
+int8_t scheduler_add_task(const char *name, scheduler_task_fn_t fn, uint32_t period_ms, uint32_t offset_ms);
+void scheduler_set_event_handler(scheduler_event_handler_t handler);
+void scheduler_set_idle_hook(scheduler_idle_hook_t hook);
+uint8_t scheduler_post_event(uint16_t id, uint16_t data);
+void scheduler_run_once(void);
+void scheduler_run(void);
+uint8_t scheduler_get_task_stats(uint8_t index, scheduler_task_stats_t *stats);
+void scheduler_get_stats(scheduler_stats_t *stats);
+void scheduler_reset_stats(void);
+
+#endif
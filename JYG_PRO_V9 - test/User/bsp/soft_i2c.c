@@ -0,0 +1,314 @@
+#include "soft_i2c.h"
+#include "./SYSTEM/delay/delay.h"
+
+#define SOFT_I2C_SCL_LOW(bus)       ((bus)->scl_port->BSRR = (uint32_t)(bus)->scl_pin << 16U)
+#define SOFT_I2C_SCL_RELEASE(bus)   ((bus)->scl_port->BSRR = (uint32_t)(bus)->scl_pin)
+#define SOFT_I2C_SDA_LOW(bus)       ((bus)->sda_port->BSRR = (uint32_t)(bus)->sda_pin << 16U)
+#define SOFT_I2C_SDA_RELEASE(bus)   ((bus)->sda_port->BSRR = (uint32_t)(bus)->sda_pin)
+#define SOFT_I2C_SCL_READ(bus)      (((bus)->scl_port->IDR & (bus)->scl_pin) != 0U)
+#define SOFT_I2C_SDA_READ(bus)      (((bus)->sda_port->IDR & (bus)->sda_pin) != 0U)
+
+/* 等到上一边沿之后半个周期；被中断打断而落后时以当前时间重新对齐，保证半周期不被压缩 */
+static void soft_i2c_tick(const soft_i2c_t *bus, uint32_t *t)
+{
+    uint32_t now;
+
+    while (((now = DWT->CYCCNT) - *t) < bus->half_period_cycles)
+    {
+    }
+
+    if ((now - *t) >= (bus->half_period_cycles * 2U))
+    {
+        *t = now;
+    }
+    else
+    {
+        *t += bus->half_period_cycles;
+    }
+}
+
+/* 释放SCL并等待其真正变高（支持从机时钟延展），返回0表示超时 */
+static uint8_t soft_i2c_scl_release(const soft_i2c_t *bus, uint32_t *t)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t timeout = SOFT_I2C_STRETCH_TIMEOUT_US * (SystemCoreClock / 1000000U);
+
+    SOFT_I2C_SCL_RELEASE(bus);
+    while (!SOFT_I2C_SCL_READ(bus))
+    {
+        if ((DWT->CYCCNT - start) >= timeout)
+        {
+            return 0U;
+        }
+    }
+
+    if ((DWT->CYCCNT - *t) >= bus->half_period_cycles)
+    {
+        *t = DWT->CYCCNT;   /* 被延展：从SCL实际上升沿开始计时 */
+    }
+    return 1U;
+}
+
+static uint8_t soft_i2c_start(const soft_i2c_t *bus, uint32_t *t)
+{
+    SOFT_I2C_SDA_RELEASE(bus);
+    soft_i2c_tick(bus, t);
+    if (!soft_i2c_scl_release(bus, t))
+    {
+        return 0U;
+    }
+    soft_i2c_tick(bus, t);
+    SOFT_I2C_SDA_LOW(bus);
+    soft_i2c_tick(bus, t);
+    SOFT_I2C_SCL_LOW(bus);
+    return 1U;
+}
+
+static void soft_i2c_stop(const soft_i2c_t *bus, uint32_t *t)
+{
+    SOFT_I2C_SDA_LOW(bus);
+    soft_i2c_tick(bus, t);
+    (void)soft_i2c_scl_release(bus, t);
+    soft_i2c_tick(bus, t);
+    SOFT_I2C_SDA_RELEASE(bus);
+    soft_i2c_tick(bus, t);
+}
+
+/* 发送一个字节，返回1表示从机应答 */
+static uint8_t soft_i2c_write_byte(const soft_i2c_t *bus, uint32_t *t, uint8_t value)
+{
+    uint8_t ack;
+
+    for (uint8_t i = 0U; i < 8U; i++)
+    {
+        if (value & 0x80U)
+        {
+            SOFT_I2C_SDA_RELEASE(bus);
+        }
+        else
+        {
+            SOFT_I2C_SDA_LOW(bus);
+        }
+        value <<= 1U;
+        soft_i2c_tick(bus, t);
+        if (!soft_i2c_scl_release(bus, t))
+        {
+            return 0U;
+        }
+        soft_i2c_tick(bus, t);
+        SOFT_I2C_SCL_LOW(bus);
+    }
+
+    SOFT_I2C_SDA_RELEASE(bus);
+    soft_i2c_tick(bus, t);
+    if (!soft_i2c_scl_release(bus, t))
+    {
+        return 0U;
+    }
+    soft_i2c_tick(bus, t);
+    ack = SOFT_I2C_SDA_READ(bus) ? 0U : 1U;
+    SOFT_I2C_SCL_LOW(bus);
+    return ack;
+}
+
+static uint8_t soft_i2c_read_byte(const soft_i2c_t *bus, uint32_t *t, uint8_t nack)
+{
+    uint8_t value = 0U;
+
+    SOFT_I2C_SDA_RELEASE(bus);
+    for (uint8_t i = 0U; i < 8U; i++)
+    {
+        soft_i2c_tick(bus, t);
+        (void)soft_i2c_scl_release(bus, t);
+        soft_i2c_tick(bus, t);
+        value = (uint8_t)((value << 1U) | (SOFT_I2C_SDA_READ(bus) ? 1U : 0U));
+        SOFT_I2C_SCL_LOW(bus);
+    }
+
+    if (nack)
+    {
+        SOFT_I2C_SDA_RELEASE(bus);
+    }
+    else
+    {
+        SOFT_I2C_SDA_LOW(bus);
+    }
+    soft_i2c_tick(bus, t);
+    (void)soft_i2c_scl_release(bus, t);
+    soft_i2c_tick(bus, t);
+    SOFT_I2C_SCL_LOW(bus);
+    SOFT_I2C_SDA_RELEASE(bus);
+
+    return value;
+}
+
+/* 发送起始条件、从机地址与寄存器号 */
+static uint8_t soft_i2c_begin(const soft_i2c_t *bus, uint32_t *t, uint8_t address, uint8_t reg)
+{
+    if (!soft_i2c_start(bus, t))
+    {
+        return 0U;
+    }
+    if (!soft_i2c_write_byte(bus, t, (uint8_t)(address << 1U)))
+    {
+        return 0U;
+    }
+    return soft_i2c_write_byte(bus, t, reg);
+}
+
+void soft_i2c_init(soft_i2c_t *bus, uint32_t freq_hz)
+{
+    GPIO_InitTypeDef gpio = {0};
+
+    if (freq_hz == 0U)
+    {
+        freq_hz = SOFT_I2C_DEFAULT_FREQ_HZ;
+    }
+    bus->half_period_cycles = SystemCoreClock / (freq_hz * 2U);
+    bus->measured_freq_hz = 0U;
+
+    sys_dwt_enable();
+
+    /* 先写1再切换为开漏输出，避免初始化瞬间拉低总线 */
+    SOFT_I2C_SCL_RELEASE(bus);
+    SOFT_I2C_SDA_RELEASE(bus);
+
+    gpio.Mode = GPIO_MODE_OUTPUT_OD;
+    gpio.Pull = GPIO_PULLUP;
+    gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+    gpio.Pin = bus->scl_pin;
+    HAL_GPIO_Init(bus->scl_port, &gpio);
+    gpio.Pin = bus->sda_pin;
+    HAL_GPIO_Init(bus->sda_port, &gpio);
+}
+
+HAL_StatusTypeDef soft_i2c_mem_write(const soft_i2c_t *bus, uint8_t address, uint8_t reg, const uint8_t *buffer, uint16_t len)
+{
+    uint32_t t = DWT->CYCCNT;
+
+    if (!soft_i2c_begin(bus, &t, address, reg))
+    {
+        soft_i2c_stop(bus, &t);
+        return HAL_ERROR;
+    }
+    for (uint16_t i = 0U; i < len; i++)
+    {
+        if (!soft_i2c_write_byte(bus, &t, buffer[i]))
+        {
+            soft_i2c_stop(bus, &t);
+            return HAL_ERROR;
+        }
+    }
+    soft_i2c_stop(bus, &t);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef soft_i2c_mem_read(const soft_i2c_t *bus, uint8_t address, uint8_t reg, uint8_t *buffer, uint16_t len)
+{
+    uint32_t t = DWT->CYCCNT;
+
+    if (!soft_i2c_begin(bus, &t, address, reg) ||
+        !soft_i2c_start(bus, &t) ||
+        !soft_i2c_write_byte(bus, &t, (uint8_t)((address << 1U) | 0x01U)))
+    {
+        soft_i2c_stop(bus, &t);
+        return HAL_ERROR;
+    }
+
+    for (uint16_t i = 0U; i < len; i++)
+    {
+        buffer[i] = soft_i2c_read_byte(bus, &t, (i + 1U == len) ? 1U : 0U);
+    }
+
+    soft_i2c_stop(bus, &t);
+    return HAL_OK;
+}
+
+/* 总线恢复：SDA被从机拉低时输出最多9个时钟，再产生STOP */
+void soft_i2c_bus_clear(const soft_i2c_t *bus)
+{
+    uint32_t t = DWT->CYCCNT;
+
+    SOFT_I2C_SDA_RELEASE(bus);
+    for (uint8_t i = 0U; i < 9U && !SOFT_I2C_SDA_READ(bus); i++)
+    {
+        SOFT_I2C_SCL_LOW(bus);
+        soft_i2c_tick(bus, &t);
+        (void)soft_i2c_scl_release(bus, &t);
+        soft_i2c_tick(bus, &t);
+    }
+    SOFT_I2C_SCL_LOW(bus);
+    soft_i2c_tick(bus, &t);
+    soft_i2c_stop(bus, &t);
+}
+
+/**
+ * 引脚回环自检：在不产生有效地址帧的前提下驱动并回读SCL/SDA，
+ * 检查上拉、引脚配置和从机占用情况，并以9个空时钟实测SCL频率
+ * 返回SOFT_I2C_TEST_*故障位，0表示通过
+ */
+uint8_t soft_i2c_self_test(soft_i2c_t *bus)
+{
+    uint8_t result = SOFT_I2C_TEST_OK;
+    uint32_t t;
+    uint32_t cycles;
+    uint32_t target;
+
+    SOFT_I2C_SDA_RELEASE(bus);
+    SOFT_I2C_SCL_RELEASE(bus);
+    delay_us(10);
+
+    if (!SOFT_I2C_SCL_READ(bus))
+    {
+        return SOFT_I2C_TEST_SCL_STUCK_LOW;
+    }
+
+    SOFT_I2C_SCL_LOW(bus);
+    delay_us(2);
+    if (SOFT_I2C_SCL_READ(bus))
+    {
+        result |= SOFT_I2C_TEST_SCL_STUCK_HIGH;
+    }
+    SOFT_I2C_SCL_RELEASE(bus);
+    delay_us(10);
+
+    if (!SOFT_I2C_SDA_READ(bus))
+    {
+        soft_i2c_bus_clear(bus);
+        if (!SOFT_I2C_SDA_READ(bus))
+        {
+            return result | SOFT_I2C_TEST_SDA_STUCK_LOW;
+        }
+    }
+
+    /* SCL为高时拉低再释放SDA：总线上表现为START紧跟STOP，从机不会响应 */
+    SOFT_I2C_SDA_LOW(bus);
+    delay_us(2);
+    if (SOFT_I2C_SDA_READ(bus))
+    {
+        result |= SOFT_I2C_TEST_SDA_STUCK_HIGH;
+    }
+    SOFT_I2C_SDA_RELEASE(bus);
+    delay_us(10);
+
+    /* SDA保持高电平输出9个时钟，测量实际周期 */
+    t = DWT->CYCCNT;
+    cycles = t;
+    for (uint8_t i = 0U; i < 9U; i++)
+    {
+        SOFT_I2C_SCL_LOW(bus);
+        soft_i2c_tick(bus, &t);
+        (void)soft_i2c_scl_release(bus, &t);
+        soft_i2c_tick(bus, &t);
+    }
+    cycles = DWT->CYCCNT - cycles;
+
+    bus->measured_freq_hz = (cycles != 0U) ? (uint32_t)(((uint64_t)SystemCoreClock * 9U) / cycles) : 0U;
+    target = SystemCoreClock / (bus->half_period_cycles * 2U);
+    if (bus->measured_freq_hz < (target - target / 10U) || bus->measured_freq_hz > (target + target / 10U))
+    {
+        result |= SOFT_I2C_TEST_FREQ_ERROR;
+    }
+
+    return result;
+}
@@ -0,0 +1,37 @@
+#ifndef __SOFT_I2C_H
+#define __SOFT_I2C_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/* 通用软件I2C：引脚固定为开漏输出+上拉，通过BSRR拉低/释放，IDR回读，无需切换输入/输出模式；
+ * 半周期由DWT周期计数器按绝对时间推进，不受Cache状态和代码执行时间影响
+ */
+#define SOFT_I2C_DEFAULT_FREQ_HZ        400000U
+#define SOFT_I2C_STRETCH_TIMEOUT_US     1000U    /* 从机时钟延展最长等待时间 */
+
+/* soft_i2c_self_test() 返回的故障位 */
+#define SOFT_I2C_TEST_OK                0x00U
+#define SOFT_I2C_TEST_SCL_STUCK_LOW     0x01U    /* 释放后SCL不能回到高电平（缺上拉或被拉住） */
+#define SOFT_I2C_TEST_SDA_STUCK_LOW     0x02U    /* 9个时钟后SDA仍被从机拉低 */
+#define SOFT_I2C_TEST_SCL_STUCK_HIGH    0x04U    /* 驱动低电平后回读仍为高（引脚配置错误或短路） */
+#define SOFT_I2C_TEST_SDA_STUCK_HIGH    0x08U
+#define SOFT_I2C_TEST_FREQ_ERROR        0x10U    /* 实测SCL频率偏离目标超过10% */
+
+typedef struct
+{
+    GPIO_TypeDef *scl_port;
+    uint16_t scl_pin;
+    GPIO_TypeDef *sda_port;
+    uint16_t sda_pin;
+    uint32_t half_period_cycles;    /* 由soft_i2c_init()根据SystemCoreClock计算 */
+    uint32_t measured_freq_hz;      /* soft_i2c_self_test()实测的SCL频率 */
+} soft_i2c_t;
+
+/* 引脚时钟需由调用者先行使能 */
+void soft_i2c_init(soft_i2c_t *bus, uint32_t freq_hz);
+HAL_StatusTypeDef soft_i2c_mem_write(const soft_i2c_t *bus, uint8_t address, uint8_t reg, const uint8_t *buffer, uint16_t len);
+HAL_StatusTypeDef soft_i2c_mem_read(const soft_i2c_t *bus, uint8_t address, uint8_t reg, uint8_t *buffer, uint16_t len);
+void soft_i2c_bus_clear(const soft_i2c_t *bus);
+uint8_t soft_i2c_self_test(soft_i2c_t *bus);
+
+#endif
@@ -7,6 +7,8 @@
 #include "fan.h"
 #include "wsd.h"
 #include "motion_sensor.h"
+#include "low_power.h"
+#include "version.h"
 
 void system_init(void)
 {
@@ -19,5 +21,8 @@ void system_init(void)
     tec_init();      
     wsd_init();      
     motion_sensor_init(); 
+#if ENABLE_LOW_POWER_MODE
+    low_power_init();
+#endif
     
 }
@@ -1,6 +1,7 @@
 #include "tec.h"
 
 static I2C_HandleTypeDef s_tec_i2c;
+static digipot_t s_tec_digipot = {0};
 static uint8_t s_tec_initialized = 0U;
 static uint8_t s_tec_enabled = 0U;
 static uint8_t s_tec_power_percent = TEC_DEFAULT_POWER_PERCENT;
@@ -9,8 +10,6 @@ static uint8_t s_tec_power_percent = TEC_DEFAULT_POWER_PERCENT;
 #define TEC_I2C_TIMING_VALUE              0x30A0A7FBU
 #endif
 
-#define TEC_I2C_MAX_RETRY                 3U
-
 static inline uint8_t tec_clamp_percent(uint8_t value)
 {
     return (value > 127U) ? 127U : value;
@@ -36,32 +35,6 @@ static uint8_t tec_percent_to_wiper(uint8_t percent)
     return (uint8_t)percent;
 }
 
-static HAL_StatusTypeDef tec_write_wiper(uint8_t wiper_value)
-{
-    HAL_StatusTypeDef status = HAL_ERROR;
-    uint8_t retry = 0U;
-
-    while (retry < TEC_I2C_MAX_RETRY)
-    {
-        if (HAL_I2C_IsDeviceReady(&s_tec_i2c, (TEC_DIGIPOT_I2C_ADDRESS << 1U), 1U, TEC_I2C_TIMEOUT_MS) == HAL_OK)
-        {
-            status = HAL_I2C_Master_Transmit(&s_tec_i2c,
-                                             (TEC_DIGIPOT_I2C_ADDRESS << 1U),
-                                             &wiper_value,
-                                             1U,
-                                             TEC_I2C_TIMEOUT_MS);
-            if (status == HAL_OK)
-            {
-                break;
-            }
-        }
-        retry++;
-        HAL_Delay(2U);
-    }
-
-    return status;
-}
-
 static void tec_gpio_init(void)
 {
     GPIO_InitTypeDef gpio = {0};
@@ -116,6 +89,12 @@ static void tec_i2c_init(void)
     
     (void)HAL_I2CEx_ConfigAnalogFilter(&s_tec_i2c, I2C_ANALOGFILTER_ENABLE);
     (void)HAL_I2CEx_ConfigDigitalFilter(&s_tec_i2c, 0U);
+    digipot_register(&s_tec_digipot, &s_tec_i2c, TEC_DIGIPOT_I2C_ADDRESS);
+
+    HAL_NVIC_SetPriority(TEC_I2C_EV_IRQn, 2, 2);
+    HAL_NVIC_EnableIRQ(TEC_I2C_EV_IRQn);
+    HAL_NVIC_SetPriority(TEC_I2C_ER_IRQn, 2, 2);
+    HAL_NVIC_EnableIRQ(TEC_I2C_ER_IRQn);
 }
 
 void tec_init(void)
@@ -135,7 +114,7 @@ void tec_init(void)
 
     s_tec_initialized = 1U;
     s_tec_enabled = 0U;
-    (void)tec_write_wiper(tec_percent_to_wiper(s_tec_power_percent));
+    digipot_ramp_to(&s_tec_digipot, tec_percent_to_wiper(s_tec_power_percent));
 }
 
 void tec_on(void)
@@ -145,11 +124,18 @@ void tec_on(void)
         tec_init();
     }
 
+    /* 已使能时只调整目标，否则从曲线起始值软启动 */
+    if (s_tec_enabled)
+    {
+        digipot_ramp_to(&s_tec_digipot, tec_percent_to_wiper(s_tec_power_percent));
+    }
+    else
+    {
+        digipot_ramp_start(&s_tec_digipot, tec_percent_to_wiper(s_tec_power_percent));
+    }
+
     HAL_GPIO_WritePin(TEC_EN_GPIO_PORT, TEC_EN_GPIO_PIN, TEC_EN_ACTIVE_LEVEL);
     s_tec_enabled = 1U;
-
-    
-    (void)tec_write_wiper(tec_percent_to_wiper(s_tec_power_percent));
 }
 
 void tec_off(void)
@@ -161,6 +147,7 @@ void tec_off(void)
 
     HAL_GPIO_WritePin(TEC_EN_GPIO_PORT, TEC_EN_GPIO_PIN, TEC_EN_INACTIVE_LEVEL);
     s_tec_enabled = 0U;
+    digipot_ramp_stop(&s_tec_digipot);
 }
 
 uint8_t tec_get_state(void)
@@ -178,10 +165,34 @@ void tec_set_power(uint8_t power_level)
         tec_init();
     }
 
-    (void)tec_write_wiper(tec_percent_to_wiper(clamped));
+    /* 关闭期间只记录功率，使能时再软启动 */
+    if (s_tec_enabled)
+    {
+        digipot_ramp_to(&s_tec_digipot, tec_percent_to_wiper(clamped));
+    }
 }
 
 uint8_t tec_get_power(void)
 {
     return s_tec_power_percent;
 }
+
+void tec_set_ramp_profile(const digipot_ramp_profile_t *profile)
+{
+    digipot_set_profile(&s_tec_digipot, profile);
+}
+
+void tec_get_digipot_stats(digipot_stats_t *stats)
+{
+    digipot_get_stats(&s_tec_digipot, stats);
+}
+
+void TEC_I2C_EV_IRQHandler(void)
+{
+    HAL_I2C_EV_IRQHandler(&s_tec_i2c);
+}
+
+void TEC_I2C_ER_IRQHandler(void)
+{
+    HAL_I2C_ER_IRQHandler(&s_tec_i2c);
+}
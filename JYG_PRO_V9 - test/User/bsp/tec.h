@@ -2,6 +2,7 @@
 #define __TEC_H
 
 #include "./SYSTEM/sys/sys.h"
+#include "digipot.h"
 
 #define TEC_EN_GPIO_PORT                 GPIOE
 #define TEC_EN_GPIO_PIN                  GPIO_PIN_0
@@ -21,7 +22,10 @@
 
 #define TEC_DIGIPOT_I2C_ADDRESS          0x2FU
 
-#define TEC_I2C_TIMEOUT_MS               50U
+#define TEC_I2C_EV_IRQn                  I2C1_EV_IRQn
+#define TEC_I2C_EV_IRQHandler            I2C1_EV_IRQHandler
+#define TEC_I2C_ER_IRQn                  I2C1_ER_IRQn
+#define TEC_I2C_ER_IRQHandler            I2C1_ER_IRQHandler
 
 #define TEC_DEFAULT_POWER_PERCENT        100U
 
@@ -31,5 +35,7 @@ void tec_off(void);
 uint8_t tec_get_state(void);
 void tec_set_power(uint8_t power_level);  
 uint8_t tec_get_power(void);
+void tec_set_ramp_profile(const digipot_ramp_profile_t *profile);   /* NULL表示不限速 */
+void tec_get_digipot_stats(digipot_stats_t *stats);
 
 #endif
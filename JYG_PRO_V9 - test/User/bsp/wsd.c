@@ -1,6 +1,7 @@
 #include "wsd.h"
 
 static I2C_HandleTypeDef s_wsd_i2c;
+static digipot_t s_wsd_digipot = {0};
 static uint8_t s_wsd_initialized = 0U;
 static uint8_t s_wsd_enabled = 0U;
 static uint8_t s_wsd_i2c_ready = 0U;
@@ -10,8 +11,6 @@ static uint8_t s_wsd_level = WSD_LEVEL_MIN;
 #define WSD_I2C_TIMING_VALUE              0x30A0A7FBU   
 #endif
 
-#define WSD_I2C_MAX_RETRY                 3U
-
 /* 档位到数字电位器值的映射表
  * 档位1 (4V):  0x7F (127) - 最低档
  * 档位2 (6V):  0x60 (96)
@@ -85,39 +84,14 @@ static void wsd_i2c_init(void)
     {
         (void)HAL_I2CEx_ConfigAnalogFilter(&s_wsd_i2c, I2C_ANALOGFILTER_ENABLE);
         (void)HAL_I2CEx_ConfigDigitalFilter(&s_wsd_i2c, 0U);
-        s_wsd_i2c_ready = 1U;
-    }
-}
-
-static HAL_StatusTypeDef wsd_write_wiper(uint8_t wiper_value)
-{
-    HAL_StatusTypeDef status = HAL_ERROR;
-    uint8_t retry = 0U;
+        digipot_register(&s_wsd_digipot, &s_wsd_i2c, WSD_DIGIPOT_I2C_ADDRESS);
 
-    if (!s_wsd_i2c_ready)
-    {
-        return HAL_ERROR;
-    }
-
-    while (retry < WSD_I2C_MAX_RETRY)
-    {
-        if (HAL_I2C_IsDeviceReady(&s_wsd_i2c, (WSD_DIGIPOT_I2C_ADDRESS << 1U), 1U, WSD_I2C_TIMEOUT_MS) == HAL_OK)
-        {
-            status = HAL_I2C_Master_Transmit(&s_wsd_i2c,
-                                             (WSD_DIGIPOT_I2C_ADDRESS << 1U),
-                                             &wiper_value,
-                                             1U,
-                                             WSD_I2C_TIMEOUT_MS);
-            if (status == HAL_OK)
-            {
-                break;
-            }
-        }
-        retry++;
-        HAL_Delay(2U);
+        HAL_NVIC_SetPriority(WSD_I2C_EV_IRQn, 2, 2);
+        HAL_NVIC_EnableIRQ(WSD_I2C_EV_IRQn);
+        HAL_NVIC_SetPriority(WSD_I2C_ER_IRQn, 2, 2);
+        HAL_NVIC_EnableIRQ(WSD_I2C_ER_IRQn);
+        s_wsd_i2c_ready = 1U;
     }
-
-    return status;
 }
 
 static uint8_t wsd_level_to_wiper(uint8_t level)
@@ -141,7 +115,7 @@ void wsd_init(void)
 
     if (s_wsd_i2c_ready)
     {
-        (void)wsd_write_wiper(wsd_level_to_wiper(s_wsd_level));
+        digipot_ramp_to(&s_wsd_digipot, wsd_level_to_wiper(s_wsd_level));
     }
 }
 
@@ -152,13 +126,21 @@ void wsd_on(void)
         wsd_init();
     }
 
-    HAL_GPIO_WritePin(WSD_EN_GPIO_PORT, WSD_EN_GPIO_PIN, WSD_EN_ACTIVE_LEVEL);
-    s_wsd_enabled = 1U;
-
+    /* 已使能时只调整目标，否则从曲线起始值软启动 */
     if (s_wsd_i2c_ready)
     {
-        (void)wsd_write_wiper(wsd_level_to_wiper(s_wsd_level));
+        if (s_wsd_enabled)
+        {
+            digipot_ramp_to(&s_wsd_digipot, wsd_level_to_wiper(s_wsd_level));
+        }
+        else
+        {
+            digipot_ramp_start(&s_wsd_digipot, wsd_level_to_wiper(s_wsd_level));
+        }
     }
+
+    HAL_GPIO_WritePin(WSD_EN_GPIO_PORT, WSD_EN_GPIO_PIN, WSD_EN_ACTIVE_LEVEL);
+    s_wsd_enabled = 1U;
 }
 
 void wsd_off(void)
@@ -170,6 +152,10 @@ void wsd_off(void)
 
     HAL_GPIO_WritePin(WSD_EN_GPIO_PORT, WSD_EN_GPIO_PIN, WSD_EN_INACTIVE_LEVEL);
     s_wsd_enabled = 0U;
+    if (s_wsd_i2c_ready)
+    {
+        digipot_ramp_stop(&s_wsd_digipot);
+    }
 }
 
 uint8_t wsd_is_on(void)
@@ -187,9 +173,10 @@ void wsd_set_level(uint8_t level)
         wsd_init();
     }
 
-    if (s_wsd_i2c_ready)
+    /* 关闭期间只记录档位，使能时再软启动 */
+    if (s_wsd_i2c_ready && s_wsd_enabled)
     {
-        (void)wsd_write_wiper(wsd_level_to_wiper(clamped));
+        digipot_ramp_to(&s_wsd_digipot, wsd_level_to_wiper(clamped));
     }
 }
 
@@ -197,3 +184,23 @@ uint8_t wsd_get_level(void)
 {
     return s_wsd_level;
 }
+
+void wsd_set_ramp_profile(const digipot_ramp_profile_t *profile)
+{
+    digipot_set_profile(&s_wsd_digipot, profile);
+}
+
+void wsd_get_digipot_stats(digipot_stats_t *stats)
+{
+    digipot_get_stats(&s_wsd_digipot, stats);
+}
+
+void WSD_I2C_EV_IRQHandler(void)
+{
+    HAL_I2C_EV_IRQHandler(&s_wsd_i2c);
+}
+
+void WSD_I2C_ER_IRQHandler(void)
+{
+    HAL_I2C_ER_IRQHandler(&s_wsd_i2c);
+}
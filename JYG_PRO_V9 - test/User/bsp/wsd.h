@@ -2,6 +2,7 @@
 #define __WSD_H
 
 #include "./SYSTEM/sys/sys.h"
+#include "digipot.h"
 
 #define WSD_EN_GPIO_PORT                 GPIOE
 #define WSD_EN_GPIO_PIN                  GPIO_PIN_15
@@ -21,7 +22,10 @@
 
 #define WSD_DIGIPOT_I2C_ADDRESS          0x2FU
 
-#define WSD_I2C_TIMEOUT_MS               50U
+#define WSD_I2C_EV_IRQn                  I2C2_EV_IRQn
+#define WSD_I2C_EV_IRQHandler            I2C2_EV_IRQHandler
+#define WSD_I2C_ER_IRQn                  I2C2_ER_IRQn
+#define WSD_I2C_ER_IRQHandler            I2C2_ER_IRQHandler
 
 #define WSD_LEVEL_MIN                    1U
 #define WSD_LEVEL_MAX                    5U
@@ -32,5 +36,7 @@ void wsd_off(void);
 uint8_t wsd_is_on(void);
 void wsd_set_level(uint8_t level);
 uint8_t wsd_get_level(void);
+void wsd_set_ramp_profile(const digipot_ramp_profile_t *profile);   /* NULL表示不限速 */
+void wsd_get_digipot_stats(digipot_stats_t *stats);
 
 #endif
@@ -1,5 +1,6 @@
 #include "./SYSTEM/sys/sys.h"
 #include "./SYSTEM/delay/delay.h"
+#include "./SYSTEM/usart/usart.h"
 #include "key.h"
 #include "version.h"
 #include "beep.h"
@@ -11,6 +12,12 @@
 #include "wsd.h"
 #include "timer.h"
 #include "motion_sensor.h"
+#include "low_power.h"
+#include "scheduler.h"
+#include "mpu.h"
+#include "qspi.h"
+#include "asset.h"
+#include "profiler.h"
 
 static uint8_t current_mode = MODE_1;
 
@@ -33,6 +40,43 @@ static uint32_t mode_145_work_start_tick = 0U;
 #define TEC_WORK_POWER_PERCENT         0U
 #define TEC_WORK_POWER_PERCENT_2			 7U			//6的值是22V，7的值是19.0V
 
+/* 各模式输出软启动曲线：TEC从0x7F升到TEC_WORK_POWER_PERCENT/_2，
+ * WSD从0x7F升到档位映射表中的值，调档升压同样按曲线逐步进行
+ */
+typedef struct
+{
+    const digipot_ramp_profile_t *tec;
+    const digipot_ramp_profile_t *wsd;
+} mode_ramp_profile_t;
+
+static const digipot_ramp_profile_t s_tec_ramp_full = {0x7FU, 4U, 20U};     /* 0x7F->0x00约640ms */
+static const digipot_ramp_profile_t s_tec_ramp_mode4 = {0x7FU, 2U, 20U};    /* 0x7F->0x07约1.2s */
+static const digipot_ramp_profile_t s_wsd_ramp = {0x7FU, 4U, 20U};          /* 0x7F->0x19约500ms */
+
+static const mode_ramp_profile_t s_mode_ramp_profiles[MODE_COUNT] =
+{
+    {&s_tec_ramp_full, &s_wsd_ramp},    /* MODE_1 */
+    {0, 0},                             /* MODE_2：仅激光 */
+    {&s_tec_ramp_full, &s_wsd_ramp},    /* MODE_3 */
+    {&s_tec_ramp_mode4, 0},             /* MODE_4：仅TEC */
+    {&s_tec_ramp_full, &s_wsd_ramp},    /* MODE_5 */
+};
+
+/* 调度任务周期 */
+#define TASK_KEY_PERIOD_MS               KEY_SCAN_INTERVAL_MS
+#define TASK_MOTION_PERIOD_MS            20U     /* FIFO中积累的样本每次整批处理 */
+#define TASK_COUNTDOWN_PERIOD_MS         50U
+#define TASK_TIME_DISPLAY_PERIOD_MS      100U
+#define TASK_FAN_PERIOD_MS               100U
+#define TASK_RAMP_PERIOD_MS              10U     /* 不大于软启动曲线的步进间隔 */
+#define TASK_PROF_PERIOD_MS              100U    /* 串口剖析命令轮询 */
+
+/* 调度器事件 */
+#define APP_EVENT_KEY                    1U      /* data为按键事件码 */
+
+#define DISPLAY_BENCHMARK_ROUNDS         8U
+#define QSPI_BENCHMARK_BYTES             (64U * 1024U)
+
 #define MODE1_WORK_TIME_MS               (30U * 1000U)
 #define MOTION_STATIC_PAUSE_MS           MOTION_SENSOR_STATIC_PAUSE_MS
 #define MOTION_STATIC_SHUTDOWN_MS        MOTION_SENSOR_STATIC_SHUTDOWN_MS
@@ -53,6 +97,17 @@ static void refresh_time_display(void);
 static void enable_motion_monitor_if_needed(uint8_t mode);
 static void disable_motion_monitor(void);
 static void process_motion_sensor(void);
+static void key_task(void);
+static void app_event_handler(const scheduler_event_t *event);
+#if ENABLE_LOW_POWER_MODE
+static uint8_t enter_low_power_if_static(void);
+#endif
+#if ENABLE_DISPLAY_BENCHMARK
+static void run_display_benchmark(void);
+#endif
+#if ENABLE_QSPI_BENCHMARK
+static void run_qspi_benchmark(void);
+#endif
 
 static void apply_mode_defaults(uint8_t mode)
 {
@@ -77,6 +132,12 @@ static void apply_mode_defaults(uint8_t mode)
 
 static void start_mode_outputs(uint8_t mode)
 {
+    if (mode >= MODE_MIN && mode <= MODE_MAX)
+    {
+        tec_set_ramp_profile(s_mode_ramp_profiles[mode - MODE_MIN].tec);
+        wsd_set_ramp_profile(s_mode_ramp_profiles[mode - MODE_MIN].wsd);
+    }
+
     fan_on();
 
     switch (mode)
@@ -204,7 +265,7 @@ static void handle_countdown_timeout(void)
             timer_reset();
             timer_started = 0U;
             last_displayed_seconds = 0xFFFFFFFFUL;
-            beep_beep();
+            beep_play(BEEP_PATTERN_FINISH);
             refresh_time_display();
         }
         else
@@ -216,7 +277,7 @@ static void handle_countdown_timeout(void)
             timer_reset();
             timer_started = 0U;
             last_displayed_seconds = 0xFFFFFFFFUL;
-            beep_beep();
+            beep_play(BEEP_PATTERN_FINISH);
             display_clear();
         }
     }
@@ -330,6 +391,7 @@ static void handle_key_event(uint8_t key_event)
             break;
         
         case KEY3_SHORT_PRESS:
+        case KEY3_REPEAT:
             
             if (mode_allows_level_adjust(current_mode) &&
                 (sys_state == SYS_STATE_WORKING || sys_state == SYS_STATE_MODE_SELECT))
@@ -345,6 +407,7 @@ static void handle_key_event(uint8_t key_event)
             break;
         
         case KEY4_SHORT_PRESS:
+        case KEY4_REPEAT:
             
             if (mode_allows_level_adjust(current_mode) &&
                 (sys_state == SYS_STATE_WORKING || sys_state == SYS_STATE_MODE_SELECT))
@@ -372,43 +435,129 @@ static void update_display(void)
 
 int main(void)
 {
-    uint8_t key_event;
-    
-    
+    mpu_memory_protection();
     sys_cache_enable();                 
     HAL_Init();                         
     sys_stm32_clock_init(192, 5, 2, 4); 
+#if ENABLE_QSPI_ASSETS || ENABLE_QSPI_BENCHMARK
+    (void)qspi_init();                  /* XIP配置下此后才能调用位于QSPI的代码 */
+#endif
+    (void)asset_init();
     delay_init(480);                    
+#if ENABLE_UART_DEBUG || ENABLE_DISPLAY_BENCHMARK || ENABLE_QSPI_BENCHMARK || ENABLE_PROFILER
+    usart_init(115200);                 /* printf重定向到USART1，未初始化时输出会卡在等待发送完成 */
+#endif
+#if ENABLE_PROFILER
+    prof_init();
+#endif
     timer_init();
     
     system_init();                      
     
     
     display_init();
+#if ENABLE_DISPLAY_BENCHMARK
+    run_display_benchmark();
+#endif
+#if ENABLE_QSPI_BENCHMARK
+    run_qspi_benchmark();
+#endif
     
     
     beep_beep();
     delay_ms(500);
     
-    
-    while (1)
+    scheduler_init();
+    scheduler_add_task("fan", fan_process, TASK_FAN_PERIOD_MS, 0U);
+    scheduler_add_task("time", update_time_display_if_needed, TASK_TIME_DISPLAY_PERIOD_MS, 1U);
+    scheduler_add_task("countdown", handle_countdown_timeout, TASK_COUNTDOWN_PERIOD_MS, 2U);
+    scheduler_add_task("motion", process_motion_sensor, TASK_MOTION_PERIOD_MS, 3U);
+    scheduler_add_task("key", key_task, TASK_KEY_PERIOD_MS, 4U);
+    scheduler_add_task("ramp", digipot_ramp_process, TASK_RAMP_PERIOD_MS, 5U);
+#if ENABLE_PROFILER
+    scheduler_add_task("prof", prof_poll_command, TASK_PROF_PERIOD_MS, 6U);
+#endif
+    scheduler_set_event_handler(app_event_handler);
+#if ENABLE_LOW_POWER_MODE
+    scheduler_set_idle_hook(enter_low_power_if_static);
+#endif
+
+    scheduler_run();
+}
+
+#if ENABLE_DISPLAY_BENCHMARK
+/* 整屏刷新耗时（DWT周期），保存最近一次结果便于调试器查看 */
+static uint32_t s_benchmark_min_cycles = 0U;
+static uint32_t s_benchmark_max_cycles = 0U;
+
+static void run_display_benchmark(void)
+{
+    uint32_t total_ms = get_mode_total_time_ms(current_mode);
+    uint32_t sum = 0U;
+
+    s_benchmark_min_cycles = 0xFFFFFFFFUL;
+    s_benchmark_max_cycles = 0U;
+    for (uint32_t i = 0U; i < DISPLAY_BENCHMARK_ROUNDS; i++)
     {
-        fan_process();
-        update_time_display_if_needed();
-        handle_countdown_timeout();
-        process_motion_sensor();
-        key_event = key_scan();         
-        
-        if (key_event != KEY_EVENT_NONE)
-        {
-            
-            handle_key_event(key_event);
-        }
-        else
-        {
-            
-            delay_ms(KEY_SCAN_INTERVAL_MS);
-        }
+        uint32_t cycles = display_benchmark_full_refresh(current_mode, current_level, total_ms, total_ms);
+
+        sum += cycles;
+        if (cycles < s_benchmark_min_cycles) s_benchmark_min_cycles = cycles;
+        if (cycles > s_benchmark_max_cycles) s_benchmark_max_cycles = cycles;
+    }
+    display_clear();
+
+    /* 基准结果不受ENABLE_UART_DEBUG控制，直接输出 */
+    printf("full refresh (TCM=%u): min %lu avg %lu max %lu cycles\r\n",
+           (unsigned int)SYS_USE_TCM,
+           (unsigned long)s_benchmark_min_cycles,
+           (unsigned long)(sum / DISPLAY_BENCHMARK_ROUNDS),
+           (unsigned long)s_benchmark_max_cycles);
+}
+#endif
+
+#if ENABLE_QSPI_BENCHMARK
+static void run_qspi_benchmark(void)
+{
+    qspi_bandwidth_t result;
+
+    if (!qspi_is_memmapped())
+    {
+        printf("QSPI not mapped, bandwidth not measured\r\n");
+        return;
+    }
+    qspi_measure_read_bandwidth(0U, QSPI_BENCHMARK_BYTES, &result);
+    printf("QSPI id %06lX, read %lu bytes in %lu cycles: %lu KB/s (prescaler %u, DDR %u, timeout %u)\r\n",
+           (unsigned long)qspi_get_jedec_id(),
+           (unsigned long)result.bytes,
+           (unsigned long)result.cycles,
+           (unsigned long)(result.bytes_per_sec / 1024U),
+           (unsigned int)QSPI_CLOCK_PRESCALER,
+           (unsigned int)QSPI_USE_DDR,
+           (unsigned int)QSPI_MEMMAP_TIMEOUT_CYCLES);
+}
+#endif
+
+static void key_task(void)
+{
+    uint8_t key_event;
+
+    while ((key_event = key_scan()) != KEY_EVENT_NONE)
+    {
+        (void)scheduler_post_event(APP_EVENT_KEY, key_event);
+    }
+}
+
+static void app_event_handler(const scheduler_event_t *event)
+{
+    if (event->id == APP_EVENT_KEY)
+    {
+        PROF_ZONE_BEGIN(PROF_ZONE_KEY_EVENT);
+
+        LCD_ResetTxByteCount();
+        handle_key_event((uint8_t)event->data);
+        PROF_ZONE_END(PROF_ZONE_KEY_EVENT);
+        LCD_DEBUG_PRINT("key %u: %lu SPI bytes\r\n", (unsigned int)event->data, (unsigned long)LCD_GetTxByteCount());
     }
 }
 
@@ -564,3 +713,59 @@ static void process_motion_sensor(void)
         return;
     }
 }
+
+#if ENABLE_LOW_POWER_MODE
+/* 静止等待期间（待机/选模式静止、模式1/3暂停）休眠，直到运动、按键或关机/风扇延时截止时间；返回1表示休眠过 */
+static uint8_t enter_low_power_if_static(void)
+{
+    uint32_t static_time;
+    uint32_t budget;
+    uint32_t fan_remaining;
+
+    if (!motion_monitor_active || !key_is_idle() || beep_is_busy())
+    {
+        return 0U;
+    }
+
+    if (sys_state == SYS_STATE_WORKING)
+    {
+        if (!((current_mode == MODE_1 || current_mode == MODE_3) && motion_paused))
+        {
+            return 0U;
+        }
+    }
+    else if (timer_started)
+    {
+        return 0U;
+    }
+
+    static_time = motion_sensor_get_static_time();
+    if (static_time < MOTION_STATIC_PAUSE_MS || static_time >= MOTION_STATIC_SHUTDOWN_MS)
+    {
+        return 0U;
+    }
+
+    budget = MOTION_STATIC_SHUTDOWN_MS - static_time;
+    fan_remaining = fan_get_delay_remaining();
+    if (fan_remaining < budget)
+    {
+        budget = fan_remaining;
+    }
+    if (budget < LOW_POWER_MIN_SLEEP_MS)
+    {
+        return 0U;
+    }
+
+    LCD_WaitIdle();
+    if (motion_sensor_wom_enter() != HAL_OK)
+    {
+        (void)motion_sensor_wom_exit();
+        return 0U;
+    }
+
+    /* 风扇PWM运行时只能进入SLEEP，STOP会冻结定时器输出 */
+    (void)low_power_sleep(budget, fan_get_state() ? 0U : 1U);
+    (void)motion_sensor_wom_exit();
+    return 1U;
+}
+#endif
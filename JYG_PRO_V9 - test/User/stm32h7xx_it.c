@@ -22,6 +22,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32h7xx_hal.h"
 #include "stm32h7xx_it.h"
+#include "./SYSTEM/sys/sys.h"
 
 
 /** @addtogroup STM32H7xx_HAL_Examples
@@ -136,7 +137,7 @@ void PendSV_Handler(void)
   * @param  None
   * @retval None
   */
-void SysTick_Handler(void)
+ITCM_CODE void SysTick_Handler(void)
 {
   HAL_IncTick();
 }
@@ -94,11 +94,38 @@
 /******************************************************************************************/
 /* 功能特性开关宏 */
 
-/* 运动传感器中断功能（当前未使用，通过轮询方式） */
+/* 运动传感器中断功能：1时ICM-42688的INT1数据就绪脉冲经EXTI通知，只在有新数据时读取；0时每次轮询都读取 */
+#ifndef ENABLE_MOTION_SENSOR_INTERRUPT
 #define ENABLE_MOTION_SENSOR_INTERRUPT  0       /* 1:启用中断  0:使用轮询 */
+#endif
 
-/* 低功耗模式 */
+/* 低功耗模式：静止等待期间ICM-42688切换为运动唤醒(WOM)模式，MCU进入STOP（风扇运行时为SLEEP），
+ * 由运动、按键或关机/风扇延时截止时间唤醒 */
+#ifndef ENABLE_LOW_POWER_MODE
 #define ENABLE_LOW_POWER_MODE           0       /* 1:启用  0:禁用 */
+#endif
+
+/* 整屏刷新基准：启动时重复整屏刷新并输出DWT周期数，分别以SYS_USE_TCM=0/1编译对比TCM放置效果 */
+#ifndef ENABLE_DISPLAY_BENCHMARK
+#define ENABLE_DISPLAY_BENCHMARK        0       /* 1:启用  0:禁用 */
+#endif
+
+/* 图片资源放在外部QSPI FLASH（W25Q64）：需要改板，QSPI时钟在100脚封装上只能用PB2，而PB2现为LCD_RST（见qspi.h）；
+ * 开启时还需同时打开User/SCRIPT/jyg_pro.sct中的USE_QSPI_ASSETS。0时图片资源和索引随程序放在内部FLASH（约22KB），不初始化QSPI */
+#ifndef ENABLE_QSPI_ASSETS
+#define ENABLE_QSPI_ASSETS              0       /* 1:启用  0:禁用 */
+#endif
+
+/* QSPI读取带宽测量：启动时测量内存映射顺序读取速度并输出，用于调整qspi.h中的分频、DDR和预取配置 */
+#ifndef ENABLE_QSPI_BENCHMARK
+#define ENABLE_QSPI_BENCHMARK           0       /* 1:启用  0:禁用 */
+#endif
+
+/* 分区剖析：DWT周期计数统计各剖析区耗时与log2直方图，串口(USART1, 115200)发送"prof"输出、"prof reset"清零；
+ * 0时剖析宏展开为空，不占用任何周期 */
+#ifndef ENABLE_PROFILER
+#define ENABLE_PROFILER                 0       /* 1:启用  0:禁用 */
+#endif
 
 /* 看门狗功能 */
 #define ENABLE_WATCHDOG                 0       /* 1:启用  0:禁用 */
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+生成运动检测回放用的合成加速度轨迹（replay/motion_replay.c的固定语料）
+
+注意：这些轨迹是按下面的场景参数确定性合成的，不是实测记录，只用于比较不同门限/实现之间的差异；
+实测轨迹按同样的CSV格式保存后可直接交给motion_replay回放。
+
+CSV格式（#开头为注释）：
+    t_ms,ax,ay,az,moving
+    t_ms      样本时间（毫秒，递增）
+    ax/ay/az  ICM-42688原始加速度（±4g量程，8192 LSB/g）
+    moving    人工标注：1=设备正在使用（此时暂停/关机都算误判），0=放下静止；可省略
+
+用法：python gen_motion_traces.py 输出目录
+"""
+import math
+import os
+import random
+import sys
+
+ODR_HZ = 100
+LSB_PER_G = 8192
+NOISE_MG = 2.0          # 传感器噪声（均方根）
+
+
+class Trace:
+    def __init__(self, name, seed, note):
+        self.name = name
+        self.note = note
+        self.rng = random.Random(seed)
+        self.rows = []
+        self.t_ms = 0
+        # 重力在传感器坐标系中的方向（单位向量）
+        self.gravity = [0.0, 0.0, 1.0]
+
+    def tilt(self, pitch_deg, roll_deg):
+        p = math.radians(pitch_deg)
+        r = math.radians(roll_deg)
+        self.gravity = [math.sin(p), -math.sin(r) * math.cos(p), math.cos(r) * math.cos(p)]
+
+    def emit(self, extra_mg, moving):
+        raw = []
+        for i in range(3):
+            mg = self.gravity[i] * 1000.0 + extra_mg[i] + self.rng.gauss(0.0, NOISE_MG)
+            v = int(round(mg * LSB_PER_G / 1000.0))
+            raw.append(max(-32768, min(32767, v)))
+        self.rows.append((self.t_ms, raw[0], raw[1], raw[2], moving))
+        self.t_ms += 1000 // ODR_HZ
+
+    def still(self, seconds, moving=0, vibration_mg=0.0, vibration_hz=0.0, bumps_per_min=0.0):
+        """静止（可叠加风扇振动和偶发的桌面碰撞）"""
+        n = int(seconds * ODR_HZ)
+        bump_left = 0
+        for k in range(n):
+            t = k / ODR_HZ
+            extra = [0.0, 0.0, 0.0]
+            if vibration_mg > 0.0:
+                extra[2] += vibration_mg * math.sin(2.0 * math.pi * vibration_hz * t)
+            if bump_left == 0 and bumps_per_min > 0.0 and self.rng.random() < bumps_per_min / 60.0 / ODR_HZ:
+                bump_left = 6
+            if bump_left > 0:
+                extra[2] += self.rng.uniform(-250.0, 250.0) * bump_left / 6.0
+                bump_left -= 1
+            self.emit(extra, moving)
+
+    def handheld(self, seconds, stroke_mg, stroke_hz, tremor_mg=15.0, tilt_deg=15.0):
+        """手持使用：沿随机方向往复推动（stroke），叠加8~12Hz生理性震颤，姿态缓慢摆动"""
+        n = int(seconds * ODR_HZ)
+        pitch0 = self.rng.uniform(-30.0, 30.0)
+        roll0 = self.rng.uniform(-30.0, 30.0)
+        tremor_hz = self.rng.uniform(8.0, 12.0)
+        direction = [self.rng.uniform(-1.0, 1.0) for _ in range(3)]
+        length = math.sqrt(sum(d * d for d in direction)) or 1.0
+        direction = [d / length for d in direction]
+        for k in range(n):
+            t = k / ODR_HZ
+            self.tilt(pitch0 + tilt_deg * math.sin(2.0 * math.pi * 0.2 * t),
+                      roll0 + tilt_deg * math.cos(2.0 * math.pi * 0.13 * t))
+            a = stroke_mg * math.sin(2.0 * math.pi * stroke_hz * t)
+            tremor = tremor_mg * math.sin(2.0 * math.pi * tremor_hz * t)
+            extra = [direction[i] * a + tremor * (0.6 if i == 2 else 0.3) for i in range(3)]
+            self.emit(extra, 1)
+
+    def set_down(self):
+        self.tilt(self.rng.uniform(-2.0, 2.0), self.rng.uniform(-2.0, 2.0))
+
+    def write(self, out_dir):
+        path = os.path.join(out_dir, self.name + ".csv")
+        with open(path, "w", newline="\n") as f:
+            f.write("# 合成轨迹（非实测）：%s\n" % self.note)
+            f.write("t_ms,ax,ay,az,moving\n")
+            for row in self.rows:
+                f.write("%d,%d,%d,%d,%d\n" % row)
+        return path
+
+
+def build_traces():
+    traces = []
+
+    t = Trace("handheld_session", 1, "桌面静止20s，手持使用60s，放下10s，再使用40s，放下后静止330s（应暂停并关机）")
+    t.set_down()
+    t.still(20)
+    t.handheld(60, stroke_mg=250.0, stroke_hz=1.2)
+    t.set_down()
+    t.still(10)
+    t.handheld(40, stroke_mg=300.0, stroke_hz=0.8)
+    t.set_down()
+    t.still(330)
+    traces.append(t)
+
+    t = Trace("slow_strokes", 2, "缓慢轻推120s（幅值60~120mg，0.3~0.8Hz），全程使用中")
+    for _ in range(6):
+        t.handheld(20, stroke_mg=t.rng.uniform(60.0, 120.0), stroke_hz=t.rng.uniform(0.3, 0.8), tremor_mg=10.0)
+    traces.append(t)
+
+    t = Trace("hold_still", 3, "手持基本不动180s（震颤10~30mg），每5~15s调整一次位置，全程使用中")
+    elapsed = 0.0
+    while elapsed < 180.0:
+        still = t.rng.uniform(5.0, 15.0)
+        t.handheld(still, stroke_mg=0.0, stroke_hz=0.0, tremor_mg=t.rng.uniform(10.0, 30.0), tilt_deg=2.0)
+        t.handheld(1.0, stroke_mg=t.rng.uniform(150.0, 300.0), stroke_hz=1.0)
+        elapsed += still + 1.0
+    traces.append(t)
+
+    t = Trace("desk_vibration", 4, "放在桌面420s，风扇振动25mg@30Hz，偶有桌面碰撞（应暂停，碰撞间隔超过5分钟时关机）")
+    t.set_down()
+    t.still(420, vibration_mg=25.0, vibration_hz=30.0, bumps_per_min=0.2)
+    traces.append(t)
+
+    return traces
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__)
+        return 1
+    out_dir = sys.argv[1]
+    os.makedirs(out_dir, exist_ok=True)
+    for trace in build_traces():
+        print(trace.write(out_dir))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,61 @@
+#ifndef HOST_CMSIS_GCC_H
+#define HOST_CMSIS_GCC_H
+/* 主机(x86-64 gcc)编译固件用的CMSIS内核函数替身：内存屏障/中断开关为空操作，
+ * __WFI交给主机模型推进仿真时间（见host_hw.c） */
+#include <stdint.h>
+#define __ASM __asm
+#define __INLINE inline
+#define __STATIC_INLINE static inline
+#define __STATIC_FORCEINLINE static inline
+#define __NO_RETURN __attribute__((__noreturn__))
+#define __USED __attribute__((used))
+#define __WEAK __attribute__((weak))
+#define __PACKED __attribute__((packed))
+#define __PACKED_STRUCT struct __attribute__((packed))
+#define __PACKED_UNION union __attribute__((packed))
+#define __ALIGNED(x) __attribute__((aligned(x)))
+#define __RESTRICT __restrict
+#define __COMPILER_BARRIER() do{}while(0)
+#define __UNALIGNED_UINT32_READ(a) (*(const uint32_t*)(a))
+#define __UNALIGNED_UINT32_WRITE(a,v) (*(uint32_t*)(a)=(v))
+#define __UNALIGNED_UINT16_READ(a) (*(const uint16_t*)(a))
+#define __UNALIGNED_UINT16_WRITE(a,v) (*(uint16_t*)(a)=(v))
+static inline void __NOP(void){}
+void host_wfi(void);
+static inline void __WFI(void){host_wfi();}
+static inline void __WFE(void){}
+static inline void __SEV(void){}
+static inline void __ISB(void){}
+static inline void __DSB(void){}
+static inline void __DMB(void){}
+static inline void __enable_irq(void){}
+static inline void __disable_irq(void){}
+static inline uint32_t __get_PRIMASK(void){return 0;}
+static inline void __set_PRIMASK(uint32_t v){(void)v;}
+static inline uint32_t __get_IPSR(void){return 0;}
+static inline uint32_t __get_CONTROL(void){return 0;}
+static inline void __set_CONTROL(uint32_t v){(void)v;}
+static inline uint32_t __get_MSP(void){return 0;}
+static inline void __set_MSP(uint32_t v){(void)v;}
+static inline uint32_t __get_PSP(void){return 0;}
+static inline void __set_PSP(uint32_t v){(void)v;}
+static inline uint32_t __get_BASEPRI(void){return 0;}
+static inline void __set_BASEPRI(uint32_t v){(void)v;}
+static inline void __set_BASEPRI_MAX(uint32_t v){(void)v;}
+static inline uint32_t __get_FAULTMASK(void){return 0;}
+static inline void __set_FAULTMASK(uint32_t v){(void)v;}
+static inline uint32_t __get_FPSCR(void){return 0;}
+static inline void __set_FPSCR(uint32_t v){(void)v;}
+static inline uint32_t __REV(uint32_t v){return __builtin_bswap32(v);}
+static inline uint32_t __REV16(uint32_t v){return ((v & 0x00FF00FFU) << 8) | ((v >> 8) & 0x00FF00FFU);}
+static inline int16_t __REVSH(int16_t v){return (int16_t)__builtin_bswap16((uint16_t)v);}
+static inline uint32_t __RBIT(uint32_t v){uint32_t r=0;for(int i=0;i<32;i++){r=(r<<1)|(v&1U);v>>=1;}return r;}
+static inline uint8_t __CLZ(uint32_t v){return v?__builtin_clz(v):32;}
+static inline uint32_t __ROR(uint32_t a,uint32_t b){return (a>>b)|(a<<(32-b));}
+static inline uint32_t __LDREXW(volatile uint32_t*p){return *p;}
+static inline uint32_t __STREXW(uint32_t v,volatile uint32_t*p){*p=v;return 0;}
+static inline void __CLREX(void){}
+#define __BKPT(x) do{}while(0)
+#define __SSAT(a,b) (a)
+#define __USAT(a,b) (a)
+#endif
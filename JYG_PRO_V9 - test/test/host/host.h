@@ -0,0 +1,48 @@
+#ifndef __HOST_H
+#define __HOST_H
+
+/* 主机测试环境：把固件源文件直接用gcc编译到Linux上运行
+ * 外设寄存器地址(0x40000000起的外设区和0xE0000000起的内核区)在进程启动时映射为普通内存，
+ * 固件读写寄存器不会出错；HAL函数由host_hal.c替代，时间由主机模型推进
+ */
+#include "./SYSTEM/sys/sys.h"
+#include <stdio.h>
+
+/* 时间模型：HAL_GetTick()每调用一次推进autoadvance微秒，忙等循环因此总能超时退出 */
+uint64_t host_now_us(void);
+void host_advance_us(uint64_t us);
+void host_set_tick_autoadvance(uint32_t us);
+
+/* 每经过1ms调用一次的钩子（仿真器用来触发SysTick和挂起的中断） */
+typedef void (*host_tick_hook_t)(void);
+void host_set_tick_hook(host_tick_hook_t hook);
+
+/* __WFI()的处理函数，默认推进1ms */
+typedef void (*host_wfi_hook_t)(void);
+void host_set_wfi_hook(host_wfi_hook_t hook);
+
+/* 测试断言：失败时打印位置并计数，测试程序以失败数作为退出码 */
+extern uint32_t g_host_failures;
+
+#define HOST_CHECK(cond)                                                        \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            g_host_failures++;                                                  \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);     \
+        }                                                                       \
+    } while (0)
+
+#define HOST_CHECK_EQ(a, b)                                                     \
+    do {                                                                        \
+        unsigned long host_a_ = (unsigned long)(a);                             \
+        unsigned long host_b_ = (unsigned long)(b);                             \
+        if (host_a_ != host_b_) {                                               \
+            g_host_failures++;                                                  \
+            printf("%s:%d: %s == %s failed: 0x%lX != 0x%lX\n",                  \
+                   __FILE__, __LINE__, #a, #b, host_a_, host_b_);               \
+        }                                                                       \
+    } while (0)
+
+int host_report(const char *name);
+
+#endif
@@ -0,0 +1,233 @@
+#include "host.h"
+#include "./SYSTEM/usart/usart.h"
+#include "qspi.h"
+#include <string.h>
+
+/* 主机上替代的HAL/ALIENTEK系统函数：只做寄存器级的最小行为，其余为空操作
+ * GPIO直接读写映射内存中的ODR/IDR，测试通过写IDR模拟按键等输入
+ */
+
+uint32_t SystemCoreClock = 480000000U;
+uint32_t SystemD2Clock = 240000000U;
+
+HAL_StatusTypeDef HAL_Init(void)
+{
+    return HAL_OK;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+    (void)GPIOx;
+    (void)GPIO_Init;
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+    (void)GPIOx;
+    (void)GPIO_Pin;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    if (PinState != GPIO_PIN_RESET)
+    {
+        GPIOx->ODR |= GPIO_Pin;
+    }
+    else
+    {
+        GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+    }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    return ((GPIOx->IDR & GPIO_Pin) != 0U) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    GPIOx->ODR ^= GPIO_Pin;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+    (void)IRQn;
+    (void)PreemptPriority;
+    (void)SubPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    (void)IRQn;
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    (void)IRQn;
+}
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
+{
+    hspi->State = HAL_SPI_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DeInit(SPI_HandleTypeDef *hspi)
+{
+    hspi->State = HAL_SPI_STATE_RESET;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+    hdma->State = HAL_DMA_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma)
+{
+    hdma->State = HAL_DMA_STATE_RESET;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma)
+{
+    hdma->State = HAL_DMA_STATE_READY;
+    return HAL_OK;
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+    (void)hdma;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *htim)
+{
+    htim->State = HAL_TIM_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, TIM_OC_InitTypeDef *sConfig, uint32_t Channel)
+{
+    (void)htim;
+    (void)sConfig;
+    (void)Channel;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    (void)htim;
+    (void)Channel;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Stop(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    (void)htim;
+    (void)Channel;
+    return HAL_OK;
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+    return 120000000U;
+}
+
+void HAL_MPU_Enable(uint32_t MPU_Control)
+{
+    (void)MPU_Control;
+}
+
+void HAL_MPU_Disable(void)
+{
+}
+
+void HAL_MPU_ConfigRegion(MPU_Region_InitTypeDef *MPU_Init)
+{
+    (void)MPU_Init;
+}
+
+void HAL_EnableCompensationCell(void)
+{
+}
+
+void HAL_PWR_EnterSLEEPMode(uint32_t Regulator, uint8_t SLEEPEntry)
+{
+    (void)Regulator;
+    (void)SLEEPEntry;
+    host_wfi();
+}
+
+void HAL_PWR_EnterSTOPMode(uint32_t Regulator, uint8_t STOPEntry)
+{
+    (void)Regulator;
+    (void)STOPEntry;
+    host_wfi();
+}
+
+/* sys.c */
+void sys_cache_enable(void)
+{
+}
+
+void sys_dwt_enable(void)
+{
+}
+
+uint8_t sys_stm32_clock_init(uint32_t plln, uint32_t pllm, uint32_t pllp, uint32_t pllq)
+{
+    (void)plln;
+    (void)pllm;
+    (void)pllp;
+    (void)pllq;
+    return 0;
+}
+
+void sys_intx_disable(void)
+{
+}
+
+void sys_intx_enable(void)
+{
+}
+
+/* usart.c：printf直接输出到主机标准输出 */
+UART_HandleTypeDef g_uart1_handle;
+uint8_t g_usart_rx_buf[USART_REC_LEN];
+uint16_t g_usart_rx_sta = 0;
+uint8_t g_rx_buffer[RXBUFFERSIZE];
+
+void usart_init(uint32_t baudrate)
+{
+    (void)baudrate;
+}
+
+/* qspi.c：主机上没有QSPI FLASH，图片资源直接链接在程序数据中 */
+uint8_t qspi_init(void)
+{
+    return 1;
+}
+
+uint8_t qspi_is_memmapped(void)
+{
+    return 0U;
+}
+
+uint32_t qspi_get_jedec_id(void)
+{
+    return 0U;
+}
+
+uint8_t qspi_is_mapped_addr(const void *addr)
+{
+    (void)addr;
+    return 0U;
+}
+
+void qspi_measure_read_bandwidth(uint32_t offset, uint32_t size, qspi_bandwidth_t *result)
+{
+    (void)offset;
+    (void)size;
+    memset(result, 0, sizeof(*result));
+}
@@ -0,0 +1,166 @@
+#define _GNU_SOURCE
+#include "host.h"
+#include "./SYSTEM/delay/delay.h"
+#include "lcd.h"
+#include <stdlib.h>
+#include <sys/mman.h>
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE     0x100000
+#endif
+
+#define HOST_CPU_MHZ            480U
+
+/* 需要映射的寄存器地址区：D1/D2/D3外设与DBGMCU、Cortex-M7内核外设(SCB/SysTick/NVIC/DWT/MPU) */
+static const struct
+{
+    uintptr_t base;
+    size_t size;
+} s_host_regions[] =
+{
+    {0x40000000U, 0x20000000U},
+    {0xE0000000U, 0x00100000U},
+};
+
+static uint64_t s_now_us = 0U;
+static uint32_t s_autoadvance_us = 1U;
+static uint64_t s_hook_ms = 0U;
+static uint8_t s_in_hook = 0U;
+static host_tick_hook_t s_tick_hook = 0;
+static host_wfi_hook_t s_wfi_hook = 0;
+static host_spi_hook_t s_spi_hook = 0;
+
+uint32_t g_host_failures = 0U;
+
+__attribute__((constructor)) static void host_map_registers(void)
+{
+    for (size_t i = 0U; i < sizeof(s_host_regions) / sizeof(s_host_regions[0]); i++)
+    {
+        void *p = mmap((void *)s_host_regions[i].base, s_host_regions[i].size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE | MAP_NORESERVE, -1, 0);
+
+        if (p != (void *)s_host_regions[i].base)
+        {
+            fprintf(stderr, "host: cannot map registers at 0x%08lX\n", (unsigned long)s_host_regions[i].base);
+            exit(2);
+        }
+    }
+
+    /* SPI轮询发送循环等待的标志保持置位：TXP(可写)、EOT(传输结束)、TXC(发送完成) */
+    SPI1->SR = SPI_SR_TXP | SPI_SR_EOT | SPI_SR_TXC;
+    /* USART发送寄存器始终为空，printf不会等待 */
+    USART1->ISR = USART_ISR_TXE_TXFNF | USART_ISR_TC;
+}
+
+uint64_t host_now_us(void)
+{
+    return s_now_us;
+}
+
+void host_advance_us(uint64_t us)
+{
+    s_now_us += us;
+    DWT->CYCCNT = (uint32_t)(s_now_us * HOST_CPU_MHZ);
+
+    /* 钩子内部再次读取时间不会嵌套触发，越过的毫秒在外层循环中补齐 */
+    if (s_tick_hook != 0 && !s_in_hook)
+    {
+        s_in_hook = 1U;
+        while (s_hook_ms < s_now_us / 1000U)
+        {
+            s_hook_ms++;
+            s_tick_hook();
+        }
+        s_in_hook = 0U;
+    }
+}
+
+void host_set_tick_autoadvance(uint32_t us)
+{
+    s_autoadvance_us = us;
+}
+
+void host_set_tick_hook(host_tick_hook_t hook)
+{
+    s_hook_ms = s_now_us / 1000U;
+    s_tick_hook = hook;
+}
+
+void host_set_wfi_hook(host_wfi_hook_t hook)
+{
+    s_wfi_hook = hook;
+}
+
+void host_wfi(void)
+{
+    if (s_wfi_hook != 0)
+    {
+        s_wfi_hook();
+    }
+    else
+    {
+        host_advance_us(1000U - (s_now_us % 1000U));
+    }
+}
+
+void host_set_spi_hook(host_spi_hook_t hook)
+{
+    s_spi_hook = hook;
+}
+
+void host_spi_write(uint8_t byte)
+{
+    if (s_spi_hook != 0)
+    {
+        s_spi_hook(byte, (LCD_DC_PORT->ODR & LCD_DC_PIN) ? 1U : 0U, (LCD_CS_PORT->ODR & LCD_CS_PIN) ? 1U : 0U);
+    }
+}
+
+int host_report(const char *name)
+{
+    printf("%s: %s (%lu failures)\n", name, (g_host_failures == 0U) ? "PASS" : "FAIL",
+           (unsigned long)g_host_failures);
+    return (g_host_failures == 0U) ? 0 : 1;
+}
+
+/* HAL时基与ALIENTEK延时函数 */
+__IO uint32_t uwTick;
+
+uint32_t HAL_GetTick(void)
+{
+    host_advance_us(s_autoadvance_us);
+    uwTick = (uint32_t)(s_now_us / 1000U);
+    return uwTick;
+}
+
+void HAL_IncTick(void)
+{
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    host_advance_us((uint64_t)Delay * 1000U);
+}
+
+void HAL_SuspendTick(void)
+{
+}
+
+void HAL_ResumeTick(void)
+{
+}
+
+void delay_init(uint16_t sysclk)
+{
+    (void)sysclk;
+}
+
+void delay_us(uint32_t nus)
+{
+    host_advance_us(nus);
+}
+
+void delay_ms(uint16_t nms)
+{
+    host_advance_us((uint64_t)nms * 1000U);
+}
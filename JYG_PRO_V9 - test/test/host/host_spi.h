@@ -0,0 +1,14 @@
+#ifndef __HOST_SPI_H
+#define __HOST_SPI_H
+
+#include <stdint.h>
+
+/* 由Makefile强制包含到每个源文件：lcd.c的LCD_SPI_WRITE_BYTE替换为host_spi_write，
+ * 发往屏幕的每个字节连同当时的DC/CS电平交给捕获钩子
+ */
+void host_spi_write(uint8_t byte);
+
+typedef void (*host_spi_hook_t)(uint8_t byte, uint8_t dc, uint8_t cs);
+void host_set_spi_hook(host_spi_hook_t hook);
+
+#endif
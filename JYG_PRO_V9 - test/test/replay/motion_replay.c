@@ -0,0 +1,363 @@
+/* 运动检测轨迹回放：CSV中的原始加速度样本按时间戳写入sim/sim_i2c.c的ICM-42688模型FIFO，
+ * 固件motion_sensor.c原样经软件I2C读FIFO、做判定，按main.c工作模式1/3的逻辑产生暂停/关机事件
+ *   motion_replay [-l 等级] 轨迹.csv...
+ * CSV格式见data/gen_motion_traces.py。每条轨迹、每个灵敏度等级输出：
+ *   onset      标注从静止变为使用后，第一次判定为运动的延迟
+ *   pause      暂停次数，false为暂停前PAUSE_MS内仍有使用标注的次数；放下后到暂停的延迟
+ *   shutdown   关机次数，false为关机前SHUTDOWN_MS内有使用标注的次数（关机后立即重新启用继续回放）
+ *   ns/sample  主机上每个样本的耗时：bus为motion_sensor_is_moving()整条路径（含模拟总线），
+ *              decision为同一批样本直接送入motion_sensor_process_sample()
+ * 直接判定的每次轮询结果必须与经总线的结果一致，否则返回失败
+ */
+#include "sim.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../User/bsp/motion_sensor.c"
+
+#define REPLAY_POLL_MS          20U     /* 与main.c中TASK_MOTION_PERIOD_MS一致 */
+#define REPLAY_BENCH_ROUNDS     20U     /* 直接判定重复次数，用于计时 */
+
+uint8_t g_sim_verbose = 0U;
+
+typedef struct
+{
+    uint32_t t_ms;
+    int16_t raw[3];
+    int8_t moving;          /* -1表示无标注 */
+} trace_row_t;
+
+typedef struct
+{
+    uint32_t first;         /* 本次轮询读出的样本范围[first, end) */
+    uint32_t end;
+    uint8_t moving;
+    uint8_t enable_after;   /* 轮询后重新启用（关机） */
+} poll_t;
+
+typedef struct
+{
+    uint32_t polls;
+    uint32_t onsets;
+    uint32_t onset_detected;
+    uint64_t onset_latency_sum;
+    uint32_t onset_latency_max;
+    uint32_t pauses;
+    uint32_t false_pauses;
+    uint32_t putdown_pauses;
+    uint64_t putdown_latency_sum;
+    uint32_t shutdowns;
+    uint32_t false_shutdowns;
+    double bus_ns;
+    double decision_ns;
+} replay_result_t;
+
+static trace_row_t *s_rows;
+static uint32_t s_row_count;
+static poll_t *s_polls;
+static uint32_t s_poll_count;
+
+static double replay_elapsed_ns(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec - start->tv_sec) * 1e9 + (double)(now.tv_nsec - start->tv_nsec);
+}
+
+static int replay_load(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    char line[256];
+    uint32_t capacity = 0U;
+
+    if (fp == NULL)
+    {
+        printf("%s: cannot open\n", path);
+        return -1;
+    }
+
+    s_row_count = 0U;
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        unsigned int t;
+        int x, y, z, moving = -1;
+        int n;
+
+        if (line[0] == '#' || line[0] == 't' || line[0] == '\n' || line[0] == '\r')
+        {
+            continue;
+        }
+        n = sscanf(line, "%u,%d,%d,%d,%d", &t, &x, &y, &z, &moving);
+        if (n < 4 || (s_row_count > 0U && t < s_rows[s_row_count - 1U].t_ms))
+        {
+            printf("%s: bad line: %s", path, line);
+            fclose(fp);
+            return -1;
+        }
+        if (s_row_count == capacity)
+        {
+            capacity = capacity ? capacity * 2U : 4096U;
+            s_rows = realloc(s_rows, capacity * sizeof(trace_row_t));
+        }
+        s_rows[s_row_count].t_ms = t;
+        s_rows[s_row_count].raw[0] = (int16_t)x;
+        s_rows[s_row_count].raw[1] = (int16_t)y;
+        s_rows[s_row_count].raw[2] = (int16_t)z;
+        s_rows[s_row_count].moving = (int8_t)((n == 5) ? (moving != 0) : -1);
+        s_row_count++;
+    }
+    fclose(fp);
+
+    if (s_row_count == 0U)
+    {
+        printf("%s: no samples\n", path);
+        return -1;
+    }
+    s_polls = realloc(s_polls, ((s_rows[s_row_count - 1U].t_ms - s_rows[0].t_ms) / REPLAY_POLL_MS + 2U) * sizeof(poll_t));
+    return 0;
+}
+
+/* 经模拟总线回放一遍，记录每次轮询读出的样本范围和结果，统计事件 */
+static void replay_bus(uint8_t level, replay_result_t *res)
+{
+    uint32_t t0 = s_rows[0].t_ms;
+    uint32_t duration = s_rows[s_row_count - 1U].t_ms - t0;
+    uint64_t base_us = host_now_us();
+    uint32_t next_row = 0U;
+    uint32_t base;
+    uint32_t cursor = 0U;
+    int8_t label = 0;
+    uint8_t have_label1 = 0U;
+    uint32_t last_label1_ms = 0U;
+    uint8_t onset_pending = 0U;
+    uint32_t onset_ms = 0U;
+    uint8_t putdown_pending = 0U;
+    uint32_t putdown_ms = 0U;
+    uint8_t paused = 0U;
+    double bus_ns = 0.0;
+
+    memset(res, 0, sizeof(*res));
+    motion_sensor_set_sensitivity_level(level);
+    motion_sensor_enable();
+    base = sim_imu_samples();       /* 模型样本计数与轨迹行号的偏移 */
+    s_poll_count = 0U;
+
+    for (uint32_t t = REPLAY_POLL_MS; t <= duration + REPLAY_POLL_MS; t += REPLAY_POLL_MS)
+    {
+        uint64_t target_us = base_us + (uint64_t)t * 1000U;
+        poll_t *poll = &s_polls[s_poll_count++];
+        struct timespec start;
+        uint8_t moving;
+
+        if (host_now_us() < target_us)
+        {
+            host_advance_us(target_us - host_now_us());
+        }
+
+        while (next_row < s_row_count && s_rows[next_row].t_ms - t0 <= t)
+        {
+            const trace_row_t *row = &s_rows[next_row++];
+            uint32_t row_ms = row->t_ms - t0;
+
+            sim_imu_push_raw(row->raw);
+            if (row->moving > 0)
+            {
+                if (label == 0)
+                {
+                    res->onsets++;
+                    onset_pending = 1U;
+                    onset_ms = row_ms;
+                    putdown_pending = 0U;
+                }
+                have_label1 = 1U;
+                last_label1_ms = row_ms;
+            }
+            else if (row->moving == 0 && label > 0)
+            {
+                onset_pending = 0U;
+                putdown_pending = paused ? 0U : 1U;     /* 放下时已处于暂停则不计延迟 */
+                putdown_ms = row_ms;
+            }
+            if (row->moving >= 0)
+            {
+                label = row->moving;
+            }
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        moving = motion_sensor_is_moving();
+        bus_ns += replay_elapsed_ns(&start);
+
+        poll->first = cursor;
+        poll->end = sim_imu_samples() - sim_imu_fifo_level() - base;
+        poll->moving = moving;
+        poll->enable_after = 0U;
+        cursor = poll->end;
+
+        if (moving)
+        {
+            if (onset_pending)
+            {
+                uint32_t latency = t - onset_ms;
+
+                res->onset_detected++;
+                res->onset_latency_sum += latency;
+                if (latency > res->onset_latency_max)
+                {
+                    res->onset_latency_max = latency;
+                }
+                onset_pending = 0U;
+            }
+            if (paused)
+            {
+                motion_sensor_reset_static_timer();
+                paused = 0U;
+            }
+            continue;
+        }
+
+        uint32_t static_time = motion_sensor_get_static_time();
+
+        if (!paused && static_time >= MOTION_SENSOR_STATIC_PAUSE_MS)
+        {
+            paused = 1U;
+            res->pauses++;
+            if (have_label1 && t - last_label1_ms < MOTION_SENSOR_STATIC_PAUSE_MS)
+            {
+                res->false_pauses++;
+            }
+            if (putdown_pending)
+            {
+                res->putdown_pauses++;
+                res->putdown_latency_sum += t - putdown_ms;
+                putdown_pending = 0U;
+            }
+        }
+
+        if (static_time >= MOTION_SENSOR_STATIC_SHUTDOWN_MS)
+        {
+            res->shutdowns++;
+            if (have_label1 && t - last_label1_ms < MOTION_SENSOR_STATIC_SHUTDOWN_MS)
+            {
+                res->false_shutdowns++;
+            }
+            paused = 0U;
+            motion_sensor_enable();     /* 重新开机继续回放，重新启用会清空FIFO */
+            cursor = sim_imu_samples() - base;
+            poll->enable_after = 1U;
+        }
+    }
+
+    res->polls = s_poll_count;
+    res->bus_ns = bus_ns / (double)s_row_count;
+}
+
+/* 把每次轮询读出的样本直接送入判定逻辑，结果须与经总线时一致；重复多轮计时 */
+static uint32_t replay_direct(uint8_t level, replay_result_t *res)
+{
+    uint32_t mismatches = 0U;
+    uint32_t total = 0U;
+    struct timespec start;
+    double ns = 0.0;
+
+    for (uint32_t round = 0U; round < REPLAY_BENCH_ROUNDS; round++)
+    {
+        motion_sensor_set_sensitivity_level(level);
+        motion_sensor_enable();
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (uint32_t p = 0U; p < s_poll_count; p++)
+        {
+            const poll_t *poll = &s_polls[p];
+            uint8_t moving;
+
+            if (poll->first == poll->end)
+            {
+                moving = motion_sensor_current_state();
+            }
+            else
+            {
+                moving = 0U;
+                for (uint32_t i = poll->first; i < poll->end; i++)
+                {
+                    moving = motion_sensor_process_sample(s_rows[i].raw);
+                }
+                total += poll->end - poll->first;
+            }
+
+            if (round == 0U && moving != poll->moving)
+            {
+                if (mismatches++ == 0U)
+                {
+                    printf("  poll %u (%u ms): bus %u, direct %u\n", (unsigned int)p,
+                           (unsigned int)((p + 1U) * REPLAY_POLL_MS), poll->moving, moving);
+                }
+            }
+            if (poll->enable_after)
+            {
+                motion_sensor_enable();
+            }
+        }
+        ns += replay_elapsed_ns(&start);
+    }
+
+    res->decision_ns = (total != 0U) ? ns / (double)total : 0.0;
+    return mismatches;
+}
+
+static void replay_print(const char *name, uint8_t level, const replay_result_t *res)
+{
+    printf("%s L%u: %u samples, onset %u/%u avg %u max %u ms, pause %u (false %u, %u after put-down avg %u ms), "
+           "shutdown %u (false %u), %.0f ns/sample bus, %.1f ns/sample decision\n",
+           name, level, (unsigned int)s_row_count,
+           (unsigned int)res->onset_detected, (unsigned int)res->onsets,
+           (unsigned int)(res->onset_detected ? res->onset_latency_sum / res->onset_detected : 0U),
+           (unsigned int)res->onset_latency_max,
+           (unsigned int)res->pauses, (unsigned int)res->false_pauses, (unsigned int)res->putdown_pauses,
+           (unsigned int)(res->putdown_pauses ? res->putdown_latency_sum / res->putdown_pauses : 0U),
+           (unsigned int)res->shutdowns, (unsigned int)res->false_shutdowns,
+           res->bus_ns, res->decision_ns);
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t level_min = MOTION_SENSOR_SENSITIVITY_LEVEL_MIN;
+    uint8_t level_max = MOTION_SENSOR_SENSITIVITY_LEVEL_MAX;
+    int argi = 1;
+
+    if (argi + 1 < argc && strcmp(argv[argi], "-l") == 0)
+    {
+        level_min = level_max = (uint8_t)atoi(argv[argi + 1]);
+        argi += 2;
+    }
+    if (argi >= argc || level_min < MOTION_SENSOR_SENSITIVITY_LEVEL_MIN || level_max > MOTION_SENSOR_SENSITIVITY_LEVEL_MAX)
+    {
+        printf("usage: motion_replay [-l 1-5] trace.csv...\n");
+        return 2;
+    }
+
+    sim_imu_set_external(1U);
+    motion_sensor_init();
+    HOST_CHECK(s_device_available);
+
+    for (; argi < argc; argi++)
+    {
+        const char *name = strrchr(argv[argi], '/') ? strrchr(argv[argi], '/') + 1 : argv[argi];
+
+        if (replay_load(argv[argi]) != 0)
+        {
+            g_host_failures++;
+            continue;
+        }
+        for (uint8_t level = level_min; level <= level_max; level++)
+        {
+            replay_result_t res;
+
+            replay_bus(level, &res);
+            HOST_CHECK_EQ(replay_direct(level, &res), 0U);
+            replay_print(name, level, &res);
+        }
+    }
+    return host_report("motion_replay");
+}
@@ -0,0 +1,43 @@
+#ifndef __SIM_H
+#define __SIM_H
+
+#include "host.h"
+
+/* 主机模拟器：完整固件(main.c起)运行在host/的寄存器映射之上，
+ * sim_panel.c把SPI1字节流解码到126x294 RGB565帧缓冲，sim_i2c.c模拟ICM-42688与TEC/WSD数字电位器
+ */
+
+extern uint8_t g_sim_verbose;
+
+/* 面板模型 */
+void sim_panel_spi(uint8_t byte, uint8_t dc, uint8_t cs);
+uint16_t sim_panel_pixel(uint16_t x, uint16_t y);
+uint32_t sim_panel_bytes(void);
+uint32_t sim_panel_frames(void);        /* 写GRAM(0x2C)命令次数 */
+int sim_panel_snapshot(const char *path);
+
+/* ICM-42688模型：加速度按毫克设定，shake在Z轴（静止时的重力方向）叠加正弦 */
+void sim_imu_set_accel(int32_t x_mg, int32_t y_mg, int32_t z_mg);
+void sim_imu_set_shake(int32_t amp_mg, uint32_t freq_hz);
+void sim_imu_tick(void);
+uint32_t sim_imu_samples(void);
+
+/* 轨迹回放：set_external(1)后模型不再按ODR自行产生样本，只接收push_raw写入的原始样本 */
+void sim_imu_set_external(uint8_t on);
+void sim_imu_push_raw(const int16_t raw[3]);
+uint32_t sim_imu_fifo_level(void);      /* FIFO中尚未读出的包数 */
+
+/* TEC/WSD数字电位器：I2C发送在下一个毫秒完成，nack让接下来的count次写入失败 */
+enum
+{
+    SIM_POT_TEC = 0,
+    SIM_POT_WSD,
+    SIM_POT_COUNT
+};
+
+void sim_i2c_tick(void);
+int32_t sim_pot_value(uint8_t pot);     /* 最后一次写入成功的值，未写过为-1 */
+uint32_t sim_pot_writes(uint8_t pot);
+void sim_pot_nack(uint8_t pot, uint32_t count);
+
+#endif
@@ -0,0 +1,484 @@
+#include "sim.h"
+#include "soft_i2c.h"
+#include "motion_sensor.h"
+#include "tec.h"
+#include "wsd.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ICM-42688寄存器模型，替代soft_i2c.c（模拟器以MOTION_SENSOR_USE_SOFT_I2C=1编译motion_sensor.c）：
+ * 按ACCEL_CONFIG0的ODR产生样本，写入数据寄存器和8字节包格式的FIFO（流模式，满后覆盖最旧的包），
+ * 每次传输按400kHz、每字节9个时钟推进模拟时间
+ */
+
+#define IMU_WHO_AM_I            0x47U
+#define IMU_REG_DEVICE_CONFIG   0x11U
+#define IMU_REG_FIFO_CONFIG     0x16U
+#define IMU_REG_ACCEL_DATA_X1   0x1FU
+#define IMU_REG_FIFO_COUNTH     0x2EU
+#define IMU_REG_FIFO_COUNTL     0x2FU
+#define IMU_REG_FIFO_DATA       0x30U
+#define IMU_REG_INT_STATUS2     0x37U
+#define IMU_REG_SIGNAL_PATH_RST 0x4BU
+#define IMU_REG_PWR_MGMT0       0x4EU
+#define IMU_REG_ACCEL_CONFIG0   0x50U
+#define IMU_REG_SMD_CONFIG      0x57U
+#define IMU_REG_FIFO_CONFIG1    0x5FU
+#define IMU_REG_WHO_AM_I        0x75U
+#define IMU_REG_BANK_SEL        0x76U
+#define IMU_REG_B4_WOM_X_THR    0x4AU
+
+#define IMU_BANKS               5U
+#define IMU_FIFO_PACKETS        256U    /* 2KB FIFO / 8字节包 */
+#define IMU_PACKET_BYTES        8U
+#define IMU_LSB_PER_G           8192    /* ±4g量程 */
+#define IMU_BUS_US_PER_BYTE_X10 225U    /* 400kHz下每字节9个时钟约22.5us */
+
+static uint8_t s_regs[IMU_BANKS][128];
+static uint8_t s_fifo[IMU_FIFO_PACKETS][IMU_PACKET_BYTES];
+static uint32_t s_fifo_head;
+static uint32_t s_fifo_count;
+static uint8_t s_fifo_read_pos;         /* 当前包已读出的字节数 */
+static uint64_t s_next_sample_us;
+static uint32_t s_samples;
+static int32_t s_accel_mg[3] = {0, 0, 1000};
+static int32_t s_shake_mg;
+static uint32_t s_shake_hz;
+static int16_t s_wom_ref[3];
+static uint8_t s_external;              /* 1=样本只来自sim_imu_push_raw() */
+
+static uint8_t *imu_reg(uint8_t reg)
+{
+    uint8_t bank = (reg == IMU_REG_BANK_SEL) ? 0U : s_regs[0][IMU_REG_BANK_SEL];
+
+    return &s_regs[(bank < IMU_BANKS) ? bank : 0U][reg & 0x7FU];
+}
+
+static void imu_reset(void)
+{
+    memset(s_regs, 0, sizeof(s_regs));
+    s_regs[0][IMU_REG_WHO_AM_I] = IMU_WHO_AM_I;
+    s_fifo_count = 0U;
+    s_fifo_read_pos = 0U;
+}
+
+static uint32_t imu_odr_us(void)
+{
+    switch (s_regs[0][IMU_REG_ACCEL_CONFIG0] & 0x0FU)
+    {
+        case 0x06U: return 1000U;
+        case 0x07U: return 5000U;
+        case 0x08U: return 10000U;
+        case 0x09U: return 20000U;
+        case 0x0AU: return 40000U;
+        default:    return 0U;
+    }
+}
+
+static int16_t imu_mg_to_raw(double mg)
+{
+    double raw = mg * IMU_LSB_PER_G / 1000.0;
+
+    if (raw > 32767.0) raw = 32767.0;
+    if (raw < -32767.0) raw = -32767.0;
+    return (int16_t)lrint(raw);
+}
+
+static void imu_sample(uint64_t t_us, int16_t raw[3])
+{
+    double shake = 0.0;
+
+    if (s_shake_mg != 0 && s_shake_hz != 0U)
+    {
+        shake = s_shake_mg * sin(2.0 * M_PI * (double)s_shake_hz * (double)t_us / 1e6);
+    }
+    raw[0] = imu_mg_to_raw(s_accel_mg[0]);
+    raw[1] = imu_mg_to_raw(s_accel_mg[1]);
+    raw[2] = imu_mg_to_raw(s_accel_mg[2] + shake);
+}
+
+/* WOM：任一轴相对进入时样本的变化超过门限(1g/256)即置位INT_STATUS2 */
+static void imu_check_wom(const int16_t raw[3])
+{
+    if ((s_regs[0][IMU_REG_SMD_CONFIG] & 0x03U) == 0U)
+    {
+        return;
+    }
+    for (uint8_t i = 0U; i < 3U; i++)
+    {
+        int32_t diff = abs((int32_t)raw[i] - s_wom_ref[i]);
+        int32_t thr = (int32_t)s_regs[4][IMU_REG_B4_WOM_X_THR + i] * (IMU_LSB_PER_G / 256);
+
+        if (diff > thr)
+        {
+            s_regs[0][IMU_REG_INT_STATUS2] |= (uint8_t)(1U << i);
+        }
+    }
+}
+
+static void imu_push(const int16_t raw[3])
+{
+    uint8_t *packet;
+
+    if (s_fifo_count == IMU_FIFO_PACKETS)
+    {
+        s_fifo_head = (s_fifo_head + 1U) % IMU_FIFO_PACKETS;
+        s_fifo_count--;
+        s_fifo_read_pos = 0U;
+    }
+    packet = s_fifo[(s_fifo_head + s_fifo_count) % IMU_FIFO_PACKETS];
+    packet[0] = 0x40U;      /* 仅加速度 */
+    for (uint8_t i = 0U; i < 3U; i++)
+    {
+        packet[1U + i * 2U] = (uint8_t)((uint16_t)raw[i] >> 8);
+        packet[2U + i * 2U] = (uint8_t)raw[i];
+    }
+    packet[7] = 0U;
+    s_fifo_count++;
+}
+
+/* 补齐到当前时间为止应产生的样本（每个模拟毫秒调用一次，样本取各自时刻的加速度） */
+void sim_imu_tick(void)
+{
+    uint64_t now = host_now_us();
+    uint32_t period = imu_odr_us();
+
+    if (s_external || period == 0U || (s_regs[0][IMU_REG_PWR_MGMT0] & 0x03U) < 2U)
+    {
+        s_next_sample_us = now + period;
+        return;
+    }
+
+    while (s_next_sample_us <= now)
+    {
+        int16_t raw[3];
+
+        imu_sample(s_next_sample_us, raw);
+        sim_imu_push_raw(raw);
+        s_next_sample_us += period;
+    }
+}
+
+void sim_imu_push_raw(const int16_t raw[3])
+{
+    for (uint8_t i = 0U; i < 3U; i++)
+    {
+        s_regs[0][IMU_REG_ACCEL_DATA_X1 + i * 2U] = (uint8_t)((uint16_t)raw[i] >> 8);
+        s_regs[0][IMU_REG_ACCEL_DATA_X1 + i * 2U + 1U] = (uint8_t)raw[i];
+    }
+    if ((s_regs[0][IMU_REG_FIFO_CONFIG] & 0xC0U) != 0U && (s_regs[0][IMU_REG_FIFO_CONFIG1] & 0x01U) != 0U)
+    {
+        imu_push(raw);
+    }
+    imu_check_wom(raw);
+    s_samples++;
+}
+
+uint32_t sim_imu_fifo_level(void)
+{
+    return s_fifo_count;
+}
+
+void sim_imu_set_external(uint8_t on)
+{
+    s_external = on;
+}
+
+void sim_imu_set_accel(int32_t x_mg, int32_t y_mg, int32_t z_mg)
+{
+    s_accel_mg[0] = x_mg;
+    s_accel_mg[1] = y_mg;
+    s_accel_mg[2] = z_mg;
+}
+
+void sim_imu_set_shake(int32_t amp_mg, uint32_t freq_hz)
+{
+    s_shake_mg = amp_mg;
+    s_shake_hz = freq_hz;
+}
+
+uint32_t sim_imu_samples(void)
+{
+    return s_samples;
+}
+
+static void imu_write(uint8_t reg, uint8_t value)
+{
+    if (reg == IMU_REG_DEVICE_CONFIG && (value & 0x01U))
+    {
+        imu_reset();
+        return;
+    }
+    if (reg == IMU_REG_SIGNAL_PATH_RST && (value & 0x02U))
+    {
+        s_fifo_count = 0U;
+        s_fifo_read_pos = 0U;
+        return;
+    }
+    if (reg == IMU_REG_SMD_CONFIG && s_regs[0][IMU_REG_BANK_SEL] == 0U)
+    {
+        imu_sample(host_now_us(), s_wom_ref);
+    }
+    *imu_reg(reg) = value;
+}
+
+static uint8_t imu_read(uint8_t reg)
+{
+    uint8_t value;
+
+    if (s_regs[0][IMU_REG_BANK_SEL] == 0U)
+    {
+        switch (reg)
+        {
+            case IMU_REG_FIFO_COUNTH:
+                return (uint8_t)(s_fifo_count >> 8);
+
+            case IMU_REG_FIFO_COUNTL:
+                return (uint8_t)s_fifo_count;
+
+            case IMU_REG_FIFO_DATA:
+                if (s_fifo_count == 0U)
+                {
+                    return (s_fifo_read_pos++ == 0U) ? 0x80U : 0x00U;   /* 空FIFO读出的包头 */
+                }
+                value = s_fifo[s_fifo_head][s_fifo_read_pos++];
+                if (s_fifo_read_pos == IMU_PACKET_BYTES)
+                {
+                    s_fifo_head = (s_fifo_head + 1U) % IMU_FIFO_PACKETS;
+                    s_fifo_count--;
+                    s_fifo_read_pos = 0U;
+                }
+                return value;
+
+            case IMU_REG_INT_STATUS2:
+                value = s_regs[0][IMU_REG_INT_STATUS2];
+                s_regs[0][IMU_REG_INT_STATUS2] = 0U;    /* 读清 */
+                return value;
+
+            default:
+                break;
+        }
+    }
+    return *imu_reg(reg);
+}
+
+/* 从机地址由AD0引脚电平决定 */
+static uint8_t imu_addressed(uint8_t address)
+{
+    uint8_t ad0 = (MOTION_SENSOR_AD0_PORT->ODR & MOTION_SENSOR_AD0_PIN) ? 1U : 0U;
+
+    return (address == (0x68U | ad0)) ? 1U : 0U;
+}
+
+static void imu_bus_time(uint16_t len)
+{
+    host_advance_us(((uint64_t)(len + 3U) * IMU_BUS_US_PER_BYTE_X10) / 10U);
+}
+
+void soft_i2c_init(soft_i2c_t *bus, uint32_t freq_hz)
+{
+    bus->half_period_cycles = SystemCoreClock / (2U * freq_hz);
+    bus->measured_freq_hz = freq_hz;
+    imu_reset();
+}
+
+uint8_t soft_i2c_self_test(soft_i2c_t *bus)
+{
+    (void)bus;
+    return SOFT_I2C_TEST_OK;
+}
+
+void soft_i2c_bus_clear(const soft_i2c_t *bus)
+{
+    (void)bus;
+}
+
+HAL_StatusTypeDef soft_i2c_mem_write(const soft_i2c_t *bus, uint8_t address, uint8_t reg, const uint8_t *buffer, uint16_t len)
+{
+    (void)bus;
+    imu_bus_time(len);
+    if (!imu_addressed(address))
+    {
+        return HAL_ERROR;
+    }
+    sim_imu_tick();
+    for (uint16_t i = 0U; i < len; i++)
+    {
+        imu_write((uint8_t)(reg + i), buffer[i]);
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef soft_i2c_mem_read(const soft_i2c_t *bus, uint8_t address, uint8_t reg, uint8_t *buffer, uint16_t len)
+{
+    (void)bus;
+    imu_bus_time(len);
+    if (!imu_addressed(address))
+    {
+        return HAL_ERROR;
+    }
+    sim_imu_tick();
+    for (uint16_t i = 0U; i < len; i++)
+    {
+        /* FIFO_DATA不自增，其余寄存器地址自增 */
+        buffer[i] = imu_read((reg == IMU_REG_FIFO_DATA) ? reg : (uint8_t)(reg + i));
+    }
+    return HAL_OK;
+}
+
+/* TEC(I2C1)/WSD(I2C2)数字电位器：HAL_I2C_Master_Transmit_IT立即返回，下一个模拟毫秒进入完成或错误回调 */
+typedef struct
+{
+    I2C_HandleTypeDef *hi2c;
+    uint8_t value;
+    uint8_t pending;
+    int32_t last;
+    uint32_t writes;
+    uint32_t nack;
+} sim_pot_t;
+
+static sim_pot_t s_pots[SIM_POT_COUNT] = {{0, 0U, 0U, -1, 0U, 0U}, {0, 0U, 0U, -1, 0U, 0U}};
+static const char *const s_pot_names[SIM_POT_COUNT] = {"TEC", "WSD"};
+
+static sim_pot_t *sim_pot_find(const I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == TEC_I2C_INSTANCE)
+    {
+        return &s_pots[SIM_POT_TEC];
+    }
+    if (hi2c->Instance == WSD_I2C_INSTANCE)
+    {
+        return &s_pots[SIM_POT_WSD];
+    }
+    return 0;
+}
+
+__attribute__((weak)) void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    (void)hi2c;
+}
+
+__attribute__((weak)) void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    (void)hi2c;
+}
+
+void sim_i2c_tick(void)
+{
+    for (uint8_t i = 0U; i < SIM_POT_COUNT; i++)
+    {
+        sim_pot_t *pot = &s_pots[i];
+        I2C_HandleTypeDef *hi2c = pot->hi2c;
+
+        if (!pot->pending)
+        {
+            continue;
+        }
+        pot->pending = 0U;
+        hi2c->State = HAL_I2C_STATE_READY;
+        if (pot->nack != 0U)
+        {
+            pot->nack--;
+            hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+            if (g_sim_verbose)
+            {
+                printf("[sim %8lu ms] %s 0x%02X NACK\n", (unsigned long)(host_now_us() / 1000U), s_pot_names[i], pot->value);
+            }
+            HAL_I2C_ErrorCallback(hi2c);
+            continue;
+        }
+        hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+        pot->last = pot->value;
+        pot->writes++;
+        if (g_sim_verbose)
+        {
+            printf("[sim %8lu ms] %s wiper 0x%02X\n", (unsigned long)(host_now_us() / 1000U), s_pot_names[i], pot->value);
+        }
+        HAL_I2C_MasterTxCpltCallback(hi2c);
+    }
+}
+
+int32_t sim_pot_value(uint8_t pot)
+{
+    return s_pots[pot].last;
+}
+
+uint32_t sim_pot_writes(uint8_t pot)
+{
+    return s_pots[pot].writes;
+}
+
+void sim_pot_nack(uint8_t pot, uint32_t count)
+{
+    s_pots[pot].nack = count;
+}
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+    hi2c->State = HAL_I2C_STATE_READY;
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c)
+{
+    sim_pot_t *pot = sim_pot_find(hi2c);
+
+    if (pot != 0)
+    {
+        pot->pending = 0U;
+    }
+    hi2c->State = HAL_I2C_STATE_RESET;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2CEx_ConfigAnalogFilter(I2C_HandleTypeDef *hi2c, uint32_t AnalogFilter)
+{
+    (void)hi2c;
+    (void)AnalogFilter;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2CEx_ConfigDigitalFilter(I2C_HandleTypeDef *hi2c, uint32_t DigitalFilter)
+{
+    (void)hi2c;
+    (void)DigitalFilter;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size)
+{
+    sim_pot_t *pot = sim_pot_find(hi2c);
+
+    (void)DevAddress;
+    if (pot == 0 || Size != 1U || hi2c->State != HAL_I2C_STATE_READY)
+    {
+        return HAL_BUSY;
+    }
+    hi2c->State = HAL_I2C_STATE_BUSY_TX;
+    pot->hi2c = hi2c;
+    pot->value = pData[0];
+    pot->pending = 1U;
+    return HAL_OK;
+}
+
+HAL_I2C_StateTypeDef HAL_I2C_GetState(I2C_HandleTypeDef *hi2c)
+{
+    return hi2c->State;
+}
+
+uint32_t HAL_I2C_GetError(I2C_HandleTypeDef *hi2c)
+{
+    return hi2c->ErrorCode;
+}
+
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c)
+{
+    (void)hi2c;
+}
+
+void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c)
+{
+    (void)hi2c;
+}
@@ -0,0 +1,502 @@
+#include "sim.h"
+#include "key.h"
+#include "beep.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* 主机模拟器：运行完整固件，按脚本在指定的模拟时间注入按键/运动并截取屏幕快照，不等待真实时间
+ *   sim [-v] [-o 快照目录] 脚本
+ * 脚本每行为"<毫秒> 命令 参数"，#开始注释，时间从固件上电起算：
+ *   key <1-4> down|up          按下/松开按键（低电平有效）
+ *   press <1-4> <保持毫秒>      按下并在保持时间后松开
+ *   accel <x> <y> <z>          设定加速度(mg)
+ *   shake <幅值mg> <频率Hz>     在Z轴叠加正弦振动，幅值0停止
+ *   nack tec|wsd <次数>        数字电位器接下来的若干次写入不应答
+ *   snap <文件.png|.ppm>       保存屏幕快照
+ *   expect tec|wsd <值>        数字电位器最后写入的值（-1表示未写过）
+ *   expect beeps <次数>        蜂鸣器累计启动次数
+ *   expect pixel <x> <y> <RGB565>
+ *   end                        打印统计并退出
+ * 按键、加速度、nack在到达时间的那个毫秒生效；snap/expect/end在该时间之后固件第一次空闲(WFI)时执行，
+ * 避免截到绘制到一半的画面
+ */
+
+extern int firmware_main(void);
+extern void BEEP_TIM_IRQHandler(void);
+
+uint8_t g_sim_verbose = 0U;
+
+typedef enum
+{
+    EV_KEY = 0,
+    EV_ACCEL,
+    EV_SHAKE,
+    EV_NACK,
+    EV_SNAP,            /* 以下在空闲时执行 */
+    EV_EXPECT_POT,
+    EV_EXPECT_BEEPS,
+    EV_EXPECT_PIXEL,
+    EV_END
+} sim_event_type_t;
+
+typedef struct
+{
+    uint32_t t_ms;
+    uint32_t line;
+    sim_event_type_t type;
+    int32_t arg[4];
+    char path[256];
+} sim_event_t;
+
+#define SIM_IDLE_TIMEOUT_MS     5000U   /* 固件超过该时间不进入空闲视为卡死 */
+
+static sim_event_t *s_events;
+static uint32_t s_event_count;
+static uint32_t s_next_input;
+static uint32_t s_next_idle;
+static const char *s_out_dir = ".";
+static uint32_t s_failures;
+static uint32_t s_beeps;
+static uint8_t s_beep_on;
+static uint32_t s_tim7_us;
+static struct timespec s_wall_start;
+
+static const struct
+{
+    GPIO_TypeDef *port;
+    uint16_t pin;
+} s_keys[4] =
+{
+    {KEY1_GPIO_PORT, KEY1_GPIO_PIN},
+    {KEY2_GPIO_PORT, KEY2_GPIO_PIN},
+    {KEY3_GPIO_PORT, KEY3_GPIO_PIN},
+    {KEY4_GPIO_PORT, KEY4_GPIO_PIN},
+};
+
+static uint32_t sim_now_ms(void)
+{
+    return (uint32_t)(host_now_us() / 1000U);
+}
+
+static void sim_usage(void)
+{
+    fprintf(stderr, "usage: sim [-v] [-o snapshot_dir] script\n");
+    exit(2);
+}
+
+static sim_event_t *sim_add_event(uint32_t t_ms, uint32_t line, sim_event_type_t type)
+{
+    static uint32_t capacity;
+    sim_event_t *ev;
+
+    if (s_event_count == capacity)
+    {
+        capacity = capacity ? capacity * 2U : 64U;
+        s_events = realloc(s_events, capacity * sizeof(*s_events));
+        if (s_events == 0)
+        {
+            fprintf(stderr, "sim: out of memory\n");
+            exit(2);
+        }
+    }
+    ev = &s_events[s_event_count++];
+    memset(ev, 0, sizeof(*ev));
+    ev->t_ms = t_ms;
+    ev->line = line;
+    ev->type = type;
+    return ev;
+}
+
+static int sim_event_cmp(const void *a, const void *b)
+{
+    const sim_event_t *ea = a;
+    const sim_event_t *eb = b;
+
+    if (ea->t_ms != eb->t_ms)
+    {
+        return (ea->t_ms < eb->t_ms) ? -1 : 1;
+    }
+    return (ea->line < eb->line) ? -1 : (ea->line > eb->line);
+}
+
+static int sim_parse_pot(const char *name)
+{
+    if (strcmp(name, "tec") == 0) return SIM_POT_TEC;
+    if (strcmp(name, "wsd") == 0) return SIM_POT_WSD;
+    return -1;
+}
+
+static void sim_load_script(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    char buf[512];
+    uint32_t line = 0U;
+
+    if (fp == 0)
+    {
+        fprintf(stderr, "sim: cannot open %s\n", path);
+        exit(2);
+    }
+
+    while (fgets(buf, sizeof(buf), fp) != 0)
+    {
+        char cmd[32] = "";
+        char word[256] = "";
+        unsigned long t;
+        long a = 0, b = 0, c = 0;
+        int n;
+        sim_event_t *ev;
+        char *hash = strchr(buf, '#');
+
+        line++;
+        if (hash != 0)
+        {
+            *hash = '\0';
+        }
+        n = sscanf(buf, "%lu %31s", &t, cmd);
+        if (n <= 0)
+        {
+            continue;
+        }
+        if (n != 2)
+        {
+            goto bad;
+        }
+
+        if (strcmp(cmd, "key") == 0 || strcmp(cmd, "press") == 0)
+        {
+            if (sscanf(buf, "%*u %*s %ld %255s", &a, word) != 2 || a < 1 || a > 4)
+            {
+                goto bad;
+            }
+            ev = sim_add_event((uint32_t)t, line, EV_KEY);
+            ev->arg[0] = (int32_t)a - 1;
+            if (cmd[0] == 'p')
+            {
+                ev->arg[1] = 1;
+                ev = sim_add_event((uint32_t)(t + strtoul(word, 0, 0)), line, EV_KEY);
+                ev->arg[0] = (int32_t)a - 1;
+                ev->arg[1] = 0;
+            }
+            else if (strcmp(word, "down") == 0 || strcmp(word, "up") == 0)
+            {
+                ev->arg[1] = (word[0] == 'd') ? 1 : 0;
+            }
+            else
+            {
+                goto bad;
+            }
+        }
+        else if (strcmp(cmd, "accel") == 0)
+        {
+            if (sscanf(buf, "%*u %*s %ld %ld %ld", &a, &b, &c) != 3)
+            {
+                goto bad;
+            }
+            ev = sim_add_event((uint32_t)t, line, EV_ACCEL);
+            ev->arg[0] = (int32_t)a;
+            ev->arg[1] = (int32_t)b;
+            ev->arg[2] = (int32_t)c;
+        }
+        else if (strcmp(cmd, "shake") == 0)
+        {
+            n = sscanf(buf, "%*u %*s %ld %ld", &a, &b);
+            if (n < 1 || (a != 0 && n != 2))
+            {
+                goto bad;
+            }
+            ev = sim_add_event((uint32_t)t, line, EV_SHAKE);
+            ev->arg[0] = (int32_t)a;
+            ev->arg[1] = (int32_t)b;
+        }
+        else if (strcmp(cmd, "nack") == 0)
+        {
+            if (sscanf(buf, "%*u %*s %31s %ld", word, &a) != 2 || sim_parse_pot(word) < 0)
+            {
+                goto bad;
+            }
+            ev = sim_add_event((uint32_t)t, line, EV_NACK);
+            ev->arg[0] = sim_parse_pot(word);
+            ev->arg[1] = (int32_t)a;
+        }
+        else if (strcmp(cmd, "snap") == 0)
+        {
+            if (sscanf(buf, "%*u %*s %255s", word) != 1)
+            {
+                goto bad;
+            }
+            ev = sim_add_event((uint32_t)t, line, EV_SNAP);
+            if (word[0] == '/')
+            {
+                snprintf(ev->path, sizeof(ev->path), "%s", word);
+            }
+            else
+            {
+                snprintf(ev->path, sizeof(ev->path), "%s/%s", s_out_dir, word);
+            }
+        }
+        else if (strcmp(cmd, "expect") == 0)
+        {
+            char what[32];
+
+            if (sscanf(buf, "%*u %*s %31s", what) != 1)
+            {
+                goto bad;
+            }
+            if (sim_parse_pot(what) >= 0 && sscanf(buf, "%*u %*s %*s %li", &a) == 1)
+            {
+                ev = sim_add_event((uint32_t)t, line, EV_EXPECT_POT);
+                ev->arg[0] = sim_parse_pot(what);
+                ev->arg[1] = (int32_t)a;
+            }
+            else if (strcmp(what, "beeps") == 0 && sscanf(buf, "%*u %*s %*s %li", &a) == 1)
+            {
+                ev = sim_add_event((uint32_t)t, line, EV_EXPECT_BEEPS);
+                ev->arg[0] = (int32_t)a;
+            }
+            else if (strcmp(what, "pixel") == 0 && sscanf(buf, "%*u %*s %*s %li %li %li", &a, &b, &c) == 3)
+            {
+                ev = sim_add_event((uint32_t)t, line, EV_EXPECT_PIXEL);
+                ev->arg[0] = (int32_t)a;
+                ev->arg[1] = (int32_t)b;
+                ev->arg[2] = (int32_t)c;
+            }
+            else
+            {
+                goto bad;
+            }
+        }
+        else if (strcmp(cmd, "end") == 0)
+        {
+            (void)sim_add_event((uint32_t)t, line, EV_END);
+        }
+        else
+        {
+            goto bad;
+        }
+        continue;
+
+bad:
+        fprintf(stderr, "sim: %s:%lu: cannot parse: %s", path, (unsigned long)line, buf);
+        exit(2);
+    }
+    fclose(fp);
+
+    /* 没有end时在最后一个事件之后结束 */
+    if (s_event_count == 0U || s_events[s_event_count - 1U].type != EV_END)
+    {
+        uint32_t last = 0U;
+
+        for (uint32_t i = 0U; i < s_event_count; i++)
+        {
+            if (s_events[i].t_ms > last) last = s_events[i].t_ms;
+        }
+        (void)sim_add_event(last, line + 1U, EV_END);
+    }
+    qsort(s_events, s_event_count, sizeof(*s_events), sim_event_cmp);
+}
+
+static void sim_expect(const sim_event_t *ev, int32_t got, int32_t want, const char *what)
+{
+    if (got != want)
+    {
+        printf("[sim %8lu ms] line %lu: expect %s %ld, got %ld\n", (unsigned long)sim_now_ms(),
+               (unsigned long)ev->line, what, (long)want, (long)got);
+        s_failures++;
+    }
+}
+
+static void sim_finish(void)
+{
+    struct timespec now;
+    double wall_ms;
+    uint32_t sim_ms = sim_now_ms();
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    wall_ms = (now.tv_sec - s_wall_start.tv_sec) * 1e3 + (now.tv_nsec - s_wall_start.tv_nsec) / 1e6;
+
+    printf("sim: %lu ms simulated in %.1f ms wall (%.0fx real time)\n", (unsigned long)sim_ms, wall_ms,
+           (wall_ms > 0.0) ? sim_ms / wall_ms : 0.0);
+    printf("sim: %lu SPI bytes, %lu GRAM writes, %lu IMU samples, %lu beeps, TEC %ld (%lu writes), WSD %ld (%lu writes)\n",
+           (unsigned long)sim_panel_bytes(), (unsigned long)sim_panel_frames(), (unsigned long)sim_imu_samples(),
+           (unsigned long)s_beeps, (long)sim_pot_value(SIM_POT_TEC), (unsigned long)sim_pot_writes(SIM_POT_TEC),
+           (long)sim_pot_value(SIM_POT_WSD), (unsigned long)sim_pot_writes(SIM_POT_WSD));
+    printf("sim: %s (%lu failed expectations)\n", (s_failures == 0U) ? "PASS" : "FAIL", (unsigned long)s_failures);
+    fflush(stdout);
+    exit((s_failures == 0U) ? 0 : 1);
+}
+
+/* 空闲时执行的事件：快照、检查、结束 */
+static void sim_run_idle_events(void)
+{
+    uint32_t now = sim_now_ms();
+
+    while (s_next_idle < s_event_count && s_events[s_next_idle].t_ms <= now)
+    {
+        const sim_event_t *ev = &s_events[s_next_idle++];
+
+        switch (ev->type)
+        {
+            case EV_SNAP:
+                if (sim_panel_snapshot(ev->path) != 0)
+                {
+                    printf("[sim %8lu ms] cannot write %s\n", (unsigned long)now, ev->path);
+                    s_failures++;
+                }
+                else
+                {
+                    printf("[sim %8lu ms] snapshot %s\n", (unsigned long)now, ev->path);
+                }
+                break;
+
+            case EV_EXPECT_POT:
+                sim_expect(ev, sim_pot_value((uint8_t)ev->arg[0]), ev->arg[1], (ev->arg[0] == SIM_POT_TEC) ? "tec" : "wsd");
+                break;
+
+            case EV_EXPECT_BEEPS:
+                sim_expect(ev, (int32_t)s_beeps, ev->arg[0], "beeps");
+                break;
+
+            case EV_EXPECT_PIXEL:
+                sim_expect(ev, sim_panel_pixel((uint16_t)ev->arg[0], (uint16_t)ev->arg[1]), ev->arg[2], "pixel");
+                break;
+
+            case EV_END:
+                sim_finish();
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+static void sim_run_input_events(void)
+{
+    uint32_t now = sim_now_ms();
+
+    while (s_next_input < s_event_count && s_events[s_next_input].t_ms <= now)
+    {
+        const sim_event_t *ev = &s_events[s_next_input++];
+
+        switch (ev->type)
+        {
+            case EV_KEY:
+                if (ev->arg[1])
+                {
+                    s_keys[ev->arg[0]].port->IDR &= ~(uint32_t)s_keys[ev->arg[0]].pin;
+                }
+                else
+                {
+                    s_keys[ev->arg[0]].port->IDR |= s_keys[ev->arg[0]].pin;
+                }
+                printf("[sim %8lu ms] key%ld %s\n", (unsigned long)now, (long)ev->arg[0] + 1, ev->arg[1] ? "down" : "up");
+                break;
+
+            case EV_ACCEL:
+                sim_imu_set_accel(ev->arg[0], ev->arg[1], ev->arg[2]);
+                break;
+
+            case EV_SHAKE:
+                sim_imu_set_shake(ev->arg[0], (uint32_t)ev->arg[1]);
+                break;
+
+            case EV_NACK:
+                sim_pot_nack((uint8_t)ev->arg[0], (uint32_t)ev->arg[1]);
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+/* TIM7（蜂鸣器）：计数频率1MHz，每毫秒按ARR+1补齐应产生的更新中断 */
+static void sim_beep_tick(void)
+{
+    if ((BEEP_TIM->CR1 & TIM_CR1_CEN) == 0U)
+    {
+        s_beep_on = 0U;
+        s_tim7_us = 0U;
+        return;
+    }
+
+    if (!s_beep_on)
+    {
+        s_beep_on = 1U;
+        s_beeps++;
+        if (g_sim_verbose)
+        {
+            printf("[sim %8lu ms] beep\n", (unsigned long)sim_now_ms());
+        }
+    }
+
+    s_tim7_us += 1000U;
+    while ((BEEP_TIM->CR1 & TIM_CR1_CEN) != 0U && s_tim7_us >= BEEP_TIM->ARR + 1U)
+    {
+        s_tim7_us -= BEEP_TIM->ARR + 1U;
+        BEEP_TIM->SR |= TIM_SR_UIF;
+        BEEP_TIM_IRQHandler();
+    }
+}
+
+/* 每个模拟毫秒（相当于SysTick） */
+static void sim_tick(void)
+{
+    sim_run_input_events();
+    sim_imu_tick();
+    sim_i2c_tick();
+    sim_beep_tick();
+
+    if (s_next_idle < s_event_count && sim_now_ms() > s_events[s_next_idle].t_ms + SIM_IDLE_TIMEOUT_MS)
+    {
+        printf("[sim %8lu ms] firmware not idle for %u ms\n", (unsigned long)sim_now_ms(), SIM_IDLE_TIMEOUT_MS);
+        s_failures++;
+        sim_finish();
+    }
+}
+
+static void sim_wfi(void)
+{
+    host_advance_us(1000U - (host_now_us() % 1000U));
+    sim_run_idle_events();
+}
+
+int main(int argc, char **argv)
+{
+    int i;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++)
+    {
+        if (strcmp(argv[i], "-v") == 0)
+        {
+            g_sim_verbose = 1U;
+        }
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+        {
+            s_out_dir = argv[++i];
+        }
+        else
+        {
+            sim_usage();
+        }
+    }
+    if (i + 1 != argc)
+    {
+        sim_usage();
+    }
+    sim_load_script(argv[i]);
+
+    for (uint8_t k = 0U; k < 4U; k++)
+    {
+        s_keys[k].port->IDR |= s_keys[k].pin;       /* 上拉，松开为高电平 */
+    }
+    host_set_spi_hook(sim_panel_spi);
+    host_set_tick_hook(sim_tick);
+    host_set_wfi_hook(sim_wfi);
+    clock_gettime(CLOCK_MONOTONIC, &s_wall_start);
+
+    firmware_main();
+    return 1;
+}
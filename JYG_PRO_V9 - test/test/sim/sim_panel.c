@@ -0,0 +1,295 @@
+#include "sim.h"
+#include "lcd.h"
+#include <string.h>
+
+/* JD9613面板模型：解码列/页地址(0x2A/0x2B)、写GRAM(0x2C)和MADCTL(0x36)，像素按高字节在前的RGB565写入帧缓冲。
+ * 帧缓冲按固件的列/页地址存放，MADCTL只记录不参与换算，快照与固件坐标一致
+ */
+
+#define PANEL_CMD_CASET     0x2AU
+#define PANEL_CMD_RASET     0x2BU
+#define PANEL_CMD_RAMWR     0x2CU
+#define PANEL_CMD_MADCTL    0x36U
+
+static uint16_t s_fb[LCD_HEIGHT][LCD_WIDTH];
+static uint8_t s_cmd;
+static uint8_t s_params[4];
+static uint8_t s_param_count;
+static uint16_t s_xs, s_xe = LCD_WIDTH - 1U, s_ys, s_ye = LCD_HEIGHT - 1U;
+static uint16_t s_x, s_y;
+static uint8_t s_pixel_hi;
+static uint8_t s_pixel_phase;
+static uint8_t s_madctl;
+static uint32_t s_bytes;
+static uint32_t s_frames;
+
+static void panel_put_pixel(uint16_t color)
+{
+    if (s_x < LCD_WIDTH && s_y < LCD_HEIGHT)
+    {
+        s_fb[s_y][s_x] = color;
+    }
+
+    if (++s_x > s_xe)
+    {
+        s_x = s_xs;
+        if (++s_y > s_ye)
+        {
+            s_y = s_ys;
+        }
+    }
+}
+
+void sim_panel_spi(uint8_t byte, uint8_t dc, uint8_t cs)
+{
+    s_bytes++;
+    if (cs != 0U)
+    {
+        return;     /* 片选无效时面板不接收 */
+    }
+
+    if (dc == 0U)
+    {
+        s_cmd = byte;
+        s_param_count = 0U;
+        if (byte == PANEL_CMD_RAMWR)
+        {
+            s_x = s_xs;
+            s_y = s_ys;
+            s_pixel_phase = 0U;
+            s_frames++;
+        }
+        return;
+    }
+
+    switch (s_cmd)
+    {
+        case PANEL_CMD_CASET:
+        case PANEL_CMD_RASET:
+            if (s_param_count < 4U)
+            {
+                s_params[s_param_count++] = byte;
+            }
+            if (s_param_count == 4U)
+            {
+                uint16_t start = (uint16_t)((s_params[0] << 8) | s_params[1]);
+                uint16_t end = (uint16_t)((s_params[2] << 8) | s_params[3]);
+
+                if (s_cmd == PANEL_CMD_CASET)
+                {
+                    s_xs = start;
+                    s_xe = end;
+                }
+                else
+                {
+                    s_ys = start;
+                    s_ye = end;
+                }
+            }
+            break;
+
+        case PANEL_CMD_RAMWR:
+            if (s_pixel_phase == 0U)
+            {
+                s_pixel_hi = byte;
+                s_pixel_phase = 1U;
+            }
+            else
+            {
+                panel_put_pixel((uint16_t)((s_pixel_hi << 8) | byte));
+                s_pixel_phase = 0U;
+            }
+            break;
+
+        case PANEL_CMD_MADCTL:
+            s_madctl = byte;
+            break;
+
+        default:
+            break;
+    }
+}
+
+uint16_t sim_panel_pixel(uint16_t x, uint16_t y)
+{
+    return (x < LCD_WIDTH && y < LCD_HEIGHT) ? s_fb[y][x] : 0U;
+}
+
+uint32_t sim_panel_bytes(void)
+{
+    return s_bytes;
+}
+
+uint32_t sim_panel_frames(void)
+{
+    return s_frames;
+}
+
+static void panel_rgb888(uint16_t color, uint8_t rgb[3])
+{
+    uint8_t r = (uint8_t)((color >> 11) & 0x1FU);
+    uint8_t g = (uint8_t)((color >> 5) & 0x3FU);
+    uint8_t b = (uint8_t)(color & 0x1FU);
+
+    rgb[0] = (uint8_t)((r << 3) | (r >> 2));
+    rgb[1] = (uint8_t)((g << 2) | (g >> 4));
+    rgb[2] = (uint8_t)((b << 3) | (b >> 2));
+}
+
+static int panel_write_ppm(FILE *fp)
+{
+    fprintf(fp, "P6\n%u %u\n255\n", (unsigned int)LCD_WIDTH, (unsigned int)LCD_HEIGHT);
+    for (uint32_t y = 0U; y < LCD_HEIGHT; y++)
+    {
+        for (uint32_t x = 0U; x < LCD_WIDTH; x++)
+        {
+            uint8_t rgb[3];
+
+            panel_rgb888(s_fb[y][x], rgb);
+            fwrite(rgb, 1U, 3U, fp);
+        }
+    }
+    return ferror(fp) ? -1 : 0;
+}
+
+/* PNG：IDAT用不压缩的deflate块（stored），只需CRC32和Adler-32，无需zlib */
+static uint32_t s_crc_table[256];
+
+static uint32_t png_crc(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    if (s_crc_table[1] == 0U)
+    {
+        for (uint32_t n = 0U; n < 256U; n++)
+        {
+            uint32_t c = n;
+
+            for (uint8_t k = 0U; k < 8U; k++)
+            {
+                c = (c & 1U) ? (0xEDB88320UL ^ (c >> 1)) : (c >> 1);
+            }
+            s_crc_table[n] = c;
+        }
+    }
+
+    crc = ~crc;
+    while (len--)
+    {
+        crc = s_crc_table[(crc ^ *data++) & 0xFFU] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void png_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static void png_chunk(FILE *fp, const char *type, const uint8_t *data, uint32_t len)
+{
+    uint8_t head[8];
+    uint8_t tail[4];
+    uint32_t crc;
+
+    png_put32(head, len);
+    memcpy(&head[4], type, 4U);
+    crc = png_crc(0U, &head[4], 4U);
+    crc = png_crc(crc, data, len);
+    png_put32(tail, crc);
+
+    fwrite(head, 1U, sizeof(head), fp);
+    fwrite(data, 1U, len, fp);
+    fwrite(tail, 1U, sizeof(tail), fp);
+}
+
+#define PNG_ROW_BYTES       (1U + LCD_WIDTH * 3U)       /* 滤波类型字节 + RGB */
+#define PNG_RAW_BYTES       (PNG_ROW_BYTES * LCD_HEIGHT)
+#define PNG_BLOCK_MAX       65535U
+#define PNG_ZLIB_BYTES      (2U + PNG_RAW_BYTES + 5U * ((PNG_RAW_BYTES + PNG_BLOCK_MAX - 1U) / PNG_BLOCK_MAX) + 4U)
+
+static int panel_write_png(FILE *fp)
+{
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    static uint8_t raw[PNG_RAW_BYTES];
+    static uint8_t zlib[PNG_ZLIB_BYTES];
+    uint8_t ihdr[13];
+    uint32_t pos = 0U;
+    uint32_t a = 1U;
+    uint32_t b = 0U;
+
+    for (uint32_t y = 0U; y < LCD_HEIGHT; y++)
+    {
+        uint8_t *row = &raw[y * PNG_ROW_BYTES];
+
+        row[0] = 0U;
+        for (uint32_t x = 0U; x < LCD_WIDTH; x++)
+        {
+            panel_rgb888(s_fb[y][x], &row[1U + x * 3U]);
+        }
+    }
+
+    zlib[pos++] = 0x78U;
+    zlib[pos++] = 0x01U;
+    for (uint32_t offset = 0U; offset < PNG_RAW_BYTES; offset += PNG_BLOCK_MAX)
+    {
+        uint32_t len = (PNG_RAW_BYTES - offset > PNG_BLOCK_MAX) ? PNG_BLOCK_MAX : (PNG_RAW_BYTES - offset);
+
+        zlib[pos++] = (offset + len == PNG_RAW_BYTES) ? 1U : 0U;
+        zlib[pos++] = (uint8_t)len;
+        zlib[pos++] = (uint8_t)(len >> 8);
+        zlib[pos++] = (uint8_t)~len;
+        zlib[pos++] = (uint8_t)(~len >> 8);
+        memcpy(&zlib[pos], &raw[offset], len);
+        pos += len;
+    }
+    for (uint32_t i = 0U; i < PNG_RAW_BYTES; i++)
+    {
+        a = (a + raw[i]) % 65521U;
+        b = (b + a) % 65521U;
+    }
+    png_put32(&zlib[pos], (b << 16) | a);
+    pos += 4U;
+
+    png_put32(&ihdr[0], LCD_WIDTH);
+    png_put32(&ihdr[4], LCD_HEIGHT);
+    ihdr[8] = 8U;       /* 位深 */
+    ihdr[9] = 2U;       /* RGB */
+    ihdr[10] = 0U;
+    ihdr[11] = 0U;
+    ihdr[12] = 0U;
+
+    fwrite(signature, 1U, sizeof(signature), fp);
+    png_chunk(fp, "IHDR", ihdr, sizeof(ihdr));
+    png_chunk(fp, "IDAT", zlib, pos);
+    png_chunk(fp, "IEND", 0, 0U);
+    return ferror(fp) ? -1 : 0;
+}
+
+/* 按扩展名选择格式：.png为PNG，其余为PPM(P6) */
+int sim_panel_snapshot(const char *path)
+{
+    size_t len = strlen(path);
+    FILE *fp = fopen(path, "wb");
+    int ret;
+
+    if (fp == 0)
+    {
+        return -1;
+    }
+
+    if (len > 4U && strcmp(&path[len - 4U], ".png") == 0)
+    {
+        ret = panel_write_png(fp);
+    }
+    else
+    {
+        ret = panel_write_ppm(fp);
+    }
+    if (fclose(fp) != 0)
+    {
+        ret = -1;
+    }
+    return ret;
+}
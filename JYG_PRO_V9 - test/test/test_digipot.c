@@ -0,0 +1,105 @@
+/* 数字电位器斜坡(user-020)：斜坡进行中把曲线改为NULL或step为0时直接到目标值，之后的节拍不再访问曲线；
+ * 无应答(user-019)后退避DIGIPOT_RETRY_BACKOFF_MS再重发
+ * 总线由sim/sim_i2c.c的电位器模型应答，sim_i2c_tick()完成上一次发送
+ */
+#include "sim/sim.h"
+#include "digipot.h"
+#include "tec.h"
+#include <string.h>
+
+uint8_t g_sim_verbose = 0U;
+
+static I2C_HandleTypeDef s_hi2c;
+static digipot_t s_dev;
+
+static const digipot_ramp_profile_t s_slow = {DIGIPOT_WIPER_MAX, 4U, 20U};
+static const digipot_ramp_profile_t s_no_step = {DIGIPOT_WIPER_MAX, 0U, 20U};
+
+static void advance_ms(uint32_t ms)
+{
+    while (ms--)
+    {
+        host_advance_us(1000U);
+        sim_i2c_tick();
+        digipot_ramp_process();
+    }
+}
+
+static void setup(void)
+{
+    memset(&s_dev, 0, sizeof(s_dev));
+    s_hi2c.Instance = TEC_I2C_INSTANCE;
+    (void)HAL_I2C_Init(&s_hi2c);
+    digipot_register(&s_dev, &s_hi2c, 0x2FU);
+    digipot_set_profile(&s_dev, &s_slow);
+    digipot_ramp_start(&s_dev, 0x00U);
+    advance_ms(50U);
+    HOST_CHECK(digipot_is_ramping(&s_dev));
+    HOST_CHECK(sim_pot_value(SIM_POT_TEC) > 0x00);
+}
+
+static void test_profile_cleared_while_ramping(const digipot_ramp_profile_t *profile)
+{
+    setup();
+    digipot_set_profile(&s_dev, profile);
+    HOST_CHECK(!digipot_is_ramping(&s_dev));
+    advance_ms(5U);
+    HOST_CHECK_EQ(sim_pot_value(SIM_POT_TEC), 0x00);
+    HOST_CHECK(!digipot_is_busy(&s_dev));
+}
+
+/* 曲线对象在斜坡中途被改成step为0（未经digipot_set_profile）时，节拍直接到目标而不是原地不动 */
+static void test_process_guard(void)
+{
+    static digipot_ramp_profile_t profile = {DIGIPOT_WIPER_MAX, 4U, 20U};
+
+    memset(&s_dev, 0, sizeof(s_dev));
+    digipot_register(&s_dev, &s_hi2c, 0x2FU);
+    digipot_set_profile(&s_dev, &profile);
+    digipot_ramp_start(&s_dev, 0x00U);
+    advance_ms(30U);
+    HOST_CHECK(digipot_is_ramping(&s_dev));
+
+    profile.step = 0U;
+    advance_ms(5U);
+    HOST_CHECK(!digipot_is_ramping(&s_dev));
+    HOST_CHECK_EQ(sim_pot_value(SIM_POT_TEC), 0x00);
+}
+
+static void test_nack_backoff(void)
+{
+    digipot_stats_t stats;
+    uint32_t writes;
+
+    memset(&s_dev, 0, sizeof(s_dev));
+    digipot_register(&s_dev, &s_hi2c, 0x2FU);
+    digipot_set_profile(&s_dev, 0);
+    advance_ms(5U);
+    writes = sim_pot_writes(SIM_POT_TEC);
+
+    sim_pot_nack(SIM_POT_TEC, 1U);
+    digipot_write(&s_dev, 0x40U);
+    host_advance_us(1000U);
+    sim_i2c_tick();                 /* 无应答 */
+    HOST_CHECK(digipot_is_busy(&s_dev));
+
+    digipot_ramp_process();         /* 退避未到，不重发 */
+    sim_i2c_tick();
+    HOST_CHECK_EQ(sim_pot_writes(SIM_POT_TEC), writes);
+
+    advance_ms(DIGIPOT_RETRY_BACKOFF_MS + 1U);
+    HOST_CHECK_EQ(sim_pot_writes(SIM_POT_TEC), writes + 1U);
+    HOST_CHECK_EQ(sim_pot_value(SIM_POT_TEC), 0x40);
+    digipot_get_stats(&s_dev, &stats);
+    HOST_CHECK_EQ(stats.retries, 1U);
+    HOST_CHECK(!digipot_is_busy(&s_dev));
+}
+
+int main(void)
+{
+    test_profile_cleared_while_ramping(0);
+    test_profile_cleared_while_ramping(&s_no_step);
+    test_process_guard();
+    test_nack_backoff();
+    return host_report("test_digipot");
+}
@@ -0,0 +1,89 @@
+/* 16灰度->RGB565查表转换(user-003)与原逐像素转换逐位一致 */
+#include "host.h"
+#include "../User/bsp/lcd.c"
+
+/* 原实现（baseline lcd.c中的LCD_Convert16GrayToRGB565），逐字保留作为参考 */
+static uint16_t ref_convert16gray_to_rgb565(uint8_t gray_4bit)
+{
+    uint8_t inverted_gray = 15 - gray_4bit;
+    uint8_t r = (inverted_gray * 31) / 15;
+    uint8_t g = (inverted_gray * 63) / 15;
+    uint8_t b = (inverted_gray * 31) / 15;
+
+    return ((uint16_t)r << 11) | ((uint16_t)g << 5) | (uint16_t)b;
+}
+
+/* 原LCD_ShowPartialImage16Gray的缓冲区填充：每像素[高字节][低字节]，奇数像素数时末字节只取高4位 */
+static uint32_t ref_convert(uint8_t *dst, const uint8_t *src, uint32_t pixels)
+{
+    uint32_t n = 0U;
+
+    for (uint32_t i = 0U; i < (pixels + 1U) / 2U; i++)
+    {
+        uint16_t v = ref_convert16gray_to_rgb565((src[i] >> 4) & 0x0F);
+        dst[n++] = (v >> 8) & 0xFF;
+        dst[n++] = v & 0xFF;
+        if ((i * 2U + 1U) < pixels)
+        {
+            v = ref_convert16gray_to_rgb565(src[i] & 0x0F);
+            dst[n++] = (v >> 8) & 0xFF;
+            dst[n++] = v & 0xFF;
+        }
+    }
+    return n;
+}
+
+static void test_every_byte(void)
+{
+    uint32_t out[1];
+    uint8_t ref[4];
+
+    for (uint32_t b = 0U; b < 256U; b++)
+    {
+        uint8_t src = (uint8_t)b;
+
+        LCD_ConvertGrayStrip((uint8_t *)out, &src, 2U);
+        ref_convert(ref, &src, 2U);
+        HOST_CHECK(memcmp(out, ref, 4U) == 0);
+
+        /* 单个像素只写低半字 */
+        out[0] = 0xA5A5A5A5U;
+        LCD_ConvertGrayStrip((uint8_t *)out, &src, 1U);
+        ref_convert(ref, &src, 1U);
+        HOST_CHECK(memcmp(out, ref, 2U) == 0);
+        HOST_CHECK_EQ(((uint8_t *)out)[2], 0xA5U);
+        HOST_CHECK_EQ(((uint8_t *)out)[3], 0xA5U);
+    }
+}
+
+/* 覆盖4字节展开循环、余数循环和奇数像素尾部的各种组合 */
+static void test_strip_lengths(void)
+{
+    static uint8_t src[LCD_WIDTH];
+    static uint32_t out[LCD_WIDTH];
+    static uint8_t ref[LCD_WIDTH * 4U];
+    uint32_t seed = 12345U;
+
+    for (uint32_t i = 0U; i < sizeof(src); i++)
+    {
+        seed = seed * 1103515245U + 12345U;
+        src[i] = (uint8_t)(seed >> 16);
+    }
+
+    for (uint32_t pixels = 1U; pixels <= LCD_WIDTH * 2U; pixels++)
+    {
+        uint32_t bytes = ref_convert(ref, src, pixels);
+
+        memset(out, 0, sizeof(out));
+        LCD_ConvertGrayStrip((uint8_t *)out, src, pixels);
+        HOST_CHECK_EQ(bytes, pixels * 2U);
+        HOST_CHECK(memcmp(out, ref, bytes) == 0);
+    }
+}
+
+int main(void)
+{
+    test_every_byte();
+    test_strip_lengths();
+    return host_report("test_gray_lut");
+}
@@ -0,0 +1,222 @@
+/* 图片资源RLE压缩(user-007)往返校验：image_logo.c中每个资源解码后与image_logo_raw.c原始数据逐字节一致，
+ * RLE直接绘制与未压缩绘制发往屏幕的像素字节相同，资源索引CRC校验通过
+ */
+#include "host.h"
+#include "lcd.h"
+#include "asset.h"
+#include "image_logo.h"
+#include <string.h>
+
+/* 原始数据与image_logo.c中的符号同名，包含时改名 */
+#define gImage_shalou_40x40     raw_shalou_40x40
+#define gImage_mode1_126x174    raw_mode1_126x174
+#define gImage_mode2_126x174    raw_mode2_126x174
+#define gImage_mode3_126x174    raw_mode3_126x174
+#define gImage_mode4_126x174    raw_mode4_126x174
+#define gImage_mode5_126x174    raw_mode5_126x174
+#define gImage_dang1            raw_dang1
+#define gImage_dang2            raw_dang2
+#define gImage_dang3            raw_dang3
+#define gImage_dang4            raw_dang4
+#define gImage_dang5            raw_dang5
+#include "../User/SCRIPT/image_logo_raw.c"
+#undef gImage_shalou_40x40
+#undef gImage_mode1_126x174
+#undef gImage_mode2_126x174
+#undef gImage_mode3_126x174
+#undef gImage_mode4_126x174
+#undef gImage_mode5_126x174
+#undef gImage_dang1
+#undef gImage_dang2
+#undef gImage_dang3
+#undef gImage_dang4
+#undef gImage_dang5
+
+typedef struct
+{
+    const char *name;
+    const image_rle_t *rle;
+    const unsigned char *raw;
+    uint32_t raw_size;
+} gray_asset_t;
+
+static const gray_asset_t s_assets[] =
+{
+    {"mode1", &gImage_mode1_126x174, raw_mode1_126x174, sizeof(raw_mode1_126x174)},
+    {"mode2", &gImage_mode2_126x174, raw_mode2_126x174, sizeof(raw_mode2_126x174)},
+    {"mode3", &gImage_mode3_126x174, raw_mode3_126x174, sizeof(raw_mode3_126x174)},
+    {"mode4", &gImage_mode4_126x174, raw_mode4_126x174, sizeof(raw_mode4_126x174)},
+    {"mode5", &gImage_mode5_126x174, raw_mode5_126x174, sizeof(raw_mode5_126x174)},
+    {"dang1", &gImage_dang1, raw_dang1, sizeof(raw_dang1)},
+    {"dang2", &gImage_dang2, raw_dang2, sizeof(raw_dang2)},
+    {"dang3", &gImage_dang3, raw_dang3, sizeof(raw_dang3)},
+    {"dang4", &gImage_dang4, raw_dang4, sizeof(raw_dang4)},
+    {"dang5", &gImage_dang5, raw_dang5, sizeof(raw_dang5)},
+};
+
+#define ASSET_COUNT     (sizeof(s_assets) / sizeof(s_assets[0]))
+#define MAX_RAW_BYTES   (LCD_WIDTH * LCD_HEIGHT / 2U)
+
+static uint8_t s_decoded[MAX_RAW_BYTES];
+static uint8_t s_pixels_a[LCD_WIDTH * LCD_HEIGHT * 2U];
+static uint8_t s_pixels_b[LCD_WIDTH * LCD_HEIGHT * 2U];
+static uint8_t *s_capture;
+static uint32_t s_capture_len;
+
+static uint8_t s_in_gram;
+
+/* 只记录写GRAM(0x2C)之后的像素数据 */
+static void capture_hook(uint8_t byte, uint8_t dc, uint8_t cs)
+{
+    if (dc == 0U)
+    {
+        s_in_gram = (byte == 0x2CU);
+    }
+    else if (s_in_gram && cs == 0U && s_capture_len < sizeof(s_pixels_a))
+    {
+        s_capture[s_capture_len++] = byte;
+    }
+}
+
+static uint8_t raw_pixel(const unsigned char *raw, uint32_t index)
+{
+    return (index & 1U) ? (raw[index >> 1] & 0x0FU) : (raw[index >> 1] >> 4);
+}
+
+/* 整幅解码，且恰好用完压缩数据 */
+static void test_round_trip(const gray_asset_t *asset)
+{
+    image_rle_reader_t reader;
+    uint32_t pixels = (uint32_t)asset->rle->width * asset->rle->height;
+    uint8_t gray;
+
+    HOST_CHECK_EQ(asset->raw_size, pixels / 2U);
+
+    image_rle_reader_init(&reader, asset->rle);
+    memset(s_decoded, 0xEE, sizeof(s_decoded));
+    image_rle_read_packed(&reader, s_decoded, pixels);
+    HOST_CHECK(memcmp(s_decoded, asset->raw, asset->raw_size) == 0);
+    HOST_CHECK(reader.run == 0U);
+    HOST_CHECK(reader.src == reader.end);
+    HOST_CHECK_EQ(image_rle_read_run(&reader, 1U, &gray), 0U);
+}
+
+/* 按行、按奇数长度分段读取和跳过，结果与原始像素一致 */
+static void test_chunked_reads(const gray_asset_t *asset)
+{
+    image_rle_reader_t reader;
+    uint32_t pixels = (uint32_t)asset->rle->width * asset->rle->height;
+    uint32_t index = 0U;
+    uint32_t chunk = 1U;
+    uint32_t mismatches = 0U;
+
+    image_rle_reader_init(&reader, asset->rle);
+    while (index < pixels)
+    {
+        uint32_t n = (chunk < pixels - index) ? chunk : (pixels - index);
+
+        if ((chunk % 3U) == 0U)
+        {
+            image_rle_skip(&reader, n);
+        }
+        else
+        {
+            uint32_t done = 0U;
+
+            while (done < n)
+            {
+                uint8_t gray;
+                uint32_t count = image_rle_read_run(&reader, n - done, &gray);
+
+                if (count == 0U)
+                {
+                    mismatches++;
+                    break;
+                }
+                for (uint32_t i = 0U; i < count; i++)
+                {
+                    if (raw_pixel(asset->raw, index + done + i) != gray)
+                    {
+                        mismatches++;
+                    }
+                }
+                done += count;
+            }
+        }
+        index += n;
+        chunk = (chunk * 7U + 5U) % 301U + 1U;
+    }
+    HOST_CHECK_EQ(mismatches, 0U);
+}
+
+/* RLE直接绘制与原始数据的未压缩绘制发送相同的像素字节；x偏移时右侧裁剪 */
+static void test_draw_matches_raw(const gray_asset_t *asset, uint16_t x, uint16_t y)
+{
+    static uint8_t clipped[MAX_RAW_BYTES];
+    uint16_t width = asset->rle->width;
+    uint16_t height = asset->rle->height;
+    uint16_t visible = (x + width > LCD_WIDTH) ? (uint16_t)(LCD_WIDTH - x) : width;
+    uint16_t rows = (y + height > LCD_HEIGHT) ? (uint16_t)(LCD_HEIGHT - y) : height;
+    uint32_t len_a;
+
+    for (uint32_t row = 0U; row < rows; row++)
+    {
+        memcpy(&clipped[row * (visible / 2U)], &asset->raw[row * (width / 2U)], visible / 2U);
+    }
+
+    s_capture = s_pixels_a;
+    s_capture_len = 0U;
+    host_set_spi_hook(capture_hook);
+    LCD_ShowImage16GrayRle(x, y, asset->rle);
+    LCD_WaitIdle();
+    len_a = s_capture_len;
+
+    s_capture = s_pixels_b;
+    s_capture_len = 0U;
+    LCD_ShowPartialImage16Gray(x, y, visible, rows, clipped);
+    LCD_WaitIdle();
+    host_set_spi_hook(0);
+
+    HOST_CHECK_EQ(len_a, (uint32_t)visible * rows * 2U);
+    HOST_CHECK_EQ(len_a, s_capture_len);
+    HOST_CHECK(memcmp(s_pixels_a, s_pixels_b, len_a) == 0);
+}
+
+static void test_asset_index(void)
+{
+    HOST_CHECK_EQ(asset_init(), 0U);
+    HOST_CHECK_EQ(asset_get_count(), ASSET_COUNT + 1U);
+    HOST_CHECK(memcmp(gImage_shalou_40x40, raw_shalou_40x40, sizeof(raw_shalou_40x40)) == 0);
+    HOST_CHECK(asset_get(0U)->data == gImage_shalou_40x40);
+    for (uint32_t i = 0U; i < ASSET_COUNT; i++)
+    {
+        const asset_entry_t *entry = asset_get(i + 1U);
+
+        HOST_CHECK(entry->data == s_assets[i].rle->data);
+        HOST_CHECK_EQ(entry->size, s_assets[i].rle->size);
+        HOST_CHECK_EQ(entry->format, ASSET_FORMAT_GRAY4_RLE);
+    }
+}
+
+int main(void)
+{
+    uint32_t raw_total = 0U;
+    uint32_t rle_total = 0U;
+
+    LCD_Init();
+
+    for (uint32_t i = 0U; i < ASSET_COUNT; i++)
+    {
+        test_round_trip(&s_assets[i]);
+        test_chunked_reads(&s_assets[i]);
+        test_draw_matches_raw(&s_assets[i], 0U, 0U);
+        test_draw_matches_raw(&s_assets[i], 40U, 200U);
+        raw_total += s_assets[i].raw_size;
+        rle_total += s_assets[i].rle->size;
+    }
+    test_asset_index();
+
+    printf("%u gray assets: %lu -> %lu bytes\n", (unsigned int)ASSET_COUNT,
+           (unsigned long)raw_total, (unsigned long)rle_total);
+    return host_report("test_image_rle");
+}
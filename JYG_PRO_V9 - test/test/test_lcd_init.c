@@ -0,0 +1,193 @@
+/* 表驱动JD9613初始化(user-006)发往屏幕的字节流与baseline逐字节发送一致：
+ * 相同的命令/参数字节、相同的DC电平、发送时片选有效，且命令间延时不少于原序列
+ */
+#include "host.h"
+#include "../User/bsp/lcd.c"
+
+#define TRACE_MAX       2048U
+#define GAP_SLACK_US    500U    /* 两字节之间除规定延时外允许的额外时间 */
+
+typedef struct
+{
+    uint8_t byte;
+    uint8_t dc;
+    uint8_t cs;
+    uint64_t t_us;
+} trace_byte_t;
+
+typedef struct
+{
+    uint8_t byte;
+    uint8_t dc;
+    uint32_t delay_ms;          /* 本字节之前的延时 */
+} ref_byte_t;
+
+static trace_byte_t s_trace[TRACE_MAX];
+static uint32_t s_trace_count;
+static ref_byte_t s_ref[TRACE_MAX];
+static uint32_t s_ref_count;
+static uint32_t s_ref_pending_ms;
+
+static void trace_hook(uint8_t byte, uint8_t dc, uint8_t cs)
+{
+    if (s_trace_count < TRACE_MAX)
+    {
+        s_trace[s_trace_count].byte = byte;
+        s_trace[s_trace_count].dc = dc;
+        s_trace[s_trace_count].cs = cs;
+        s_trace[s_trace_count].t_us = host_now_us();
+    }
+    s_trace_count++;
+}
+
+static void ref_byte(uint8_t dc, uint8_t byte)
+{
+    if (s_ref_count < TRACE_MAX)
+    {
+        s_ref[s_ref_count].byte = byte;
+        s_ref[s_ref_count].dc = dc;
+        s_ref[s_ref_count].delay_ms = s_ref_pending_ms;
+    }
+    s_ref_count++;
+    s_ref_pending_ms = 0U;
+}
+
+static void ref_delay(uint32_t ms)
+{
+    s_ref_pending_ms += ms;
+}
+
+static void trace_reset(void)
+{
+    s_trace_count = 0U;
+    s_ref_count = 0U;
+    s_ref_pending_ms = 0U;
+}
+
+#define LCD_WriteCommand(c)     ref_byte(0U, (uint8_t)(c))
+#define LCD_WriteData(d)        ref_byte(1U, (uint8_t)(d))
+#define HAL_Delay(ms)           ref_delay(ms)
+
+static void ref_init_sequence(void)
+{
+#include "ref/jd9613_init_baseline.inc"
+}
+
+/* baseline LCD_SetWindow */
+static void ref_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    LCD_WriteCommand(0x2A);
+    LCD_WriteData(x0 >> 8);
+    LCD_WriteData(x0 & 0xFF);
+    LCD_WriteData(x1 >> 8);
+    LCD_WriteData(x1 & 0xFF);
+    LCD_WriteCommand(0x2B);
+    LCD_WriteData(y0 >> 8);
+    LCD_WriteData(y0 & 0xFF);
+    LCD_WriteData(y1 >> 8);
+    LCD_WriteData(y1 & 0xFF);
+    LCD_WriteCommand(0x2C);
+}
+
+#undef LCD_WriteCommand
+#undef LCD_WriteData
+#undef HAL_Delay
+
+static void compare_streams(uint8_t check_timing)
+{
+    uint32_t mismatches = 0U;
+
+    HOST_CHECK_EQ(s_trace_count, s_ref_count);
+    for (uint32_t i = 0U; i < s_ref_count && i < s_trace_count && i < TRACE_MAX; i++)
+    {
+        if (s_trace[i].byte != s_ref[i].byte || s_trace[i].dc != s_ref[i].dc || s_trace[i].cs != 0U)
+        {
+            if (mismatches++ < 5U)
+            {
+                printf("byte %lu: got %02X dc=%u cs=%u, expected %02X dc=%u\n", (unsigned long)i,
+                       s_trace[i].byte, s_trace[i].dc, s_trace[i].cs, s_ref[i].byte, s_ref[i].dc);
+            }
+        }
+        if (check_timing && i > 0U)
+        {
+            uint64_t gap = s_trace[i].t_us - s_trace[i - 1U].t_us;
+            uint64_t want = (uint64_t)s_ref[i].delay_ms * 1000U;
+
+            HOST_CHECK(gap >= want);
+            HOST_CHECK(gap < want + GAP_SLACK_US);
+        }
+    }
+    HOST_CHECK_EQ(mismatches, 0U);
+}
+
+static void test_init_sequence(void)
+{
+    uint32_t trailing_ms;
+    uint64_t t_end;
+
+    trace_reset();
+    ref_init_sequence();
+    trailing_ms = s_ref_pending_ms;
+    s_trace_count = 0U;
+
+    host_set_spi_hook(trace_hook);
+    LCD_Init();
+    t_end = host_now_us();
+    host_set_spi_hook(0);
+
+    HOST_CHECK(s_ref_count > 100U);
+    compare_streams(1U);
+    if (s_trace_count > 0U && s_trace_count <= TRACE_MAX)
+    {
+        HOST_CHECK(t_end - s_trace[s_trace_count - 1U].t_us >= (uint64_t)trailing_ms * 1000U);
+    }
+    printf("init sequence: %lu bytes, trailing delay %lu ms\n", (unsigned long)s_ref_count,
+           (unsigned long)trailing_ms);
+}
+
+static void test_set_window(void)
+{
+    static const uint16_t windows[][4] =
+    {
+        {0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1},
+        {10, 20, 49, 59},
+        {0, 255, 125, 293},
+        {86, 250, 125, 289},
+    };
+
+    for (uint32_t i = 0U; i < sizeof(windows) / sizeof(windows[0]); i++)
+    {
+        trace_reset();
+        ref_set_window(windows[i][0], windows[i][1], windows[i][2], windows[i][3]);
+
+        host_set_spi_hook(trace_hook);
+        LCD_SetWindow(windows[i][0], windows[i][1], windows[i][2], windows[i][3]);
+        host_set_spi_hook(0);
+
+        compare_streams(0U);
+    }
+}
+
+/* 不完整的表项不发送，也不越界读取 */
+static void test_truncated_table(void)
+{
+    static const uint8_t table[] = {0x36, 1, 0x00, 0x11, LCD_CMD_DELAY | 0, 120, 0x3A, 2, 0x55};
+
+    trace_reset();
+    host_set_spi_hook(trace_hook);
+    LCD_WriteCommandTable(table, sizeof(table));
+    host_set_spi_hook(0);
+
+    HOST_CHECK_EQ(s_trace_count, 3U);
+    HOST_CHECK_EQ(s_trace[0].byte, 0x36U);
+    HOST_CHECK_EQ(s_trace[1].byte, 0x00U);
+    HOST_CHECK_EQ(s_trace[2].byte, 0x11U);
+}
+
+int main(void)
+{
+    test_init_sequence();
+    test_set_window();
+    test_truncated_table();
+    return host_report("test_lcd_init");
+}
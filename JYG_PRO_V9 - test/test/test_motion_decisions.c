@@ -0,0 +1,240 @@
+/* 运动判定整数化(user-013)与重构前sqrtf实现逐样本一致：
+ * 1) isqrt与(int32_t)sqrtf在2^24以内（覆盖有效模长与全部门限）的每个整数上结果相同；
+ * 2) 五个灵敏度等级下，确定性生成的合成样本流（静止噪声、晃动、门限附近的阶跃、读失败、超量程）
+ *    同时送入当前motion_sensor_process_sample()与ref/motion_sensor_float.inc，返回值和全部判定状态逐样本比较
+ */
+#include "host.h"
+#include <math.h>
+#include "../User/bsp/motion_sensor.c"
+#include "ref/motion_sensor_float.inc"
+
+#define STREAM_SAMPLES      200000U
+#define LSB_PER_MG(mg)      ((int32_t)(mg) * MOTION_SENSOR_ACCEL_SENSITIVITY_LSB_PER_G / 1000)
+
+static uint32_t s_seed;
+
+static uint32_t rand_next(void)
+{
+    s_seed = s_seed * 1103515245U + 12345U;
+    return s_seed >> 8;
+}
+
+static int32_t rand_range(int32_t lo, int32_t hi)
+{
+    return lo + (int32_t)(rand_next() % (uint32_t)(hi - lo + 1));
+}
+
+static int16_t clamp16(int32_t v)
+{
+    return (int16_t)((v > INT16_MAX) ? INT16_MAX : ((v < INT16_MIN) ? INT16_MIN : v));
+}
+
+/* 有效模长(<=4000mg)的平方和与变化量门限的平方都小于2^24，此范围内float可精确表示整数，逐一比较 */
+static void test_isqrt(void)
+{
+    uint32_t mismatches = 0U;
+
+    for (uint32_t v = 0U; v < (1UL << 24); v++)
+    {
+        uint32_t ref = (uint32_t)sqrtf((float)v);
+
+        if (motion_sensor_isqrt(v) != ref)
+        {
+            if (mismatches++ == 0U)
+            {
+                HOST_CHECK_EQ(motion_sensor_isqrt(v), ref);
+            }
+        }
+    }
+    HOST_CHECK_EQ(mismatches, 0U);
+
+    /* 门限附近：floor(sqrtf(s)) >= T 与 s >= T^2 等价 */
+    for (uint32_t t = 1U; t <= 400U; t++)
+    {
+        for (int32_t d = -2; d <= 2; d++)
+        {
+            uint32_t s = t * t + (uint32_t)d;
+
+            HOST_CHECK_EQ(((uint32_t)sqrtf((float)s) >= t), (s >= t * t));
+        }
+    }
+}
+
+static void reset_states(uint8_t level)
+{
+    s_sample_valid = 0U;
+    s_norm_baseline_mg = MOTION_SENSOR_GRAVITY_MG;
+    s_motion_state = 0U;
+    s_motion_confirm_count = 0U;
+    s_static_confirm_count = 0U;
+    memset(s_last_sample, 0, sizeof(s_last_sample));
+    s_last_sample_valid = 0U;
+    s_last_valid_norm_mg = MOTION_SENSOR_GRAVITY_MG;
+    memset(s_prev_sample, 0, sizeof(s_prev_sample));
+    s_prev_sample_valid = 0U;
+    s_last_motion_valid = 0U;
+    s_sensitivity_level = level;
+
+    ref_s_sample_valid = 0U;
+    ref_s_norm_baseline_mg = MOTION_SENSOR_GRAVITY_MG;
+    ref_s_motion_state = 0U;
+    ref_s_motion_confirm_count = 0U;
+    ref_s_static_confirm_count = 0U;
+    memset(ref_s_last_sample, 0, sizeof(ref_s_last_sample));
+    ref_s_last_sample_valid = 0U;
+    ref_s_last_valid_norm_mg = MOTION_SENSOR_GRAVITY_MG;
+    memset(ref_s_prev_sample, 0, sizeof(ref_s_prev_sample));
+    ref_s_prev_sample_valid = 0U;
+    ref_s_last_motion_valid = 0U;
+    ref_s_sensitivity_level = level;
+}
+
+typedef enum
+{
+    SEG_STATIC = 0,     /* 任意姿态静止，噪声0~60mg */
+    SEG_SHAKE,          /* 沿重力方向正弦晃动 */
+    SEG_STEP,           /* 模长偏离基线恰好落在各门限±2mg */
+    SEG_DROPOUT,        /* 读失败(NULL) */
+    SEG_RANGE,          /* 模长<200mg或>4000mg */
+    SEG_RANDOM,         /* 任意int16 */
+    SEG_RESET,          /* 重新初始化 */
+    SEG_COUNT
+} segment_t;
+
+typedef struct
+{
+    uint32_t samples;
+    uint32_t moving;
+    uint32_t transitions;
+} stream_stats_t;
+
+/* 返回0表示出现不一致 */
+static int compare_sample(const int16_t *sample, stream_stats_t *stats)
+{
+    uint8_t got = motion_sensor_process_sample(sample);
+    uint8_t ref = ref_motion_sensor_process_sample(sample);
+
+    stats->samples++;
+    stats->moving += ref;
+
+    if (got != ref ||
+        s_motion_state != ref_s_motion_state ||
+        s_motion_confirm_count != ref_s_motion_confirm_count ||
+        s_static_confirm_count != ref_s_static_confirm_count ||
+        s_norm_baseline_mg != ref_s_norm_baseline_mg ||
+        s_sample_valid != ref_s_sample_valid ||
+        s_last_valid_norm_mg != ref_s_last_valid_norm_mg)
+    {
+        printf("sample %u: %d %d %d\n", (unsigned int)stats->samples,
+               sample ? sample[0] : 0, sample ? sample[1] : 0, sample ? sample[2] : 0);
+        HOST_CHECK_EQ(got, ref);
+        HOST_CHECK_EQ(s_motion_state, ref_s_motion_state);
+        HOST_CHECK_EQ(s_motion_confirm_count, ref_s_motion_confirm_count);
+        HOST_CHECK_EQ(s_static_confirm_count, ref_s_static_confirm_count);
+        HOST_CHECK_EQ(s_norm_baseline_mg, ref_s_norm_baseline_mg);
+        HOST_CHECK_EQ(s_sample_valid, ref_s_sample_valid);
+        HOST_CHECK_EQ(s_last_valid_norm_mg, ref_s_last_valid_norm_mg);
+        return 0;
+    }
+    return 1;
+}
+
+static void run_stream(uint8_t level, uint32_t seed)
+{
+    static const int32_t axes[][3] =
+    {
+        {0, 0, 1000}, {0, 0, -1000}, {1000, 0, 0}, {0, -1000, 0}, {577, 577, 577}, {-707, 0, 707},
+    };
+    const motion_sensor_thresholds_t *th = &s_level_thresholds[level - 1U];
+    const int32_t step_targets[] =
+    {
+        (int32_t)th->static_mg, (int32_t)th->moving_mg, (int32_t)th->moving_2_3_mg,
+        (int32_t)th->moving_3_5_mg, MOTION_SENSOR_BASELINE_TRACK_THRESHOLD_MG,
+    };
+    stream_stats_t stats = {0};
+    uint8_t last_state = 0U;
+
+    s_seed = seed;
+    reset_states(level);
+
+    while (stats.samples < STREAM_SAMPLES)
+    {
+        segment_t seg = (segment_t)(rand_next() % SEG_COUNT);
+        const int32_t *g = axes[rand_next() % (sizeof(axes) / sizeof(axes[0]))];
+        uint32_t len = (uint32_t)rand_range(1, 300);
+        int32_t noise = rand_range(0, 60);
+        int32_t amp = rand_range(10, 600);
+        int32_t period = rand_range(4, 40);
+        int32_t target = step_targets[rand_next() % (sizeof(step_targets) / sizeof(step_targets[0]))] + rand_range(-2, 2);
+
+        if (seg == SEG_RESET)
+        {
+            reset_states(level);
+            continue;
+        }
+
+        for (uint32_t n = 0U; n < len; n++)
+        {
+            int16_t sample[3];
+            int32_t scale = 1000;
+            const int16_t *in = sample;
+
+            switch (seg)
+            {
+                case SEG_SHAKE:
+                    scale = 1000 + (int32_t)(amp * sinf(6.2831853f * (float)n / (float)period));
+                    break;
+                case SEG_STEP:
+                    scale = 1000 + (((n / 8U) & 1U) ? target : -target);
+                    break;
+                case SEG_RANGE:
+                    scale = (rand_next() & 1U) ? rand_range(0, 199) : rand_range(4001, 4100);
+                    break;
+                default:
+                    break;
+            }
+
+            for (uint8_t i = 0U; i < 3U; i++)
+            {
+                int32_t mg = g[i] * scale / 1000;
+
+                if (seg == SEG_STATIC || seg == SEG_STEP)
+                {
+                    mg += rand_range(-noise, noise) / 4;
+                }
+                sample[i] = (seg == SEG_RANDOM) ? (int16_t)rand_next() : clamp16(LSB_PER_MG(mg));
+            }
+            if (seg == SEG_DROPOUT)
+            {
+                in = NULL;
+            }
+
+            if (!compare_sample(in, &stats))
+            {
+                printf("level %u seed %u: diverged\n", level, (unsigned int)seed);
+                return;
+            }
+            if (ref_s_motion_state != last_state)
+            {
+                stats.transitions++;
+                last_state = ref_s_motion_state;
+            }
+        }
+    }
+
+    printf("level %u: %u samples, %u moving, %u state changes\n", level,
+           (unsigned int)stats.samples, (unsigned int)stats.moving, (unsigned int)stats.transitions);
+    /* 样本流必须真正覆盖两种状态，否则比较没有意义 */
+    HOST_CHECK(stats.transitions > 100U);
+    HOST_CHECK(stats.moving > 0U && stats.moving < stats.samples);
+}
+
+int main(void)
+{
+    test_isqrt();
+    for (uint8_t level = MOTION_SENSOR_SENSITIVITY_LEVEL_MIN; level <= MOTION_SENSOR_SENSITIVITY_LEVEL_MAX; level++)
+    {
+        run_stream(level, 0x13U * level + 1U);
+    }
+    return host_report("test_motion_decisions");
+}